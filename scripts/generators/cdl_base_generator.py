@@ -58,6 +58,16 @@ intercept_post_functions = [
     'vkDestroyShaderModule',
     'vkCreateGraphicsPipelines',
     'vkCreateComputePipelines',
+    # Destroy hooks so object names are dropped with their objects
+    'vkFreeMemory',
+    'vkDestroyFence',
+    'vkDestroyEvent',
+    'vkDestroyQueryPool',
+    'vkDestroyBuffer',
+    'vkDestroyBufferView',
+    'vkDestroyImage',
+    'vkDestroyImageView',
+    'vkDestroySampler',
 ]
 
 no_intercept_post_functions = [
@@ -115,6 +125,10 @@ intercept_functions = [
     'vkDestroyDebugUtilsMessengerEXT',
     'vkCreateDebugReportCallbackEXT',
     'vkDestroyDebugReportCallbackEXT',
+    # Track which device owns the objects named in address binding reports
+    'vkAllocateMemory',
+    'vkCreateBuffer',
+    'vkCreateImage',
 ]
 
 namespace = 'crash_diagnostic_layer'
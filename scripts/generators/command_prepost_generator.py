@@ -47,6 +47,13 @@ default_instrumented_functions = (
     'vkCmdInsertDebugUtilsLabelEXT',
 )
 
+# Commands that change CommandBufferInternalState, which is kept up to date
+# while recording.
+internal_state_functions = (
+    'vkCmdBindPipeline',
+    'vkCmdBindDescriptorSets',
+)
+
 #
 # InterceptCommandsOutputGenerator - Generate the dispatch tables
 class CommandPrePostGenerator(CdlBaseOutputGenerator):
@@ -101,6 +108,8 @@ class CommandPrePostGenerator(CdlBaseOutputGenerator):
 
             out.append(f'{pre_func_decl}\n')
             out.append(f'{func_call}\n')
+            if vkcommand.name in internal_state_functions:
+                out.append('  RecordInternalState(tracker_.GetCommands().back());\n')
             if vkcommand.name not in default_instrumented_functions:
                 out.append('  if (instrument_all_commands_)\n')
                 out.append('  ')
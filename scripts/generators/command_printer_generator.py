@@ -46,10 +46,10 @@ class CommandPrinterOutputGenerator(CdlBaseOutputGenerator):
 
         out = []
         out.append('''
-#include <yaml-cpp/emitter.h>
 #include <vulkan/vulkan.h>
 
 #include "command_common.h"
+#include "dump_emitter.h"
 #include "object_name_db.h"
 
 struct VkStruct {
@@ -58,10 +58,10 @@ struct VkStruct {
 };
 
 // Declare generic struct printer.
-YAML::Emitter &PrintVkStruct(YAML::Emitter &os, const VkStruct *pStruct);
+crash_diagnostic_layer::DumpEmitter &PrintVkStruct(crash_diagnostic_layer::DumpEmitter &os, const VkStruct *pStruct);
 
 // Declare pNext chain printer.
-YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext);
+crash_diagnostic_layer::DumpEmitter &PrintNextPtr(crash_diagnostic_layer::DumpEmitter &os, const void *pNext);
 ''')
         self.write("".join(out))
 
@@ -71,7 +71,7 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext);
             out.extend([f'#ifdef {vkhandle.protect}\n'] if vkhandle.protect else [])
             if not vkhandle.dispatchable:
                 out.append('#if VK_USE_64_BIT_PTR_DEFINES\n')
-            out.append(f'YAML::Emitter &operator<<(YAML::Emitter& os, const {vkhandle.name} &a);')
+            out.append(f'crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const {vkhandle.name} &a);')
             if not vkhandle.dispatchable:
                 out.append('#endif //VK_USE_64_BIT_PTR_DEFINES\n')
             out.extend([f'#endif //{vkhandle.protect}\n'] if vkhandle.protect else [])
@@ -81,7 +81,7 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext);
         out = []
         for vkenum in [x for x in self.vk.enums.values() if len(x.fields) > 0]:
             out.extend([f'#ifdef {vkenum.protect}\n'] if vkenum.protect else [])
-            out.append(f'YAML::Emitter &operator<<(YAML::Emitter &os, const {vkenum.name} &t);\n')
+            out.append(f'crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const {vkenum.name} &t);\n')
             out.extend([f'#endif //{vkenum.protect}\n'] if vkenum.protect else [])
         self.write("".join(out))
 
@@ -89,22 +89,22 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext);
         out = []
         for vkstruct in self.vk.structs.values():
             out.extend([f'#ifdef {vkstruct.protect}\n'] if vkstruct.protect else [])
-            out.append(f'YAML::Emitter &operator<<(YAML::Emitter &os, const {vkstruct.name} &t);\n')
+            out.append(f'crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const {vkstruct.name} &t);\n')
             out.extend([f'#endif //{vkstruct.protect}\n'] if vkstruct.protect else [])
         self.write("".join(out))
 
         out = []
         out.append('''
 // Declare print functions.
-class ObjectInfoDB;
+class ObjectInfoSnapshot;
 class CommandPrinter {
  public:
-  void SetNameResolver(const ObjectInfoDB *name_resolver);
-  void PrintCommandParameters(YAML::Emitter &os, const Command &cmd);
+  void SetNameResolver(const ObjectInfoSnapshot *name_resolver);
+  void PrintCommandParameters(crash_diagnostic_layer::DumpEmitter &os, const Command &cmd);
 ''')
         for vkcommand in filter(lambda x: self.CommandBufferCall(x), self.vk.commands.values()):
             out.extend([f'#ifdef {vkcommand.protect}\n'] if vkcommand.protect else [])
-            out.append(f'  void Print{vkcommand.name[2:]}Args(YAML::Emitter &os, const {vkcommand.name[2:]}Args &args);\n')
+            out.append(f'  void Print{vkcommand.name[2:]}Args(crash_diagnostic_layer::DumpEmitter &os, const {vkcommand.name[2:]}Args &args);\n')
             out.extend([f'#endif //{vkcommand.protect}\n'] if vkcommand.protect else [])
         out.append('};\n');
         self.write("".join(out))
@@ -273,8 +273,9 @@ class CommandPrinter {
 #include "command_printer.h"
 #include "util.h"
 
-const ObjectInfoDB *global_name_resolver = nullptr;
-void CommandPrinter::SetNameResolver(const ObjectInfoDB *name_resolver) {
+// Per thread, so dumps written concurrently can resolve against different snapshots.
+thread_local const ObjectInfoSnapshot *global_name_resolver = nullptr;
+void CommandPrinter::SetNameResolver(const ObjectInfoSnapshot *name_resolver) {
   global_name_resolver = name_resolver;
 }
 ''')
@@ -287,8 +288,8 @@ void CommandPrinter::SetNameResolver(const ObjectInfoDB *name_resolver) {
             if not vkhandle.dispatchable:
                 out.append('#if VK_USE_64_BIT_PTR_DEFINES\n')
             out.append(f'''
-YAML::Emitter &operator<<(YAML::Emitter& os, const {vkhandle.name} &a) {{
-    os << global_name_resolver->GetObjectInfo(reinterpret_cast<uint64_t>(a));
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const {vkhandle.name} &a) {{
+    global_name_resolver->PrintObjectInfo(os, reinterpret_cast<uint64_t>(a));
     return os;
 }}
 ''')
@@ -302,7 +303,7 @@ YAML::Emitter &operator<<(YAML::Emitter& os, const {vkhandle.name} &a) {{
         out = []
         for vkenum in [x for x in self.vk.enums.values() if len(x.fields) > 0]:
             out.extend([f'#ifdef {vkenum.protect}\n'] if vkenum.protect else [])
-            out.append(f'YAML::Emitter &operator<<(YAML::Emitter & os, const {vkenum.name} &t) {{\n')
+            out.append(f'crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter & os, const {vkenum.name} &t) {{\n')
             out.append(f'  os << string_{vkenum.name}(t);\n')
             out.append('  return os;\n')
             out.append('}\n')
@@ -322,7 +323,7 @@ YAML::Emitter &operator<<(YAML::Emitter& os, const {vkhandle.name} &a) {{
 #include "command_printer.h"
 #include "util.h"
 
-YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext) {
+crash_diagnostic_layer::DumpEmitter &PrintNextPtr(crash_diagnostic_layer::DumpEmitter &os, const void *pNext) {
   if (pNext == nullptr) {
     os << "nullptr";
     return os;
@@ -340,7 +341,7 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext) {
             if vkstruct.name in manual_structs:
                 continue
             out.extend([f'#ifdef {vkstruct.protect}\n'] if vkstruct.protect else [])
-            out.append(f'YAML::Emitter &operator<<(YAML::Emitter & os, const {vkstruct.name} &t) {{\n')
+            out.append(f'crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter & os, const {vkstruct.name} &t) {{\n')
             out.append('  os << YAML::BeginMap;\n')
             for member in vkstruct.members:
                 self.printMember(out, member, 't', False)
@@ -353,7 +354,7 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext) {
 
         out = []
         out.append('''
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSet &t) {
   os << YAML::BeginMap;
   os << YAML::Key << "sType" << YAML::Value << t.sType;
 
@@ -413,7 +414,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
 
         out = []
         out.append('//  Print out a VkStruct\n')
-        out.append('YAML::Emitter & PrintVkStruct(YAML::Emitter & os, const VkStruct *pStruct) {\n')
+        out.append('crash_diagnostic_layer::DumpEmitter & PrintVkStruct(crash_diagnostic_layer::DumpEmitter & os, const VkStruct *pStruct) {\n')
         out.append('  switch (pStruct->sType) {\n')
         for vkstruct in self.vk.structs.values():
             if vkstruct.sType is None:
@@ -447,7 +448,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
         for vkcommand in filter(lambda x: self.CommandBufferCall(x), self.vk.commands.values()):
             out.extend([f'#ifdef {vkcommand.protect}\n'] if vkcommand.protect else [])
             out.append(f'void CommandPrinter::Print{vkcommand.name[2:]}Args(\n')
-            out.append(f'  YAML::Emitter & os, const {vkcommand.name[2:]}Args &args) {{\n')
+            out.append(f'  crash_diagnostic_layer::DumpEmitter & os, const {vkcommand.name[2:]}Args &args) {{\n')
             for member in vkcommand.params:
                 if member.name != 'commandBuffer':
                     self.printMember(out, member, 'args', False)
@@ -455,7 +456,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
             out.extend([f'#endif //{vkcommand.protect}\n'] if vkcommand.protect else [])
             out.append('\n')
         out.append('''
-void CommandPrinter::PrintCommandParameters(YAML::Emitter &os, const Command &cmd)
+void CommandPrinter::PrintCommandParameters(crash_diagnostic_layer::DumpEmitter &os, const Command &cmd)
 {
   switch (cmd.type)
   {
@@ -38,11 +38,25 @@ class CommandRecorderOutputGenerator(CdlBaseOutputGenerator):
 
         self.write(self.GenerateFileEnd())
 
+    # Commands whose parameters are all scalars or handles need no deep copies,
+    # they are recorded inline in the header with a single POD copy.
+    def isTrivialCommand(self, vkcommand):
+        for vkparam in vkcommand.params:
+            if vkparam.pointer:
+                return False
+            if vkparam.fixedSizeArray is not None and len(vkparam.fixedSizeArray) > 0:
+                return False
+            if vkparam.length is not None and len(vkparam.length) > 0:
+                return False
+        return True
+
     def generateHeader(self):
         out = []
         out.append('''
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include <vulkan/vulkan.h>
 
@@ -52,12 +66,27 @@ class CommandRecorderOutputGenerator(CdlBaseOutputGenerator):
 class CommandRecorder
 {
   public:
+  explicit CommandRecorder(std::shared_ptr<LinearAllocatorBlockCache> block_cache = nullptr)
+    : m_allocator(std::move(block_cache)) {}
   void Reset() { m_allocator.Reset(); }
+  const CommandLabel *PushLabel(const CommandLabel *parent, const char *name) {
+    auto *label = Alloc<CommandLabel>();
+    label->name = name ? CopyArray<>(name, 0, strlen(name) + 1) : nullptr;
+    label->parent = parent;
+    return label;
+  }
 ''')
         for vkcommand in filter(lambda x: self.CommandBufferCall(x), self.vk.commands.values()):
             out.extend([f'#ifdef {vkcommand.protect}\n'] if vkcommand.protect else [])
             func_decl = vkcommand.cPrototype.replace('VKAPI_ATTR ', '').replace('VKAPI_CALL ', '').replace('vk', 'Record', 1).replace(f'{vkcommand.returnType} ', f'{vkcommand.name[2:]}Args*', 1)
-            out.append(f'  {func_decl}\n')
+            if self.isTrivialCommand(vkcommand):
+                func_decl = func_decl.replace(';', ' {', 1)
+                params = ', '.join([vkparam.name for vkparam in vkcommand.params])
+                out.append(f'  {func_decl}\n')
+                out.append(f'    return AllocTrivial<{vkcommand.name[2:]}Args>({{{params}}});\n')
+                out.append('  }\n')
+            else:
+                out.append(f'  {func_decl}\n')
             out.extend([f'#endif //{vkcommand.protect}\n'] if vkcommand.protect else [])
             out.append('\n')
         out.append('''
@@ -65,6 +94,12 @@ class CommandRecorder
   private:
 
     template <typename T> T *Alloc() { return new(m_allocator.Alloc(sizeof(T))) T; }
+    // Commands whose arguments are all scalars or handles are recorded inline
+    // with a single copy of the aggregate argument pack.
+    template <typename T> T *AllocTrivial(const T &src) {
+      static_assert(std::is_trivially_copyable<T>::value, "Trivial commands must have POD argument packs");
+      return new(m_allocator.Alloc(sizeof(T))) T(src);
+    }
     template <typename T> T *CopyArray(const T *src, size_t start_index, size_t count) {
       auto ptr = reinterpret_cast<T *>(m_allocator.Alloc(sizeof(T) * count));
       std::memcpy(ptr, src, sizeof(T) * count);
@@ -166,7 +201,7 @@ class CommandRecorder
             out.extend([f'#endif //{vkstruct.protect}\n'] if vkstruct.protect else [])
             out.append('\n')
 
-        for vkcommand in filter(lambda x: self.CommandBufferCall(x), self.vk.commands.values()):
+        for vkcommand in filter(lambda x: self.CommandBufferCall(x) and not self.isTrivialCommand(x), self.vk.commands.values()):
             out.extend([f'#ifdef {vkcommand.protect}\n'] if vkcommand.protect else [])
             func_decl = vkcommand.cPrototype.replace('VKAPI_ATTR ', '').replace('VKAPI_CALL ', '').replace('vk', 'CommandRecorder::Record').replace(f'{vkcommand.returnType} ', f'{vkcommand.name[2:]}Args*', 1).replace(';', ' {', 1)
             out.append(f'{func_decl}\n')
@@ -40,6 +40,7 @@ class CommandTrackerGenerator(CdlBaseOutputGenerator):
         out = []
         out.append('''
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -47,14 +48,17 @@ class CommandTrackerGenerator(CdlBaseOutputGenerator):
 
 #include "command_common.h"
 #include "command_recorder.h"
+#include "command_store.h"
 
 class CommandTracker
 {
  public:
+  explicit CommandTracker(std::shared_ptr<LinearAllocatorBlockCache> block_cache = nullptr)
+    : recorder_(std::move(block_cache)) {}
   void Reset();
 
-  const std::vector<Command> &GetCommands() const { return commands_; }
-  std::vector<Command> &GetCommands() { return commands_; }
+  const CommandStore &GetCommands() const { return commands_; }
+  void SetInstrumented(uint32_t command_id) { commands_.SetInstrumented(command_id - 1); }
 
 ''')
         for vkcommand in filter(lambda x: self.CommandBufferCall(x), self.vk.commands.values()):
@@ -64,9 +68,9 @@ class CommandTracker
             out.extend([f'#endif //{vkcommand.protect}\n'] if vkcommand.protect else [])
             out.append('\n')
         out.append(''' private:
-  std::vector<Command> commands_;
+  CommandStore commands_;
   CommandRecorder recorder_;
-  std::vector<std::string> labels_;
+  const CommandLabel *labels_{nullptr};
 };
 ''')
         self.write("".join(out))
@@ -82,7 +86,8 @@ class CommandTracker
 
 void CommandTracker::Reset()
 {
-  commands_.clear();
+  commands_.Clear();
+  labels_ = nullptr;
   recorder_.Reset();
 }
 ''')
@@ -92,30 +97,25 @@ void CommandTracker::Reset()
             out.extend([f'#ifdef {vkcommand.protect}\n'] if vkcommand.protect else [])
             func_decl = vkcommand.cPrototype.replace('VKAPI_ATTR ', '').replace('VKAPI_CALL ', '').replace(';', ' {').replace(f'{vkcommand.returnType} ', 'void ', 1).replace('vk', 'CommandTracker::', 1)
             out.append(f'{func_decl}\n')
-            out.append('  Command cmd {};\n')
-            out.append(f'  cmd.type = Command::Type::k{vkcommand.name[2:]};\n')
-            out.append('  cmd.id = static_cast<uint32_t>(commands_.size()) + 1;\n')
-            func_call = f'cmd.parameters = recorder_.Record{vkcommand.name[2:]}('
-
-            if vkcommand.name == 'vkCmdDebugMarkerBeginEXT':
-                out.append('  labels_.push_back(pMarkerInfo->pMarkerName);\n')
-            elif vkcommand.name == 'vkCmdBeginDebugUtilsLabelEXT':
-                out.append('  labels_.push_back(pLabelInfo->pLabelName);\n')
-            out.append('  cmd.labels = labels_;\n')
-            if vkcommand.name in ('vkCmdEndDebugUtilsLabelEXT', 'vkCmdDebugMarkerEndEXT'):
-                out.append('  // do not crash even if the application ends without a marker present\n')
-                out.append('  if (!labels_.empty()) {\n')
-                out.append('      labels_.pop_back();\n')
-                out.append('  }\n')
-
+            func_call = f'auto* args = recorder_.Record{vkcommand.name[2:]}('
             count = 0
             for vkparam in vkcommand.params:
                 if count != 0:
                     func_call += ', '
                 func_call += vkparam.name
                 count += 1
+
+            if vkcommand.name == 'vkCmdDebugMarkerBeginEXT':
+                out.append('  labels_ = recorder_.PushLabel(labels_, pMarkerInfo->pMarkerName);\n')
+            elif vkcommand.name == 'vkCmdBeginDebugUtilsLabelEXT':
+                out.append('  labels_ = recorder_.PushLabel(labels_, pLabelInfo->pLabelName);\n')
             out.append(f'  {func_call});\n')
-            out.append('  commands_.push_back(cmd);\n')
+            out.append(f'  commands_.Append(Command::Type::k{vkcommand.name[2:]}, args, labels_);\n')
+            if vkcommand.name in ('vkCmdEndDebugUtilsLabelEXT', 'vkCmdDebugMarkerEndEXT'):
+                out.append('  // do not crash even if the application ends without a marker present\n')
+                out.append('  if (labels_) {\n')
+                out.append('      labels_ = labels_->parent;\n')
+                out.append('  }\n')
             out.append('}\n')
             out.extend([f'#endif //{vkcommand.protect}\n'] if vkcommand.protect else [])
             out.append('\n')
@@ -141,6 +141,8 @@ class TestIcdGenerator(BaseGenerator):
             'vkGetQueueCheckpointDataNV',
             'vkGetQueueCheckpointData2NV',
             'vkCmdBeginDebugUtilsLabelEXT',
+            'vkCreateDebugUtilsMessengerEXT',
+            'vkDestroyDebugUtilsMessengerEXT',
         )
 
     def generate(self):
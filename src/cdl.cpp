@@ -33,17 +33,15 @@
 
 #include <algorithm>
 #include <chrono>
-#include <fstream>
 #include <inttypes.h>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include <vulkan/vk_enum_string_helper.h>
 
-#include <yaml-cpp/emitter.h>
-
 #if defined(WIN32)
 #include <direct.h>
 #endif
@@ -91,12 +89,33 @@ static const std::unordered_map<std::string, DumpShaders> kDumpShadersValues{
     {"all", DumpShaders::kAll},
 };
 
+const char* kDumpFormat = "dump_format";
+static const std::unordered_map<std::string, DumpFormat> kDumpFormatValues{
+    {"yaml", DumpFormat::kYaml},
+    {"binary", DumpFormat::kBinary},
+};
+
 const char* kWatchdogTimeout = "watchdog_timeout_ms";
+const char* kProgressSample = "progress_sample_ms";
 const char* kDumpAllCommandBuffers = "dump_all_command_buffers";
 const char* kTrackSemaphores = "track_semaphores";
 const char* kTraceAllSemaphores = "trace_all_semaphores";
 const char* kInstrumentAllCommands = "instrument_all_commands";
 const char* kSyncAfterCommands = "sync_after_commands";
+const char* kMarkerBufferReserve = "marker_buffer_reserve";
+const char* kPackedCheckpoints = "packed_checkpoints";
+const char* kBatchQueueSubmits = "batch_queue_submits";
+const char* kMaxTrackedSubmits = "max_tracked_submits";
+const char* kInstrumentationMode = "instrumentation_mode";
+static const std::unordered_map<std::string, InstrumentationMode> kInstrumentationModeValues{
+    {"default", InstrumentationMode::kDefault},
+    {"all", InstrumentationMode::kAll},
+    {"every_nth", InstrumentationMode::kEveryNth},
+    {"label_regions", InstrumentationMode::kLabelRegions},
+};
+const char* kInstrumentEveryNth = "instrument_every_nth";
+const char* kInstrumentLabelRegions = "instrument_label_regions";
+const char* kWidenAfterCrash = "widen_after_crash";
 }  // namespace settings
 
 const char* kLogTimeTag = "%Y-%m-%d-%H%M%S";
@@ -133,14 +152,49 @@ Settings::Settings(VkuLayerSettingSet layer_settings, Logger& log) {
     GetEnumVal<DumpCommands>(log, layer_settings, settings::kDumpCommands, dump_commands,
                              settings::kDumpCommandsValues);
     GetEnumVal<DumpShaders>(log, layer_settings, settings::kDumpShaders, dump_shaders, settings::kDumpShadersValues);
+    GetEnumVal<DumpFormat>(log, layer_settings, settings::kDumpFormat, dump_format, settings::kDumpFormatValues);
     GetEnvVal<uint64_t>(layer_settings, settings::kWatchdogTimeout, watchdog_timer_ms);
+    GetEnvVal<uint64_t>(layer_settings, settings::kProgressSample, progress_sample_ms);
     GetEnvVal<bool>(layer_settings, settings::kTrackSemaphores, track_semaphores);
     GetEnvVal<bool>(layer_settings, settings::kTraceAllSemaphores, trace_all_semaphores);
     GetEnvVal<bool>(layer_settings, settings::kInstrumentAllCommands, instrument_all_commands);
     GetEnvVal<bool>(layer_settings, settings::kSyncAfterCommands, sync_after_commands);
+    GetEnvVal<uint32_t>(layer_settings, settings::kMarkerBufferReserve, marker_buffer_reserve);
+    GetEnvVal<bool>(layer_settings, settings::kPackedCheckpoints, packed_checkpoints);
+    GetEnvVal<bool>(layer_settings, settings::kBatchQueueSubmits, batch_queue_submits);
+    GetEnvVal<uint32_t>(layer_settings, settings::kMaxTrackedSubmits, max_tracked_submits);
+    GetEnumVal<InstrumentationMode>(log, layer_settings, settings::kInstrumentationMode, instrumentation_mode,
+                                    settings::kInstrumentationModeValues);
+    GetEnvVal<uint32_t>(layer_settings, settings::kInstrumentEveryNth, instrument_every_nth);
+    GetEnvVal<std::string>(layer_settings, settings::kInstrumentLabelRegions, instrument_label_regions);
+    GetEnvVal<bool>(layer_settings, settings::kWidenAfterCrash, widen_after_crash);
+
+    // instrument_all_commands predates instrumentation_mode and still wins.
+    if (instrument_all_commands) {
+        instrumentation_mode = InstrumentationMode::kAll;
+    }
+    if (instrument_every_nth == 0) {
+        log.Error("Bad value for %s setting: 0", settings::kInstrumentEveryNth);
+        instrument_every_nth = 1;
+    }
+    if (!instrument_label_regions.empty()) {
+        // Label names may contain spaces, only split on commas.
+        std::regex re("\\s*,\\s*");
+        std::sregex_token_iterator re_iter(instrument_label_regions.begin(), instrument_label_regions.end(), re, -1);
+        std::sregex_token_iterator re_end;
+        for (; re_iter != re_end; ++re_iter) {
+            if (re_iter->length() > 0) {
+                instrument_label_region_names.emplace_back(*re_iter);
+            }
+        }
+    }
+    if (instrumentation_mode == InstrumentationMode::kLabelRegions && instrument_label_region_names.empty()) {
+        log.Warning("%s is label_regions but %s is empty, no commands will be instrumented.",
+                    settings::kInstrumentationMode, settings::kInstrumentLabelRegions);
+    }
 }
 
-YAML::Emitter& operator<<(YAML::Emitter& os, DumpCommands value) {
+DumpEmitter& operator<<(DumpEmitter& os, DumpCommands value) {
     for (auto& entry : settings::kDumpCommandsValues) {
         if (value == entry.second) {
             os << entry.first;
@@ -151,7 +205,7 @@ YAML::Emitter& operator<<(YAML::Emitter& os, DumpCommands value) {
     return os;
 }
 
-YAML::Emitter& operator<<(YAML::Emitter& os, DumpShaders value) {
+DumpEmitter& operator<<(DumpEmitter& os, DumpShaders value) {
     for (auto& entry : settings::kDumpShadersValues) {
         if (value == entry.second) {
             os << entry.first;
@@ -162,7 +216,29 @@ YAML::Emitter& operator<<(YAML::Emitter& os, DumpShaders value) {
     return os;
 }
 
-void Settings::Print(YAML::Emitter& os) const {
+DumpEmitter& operator<<(DumpEmitter& os, DumpFormat value) {
+    for (auto& entry : settings::kDumpFormatValues) {
+        if (value == entry.second) {
+            os << entry.first;
+            return os;
+        }
+    }
+    os << "unknown";
+    return os;
+}
+
+DumpEmitter& operator<<(DumpEmitter& os, InstrumentationMode value) {
+    for (auto& entry : settings::kInstrumentationModeValues) {
+        if (value == entry.second) {
+            os << entry.first;
+            return os;
+        }
+    }
+    os << "unknown";
+    return os;
+}
+
+void Settings::Print(DumpEmitter& os) const {
     os << YAML::BeginMap;
     os << YAML::Key << settings::kOutputPath << YAML::Value << output_path;
     os << YAML::Key << settings::kTraceOn << YAML::Value << trace_all;
@@ -170,11 +246,21 @@ void Settings::Print(YAML::Emitter& os) const {
     os << YAML::Key << settings::kDumpCommandBuffers << YAML::Value << dump_command_buffers;
     os << YAML::Key << settings::kDumpCommands << YAML::Value << dump_commands;
     os << YAML::Key << settings::kDumpShaders << YAML::Value << dump_shaders;
+    os << YAML::Key << settings::kDumpFormat << YAML::Value << dump_format;
     os << YAML::Key << settings::kWatchdogTimeout << YAML::Value << watchdog_timer_ms;
+    os << YAML::Key << settings::kProgressSample << YAML::Value << progress_sample_ms;
     os << YAML::Key << settings::kTrackSemaphores << YAML::Value << track_semaphores;
     os << YAML::Key << settings::kTraceAllSemaphores << YAML::Value << trace_all_semaphores;
     os << YAML::Key << settings::kInstrumentAllCommands << YAML::Value << instrument_all_commands;
     os << YAML::Key << settings::kSyncAfterCommands << YAML::Value << sync_after_commands;
+    os << YAML::Key << settings::kMarkerBufferReserve << YAML::Value << marker_buffer_reserve;
+    os << YAML::Key << settings::kPackedCheckpoints << YAML::Value << packed_checkpoints;
+    os << YAML::Key << settings::kBatchQueueSubmits << YAML::Value << batch_queue_submits;
+    os << YAML::Key << settings::kMaxTrackedSubmits << YAML::Value << max_tracked_submits;
+    os << YAML::Key << settings::kInstrumentationMode << YAML::Value << instrumentation_mode;
+    os << YAML::Key << settings::kInstrumentEveryNth << YAML::Value << instrument_every_nth;
+    os << YAML::Key << settings::kInstrumentLabelRegions << YAML::Value << instrument_label_regions;
+    os << YAML::Key << settings::kWidenAfterCrash << YAML::Value << widen_after_crash;
     os << YAML::EndMap;
 }
 
@@ -309,12 +395,17 @@ Context::Context(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCall
             StartWatchdogTimer();
             Log().Info("Begin Watchdog: %" PRId64 "ms", settings_->watchdog_timer_ms);
         }
+        if (settings_->progress_sample_ms > 0) {
+            StartProgressSampler();
+            Log().Info("Begin Progress Sampler: %" PRId64 "ms", settings_->progress_sample_ms);
+        }
     }
 
     vkuDestroyLayerSettingSet(layer_setting_set, nullptr);
 }
 
 Context::~Context() {
+    StopProgressSampler();
     StopWatchdogTimer();
     logger_.CloseLogFile();
 }
@@ -383,19 +474,38 @@ Context::ConstDevicePtr Context::GetQueueDevice(VkQueue queue) const {
 
 void Context::StartWatchdogTimer() {
     // Start up the watchdog timer thread.
+    std::lock_guard<std::mutex> lock(watchdog_mutex_);
     watchdog_running_ = true;
+    auto last_submit = std::chrono::steady_clock::time_point(std::chrono::milliseconds(last_submit_time_.load()));
+    watchdog_deadlines_.push({last_submit + std::chrono::milliseconds(settings_->watchdog_timer_ms), VK_NULL_HANDLE});
     watchdog_thread_ = std::thread([&]() { this->WatchdogTimer(); });
 }
 void Context::UpdateWatchdog() {
     using namespace std::chrono;
-    last_submit_time_ = duration_cast<milliseconds>(high_resolution_clock::now().time_since_epoch()).count();
+    last_submit_time_ = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
 }
 
-void Context::StopWatchdogTimer() {
+void Context::ArmQueueWatchdog(Queue& queue) {
+    if (settings_->watchdog_timer_ms == 0 || !queue.ArmWatchdog()) {
+        return;
+    }
+    auto time = std::chrono::steady_clock::now() + std::chrono::milliseconds(settings_->watchdog_timer_ms);
+    std::lock_guard<std::mutex> lock(watchdog_mutex_);
     if (watchdog_running_) {
-        Log().Info("Stopping Watchdog");
-        watchdog_running_ = false;  // TODO: condition variable that waits
+        // No need to wake the watchdog thread, the submit deadline can't be later than this one.
+        watchdog_deadlines_.push({time, queue.GetVkQueue()});
     }
+}
+
+void Context::StopWatchdogTimer() {
+    {
+        std::lock_guard<std::mutex> lock(watchdog_mutex_);
+        if (watchdog_running_) {
+            Log().Info("Stopping Watchdog");
+            watchdog_running_ = false;
+        }
+    }
+    watchdog_cv_.notify_all();
     // make sure the watchdog thread is joined even if it quit on its own.
     if (watchdog_thread_.joinable()) {
         watchdog_thread_.join();
@@ -404,39 +514,109 @@ void Context::StopWatchdogTimer() {
 }
 
 void Context::WatchdogTimer() {
-    uint64_t test_interval_us = std::min((uint64_t)(1000 * 1000), settings_->watchdog_timer_ms * 500);
+    using namespace std::chrono;
+    const milliseconds timeout(settings_->watchdog_timer_ms);
+    std::unique_lock<std::mutex> lock(watchdog_mutex_);
     while (watchdog_running_) {
-        // TODO: condition variable that waits
-        std::this_thread::sleep_for(std::chrono::microseconds(test_interval_us));
-        if (!watchdog_running_) {
-            break;
+        if (watchdog_deadlines_.empty()) {
+            watchdog_cv_.wait(lock);
+            continue;
         }
-
-        auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-                       std::chrono::high_resolution_clock::now().time_since_epoch())
-                       .count();
-        auto ms = (int64_t)(now - last_submit_time_);
-
-        if (ms > (int64_t)settings_->watchdog_timer_ms) {
-            Log().Info("CDL: Watchdog check failed, no submit in %" PRId64 "ms", ms);
-
-            auto devs = GetAllDevices();
-            bool dump_prologue = true;
-            auto file = OpenDumpFile();
-            YAML::Emitter os(file.is_open() ? file : std::cerr);
-
-            for (auto& device : devs) {
-                device->WatchdogTimeout(dump_prologue, os);
-                dump_prologue = false;
+        const auto deadline = watchdog_deadlines_.top();
+        if (steady_clock::now() < deadline.time) {
+            watchdog_cv_.wait_until(lock, deadline.time);
+            continue;
+        }
+        watchdog_deadlines_.pop();
+        lock.unlock();
+
+        const auto now = steady_clock::now();
+        bool hang = false;
+        std::optional<steady_clock::time_point> next_time;
+        if (deadline.queue == VK_NULL_HANDLE) {
+            auto last_submit = steady_clock::time_point(milliseconds(last_submit_time_.load()));
+            auto ms = duration_cast<milliseconds>(now - last_submit).count();
+            if (ms >= (int64_t)settings_->watchdog_timer_ms) {
+                Log().Info("CDL: Watchdog check failed, no submit in %" PRId64 "ms", ms);
+                hang = true;
+            } else {
+                next_time = last_submit + timeout;
             }
+        } else {
+            auto device = GetQueueDevice(deadline.queue);
+            auto queue = device ? device->GetQueue(deadline.queue) : nullptr;
+            switch (queue ? queue->CheckWatchdog() : Queue::WatchdogState::kIdle) {
+                case Queue::WatchdogState::kIdle:
+                    break;
+                case Queue::WatchdogState::kProgressed:
+                    next_time = now + timeout;
+                    break;
+                case Queue::WatchdogState::kStalled:
+                    Log().Info("CDL: Watchdog check failed, no progress on VkQueue %s in %" PRId64 "ms",
+                               device->GetObjectName((uint64_t)deadline.queue).c_str(),
+                               (int64_t)settings_->watchdog_timer_ms);
+                    hang = true;
+                    break;
+            }
+        }
 
+        if (hang) {
+            WatchdogTimeout();
             // Quit the thread after a hang is detected, it is unlikely that further dumps will
             // show anything more useful than the first one.
+            lock.lock();
             watchdog_running_ = false;
+            break;
+        }
+        lock.lock();
+        if (next_time) {
+            watchdog_deadlines_.push({*next_time, deadline.queue});
         }
     }
 }
 
+void Context::StartProgressSampler() {
+    std::lock_guard<std::mutex> lock(sampler_mutex_);
+    sampler_running_ = true;
+    sampler_thread_ = std::thread([&]() { this->ProgressSampler(); });
+}
+
+void Context::StopProgressSampler() {
+    {
+        std::lock_guard<std::mutex> lock(sampler_mutex_);
+        sampler_running_ = false;
+    }
+    sampler_cv_.notify_all();
+    if (sampler_thread_.joinable()) {
+        sampler_thread_.join();
+    }
+}
+
+void Context::ProgressSampler() {
+    using namespace std::chrono;
+    const milliseconds interval(settings_->progress_sample_ms);
+    std::unique_lock<std::mutex> lock(sampler_mutex_);
+    while (sampler_running_) {
+        int64_t now_ms = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+        for (auto& device : GetAllDevices()) {
+            device->SampleProgress(now_ms);
+        }
+        sampler_cv_.wait_for(lock, interval, [this] { return !sampler_running_; });
+    }
+}
+
+void Context::WatchdogTimeout() {
+    auto devs = GetAllDevices();
+    auto os = OpenDumpFile();
+
+    // Write the prologue up front, a device that has already been dumped
+    // writes nothing.
+    DumpReportPrologue(os);
+    for (auto& device : devs) {
+        device->WatchdogTimeout(os);
+    }
+}
+
 void Context::PreApiFunction(const char* api_name) {
     if (settings_->trace_all) {
         Log().Info("{ %s", api_name);
@@ -604,26 +784,29 @@ const VkDeviceCreateInfo* Context::GetModifiedDeviceCreateInfo(VkPhysicalDevice
 }
 
 void Context::DumpDeviceExecutionState(Device& device) {
-    auto file = OpenDumpFile();
-    YAML::Emitter os(file.is_open() ? file : std::cerr);
+    auto os = OpenDumpFile();
     DumpDeviceExecutionState(device, {}, true, kDeviceLostError, os);
 }
 
 void Context::DumpDeviceExecutionState(Device& device, bool dump_prologue, CrashSource crash_source,
-                                       YAML::Emitter& os) {
+                                       DumpEmitter& os) {
     DumpDeviceExecutionState(device, {}, dump_prologue, crash_source, os);
 }
 
 void Context::DumpDeviceExecutionState(Device& device, const std::string& error_report, bool dump_prologue,
-                                       CrashSource crash_source, YAML::Emitter& os) {
+                                       CrashSource crash_source, DumpEmitter& os) {
     if (dump_prologue) {
         DumpReportPrologue(os);
     }
 
     device.Print(os, error_report);
+
+    if (settings_->widen_after_crash && !instrumentation_widened_.exchange(true)) {
+        Log().Info("Crash detected, instrumenting all commands in command buffers recorded from now on.");
+    }
 }
 
-void Context::DumpDeviceExecutionStateValidationFailed(Device& device, YAML::Emitter& os) {
+void Context::DumpDeviceExecutionStateValidationFailed(Device& device, DumpEmitter& os) {
     if (device.HangDetected()) {
         return;
     }
@@ -640,7 +823,7 @@ void Context::DumpDeviceExecutionStateValidationFailed(Device& device, YAML::Emi
 #endif
 }
 
-void Context::DumpReportPrologue(YAML::Emitter& os) {
+void Context::DumpReportPrologue(DumpEmitter& os) {
     auto elapsed = std::chrono::system_clock::now() - start_time_;
     os << YAML::Comment("----------------------------------------------------------------") << YAML::Newline;
     os << YAML::Comment("-                    CRASH DIAGNOSTIC LAYER                    -") << YAML::Newline;
@@ -656,6 +839,8 @@ void Context::DumpReportPrologue(YAML::Emitter& os) {
     os << YAML::Key << "Settings" << YAML::Value;
     settings_->Print(os);
 
+    DumpInstrumentationPolicy(os);
+
     os << YAML::Key << "SystemInfo" << YAML::Value << YAML::BeginMap;
     os << YAML::Key << "osName" << YAML::Value << system_.GetOsName();
     os << YAML::Key << "osVersion" << YAML::Value << system_.GetOsVersion();
@@ -698,7 +883,29 @@ void Context::DumpReportPrologue(YAML::Emitter& os) {
     assert(os.good());
 }
 
-std::ofstream Context::OpenDumpFile() {
+// The policy actually in effect, which may differ from the settings once
+// widen_after_crash has kicked in.
+void Context::DumpInstrumentationPolicy(DumpEmitter& os) {
+    const auto& settings = *settings_;
+    bool widened = instrumentation_widened_;
+    os << YAML::Key << "InstrumentationPolicy" << YAML::Value << YAML::BeginMap;
+    os << YAML::Key << "mode" << YAML::Value << (widened ? InstrumentationMode::kAll : settings.instrumentation_mode);
+    if (settings.instrumentation_mode == InstrumentationMode::kEveryNth) {
+        os << YAML::Key << "everyNth" << YAML::Value << settings.instrument_every_nth;
+    }
+    if (settings.instrumentation_mode == InstrumentationMode::kLabelRegions) {
+        os << YAML::Key << "labelRegions" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+        for (const auto& name : settings.instrument_label_region_names) {
+            os << name;
+        }
+        os << YAML::EndSeq;
+    }
+    os << YAML::Key << "widenAfterCrash" << YAML::Value << settings.widen_after_crash;
+    os << YAML::Key << "widened" << YAML::Value << widened;
+    os << YAML::EndMap;  // InstrumentationPolicy
+}
+
+DumpEmitter Context::OpenDumpFile() {
     // Make sure our output directory exists.
     std::filesystem::create_directories(output_path_);
 
@@ -708,11 +915,13 @@ std::ofstream Context::OpenDumpFile() {
     // Keep the first log as cdl_dump.yaml then add a number if more than one log is
     // generated. Multiple logs are a new feature and we want to keep backward
     // compatiblity for now.
+    auto format = GetSettings().dump_format;
+    const char* extension = format == DumpFormat::kBinary ? ".cdlb" : ".yaml";
     std::stringstream ss_name;
     if (total_logs_ > 0) {
-        ss_name << "cdl_dump_" << total_logs_ << ".yaml";
+        ss_name << "cdl_dump_" << total_logs_ << extension;
     } else {
-        ss_name << "cdl_dump.yaml";
+        ss_name << "cdl_dump" << extension;
     }
     dump_file_path /= ss_name.str();
     total_logs_++;
@@ -720,7 +929,7 @@ std::ofstream Context::OpenDumpFile() {
 #if !defined(WIN32)
     // Create a symlink from the generated log file.
     std::filesystem::path symlink_path(base_output_path_);
-    symlink_path /= "cdl_dump.yaml.symlink";
+    symlink_path /= std::string("cdl_dump") + extension + ".symlink";
     remove(symlink_path.string().c_str());
     symlink(dump_file_path.string().c_str(), symlink_path.string().c_str());
 #endif
@@ -738,12 +947,12 @@ std::ofstream Context::OpenDumpFile() {
 #endif
     Log().Error(ss.str());
 
-    std::ofstream fs(dump_file_path);
-    if (!fs.is_open()) {
+    bool opened = false;
+    auto os = DumpEmitter::OpenFile(dump_file_path, format, &opened);
+    if (!opened) {
         Log().Error("UNABLE TO OPEN LOG FILE");
     }
-    fs << std::unitbuf;
-    return fs;
+    return os;
 }
 
 // =============================================================================
@@ -766,6 +975,10 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL MessengerCallback(VkDebugUtilsMessageSever
     return VK_FALSE;
 }
 
+// Set while this thread is inside a create call that may send address binding
+// reports for an object whose handle has not been returned yet.
+static thread_local VkDevice creating_device = VK_NULL_HANDLE;
+
 void Context::MemoryBindEvent(const VkDeviceAddressBindingCallbackDataEXT& mem_info,
                               const VkDebugUtilsObjectNameInfoEXT& object) {
     DeviceAddressRecord rec{mem_info.baseAddress,
@@ -776,11 +989,32 @@ void Context::MemoryBindEvent(const VkDeviceAddressBindingCallbackDataEXT& mem_i
                             object.objectHandle,
                             object.pObjectName ? object.pObjectName : "",
                             std::chrono::high_resolution_clock::now()};
-    auto devs = GetAllDevices();
-
-    bool multi_device = devs.size() > 1;
-    for (auto& dev : devs) {
-        dev->MemoryBindEvent(rec, multi_device);
+    // Reports sent while an object is being created arrive before its handle
+    // is known, they belong to the device running the create call on this thread.
+    if (creating_device != VK_NULL_HANDLE) {
+        if (auto device = GetDevice(creating_device)) {
+            device->MemoryBindEvent(rec);
+            return;
+        }
+    }
+    // Handles are only unique per device, so more than one device may own
+    // this one. Record it on each of them rather than guess.
+    auto devices = GetAllDevices();
+    bool owner_found = false;
+    for (auto& dev : devices) {
+        if (dev->IsBoundObject(object.objectHandle)) {
+            dev->MemoryBindEvent(rec);
+            owner_found = true;
+        }
+    }
+    if (owner_found) {
+        return;
+    }
+    // Objects we do not track, such as acceleration structures. Device
+    // addresses of different devices may overlap, but a record on the wrong
+    // device is more useful than a dropped one.
+    for (auto& dev : devices) {
+        dev->MemoryBindEvent(rec);
     }
 }
 
@@ -879,6 +1113,10 @@ void Context::PreDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAl
             devices_.erase(iter);
         }
     }
+    {
+        // Wait for a progress sampler pass that may still hold a reference to the device.
+        std::lock_guard<std::mutex> lock(sampler_mutex_);
+    }
     device_state.reset();
 }
 
@@ -1057,6 +1295,102 @@ VkResult Context::PostAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapch
     return result;
 }
 
+VkResult Context::PreAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                    const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+    if (GetDevice(device)->HasAddressBindingReport()) {
+        creating_device = device;
+    }
+    return VK_SUCCESS;
+}
+
+VkResult Context::PostAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                     const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
+                                     VkResult result) {
+    creating_device = VK_NULL_HANDLE;
+    if (result == VK_SUCCESS) {
+        GetDevice(device)->AddBoundObject((uint64_t)*pMemory);
+    }
+    return result;
+}
+
+// Object names are dropped with their objects, so handles reused by the driver do not
+// inherit stale names and the name database does not grow with every transient object.
+void Context::PostFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
+    auto device_state = GetDevice(device);
+    device_state->RemoveObjectInfo((uint64_t)memory);
+    device_state->RemoveBoundObject((uint64_t)memory);
+}
+
+void Context::PostDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)fence);
+}
+
+void Context::PostDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)event);
+}
+
+void Context::PostDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)queryPool);
+}
+
+VkResult Context::PreCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                                  const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+    if (GetDevice(device)->HasAddressBindingReport()) {
+        creating_device = device;
+    }
+    return VK_SUCCESS;
+}
+
+VkResult Context::PostCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                                   const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer, VkResult result) {
+    creating_device = VK_NULL_HANDLE;
+    if (result == VK_SUCCESS) {
+        GetDevice(device)->AddBoundObject((uint64_t)*pBuffer);
+    }
+    return result;
+}
+
+void Context::PostDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
+    auto device_state = GetDevice(device);
+    device_state->RemoveObjectInfo((uint64_t)buffer);
+    device_state->RemoveBoundObject((uint64_t)buffer);
+}
+
+void Context::PostDestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)bufferView);
+}
+
+VkResult Context::PreCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                 const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+    if (GetDevice(device)->HasAddressBindingReport()) {
+        creating_device = device;
+    }
+    return VK_SUCCESS;
+}
+
+VkResult Context::PostCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                                  const VkAllocationCallbacks* pAllocator, VkImage* pImage, VkResult result) {
+    creating_device = VK_NULL_HANDLE;
+    if (result == VK_SUCCESS) {
+        GetDevice(device)->AddBoundObject((uint64_t)*pImage);
+    }
+    return result;
+}
+
+void Context::PostDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
+    auto device_state = GetDevice(device);
+    device_state->RemoveObjectInfo((uint64_t)image);
+    device_state->RemoveBoundObject((uint64_t)image);
+}
+
+void Context::PostDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)imageView);
+}
+
+void Context::PostDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
+    GetDevice(device)->RemoveObjectInfo((uint64_t)sampler);
+}
+
 VkResult Context::PostCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                          VkResult callResult) {
@@ -1122,7 +1456,7 @@ void Context::PreDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
     PreApiFunction("vkDestroyCommandPool");
 
     auto device_state = GetDevice(device);
-    YAML::Emitter os;
+    DumpEmitter os;
     device_state->ValidateCommandPoolState(commandPool, os);
     if (os.size() > 0) {
         DumpDeviceExecutionStateValidationFailed(*device_state, os);
@@ -1141,7 +1475,7 @@ VkResult Context::PreResetCommandPool(VkDevice device, VkCommandPool commandPool
     PreApiFunction("vkResetCommandPool");
 
     auto device_state = GetDevice(device);
-    YAML::Emitter os;
+    DumpEmitter os;
     device_state->ValidateCommandPoolState(commandPool, os);
     if (os.size() > 0) {
         DumpDeviceExecutionStateValidationFailed(*device_state, os);
@@ -1188,7 +1522,7 @@ void Context::PostFreeCommandBuffers(VkDevice device, VkCommandPool commandPool,
 
     auto device_state = GetDevice(device);
     if (!device_state->HangDetected()) {
-        YAML::Emitter os;
+        DumpEmitter os;
         bool all_cb_ok = true;
         for (uint32_t i = 0; i < commandBufferCount; ++i) {
             all_cb_ok = all_cb_ok && device_state->ValidateCommandBufferNotInUse(pCommandBuffers[i], os);
@@ -1259,11 +1593,12 @@ void Context::PreDestroySemaphore(VkDevice device, VkSemaphore semaphore, const
 }
 
 void Context::PostDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
+    auto device_state = GetDevice(device);
     if (settings_->track_semaphores) {
-        auto device_state = GetDevice(device);
         auto semaphore_tracker = device_state->GetSemaphoreTracker();
         semaphore_tracker->EraseSemaphore(semaphore);
     }
+    device_state->RemoveObjectInfo((uint64_t)semaphore);
 }
 
 VkResult Context::PostSignalSemaphore(VkDevice device, const VkSemaphoreSignalInfoKHR* pSignalInfo, VkResult result) {
@@ -1416,7 +1751,7 @@ VkResult Context::PreBeginCommandBuffer(VkCommandBuffer commandBuffer, VkCommand
     auto p_cmd = crash_diagnostic_layer::GetCommandBuffer(commandBuffer);
     {
         auto& device = p_cmd->GetDevice();
-        YAML::Emitter os;
+        DumpEmitter os;
         if (!device.ValidateCommandBufferNotInUse(commandBuffer, os)) {
             DumpDeviceExecutionStateValidationFailed(device, os);
         }
@@ -1429,7 +1764,7 @@ VkResult Context::PreResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommand
     auto p_cmd = crash_diagnostic_layer::GetCommandBuffer(commandBuffer);
     {
         auto& device = p_cmd->GetDevice();
-        YAML::Emitter os;
+        DumpEmitter os;
         if (!device.ValidateCommandBufferNotInUse(commandBuffer, os)) {
             DumpDeviceExecutionStateValidationFailed(device, os);
         }
@@ -1447,6 +1782,8 @@ VkResult Context::QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmi
     PostApiFunction("vkQueueSubmit", result);
     if (IsVkError(result)) {
         device_state->DeviceFault();
+    } else if (result == VK_SUCCESS) {
+        ArmQueueWatchdog(*queue_state);
     }
     return result;
 }
@@ -1460,6 +1797,8 @@ VkResult Context::QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubm
     PostApiFunction("vkQueueSubmit2", result);
     if (IsVkError(result)) {
         device_state->DeviceFault();
+    } else if (result == VK_SUCCESS) {
+        ArmQueueWatchdog(*queue_state);
     }
     return result;
 }
@@ -1473,6 +1812,8 @@ VkResult Context::QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkS
     PostApiFunction("vkQueueSubmit2KHR", result);
     if (IsVkError(result)) {
         device_state->DeviceFault();
+    } else if (result == VK_SUCCESS) {
+        ArmQueueWatchdog(*queue_state);
     }
     return result;
 }
@@ -1487,6 +1828,8 @@ VkResult Context::QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, VkBindS
     PostApiFunction("vkQueueBindSparse", result);
     if (IsVkError(result)) {
         device_state->DeviceFault();
+    } else if (result == VK_SUCCESS) {
+        ArmQueueWatchdog(*queue_state);
     }
     return result;
 }
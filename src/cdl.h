@@ -32,20 +32,23 @@
 #include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <new>
+#include <queue>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
-#include <yaml-cpp/emitter.h>
 
 #include "command.h"
 #include "command_buffer_tracker.h"
 #include "device.h"
+#include "dump_emitter.h"
 #include "layer_base.h"
 #include "logger.h"
 #include "system.h"
@@ -103,19 +106,30 @@ struct Settings {
     Settings();
     Settings(VkuLayerSettingSet settings, Logger& log);
     ~Settings() {}
-    void Print(YAML::Emitter& os) const;
+    void Print(DumpEmitter& os) const;
 
     DumpCommands dump_queue_submits{DumpCommands::kRunning};
     DumpCommands dump_command_buffers{DumpCommands::kRunning};
     DumpCommands dump_commands{DumpCommands::kRunning};
     DumpShaders dump_shaders{DumpShaders::kOff};
+    DumpFormat dump_format{DumpFormat::kYaml};
     std::string output_path;
     bool instrument_all_commands{false};
     bool track_semaphores{false};
     bool trace_all_semaphores{false};
     bool trace_all{false};
     bool sync_after_commands{false};
+    bool packed_checkpoints{false};
+    bool batch_queue_submits{false};
+    uint32_t max_tracked_submits{0};
+    InstrumentationMode instrumentation_mode{InstrumentationMode::kDefault};
+    uint32_t instrument_every_nth{4};
+    std::string instrument_label_regions;
+    std::vector<std::string> instrument_label_region_names;
+    bool widen_after_crash{false};
     uint64_t watchdog_timer_ms{0};
+    uint64_t progress_sample_ms{0};
+    uint32_t marker_buffer_reserve{0};
 };
 
 class Context : public Interceptor {
@@ -133,7 +147,7 @@ class Context : public Interceptor {
     VkInstance GetInstance() { return vk_instance_; }
 
     const std::filesystem::path& GetOutputPath() const;
-    std::ofstream OpenDumpFile();
+    DumpEmitter OpenDumpFile();
     const Logger& Log() const { return logger_; }
 
     const ShaderModule* FindShaderModule(VkShaderModule shader) const;
@@ -148,25 +162,35 @@ class Context : public Interceptor {
     ConstDevicePtr GetQueueDevice(VkQueue) const;
 
     const Settings& GetSettings() const { return settings_.value(); }
+    // True once widen_after_crash has kicked in, command buffers begun after
+    // that instrument every command.
+    bool InstrumentationWidened() const { return instrumentation_widened_; }
 
     void MemoryBindEvent(const VkDeviceAddressBindingCallbackDataEXT& mem_info,
                          const VkDebugUtilsObjectNameInfoEXT& object);
 
     void DumpAllDevicesExecutionState(CrashSource crash_source);
     void DumpDeviceExecutionState(Device& device);
-    void DumpDeviceExecutionState(Device& device, bool dump_prologue, CrashSource crash_source, YAML::Emitter& os);
+    void DumpDeviceExecutionState(Device& device, bool dump_prologue, CrashSource crash_source, DumpEmitter& os);
     void DumpDeviceExecutionState(Device& device, const std::string& error_report, bool dump_prologue,
-                                  CrashSource crash_source, YAML::Emitter& os);
-    void DumpDeviceExecutionStateValidationFailed(Device& device, YAML::Emitter& os);
+                                  CrashSource crash_source, DumpEmitter& os);
+    void DumpDeviceExecutionStateValidationFailed(Device& device, DumpEmitter& os);
 
-    void DumpReportPrologue(YAML::Emitter& os);
+    void DumpReportPrologue(DumpEmitter& os);
+    void DumpInstrumentationPolicy(DumpEmitter& os);
 
     void StopWatchdogTimer();
 
    private:
     void StartWatchdogTimer();
     void WatchdogTimer();
+    void WatchdogTimeout();
     void UpdateWatchdog();
+    void ArmQueueWatchdog(Queue& queue);
+
+    void StartProgressSampler();
+    void StopProgressSampler();
+    void ProgressSampler();
 
     void ValidateCommandBufferNotInUse(CommandBuffer* commandBuffer);
 
@@ -209,9 +233,19 @@ class Context : public Interceptor {
     VkResult PreDeviceWaitIdle(VkDevice device) override;
     VkResult PostDeviceWaitIdle(VkDevice device, VkResult result) override;
 
+    VkResult PreAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                               const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) override;
+    VkResult PostAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
+                                VkResult result) override;
+
+    void PostFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) override;
+
     VkResult QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo,
                              VkFence fence) override;
 
+    void PostDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) override;
+
     VkResult PreGetFenceStatus(VkDevice device, VkFence fence) override;
     VkResult PostGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
 
@@ -227,6 +261,10 @@ class Context : public Interceptor {
     void PreDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) override;
     void PostDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) override;
 
+    void PostDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) override;
+
+    void PostDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) override;
+
     VkResult PreGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                                     size_t dataSize, void* pData, VkDeviceSize stride,
                                     VkQueryResultFlags flags) override;
@@ -234,6 +272,25 @@ class Context : public Interceptor {
                                      size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags,
                                      VkResult result) override;
 
+    VkResult PreCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                             const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) override;
+    VkResult PostCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo,
+                              const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer, VkResult result) override;
+
+    void PostDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) override;
+
+    void PostDestroyBufferView(VkDevice device, VkBufferView bufferView,
+                               const VkAllocationCallbacks* pAllocator) override;
+
+    VkResult PreCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                            const VkAllocationCallbacks* pAllocator, VkImage* pImage) override;
+    VkResult PostCreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
+                             const VkAllocationCallbacks* pAllocator, VkImage* pImage, VkResult result) override;
+
+    void PostDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) override;
+
+    void PostDestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) override;
+
     VkResult PostCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                     const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
                                     VkResult result) override;
@@ -253,6 +310,8 @@ class Context : public Interceptor {
 
     void PostDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) override;
 
+    void PostDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) override;
+
     VkResult PreCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
                                   const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) override;
     VkResult PostCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
@@ -337,6 +396,7 @@ class Context : public Interceptor {
 
    private:
     std::optional<Settings> settings_;
+    std::atomic<bool> instrumentation_widened_{false};
 
     TimePoint start_time_;
     Logger logger_;
@@ -385,9 +445,36 @@ class Context : public Interceptor {
     int total_logs_ = 0;
 
     // Watchdog
+    //
+    // The watchdog thread sleeps on a condition variable until the earliest
+    // deadline. One deadline tracks the time since the last submit or
+    // successful wait, and each queue with work in flight has one that checks
+    // the queue's completed sequence number. Deadlines are only re-checked when
+    // they expire, so submits just store a timestamp or arm an idle queue.
+    struct WatchdogDeadline {
+        std::chrono::steady_clock::time_point time;
+        // VK_NULL_HANDLE for the submit deadline.
+        VkQueue queue;
+
+        bool operator>(const WatchdogDeadline& other) const { return time > other.time; }
+    };
     std::thread watchdog_thread_;
-    std::atomic<bool> watchdog_running_;
+    std::mutex watchdog_mutex_;
+    std::condition_variable watchdog_cv_;
+    bool watchdog_running_{false};
+    std::priority_queue<WatchdogDeadline, std::vector<WatchdogDeadline>, std::greater<WatchdogDeadline>>
+        watchdog_deadlines_;
+    // steady_clock milliseconds
     std::atomic<long long> last_submit_time_;
+
+    // Progress sampler
+    //
+    // Each pass holds sampler_mutex_, so vkDestroyDevice can wait for the
+    // pass to drop its references before the device state is destroyed.
+    std::thread sampler_thread_;
+    std::mutex sampler_mutex_;
+    std::condition_variable sampler_cv_;
+    bool sampler_running_{false};
 };
 
 }  // namespace crash_diagnostic_layer
@@ -18,18 +18,39 @@
 #include "device.h"
 #include "logger.h"
 
+#include <algorithm>
 #include <cassert>
+#include <utility>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 namespace crash_diagnostic_layer {
 
-Checkpoint::Checkpoint(CheckpointMgr *mgr, CheckpointId id) : mgr_(mgr), id_(id) {}
+Checkpoint::Checkpoint(CheckpointMgr *mgr, CheckpointId id, void *data) : mgr_(mgr), id_(id), data_(data) {}
 
-Checkpoint::~Checkpoint() {
+Checkpoint::~Checkpoint() { Free(); }
+
+Checkpoint::Checkpoint(Checkpoint &&other) noexcept : mgr_(other.mgr_), id_(other.id_), data_(other.data_) {
+    other.mgr_ = nullptr;
+    other.id_ = kInvalidCheckpoint;
+    other.data_ = nullptr;
+}
+
+Checkpoint &Checkpoint::operator=(Checkpoint &&other) noexcept {
+    if (this != &other) {
+        Free();
+        std::swap(mgr_, other.mgr_);
+        std::swap(id_, other.id_);
+        std::swap(data_, other.data_);
+    }
+    return *this;
+}
+
+void Checkpoint::Free() {
     if (mgr_) {
         mgr_->Free(*this);
         mgr_ = nullptr;
         id_ = kInvalidCheckpoint;
+        data_ = nullptr;
     }
 }
 
@@ -38,65 +59,173 @@ void Checkpoint::WriteBottom(VkCommandBuffer cmd, uint32_t value) { mgr_->WriteB
 
 uint32_t Checkpoint::ReadTop() const { return mgr_->ReadTop(*this); }
 uint32_t Checkpoint::ReadBottom() const { return mgr_->ReadBottom(*this); }
+const uint32_t *Checkpoint::HostMarkers() const { return mgr_->HostMarkers(*this); }
 
 void Checkpoint::Reset() { mgr_->Reset(*this); }
 
-BufferMarkerCheckpointMgr::BufferMarkerCheckpointMgr(Device &device) : markers_(device) {}
+namespace {
+// Live BufferMarkerCheckpointMgrs by uid. A thread cache only knows the uid of
+// the manager it belongs to, this is how it finds out whether the manager is
+// still around to take its pairs back.
+std::mutex g_checkpoint_mgrs_mutex;
+std::unordered_map<uint64_t, BufferMarkerCheckpointMgr *> g_checkpoint_mgrs;
+std::atomic<uint64_t> g_next_checkpoint_mgr_uid{1};
+}  // namespace
+
+struct BufferMarkerCheckpointMgr::ThreadCache {
+    ~ThreadCache() { Release(); }
+
+    // Hand the cached pairs back to their manager, unless it was destroyed.
+    void Release() {
+        if (owner_uid != 0 && !pairs.empty()) {
+            std::lock_guard<std::mutex> lock(g_checkpoint_mgrs_mutex);
+            auto iter = g_checkpoint_mgrs.find(owner_uid);
+            if (iter != g_checkpoint_mgrs.end()) {
+                iter->second->ReturnPairs(pairs, pairs.size());
+            }
+        }
+        pairs.clear();
+        owner_uid = 0;
+    }
 
-std::unique_ptr<Checkpoint> BufferMarkerCheckpointMgr::Allocate(uint32_t initial_value) {
-    auto checkpoint = std::make_unique<Checkpoint>(this, next_id_++);
-    Data data;
-    data.top_marker = markers_.Allocate(initial_value);
-    data.bottom_marker = markers_.Allocate(initial_value);
-    if (!data.top_marker || !data.bottom_marker) {
-        return nullptr;
+    uint64_t owner_uid{0};
+    std::vector<MarkerPair *> pairs;
+};
+
+BufferMarkerCheckpointMgr::ThreadCache &BufferMarkerCheckpointMgr::GetThreadCache() {
+    static thread_local ThreadCache cache;
+    return cache;
+}
+
+BufferMarkerCheckpointMgr::BufferMarkerCheckpointMgr(BufferMarkerMgr &markers)
+    : markers_(markers), uid_(g_next_checkpoint_mgr_uid++) {
+    std::lock_guard<std::mutex> lock(g_checkpoint_mgrs_mutex);
+    g_checkpoint_mgrs[uid_] = this;
+}
+
+BufferMarkerCheckpointMgr::~BufferMarkerCheckpointMgr() {
+    // Pairs still sitting in other threads' caches are dropped when those
+    // caches next change owner or their thread exits.
+    std::lock_guard<std::mutex> lock(g_checkpoint_mgrs_mutex);
+    g_checkpoint_mgrs.erase(uid_);
+}
+
+// A thread usually records for a single device, so its cache only holds pairs
+// of one manager. Switching managers gives the old manager its pairs back.
+void BufferMarkerCheckpointMgr::AdoptThreadCache(ThreadCache &cache) {
+    if (cache.owner_uid != uid_) {
+        cache.Release();
+        cache.owner_uid = uid_;
+    }
+}
+
+bool BufferMarkerCheckpointMgr::RefillThreadCache(ThreadCache &cache) {
+    std::lock_guard<std::mutex> lock(free_pairs_mutex_);
+    if (free_pairs_.empty()) {
+        auto data = markers_.AllocateData(2 * kPairsPerSlab);
+        if (!data) {
+            return false;
+        }
+        std::unique_ptr<MarkerPair[]> slab(new MarkerPair[kPairsPerSlab]);
+        auto *words = static_cast<uint32_t *>(data->cpu_mapped_address);
+        // Push in reverse so the pairs are handed out in buffer order.
+        for (uint32_t i = kPairsPerSlab; i-- > 0;) {
+            slab[i].buffer = data->buffer;
+            slab[i].offset = data->offset + 2 * i * static_cast<uint32_t>(sizeof(uint32_t));
+            slab[i].cpu_mapped_address = words + 2 * i;
+            free_pairs_.push_back(&slab[i]);
+        }
+        slabs_.push_back(std::move(slab));
     }
-    checkpoint_data_.emplace(std::make_pair(checkpoint->Id(), std::move(data)));
-    return checkpoint;
+    auto count = std::min<size_t>(kTransferBatch, free_pairs_.size());
+    cache.pairs.insert(cache.pairs.end(), free_pairs_.end() - static_cast<std::ptrdiff_t>(count), free_pairs_.end());
+    free_pairs_.resize(free_pairs_.size() - count);
+    return true;
+}
+
+// Moves the last count entries of pairs to the shared free list.
+void BufferMarkerCheckpointMgr::ReturnPairs(std::vector<MarkerPair *> &pairs, size_t count) {
+    assert(count <= pairs.size());
+    std::lock_guard<std::mutex> lock(free_pairs_mutex_);
+    free_pairs_.insert(free_pairs_.end(), pairs.end() - static_cast<std::ptrdiff_t>(count), pairs.end());
+    pairs.resize(pairs.size() - count);
 }
 
-void BufferMarkerCheckpointMgr::Free(Checkpoint &c) {}
+bool BufferMarkerCheckpointMgr::Allocate(Checkpoint &checkpoint, uint32_t initial_value) {
+    auto &cache = GetThreadCache();
+    AdoptThreadCache(cache);
+    if (cache.pairs.empty() && !RefillThreadCache(cache)) {
+        return false;
+    }
+    MarkerPair *pair = cache.pairs.back();
+    cache.pairs.pop_back();
+    pair->cpu_mapped_address[0] = initial_value;
+    pair->cpu_mapped_address[1] = initial_value;
+    checkpoint = Checkpoint(this, next_id_++, pair);
+    return true;
+}
+
+void BufferMarkerCheckpointMgr::Free(Checkpoint &c) {
+    auto *pair = static_cast<MarkerPair *>(c.Data());
+    if (!pair) {
+        return;
+    }
+    auto &cache = GetThreadCache();
+    AdoptThreadCache(cache);
+    cache.pairs.push_back(pair);
+    if (cache.pairs.size() > kMaxThreadCachedPairs) {
+        ReturnPairs(cache.pairs, kTransferBatch);
+    }
+}
 
 void BufferMarkerCheckpointMgr::WriteTop(Checkpoint &c, VkCommandBuffer cmd, uint32_t value) {
-    auto iter = checkpoint_data_.find(c.Id());
-    assert(iter != checkpoint_data_.end());
-    iter->second.top_marker->Write(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, value);
+    auto *pair = static_cast<MarkerPair *>(c.Data());
+    assert(pair);
+    markers_.Dispatch().CmdWriteBufferMarkerAMD(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pair->buffer, pair->offset,
+                                                value);
 }
 
 void BufferMarkerCheckpointMgr::WriteBottom(Checkpoint &c, VkCommandBuffer cmd, uint32_t value) {
-    auto iter = checkpoint_data_.find(c.Id());
-    assert(iter != checkpoint_data_.end());
-    iter->second.bottom_marker->Write(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, value);
+    auto *pair = static_cast<MarkerPair *>(c.Data());
+    assert(pair);
+    markers_.Dispatch().CmdWriteBufferMarkerAMD(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, pair->buffer,
+                                                pair->offset + sizeof(uint32_t), value);
 }
 
 uint32_t BufferMarkerCheckpointMgr::ReadTop(const Checkpoint &c) const {
-    auto iter = checkpoint_data_.find(c.Id());
-    assert(iter != checkpoint_data_.end());
-    return iter->second.top_marker->Read();
+    auto *pair = static_cast<const MarkerPair *>(c.Data());
+    assert(pair);
+    return pair->cpu_mapped_address[0];
 }
 
 uint32_t BufferMarkerCheckpointMgr::ReadBottom(const Checkpoint &c) const {
-    auto iter = checkpoint_data_.find(c.Id());
-    assert(iter != checkpoint_data_.end());
-    return iter->second.bottom_marker->Read();
+    auto *pair = static_cast<const MarkerPair *>(c.Data());
+    assert(pair);
+    return pair->cpu_mapped_address[1];
+}
+
+const uint32_t *BufferMarkerCheckpointMgr::HostMarkers(const Checkpoint &c) const {
+    auto *pair = static_cast<const MarkerPair *>(c.Data());
+    assert(pair);
+    return pair->cpu_mapped_address;
 }
 
 void BufferMarkerCheckpointMgr::Reset(Checkpoint &c) {
-    auto iter = checkpoint_data_.find(c.Id());
-    assert(iter != checkpoint_data_.end());
-    iter->second.top_marker->Write(0);
-    iter->second.bottom_marker->Write(0);
+    auto *pair = static_cast<MarkerPair *>(c.Data());
+    assert(pair);
+    pair->cpu_mapped_address[0] = 0;
+    pair->cpu_mapped_address[1] = 0;
 }
 
 DiagnosticCheckpointMgr::DiagnosticCheckpointMgr(Device &device) : device_(device) {}
 
-std::unique_ptr<Checkpoint> DiagnosticCheckpointMgr::Allocate(uint32_t initial_value) {
-    auto checkpoint = std::make_unique<Checkpoint>(this, next_id_++);
+bool DiagnosticCheckpointMgr::Allocate(Checkpoint &checkpoint, uint32_t initial_value) {
+    checkpoint = Checkpoint(this, next_id_++);
     Data data;
     data.top_value = initial_value;
     data.bottom_value = initial_value;
-    checkpoint_data_.emplace(std::make_pair(checkpoint->Id(), std::move(data)));
-    return checkpoint;
+    checkpoint_data_.emplace(std::make_pair(checkpoint.Id(), std::move(data)));
+    return true;
 }
 
 void DiagnosticCheckpointMgr::Free(Checkpoint &c) { checkpoint_data_.erase(c.Id()); }
@@ -16,6 +16,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "marker.h"
 
 namespace crash_diagnostic_layer {
@@ -25,62 +31,119 @@ class CheckpointMgr;
 using CheckpointId = uint32_t;
 constexpr uint32_t kInvalidCheckpoint = ~0u;
 
+//
+// Checkpoint is a handle to a top and bottom marker owned by a CheckpointMgr.
+// It is held by value so that setting up a command buffer's checkpoint does
+// not allocate; a default constructed Checkpoint is empty until a manager
+// fills it in.
+//
 class Checkpoint {
    public:
-    Checkpoint(CheckpointMgr *mgr, MarkerId id);
+    Checkpoint() = default;
+    Checkpoint(CheckpointMgr *mgr, MarkerId id, void *data = nullptr);
     ~Checkpoint();
+    Checkpoint(const Checkpoint &) = delete;
+    Checkpoint &operator=(const Checkpoint &) = delete;
+    Checkpoint(Checkpoint &&other) noexcept;
+    Checkpoint &operator=(Checkpoint &&other) noexcept;
+
+    explicit operator bool() const { return mgr_ != nullptr; }
 
     void WriteTop(VkCommandBuffer cmd, uint32_t value);
     void WriteBottom(VkCommandBuffer cmd, uint32_t value);
     uint32_t ReadTop() const;
     uint32_t ReadBottom() const;
+    const uint32_t *HostMarkers() const;
 
     void Reset();
 
     CheckpointId Id() const { return id_; }
+    // Manager private storage for this checkpoint, if the manager uses any.
+    void *Data() const { return data_; }
 
    private:
-    CheckpointMgr *mgr_;
-    CheckpointId id_;
+    void Free();
+
+    CheckpointMgr *mgr_{nullptr};
+    CheckpointId id_{kInvalidCheckpoint};
+    void *data_{nullptr};
 };
 
 class CheckpointMgr {
    public:
     virtual ~CheckpointMgr() {}
-    virtual std::unique_ptr<Checkpoint> Allocate(uint32_t initial_value) = 0;
+    // Fills in checkpoint, returns false if no markers are left.
+    virtual bool Allocate(Checkpoint &checkpoint, uint32_t initial_value) = 0;
     virtual void Free(Checkpoint &) = 0;
     virtual void WriteTop(Checkpoint &, VkCommandBuffer cmd, uint32_t value) = 0;
     virtual void WriteBottom(Checkpoint &, VkCommandBuffer cmd, uint32_t value) = 0;
     virtual uint32_t ReadTop(const Checkpoint &) const = 0;
     virtual uint32_t ReadBottom(const Checkpoint &) const = 0;
+    // The host mapped top marker word, followed by the bottom one, or nullptr
+    // if the markers can only be read through ReadTop() and ReadBottom(). The
+    // memory stays mapped for the life of the manager, so it may be read from
+    // another thread after the checkpoint has been freed.
+    virtual const uint32_t *HostMarkers(const Checkpoint &) const { return nullptr; }
     virtual void Update() {}
     virtual void Reset(Checkpoint &) = 0;
 };
 
+//
+// BufferMarkerCheckpointMgr writes checkpoints with vkCmdWriteBufferMarkerAMD.
+//
+// Every checkpoint needs a top and a bottom marker word. Rather than
+// allocating the two markers separately, the words are carved out of the
+// marker buffers in slabs of kPairsPerSlab adjacent pairs, so a slab costs one
+// trip through the BufferMarkerMgr lock. Freed pairs are recycled: each thread
+// keeps a small cache of free pairs, which Allocate() and Free() use without
+// locking, and spills to or refills from the manager's free list in batches.
+// Command buffers are created and destroyed on the same threads over and over,
+// so most checkpoints never touch a lock.
+//
 class BufferMarkerCheckpointMgr : public CheckpointMgr {
    public:
-    BufferMarkerCheckpointMgr(Device &device);
+    BufferMarkerCheckpointMgr(BufferMarkerMgr &markers);
+    ~BufferMarkerCheckpointMgr();
     BufferMarkerCheckpointMgr(BufferMarkerCheckpointMgr &) = delete;
     BufferMarkerCheckpointMgr &operator=(BufferMarkerCheckpointMgr &) = delete;
 
-    std::unique_ptr<Checkpoint> Allocate(uint32_t initial_value) override;
+    bool Allocate(Checkpoint &checkpoint, uint32_t initial_value) override;
     void Free(Checkpoint &) override;
     void WriteTop(Checkpoint &, VkCommandBuffer cmd, uint32_t value) override;
     void WriteBottom(Checkpoint &, VkCommandBuffer cmd, uint32_t value) override;
     uint32_t ReadTop(const Checkpoint &) const override;
     uint32_t ReadBottom(const Checkpoint &) const override;
+    const uint32_t *HostMarkers(const Checkpoint &) const override;
 
     void Reset(Checkpoint &) override;
 
    private:
-    struct Data {
-        std::unique_ptr<Marker> top_marker, bottom_marker;
+    // A top and bottom marker word pair. The bottom word follows the top one.
+    struct MarkerPair {
+        VkBuffer buffer;
+        uint32_t offset;
+        uint32_t *cpu_mapped_address;
     };
 
-    BufferMarkerMgr markers_;
+    static constexpr uint32_t kPairsPerSlab = 64;
+    // Free pairs moved between a thread cache and the shared free list at once.
+    static constexpr uint32_t kTransferBatch = 16;
+    static constexpr uint32_t kMaxThreadCachedPairs = 2 * kTransferBatch;
 
-    std::unordered_map<CheckpointId, Data> checkpoint_data_;
-    uint32_t next_id_{1};
+    struct ThreadCache;
+
+    static ThreadCache &GetThreadCache();
+    void AdoptThreadCache(ThreadCache &cache);
+    bool RefillThreadCache(ThreadCache &cache);
+    void ReturnPairs(std::vector<MarkerPair *> &pairs, size_t count);
+
+    BufferMarkerMgr &markers_;
+    const uint64_t uid_;
+    std::atomic<uint32_t> next_id_{1};
+
+    std::mutex free_pairs_mutex_;
+    std::vector<std::unique_ptr<MarkerPair[]>> slabs_;
+    std::vector<MarkerPair *> free_pairs_;
 };
 
 class DiagnosticCheckpointMgr : public CheckpointMgr {
@@ -89,7 +152,7 @@ class DiagnosticCheckpointMgr : public CheckpointMgr {
     DiagnosticCheckpointMgr(DiagnosticCheckpointMgr &) = delete;
     DiagnosticCheckpointMgr &operator=(DiagnosticCheckpointMgr &) = delete;
 
-    std::unique_ptr<Checkpoint> Allocate(uint32_t initial_value) override;
+    bool Allocate(Checkpoint &checkpoint, uint32_t initial_value) override;
     void Free(Checkpoint &) override;
     void WriteTop(Checkpoint &, VkCommandBuffer cmd, uint32_t value) override;
     void WriteBottom(Checkpoint &, VkCommandBuffer cmd, uint32_t value) override;
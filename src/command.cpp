@@ -18,14 +18,15 @@
 #include "command.h"
 #include "util.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <memory>
 #include <sstream>
-#include <yaml-cpp/emitter.h>
 
 #include "device.h"
 #include "cdl.h"
+#include "dump_emitter.h"
 
 namespace crash_diagnostic_layer {
 
@@ -35,14 +36,15 @@ CommandBuffer::CommandBuffer(Device& device, VkCommandPool vk_command_pool, VkCo
       vk_command_pool_(vk_command_pool),
       vk_command_buffer_(vk_command_buffer),
       cb_level_(allocate_info->level),
-      sync_after_commands_(device.GetContext().GetSettings().sync_after_commands) {
+      tracker_(device.GetCommandBlockCache()),
+      recorded_state_(device),
+      sync_after_commands_(device.GetContext().GetSettings().sync_after_commands),
+      packed_checkpoints_(device.GetContext().GetSettings().packed_checkpoints) {
     if (has_checkpoints) {
         begin_value_ = 1;
         end_value_ = 0x0000FFFF;
 
-        checkpoint_ = device_.AllocateCheckpoint(begin_value_);
-
-        if (!checkpoint_) {
+        if (!device_.AllocateCheckpoint(checkpoint_, begin_value_)) {
             device_.Log().Warning("Cannot acquire checkpoint. Not tracking VkCommandBuffer %s",
                                   device_.GetObjectName((uint64_t)vk_command_buffer).c_str());
         }
@@ -63,25 +65,64 @@ void CommandBuffer::WriteBeginCheckpoint() {
     // - n vkCmd commands recorded into command buffer: 2 ... n+1
     // - vkEndCommandBuffer: n+2
     if (checkpoint_) {
-        checkpoint_->WriteTop(vk_command_buffer_, begin_value_ + 1);
+        checkpoint_.WriteTop(vk_command_buffer_, begin_value_ + 1);
     }
 }
 
 void CommandBuffer::WriteEndCheckpoint() {
     if (checkpoint_) {
-        checkpoint_->WriteBottom(vk_command_buffer_, end_value_);
+        checkpoint_.WriteBottom(vk_command_buffer_, end_value_);
+    }
+}
+
+bool CommandBuffer::InLabelRegion(const CommandLabel* labels) const {
+    const auto& names = device_.GetContext().GetSettings().instrument_label_region_names;
+    for (; labels; labels = labels->parent) {
+        for (const auto& name : names) {
+            if (name == labels->name) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool CommandBuffer::SampleCommand(uint32_t command_id) {
+    switch (instrumentation_mode_) {
+        case InstrumentationMode::kEveryNth:
+            return (sampled_commands_++ % instrument_every_nth_) == 0;
+        case InstrumentationMode::kLabelRegions: {
+            // The label stack only changes on label commands, don't walk it for every command.
+            const CommandLabel* labels = tracker_.GetCommands().GetLabels(command_id - 1);
+            if (labels != label_match_labels_) {
+                label_match_labels_ = labels;
+                label_match_ = InLabelRegion(labels);
+            }
+            return label_match_;
+        }
+        default:
+            return true;
     }
 }
 
 void CommandBuffer::WriteCommandBeginCheckpoint(uint32_t command_id) {
-    if (checkpoint_) {
-        checkpoint_->WriteTop(vk_command_buffer_, begin_value_ + command_id);
+    instrument_current_command_ = SampleCommand(command_id);
+    if (!instrument_current_command_ || !checkpoint_) {
+        return;
     }
+    if (packed_checkpoints_) {
+        tracker_.SetInstrumented(command_id);
+        return;
+    }
+    checkpoint_.WriteTop(vk_command_buffer_, begin_value_ + command_id);
 }
 
 void CommandBuffer::WriteCommandEndCheckpoint(uint32_t command_id) {
+    if (!instrument_current_command_) {
+        return;
+    }
     if (checkpoint_) {
-        checkpoint_->WriteBottom(vk_command_buffer_, begin_value_ + command_id);
+        checkpoint_.WriteBottom(vk_command_buffer_, begin_value_ + command_id);
     }
     if (sync_after_commands_) {
         bool stopped_rendering = false;
@@ -111,14 +152,14 @@ bool CommandBuffer::StartedExecution() const {
     if (!checkpoint_) {
         return false;
     }
-    return (checkpoint_->ReadTop() > begin_value_);
+    return (checkpoint_.ReadTop() > begin_value_);
 }
 
 bool CommandBuffer::CompletedExecution() const {
     if (!checkpoint_) {
         return false;
     }
-    return (checkpoint_->ReadBottom() >= end_value_);
+    return (checkpoint_.ReadBottom() >= end_value_);
 }
 
 void CommandBuffer::Reset() {
@@ -126,7 +167,7 @@ void CommandBuffer::Reset() {
 
     // Reset marker state.
     if (checkpoint_) {
-        checkpoint_->Reset();
+        checkpoint_.Reset();
     }
 
     // Clear inheritance info
@@ -137,6 +178,11 @@ void CommandBuffer::Reset() {
 
     // Clear commands and internal state.
     tracker_.Reset();
+    recorded_state_.Reset();
+    state_keyframes_.clear();
+    sampled_commands_ = 0;
+    label_match_labels_ = nullptr;
+    label_match_ = false;
     submitted_queue_ = VK_NULL_HANDLE;
     submitted_fence_ = VK_NULL_HANDLE;
 }
@@ -153,6 +199,13 @@ VkResult CommandBuffer::PreBeginCommandBuffer(VkCommandBuffer commandBuffer,
                                               const VkCommandBufferBeginInfo* pBeginInfo) {
     // Reset state on Begin.
     Reset();
+
+    const auto& settings = device_.GetContext().GetSettings();
+    instrumentation_mode_ =
+        device_.GetContext().InstrumentationWidened() ? InstrumentationMode::kAll : settings.instrumentation_mode;
+    instrument_all_commands_ = instrumentation_mode_ == InstrumentationMode::kAll;
+    instrument_every_nth_ = settings.instrument_every_nth;
+
     tracker_.BeginCommandBuffer(commandBuffer, pBeginInfo);
     return VK_SUCCESS;
 }
@@ -207,16 +260,28 @@ uint32_t CommandBuffer::GetLastStartedCommand() const {
     if (!checkpoint_) {
         return 0;
     }
-    return checkpoint_->ReadTop() - begin_value_;
+    uint32_t last_started = checkpoint_.ReadTop() - begin_value_;
+    if (packed_checkpoints_ && StartedExecution()) {
+        // Only command ends were written. Assume the instrumented command
+        // following the last complete one is running.
+        // Command ids are index + 1, so the command after last_complete is at
+        // index last_complete.
+        uint32_t last_complete = GetLastCompleteCommand();
+        const auto& commands = tracker_.GetCommands();
+        uint32_t next = commands.NextInstrumented(last_complete);
+        last_started = std::max(last_started, next < commands.size() ? next + 1 : last_complete);
+    }
+    return last_started;
 }
 
 uint32_t CommandBuffer::GetLastCompleteCommand() const {
     if (!checkpoint_) {
         return 0;
     }
-    uint32_t marker = checkpoint_->ReadBottom();
+    uint32_t marker = checkpoint_.ReadBottom();
     if (marker == end_value_) {
-        return tracker_.GetCommands().back().id;
+        // Command ids are consecutive, the last recorded command has the highest id.
+        return tracker_.GetCommands().size();
     }
     return marker - begin_value_;
 }
@@ -279,7 +344,8 @@ std::string CommandBuffer::PrintCommandBufferState(CommandBufferState cb_state)
     }
 }
 
-CommandState CommandBuffer::GetCommandState(CommandBufferState cb_state, const Command& command) const {
+CommandState CommandBuffer::GetCommandState(CommandBufferState cb_state, const Command& command, uint32_t last_started,
+                                            uint32_t last_completed) const {
     if (IsPrimaryCommandBuffer() && !WasSubmittedToQueue()) {
         return CommandState::kCommandNotSubmitted;
     }
@@ -298,10 +364,10 @@ CommandState CommandBuffer::GetCommandState(CommandBufferState cb_state, const C
         }
         assert(cb_state == CommandBufferState::kSubmittedExecutionIncomplete);
     }
-    if (command.id > GetLastStartedCommand()) {
+    if (command.id > last_started) {
         return CommandState::kCommandNotStarted;
     }
-    if (command.id <= GetLastCompleteCommand()) {
+    if (command.id <= last_completed) {
         return CommandState::kCommandCompleted;
     }
     return CommandState::kCommandIncomplete;
@@ -325,15 +391,14 @@ std::string CommandBuffer::PrintCommandState(CommandState cm_state) const {
     }
 }
 
-bool CommandBuffer::DumpCommand(const Command& command, YAML::Emitter& os) {
-    printer_.SetNameResolver(&device_.GetObjectInfoDB());
+bool CommandBuffer::DumpCommand(const Command& command, DumpEmitter& os) {
     printer_.PrintCommandParameters(os, command);
     // TODO: does this matter?
     return true;
 }
 
-bool CommandBuffer::DumpCmdExecuteCommands(const Command& command, CommandState command_state, YAML::Emitter& os,
-                                           const Settings& settings) {
+bool CommandBuffer::DumpCmdExecuteCommands(const Command& command, CommandState command_state, DumpEmitter& os,
+                                           const Settings& settings, const ObjectInfoSnapshot& names) {
     auto args = reinterpret_cast<CmdExecuteCommandsArgs*>(command.parameters);
     os << YAML::BeginMap;
     os << YAML::Key << "commandBufferCount" << YAML::Value << args->commandBufferCount;
@@ -342,7 +407,7 @@ bool CommandBuffer::DumpCmdExecuteCommands(const Command& command, CommandState
         for (uint32_t i = 0; i < args->commandBufferCount; i++) {
             auto secondary_command_buffer = crash_diagnostic_layer::GetCommandBuffer(args->pCommandBuffers[i]);
             if (secondary_command_buffer) {
-                secondary_command_buffer->DumpContents(os, settings, submitted_queue_seq_, command_state);
+                secondary_command_buffer->DumpContents(os, settings, names, submitted_queue_seq_, command_state);
             }
         }
     }
@@ -350,30 +415,6 @@ bool CommandBuffer::DumpCmdExecuteCommands(const Command& command, CommandState
     return true;
 }
 
-// Mutable internal command buffer state used to determine what the
-// state should be at a given command
-class CommandBufferInternalState {
-   public:
-    CommandBufferInternalState(Device& device) : device_(device) {}
-
-    // Mutate the internal state by the command.
-    void Mutate(const Command& cmd);
-
-    // Print the relevant state for the command.
-    bool Print(const Command& cmd, YAML::Emitter& os, const ObjectInfoDB& name_resolver);
-
-    const Pipeline* GetPipeline(VkPipelineBindPoint bind_point) const {
-        return bound_pipelines_[static_cast<uint32_t>(bind_point)];
-    }
-
-   private:
-    static constexpr int kNumBindPoints = 2;  // graphics, compute
-
-    Device& device_;
-    std::array<const Pipeline*, kNumBindPoints> bound_pipelines_{nullptr, nullptr};
-    std::array<ActiveDescriptorSets, kNumBindPoints> bound_descriptors_;
-};
-
 // Returns the pipeline used by this command or -1 if no pipeline used.
 int GetCommandPipelineType(const Command& command) {
     switch (command.type) {
@@ -408,29 +449,74 @@ void CommandBuffer::HandleIncompleteCommand(const Command& command, const Comman
     }
 
     auto pipeline = state.GetPipeline(static_cast<VkPipelineBindPoint>(pipeline_type));
+    if (!pipeline) {
+        return;
+    }
     auto vk_pipeline = pipeline->GetVkPipeline();
 
     device_.DumpShaderFromPipeline(vk_pipeline);
 }
 
+void CommandBuffer::RecordInternalState(const Command& command) {
+    // The state hasn't changed since the last keyframe was taken, so it is
+    // also the state at every interval crossed since.
+    uint32_t index = command.id - 1;
+    while (state_keyframes_.size() * kStateKeyframeInterval <= index) {
+        state_keyframes_.push_back(recorded_state_);
+    }
+    recorded_state_.Mutate(command);
+}
+
+CommandBufferInternalState CommandBuffer::GetInternalState(uint32_t index) const {
+    uint32_t keyframe = index / kStateKeyframeInterval;
+    if (keyframe >= state_keyframes_.size()) {
+        // Nothing mutated the state after the last keyframe.
+        return recorded_state_;
+    }
+    CommandBufferInternalState state = state_keyframes_[keyframe];
+    const auto& commands = tracker_.GetCommands();
+    for (uint32_t i = keyframe * kStateKeyframeInterval; i < index; ++i) {
+        if (CommandBufferInternalState::Mutates(commands.GetType(i))) {
+            state.Mutate(commands.Get(i));
+        }
+    }
+    return state;
+}
+
+void CommandBufferInternalState::Reset() {
+    bound_pipelines_.fill(VK_NULL_HANDLE);
+    for (auto& descriptors : bound_descriptors_) {
+        descriptors.Reset();
+    }
+}
+
 void CommandBufferInternalState::Mutate(const Command& cmd) {
     if (cmd.type == Command::Type::kCmdBindDescriptorSets) {
         if (cmd.parameters) {
             // Update the active descriptorsets for this bind point.
             auto args = reinterpret_cast<CmdBindDescriptorSetsArgs*>(cmd.parameters);
-            bound_descriptors_[args->pipelineBindPoint].Bind(args->firstSet, args->descriptorSetCount,
-                                                             args->pDescriptorSets);
+            if (static_cast<int>(args->pipelineBindPoint) < kNumBindPoints) {
+                bound_descriptors_[args->pipelineBindPoint].Bind(args->firstSet, args->descriptorSetCount,
+                                                                 args->pDescriptorSets);
+            }
         }
     } else if (cmd.type == Command::Type::kCmdBindPipeline) {
         if (cmd.parameters) {
             // Update the currently bound pipeline.
             auto args = reinterpret_cast<CmdBindPipelineArgs*>(cmd.parameters);
-            bound_pipelines_[args->pipelineBindPoint] = device_.FindPipeline(args->pipeline);
+            if (static_cast<int>(args->pipelineBindPoint) < kNumBindPoints) {
+                bound_pipelines_[args->pipelineBindPoint] = args->pipeline;
+            }
         }
     }
 }
 
-bool CommandBufferInternalState::Print(const Command& cmd, YAML::Emitter& os, const ObjectInfoDB& name_resolver) {
+const Pipeline* CommandBufferInternalState::GetPipeline(VkPipelineBindPoint bind_point) const {
+    auto vk_pipeline = bound_pipelines_[static_cast<uint32_t>(bind_point)];
+    return vk_pipeline != VK_NULL_HANDLE ? device_.FindPipeline(vk_pipeline) : nullptr;
+}
+
+bool CommandBufferInternalState::Print(const Command& cmd, DumpEmitter& os, const ObjectInfoSnapshot& names) {
     int bind_point = -1;
     switch (cmd.type) {
         case Command::Type::kCmdDraw:
@@ -453,15 +539,15 @@ bool CommandBufferInternalState::Print(const Command& cmd, YAML::Emitter& os, co
         os << YAML::Key << "internalState" << YAML::Value << YAML::BeginMap;
 
         os << YAML::Key << "pipeline" << YAML::Value;
-        const auto& pipeline = bound_pipelines_[static_cast<uint32_t>(bind_point)];
+        const auto* pipeline = GetPipeline(static_cast<VkPipelineBindPoint>(bind_point));
         if (pipeline) {
-            pipeline->Print(os, name_resolver);
+            pipeline->Print(os, names);
         } else {
             os << YAML::BeginMap << YAML::EndMap;
         }
 
         os << YAML::Key << "descriptorSets" << YAML::Value;
-        bound_descriptors_[static_cast<uint32_t>(bind_point)].Print(device_, os);
+        bound_descriptors_[static_cast<uint32_t>(bind_point)].Print(names, os);
         os << YAML::EndMap;
         return true;
     }
@@ -469,8 +555,16 @@ bool CommandBufferInternalState::Print(const Command& cmd, YAML::Emitter& os, co
     return false;
 }
 
-void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, uint64_t secondary_cb_queue_seq,
-                                 CommandState vkcmd_execute_commands_command_state) {
+// Labels are linked from the innermost region outwards, print them outermost first.
+static void DumpLabels(const CommandLabel* label, DumpEmitter& os) {
+    if (label) {
+        DumpLabels(label->parent, os);
+        os << (label->name ? label->name : "");
+    }
+}
+
+void CommandBuffer::DumpContents(DumpEmitter& os, const Settings& settings, const ObjectInfoSnapshot& names,
+                                 uint64_t secondary_cb_queue_seq, CommandState vkcmd_execute_commands_command_state) {
     if (vk_command_buffer_ == VK_NULL_HANDLE) {
         return;
     }
@@ -500,11 +594,15 @@ void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, ui
     os << YAML::Key << "state";
     os << YAML::Value << PrintCommandBufferState(cb_state);
 
-    os << YAML::Key << "handle" << YAML::Value << device_.GetObjectInfo((uint64_t)vk_command_buffer_);
-    os << YAML::Key << "commandPool" << YAML::Value << device_.GetObjectInfo((uint64_t)vk_command_pool_);
+    os << YAML::Key << "handle" << YAML::Value;
+    names.PrintObjectInfo(os, (uint64_t)vk_command_buffer_);
+    os << YAML::Key << "commandPool" << YAML::Value;
+    names.PrintObjectInfo(os, (uint64_t)vk_command_pool_);
     if (buffer_state_ == CommandBufferState::kPending) {
-        os << YAML::Key << "queue" << device_.GetObjectInfo((uint64_t)submitted_queue_);
-        os << YAML::Key << "fence" << device_.GetObjectInfo((uint64_t)submitted_fence_);
+        os << YAML::Key << "queue";
+        names.PrintObjectInfo(os, (uint64_t)submitted_queue_);
+        os << YAML::Key << "fence";
+        names.PrintObjectInfo(os, (uint64_t)submitted_fence_);
     }
 
     os << YAML::Key << "queueSeq" << YAML::Value;
@@ -526,36 +624,40 @@ void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, ui
         os << YAML::Hex;
         os << YAML::Key << "beginValue" << YAML::Value << Uint32ToStr(begin_value_);
         os << YAML::Key << "endValue" << YAML::Value << Uint32ToStr(end_value_);
-        os << YAML::Key << "topCheckpointValue" << YAML::Value << Uint32ToStr(checkpoint_->ReadTop());
-        os << YAML::Key << "bottomCheckpointValue" << YAML::Value << Uint32ToStr(checkpoint_->ReadBottom());
+        os << YAML::Key << "topCheckpointValue" << YAML::Value << Uint32ToStr(checkpoint_.ReadTop());
+        os << YAML::Key << "bottomCheckpointValue" << YAML::Value << Uint32ToStr(checkpoint_.ReadBottom());
         os << YAML::Dec;
     }
     auto last_started = GetLastStartedCommand();
     auto last_completed = GetLastCompleteCommand();
 
     if (cb_state == CommandBufferState::kSubmittedExecutionIncomplete) {
-        os << YAML::Key << "lastStartedCommand" << YAML::Value << GetLastStartedCommand();
-        os << YAML::Key << "lastCompletedCommand" << YAML::Value << GetLastCompleteCommand();
+        os << YAML::Key << "lastStartedCommand" << YAML::Value << last_started;
+        os << YAML::Key << "lastCompletedCommand" << YAML::Value << last_completed;
+    }
+    printer_.SetNameResolver(&names);
+    // Command ids are index + 1, so the commands to dump are the index range
+    // [begin_index, end_index) and the rest are never read.
+    const auto& commands = tracker_.GetCommands();
+    uint32_t begin_index = 0;
+    uint32_t end_index = commands.size();
+    auto dump_cmds = settings.dump_commands;
+    if (dump_cmds == DumpCommands::kRunning || dump_cmds == DumpCommands::kPending) {
+        begin_index = std::min(last_completed > 0 ? last_completed - 1 : 0, end_index);
+    }
+    if (dump_cmds == DumpCommands::kRunning) {
+        end_index = std::max(begin_index, std::min(last_started, end_index));
     }
     // Internal command buffer state that needs to be tracked.
-    CommandBufferInternalState state(device_);
+    CommandBufferInternalState state = GetInternalState(begin_index);
 
-    auto dump_cmds = settings.dump_commands;
     os << YAML::Key << "Commands" << YAML::Value << YAML::BeginSeq;
-    for (const auto& command : tracker_.GetCommands()) {
+    for (uint32_t index = begin_index; index < end_index; ++index) {
+        const Command command = commands.Get(index);
         auto command_name = Command::GetCommandName(command);
-        auto command_state = GetCommandState(cb_state, command);
-
-        if (dump_cmds == DumpCommands::kRunning) {
-            if (command.id < last_completed || command.id > last_started) {
-                continue;
-            }
-        } else if (dump_cmds == DumpCommands::kPending) {
-            if (command.id < last_completed) {
-                continue;
-            }
-        }
+        auto command_state = GetCommandState(cb_state, command, last_started, last_completed);
 
+        os.BeginRecord(command.type);
         os << YAML::BeginMap << YAML::Comment("Command:");
         // os << YAML::Key << "id" << YAML::Value << command.id << "/" << num_commands;
         os << YAML::Key << "id" << YAML::Value << command.id;
@@ -563,11 +665,9 @@ void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, ui
            << crash_diagnostic_layer::Uint32ToStr(begin_value_ + command.id);
         os << YAML::Key << "name" << YAML::Value << command_name;
         os << YAML::Key << "state" << YAML::Value << PrintCommandState(command_state);
-        if (!command.labels.empty()) {
+        if (command.labels) {
             os << YAML::Key << "labels" << YAML::BeginSeq;
-            for (const auto& label : command.labels) {
-                os << label;
-            }
+            DumpLabels(command.labels, os);
             os << YAML::EndSeq;
         }
 
@@ -579,10 +679,10 @@ void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, ui
         if (strcmp(command_name, "vkCmdExecuteCommands") != 0) {
             DumpCommand(command, os);
         } else {
-            DumpCmdExecuteCommands(command, command_state, os, settings);
+            DumpCmdExecuteCommands(command, command_state, os, settings, names);
         }
         os << YAML::EndMap;
-        state.Print(command, os, device_.GetObjectInfoDB());
+        state.Print(command, os, names);
         if (command_state == CommandState::kCommandIncomplete) {
             HandleIncompleteCommand(command, state);
         }
@@ -590,14 +690,15 @@ void CommandBuffer::DumpContents(YAML::Emitter& os, const Settings& settings, ui
         // To make this message more visible, we put it in a special
         // Command entry.
         if (cb_state == CommandBufferState::kSubmittedExecutionIncomplete) {
-            if (command.id == GetLastCompleteCommand()) {
+            if (command.id == last_completed) {
                 os << YAML::Key << "message" << YAML::Value << "'>>>>>>>>>>>>>> LAST COMPLETE COMMAND <<<<<<<<<<<<<<'";
-            } else if (command.id == GetLastStartedCommand()) {
+            } else if (command.id == last_started) {
                 os << YAML::Key << "message" << YAML::Value << "'^^^^^^^^^^^^^^ LAST STARTED COMMAND ^^^^^^^^^^^^^^'";
             }
         }
         assert(os.good());
         os << YAML::EndMap;  // Command
+        os.EndRecord();
         assert(os.good());
     }
     assert(os.good());
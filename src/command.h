@@ -19,6 +19,7 @@
 
 #include <vulkan/vulkan.h>
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -41,6 +42,7 @@ class Emitter;
 namespace crash_diagnostic_layer {
 
 class Device;
+class Pipeline;
 struct Settings;
 
 enum class CommandState {
@@ -72,6 +74,46 @@ enum class CommandBufferState {
     kNotSubmitted,
 };
 
+// Which commands get checkpoints written around them
+enum class InstrumentationMode {
+    kDefault = 0,   // draws, dispatches, copies, barriers, labels, ...
+    kAll,           // every command
+    kEveryNth,      // every Nth of the default commands
+    kLabelRegions,  // default commands inside selected debug label regions
+};
+
+// Mutable internal command buffer state used to determine what the
+// state should be at a given command
+class CommandBufferInternalState {
+   public:
+    CommandBufferInternalState(Device& device) : device_(device) {}
+
+    void Reset();
+
+    // Whether commands of this type mutate the state, so others can be skipped
+    // without reading their parameters.
+    static bool Mutates(Command::Type type) {
+        return type == Command::Type::kCmdBindPipeline || type == Command::Type::kCmdBindDescriptorSets;
+    }
+
+    // Mutate the internal state by the command.
+    void Mutate(const Command& cmd);
+
+    // Print the relevant state for the command.
+    bool Print(const Command& cmd, DumpEmitter& os, const ObjectInfoSnapshot& names);
+
+    const Pipeline* GetPipeline(VkPipelineBindPoint bind_point) const;
+
+   private:
+    static constexpr int kNumBindPoints = 2;  // graphics, compute
+
+    Device& device_;
+    // Pipelines are looked up when printing, so recording doesn't take the
+    // device's pipeline lock.
+    std::array<VkPipeline, kNumBindPoints> bound_pipelines_{VK_NULL_HANDLE, VK_NULL_HANDLE};
+    std::array<ActiveDescriptorSets, kNumBindPoints> bound_descriptors_;
+};
+
 // =================================================================================================
 // CommandBuffer
 // =================================================================================================
@@ -92,10 +134,10 @@ class CommandBuffer {
 
     void SetCompleted() { buffer_state_ = CommandBufferState::kSubmittedExecutionCompleted; }
     bool IsPrimaryCommandBuffer() const { return cb_level_ == VK_COMMAND_BUFFER_LEVEL_PRIMARY; }
-    bool HasCheckpoints() const { return checkpoint_ != nullptr; }
+    bool HasCheckpoints() const { return static_cast<bool>(checkpoint_); }
+    const uint32_t* GetCheckpointMarkers() const { return checkpoint_ ? checkpoint_.HostMarkers() : nullptr; }
 
     uint64_t GetQueueSeq() { return submitted_queue_seq_; }
-    void SetInstrumentAllCommands(bool all) { instrument_all_commands_ = all; }
 
     bool WasSubmittedToQueue() const;
     bool StartedExecution() const;
@@ -104,7 +146,8 @@ class CommandBuffer {
     void Reset();
     void QueueSubmit(VkQueue queue, uint64_t queue_seq, VkFence fence);
 
-    void DumpContents(YAML::Emitter& os, const Settings& settings, uint64_t secondary_cb_submit_info_id = 0,
+    void DumpContents(DumpEmitter& os, const Settings& settings, const ObjectInfoSnapshot& names,
+                      uint64_t secondary_cb_submit_info_id = 0,
                       CommandState vkcmd_execute_commands_command_state = CommandState::kInvalidState);
 
     // custom command buffer functions (not autogenerated)
@@ -142,17 +185,24 @@ class CommandBuffer {
 
     std::string PrintCommandBufferState(CommandBufferState cb_state) const;
     CommandBufferState GetSecondaryCommandBufferState(CommandState vkcmd_execute_commands_command_state) const;
-    CommandState GetCommandState(CommandBufferState cb_state, const Command& command) const;
+    // last_started and last_completed are the checkpoint positions read once
+    // for the whole dump.
+    CommandState GetCommandState(CommandBufferState cb_state, const Command& command, uint32_t last_started,
+                                 uint32_t last_completed) const;
     std::string PrintCommandState(CommandState cm_state) const;
 
-    bool DumpCmdExecuteCommands(const Command& command, CommandState command_state, YAML::Emitter& os,
-                                const Settings& settings);
+    bool DumpCmdExecuteCommands(const Command& command, CommandState command_state, DumpEmitter& os,
+                                const Settings& settings, const ObjectInfoSnapshot& names);
 
     uint32_t GetLastStartedCommand() const;
     uint32_t GetLastCompleteCommand() const;
 
-    bool DumpCommand(const Command& command, YAML::Emitter& os);
-    void HandleIncompleteCommand(const Command& command, const class CommandBufferInternalState& state) const;
+    bool DumpCommand(const Command& command, DumpEmitter& os);
+    void HandleIncompleteCommand(const Command& command, const CommandBufferInternalState& state) const;
+
+    void RecordInternalState(const Command& command);
+    // Returns the internal state before the command at index.
+    CommandBufferInternalState GetInternalState(uint32_t index) const;
 
    private:
     Device& device_;
@@ -165,9 +215,19 @@ class CommandBuffer {
     // secondary command buffer inheritance info
     VkCommandBufferInheritanceInfo* scb_inheritance_info_ = nullptr;
 
+    // Instrumentation policy, fixed when recording begins.
+    InstrumentationMode instrumentation_mode_ = InstrumentationMode::kDefault;
     bool instrument_all_commands_ = false;
+    uint32_t instrument_every_nth_ = 1;
+    // Whether the command being recorded got a begin checkpoint, so its end
+    // checkpoint must be written too.
+    bool instrument_current_command_ = false;
+    uint32_t sampled_commands_ = 0;
+    // Label region match for the last seen label stack.
+    const CommandLabel* label_match_labels_ = nullptr;
+    bool label_match_ = false;
 
-    std::unique_ptr<Checkpoint> checkpoint_;
+    Checkpoint checkpoint_;
 
     uint32_t begin_value_;
     uint32_t end_value_;
@@ -184,10 +244,27 @@ class CommandBuffer {
     bool rendering_active_{false};
     bool sync_after_commands_{false};
 
+    // With packed checkpoints only the end of each instrumented command is
+    // written, so the ids of those commands are kept to work out which one
+    // was running.
+    bool packed_checkpoints_{false};
+
+    // Internal state keyframes, state_keyframes_[i] is the state before the
+    // command at index i * kStateKeyframeInterval, so dumps only replay the
+    // commands after the nearest one. Keyframes are only taken when a command
+    // that mutates the state is recorded past the next interval, the state
+    // does not change in between. recorded_state_ is the state after the last
+    // recorded command.
+    static constexpr uint32_t kStateKeyframeInterval = 1024;
+    CommandBufferInternalState recorded_state_;
+    std::vector<CommandBufferInternalState> state_keyframes_;
+
     void WriteBeginCheckpoint();
     void WriteEndCheckpoint();
     void WriteCommandBeginCheckpoint(uint32_t command_id);
     void WriteCommandEndCheckpoint(uint32_t command_id);
+    bool SampleCommand(uint32_t command_id);
+    bool InLabelRegion(const CommandLabel* labels) const;
 };
 
 using CommandBufferPtr = std::unique_ptr<CommandBuffer>;
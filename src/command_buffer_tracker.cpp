@@ -18,42 +18,33 @@
 #include "command_buffer_tracker.h"
 
 #include "command.h"
+#include "concurrent_pointer_map.h"
 
 namespace crash_diagnostic_layer {
 
 // Keep track of crash_diagnostic_layer::CommandBuffer objects created for
-// each VkCommandBuffer
+// each VkCommandBuffer. The map owns the objects and is only touched by
+// writers, lookups go through the lock free index.
 static std::unordered_map<VkCommandBuffer, CommandBufferPtr> global_commandbuffer_map_;
 static std::mutex global_commandbuffer_map_mutex_;
-
-static thread_local ThreadLocalCommandBufferCache thread_cb_cache_;
+static ConcurrentPointerMap<CommandBuffer> global_commandbuffer_index_(1024);
 
 void SetCommandBuffer(VkCommandBuffer vk_command_buffer, CommandBufferPtr command_buffer) {
     // We willingly allow to overwrite the existing key's value since Vulkan
     // command buffers can be reused.
     std::lock_guard<std::mutex> lock(global_commandbuffer_map_mutex_);
+    // Point the index at the new object before the old one is destroyed.
+    global_commandbuffer_index_.Insert(reinterpret_cast<uintptr_t>(vk_command_buffer), command_buffer.get());
     global_commandbuffer_map_[vk_command_buffer] = std::move(command_buffer);
 }
 
 crash_diagnostic_layer::CommandBuffer* GetCommandBuffer(VkCommandBuffer vk_command_buffer) {
-    if (thread_cb_cache_.vkcb == vk_command_buffer) {
-        return thread_cb_cache_.cdlcb;
-    }
-    std::lock_guard<std::mutex> lock(global_commandbuffer_map_mutex_);
-    auto it = global_commandbuffer_map_.find(vk_command_buffer);
-    if (global_commandbuffer_map_.end() == it) {
-        return nullptr;
-    }
-    thread_cb_cache_.vkcb = vk_command_buffer;
-    thread_cb_cache_.cdlcb = it->second.get();
-    return thread_cb_cache_.cdlcb;
+    return global_commandbuffer_index_.Find(reinterpret_cast<uintptr_t>(vk_command_buffer));
 }
 
 void DeleteCommandBuffer(VkCommandBuffer vk_command_buffer) {
-    if (thread_cb_cache_.vkcb == vk_command_buffer) {
-        thread_cb_cache_.vkcb = VK_NULL_HANDLE;
-    }
     std::lock_guard<std::mutex> lock(global_commandbuffer_map_mutex_);
+    global_commandbuffer_index_.Erase(reinterpret_cast<uintptr_t>(vk_command_buffer));
     global_commandbuffer_map_.erase(vk_command_buffer);
 }
 
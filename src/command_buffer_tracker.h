@@ -20,7 +20,7 @@
 #include <vulkan/vulkan.h>
 
 #include <algorithm>
-#include <thread>
+#include <memory>
 #include <unordered_map>
 
 namespace crash_diagnostic_layer {
@@ -28,12 +28,6 @@ namespace crash_diagnostic_layer {
 class CommandBuffer;
 using CommandBufferPtr = std::unique_ptr<CommandBuffer>;
 
-// Thread local cache
-struct ThreadLocalCommandBufferCache {
-    VkCommandBuffer vkcb = VK_NULL_HANDLE;
-    crash_diagnostic_layer::CommandBuffer *cdlcb = nullptr;
-};
-
 void SetCommandBuffer(VkCommandBuffer vk_command_buffer, CommandBufferPtr command_buffer);
 
 crash_diagnostic_layer::CommandBuffer *GetCommandBuffer(VkCommandBuffer vk_command_buffer);
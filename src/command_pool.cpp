@@ -17,42 +17,48 @@
 
 #include "command_pool.h"
 
-#include <algorithm>
 #include <cassert>
 
+#include "command.h"
+
 namespace crash_diagnostic_layer {
 
 CommandPool::CommandPool(VkCommandPool vk_command_pool, const VkCommandPoolCreateInfo* p_create_info)
     : vk_command_pool_(vk_command_pool), m_flags(p_create_info->flags) {}
 
 void CommandPool::AllocateCommandBuffers(const VkCommandBufferAllocateInfo* allocate_info,
-                                         const VkCommandBuffer* p_command_buffers) {
-    if (allocate_info->level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) {
-        primary_command_buffers_.insert(primary_command_buffers_.end(), p_command_buffers,
-                                        p_command_buffers + allocate_info->commandBufferCount);
-    } else {
-        secondary_command_buffers_.insert(secondary_command_buffers_.end(), p_command_buffers,
-                                          p_command_buffers + allocate_info->commandBufferCount);
+                                         CommandBuffer* const* p_command_buffers) {
+    auto& command_buffers = CommandBuffers(allocate_info->level);
+    command_buffers.reserve(command_buffers.size() + allocate_info->commandBufferCount);
+    slots_.reserve(slots_.size() + allocate_info->commandBufferCount);
+    for (uint32_t i = 0; i < allocate_info->commandBufferCount; ++i) {
+        VkCommandBuffer vk_command_buffer = p_command_buffers[i]->GetVkCommandBuffer();
+        assert(slots_.find(vk_command_buffer) == slots_.end());
+        slots_[vk_command_buffer] = Slot{allocate_info->level, static_cast<uint32_t>(command_buffers.size())};
+        command_buffers.push_back(p_command_buffers[i]);
     }
 }
 
 void CommandPool::FreeCommandBuffers(uint32_t command_buffer_count, const VkCommandBuffer* p_command_buffers) {
     for (uint32_t i = 0; i < command_buffer_count; ++i) {
-        auto primary =
-            std::find(primary_command_buffers_.begin(), primary_command_buffers_.end(), p_command_buffers[i]);
-        if (primary != primary_command_buffers_.end()) {
-            primary_command_buffers_.erase(primary);
-        } else {
-            auto secondary =
-                std::find(secondary_command_buffers_.begin(), secondary_command_buffers_.end(), p_command_buffers[i]);
-            if (secondary != secondary_command_buffers_.end()) {
-                secondary_command_buffers_.erase(secondary);
-            }
+        auto slot = slots_.find(p_command_buffers[i]);
+        if (slot == slots_.end()) {
+            continue;
+        }
+        auto& command_buffers = CommandBuffers(slot->second.level);
+        uint32_t index = slot->second.index;
+        // Move the last command buffer of this level into the freed slot.
+        CommandBuffer* last = command_buffers.back();
+        if (last->GetVkCommandBuffer() != p_command_buffers[i]) {
+            command_buffers[index] = last;
+            slots_[last->GetVkCommandBuffer()].index = index;
         }
+        command_buffers.pop_back();
+        slots_.erase(slot);
     }
 }
 
-const std::vector<VkCommandBuffer>& CommandPool::GetCommandBuffers(VkCommandBufferLevel level) const {
+const std::vector<CommandBuffer*>& CommandPool::GetCommandBuffers(VkCommandBufferLevel level) const {
     if (level == VK_COMMAND_BUFFER_LEVEL_PRIMARY) {
         return primary_command_buffers_;
     }
@@ -60,7 +66,14 @@ const std::vector<VkCommandBuffer>& CommandPool::GetCommandBuffers(VkCommandBuff
 }
 
 void CommandPool::Reset() {
-    // TODO reset all CBs
+    // Each command buffer keeps its checkpoint, Reset() only clears the marker
+    // values, and hands the recorder blocks back to the device block cache.
+    for (auto* command_buffer : primary_command_buffers_) {
+        command_buffer->Reset();
+    }
+    for (auto* command_buffer : secondary_command_buffers_) {
+        command_buffer->Reset();
+    }
 }
 
 }  // namespace crash_diagnostic_layer
@@ -20,38 +20,63 @@
 #include <vulkan/vulkan.h>
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace crash_diagnostic_layer {
 
+class CommandBuffer;
 class Device;
 
 // =================================================================================================
 // CommandPool
 // =================================================================================================
+//
+// The command buffers of a pool are kept in one dense vector per level, with a
+// map from handle to its slot. Freeing a command buffer moves the last entry
+// of its level into the freed slot, so allocate and free are O(1) per handle
+// and the vectors do not keep allocation order once buffers have been freed.
+//
+// The pool does not own the CommandBuffer objects, they stay in the global
+// command buffer map. Holding the pointers lets pool wide operations like
+// Reset() walk the command buffers without looking each handle up.
+//
 class CommandPool {
    public:
     CommandPool(VkCommandPool vk_command_pool, const VkCommandPoolCreateInfo* p_create_info);
 
     bool CanResetBuffer() const { return m_flags & VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; }
 
+    // Resets every command buffer of the pool in one pass.
     void Reset();
 
     void AllocateCommandBuffers(const VkCommandBufferAllocateInfo* allocate_info,
-                                const VkCommandBuffer* p_command_buffers);
+                                CommandBuffer* const* p_command_buffers);
     void FreeCommandBuffers(uint32_t command_buffer_count, const VkCommandBuffer* p_command_buffers);
 
     VkCommandPool GetCommandPool() const { return vk_command_pool_; }
 
-    const std::vector<VkCommandBuffer>& GetCommandBuffers(VkCommandBufferLevel level) const;
+    const std::vector<CommandBuffer*>& GetCommandBuffers(VkCommandBufferLevel level) const;
+
+    size_t Size() const { return slots_.size(); }
 
    private:
+    struct Slot {
+        VkCommandBufferLevel level;
+        uint32_t index;
+    };
+
+    std::vector<CommandBuffer*>& CommandBuffers(VkCommandBufferLevel level) {
+        return level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? primary_command_buffers_ : secondary_command_buffers_;
+    }
+
     VkCommandPool vk_command_pool_;
 
     VkCommandPoolCreateFlags m_flags;
 
-    std::vector<VkCommandBuffer> primary_command_buffers_;
-    std::vector<VkCommandBuffer> secondary_command_buffers_;
+    std::vector<CommandBuffer*> primary_command_buffers_;
+    std::vector<CommandBuffer*> secondary_command_buffers_;
+    std::unordered_map<VkCommandBuffer, Slot> slots_;
 };
 
 using CommandPoolPtr = std::unique_ptr<CommandPool>;
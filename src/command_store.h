@@ -0,0 +1,169 @@
+/*
+ Copyright 2023-2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "command_common.h"
+#include "linear_allocator.h"
+
+//
+// CommandStore is an append-only, structure-of-arrays container for the
+// commands recorded into a command buffer.
+//
+// Commands are stored in fixed size chunks, each chunk holding one column per
+// Command field. Each chunk is a single allocation from the store's
+// LinearAllocator, so a chunk's columns are contiguous and never move once
+// allocated. Appending never moves previously recorded commands and Clear()
+// keeps the allocator's blocks around for the next recording. Command ids are
+// not stored, a command's id is its index + 1.
+//
+// Accessors that return a Command build it from the columns on demand; scans
+// that only care about one field should use the per-column getters.
+//
+// Each chunk also has one bit per command flagging the commands that got a
+// checkpoint. Packed checkpoints only write command ends, so this is what
+// tells which command follows the last completed one.
+//
+class CommandStore {
+   public:
+    static constexpr uint32_t kCommandsPerChunk = 1024;
+
+    class Iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Command;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Command;
+
+        Iterator(const CommandStore& store, uint32_t index) : store_(&store), index_(index) {}
+
+        Command operator*() const { return store_->Get(index_); }
+        Iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator tmp = *this;
+            ++index_;
+            return tmp;
+        }
+        bool operator==(const Iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const Iterator& other) const { return index_ != other.index_; }
+
+       private:
+        const CommandStore* store_;
+        uint32_t index_;
+    };
+
+    void Append(Command::Type type, void* parameters, const CommandLabel* labels) {
+        uint32_t offset = size_ % kCommandsPerChunk;
+        if (offset == 0) {
+            Chunk* chunk = new (allocator_.Alloc(sizeof(Chunk))) Chunk;
+            std::fill(std::begin(chunk->instrumented), std::end(chunk->instrumented), 0);
+            chunks_.push_back(chunk);
+        }
+        Chunk* chunk = chunks_.back();
+        chunk->types[offset] = static_cast<uint16_t>(type);
+        chunk->parameters[offset] = parameters;
+        chunk->labels[offset] = labels;
+        ++size_;
+    }
+
+    // Forget all commands but keep the chunk memory for reuse.
+    void Clear() {
+        chunks_.clear();
+        allocator_.Reset();
+        size_ = 0;
+    }
+
+    uint32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // Id that will be given to the next appended command.
+    uint32_t NextId() const { return size_ + 1; }
+
+    Command::Type GetType(uint32_t index) const {
+        return static_cast<Command::Type>(chunks_[index / kCommandsPerChunk]->types[index % kCommandsPerChunk]);
+    }
+    void* GetParameters(uint32_t index) const {
+        return chunks_[index / kCommandsPerChunk]->parameters[index % kCommandsPerChunk];
+    }
+    const CommandLabel* GetLabels(uint32_t index) const {
+        return chunks_[index / kCommandsPerChunk]->labels[index % kCommandsPerChunk];
+    }
+
+    void SetInstrumented(uint32_t index) {
+        assert(index < size_);
+        uint32_t offset = index % kCommandsPerChunk;
+        chunks_[index / kCommandsPerChunk]->instrumented[offset / 64] |= uint64_t(1) << (offset % 64);
+    }
+    // Index of the first instrumented command at or after index, or size() if
+    // there is none.
+    uint32_t NextInstrumented(uint32_t index) const {
+        while (index < size_) {
+            uint32_t offset = index % kCommandsPerChunk;
+            uint64_t bits = chunks_[index / kCommandsPerChunk]->instrumented[offset / 64] >> (offset % 64);
+            if (bits == 0) {
+                // Nothing left in this word, move to the start of the next one.
+                index += 64 - offset % 64;
+                continue;
+            }
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                ++index;
+            }
+            return index;
+        }
+        return size_;
+    }
+
+    Command Get(uint32_t index) const {
+        assert(index < size_);
+        const Chunk* chunk = chunks_[index / kCommandsPerChunk];
+        uint32_t offset = index % kCommandsPerChunk;
+        Command cmd{};
+        cmd.type = static_cast<Command::Type>(chunk->types[offset]);
+        cmd.id = index + 1;
+        cmd.parameters = chunk->parameters[offset];
+        cmd.labels = chunk->labels[offset];
+        return cmd;
+    }
+    Command operator[](uint32_t index) const { return Get(index); }
+    Command back() const { return Get(size_ - 1); }
+
+    Iterator begin() const { return Iterator(*this, 0); }
+    Iterator end() const { return Iterator(*this, size_); }
+
+   private:
+    struct Chunk {
+        void* parameters[kCommandsPerChunk];
+        const CommandLabel* labels[kCommandsPerChunk];
+        uint16_t types[kCommandsPerChunk];
+        uint64_t instrumented[kCommandsPerChunk / 64];
+    };
+
+    uint32_t size_{0};
+    std::vector<Chunk*> chunks_;
+    LinearAllocator<sizeof(Chunk)> allocator_;
+};
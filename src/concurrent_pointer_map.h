@@ -0,0 +1,229 @@
+/*
+ Copyright 2023-2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace crash_diagnostic_layer {
+
+//
+// ConcurrentPointerMap is a read-mostly hash map from handle-like keys to
+// non-owning pointers.
+//
+// Find() is lock free. It probes an open addressing table that is published
+// through an atomic pointer. Insert() and Erase() are serialized by a mutex.
+// Erased slots become tombstones, which later inserts reuse. When used slots
+// reach half the capacity, the writer builds a compacted or larger copy of
+// the table and publishes it.
+//
+// A replaced table is retired, not freed, because readers may still be
+// probing it. Each reader counts itself in one of a few cache line sized
+// stripes while it probes. Writers free the retired tables once every stripe
+// reads zero. A reader that arrives after that check can only load the new
+// table.
+//
+// Keys 0 and 1 are reserved, they are never valid handles or dispatch keys.
+// Key defaults to uintptr_t for pointers and dispatchable handles; use
+// uint64_t for non-dispatchable handles, which are 64 bits on every platform.
+//
+template <typename T, typename Key = uintptr_t>
+class ConcurrentPointerMap {
+   public:
+    explicit ConcurrentPointerMap(size_t initial_capacity = 64) : initial_capacity_(initial_capacity) {
+        assert(initial_capacity_ > 0 && 0 == (initial_capacity_ & (initial_capacity_ - 1)));
+        live_table_ = std::make_unique<Table>(initial_capacity_);
+        table_.store(live_table_.get());
+    }
+    ConcurrentPointerMap(const ConcurrentPointerMap&) = delete;
+    ConcurrentPointerMap& operator=(const ConcurrentPointerMap&) = delete;
+
+    T* Find(Key key) const {
+        auto& readers = reader_stripes_[ReaderStripeIndex()].count;
+        readers.fetch_add(1);
+        const Table* table = table_.load();
+        T* value = nullptr;
+        const size_t mask = table->capacity - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Key slot_key = table->slots[i].key.load(std::memory_order_acquire);
+            if (slot_key == key) {
+                value = table->slots[i].value.load(std::memory_order_acquire);
+                break;
+            }
+            if (slot_key == kEmpty) {
+                break;
+            }
+        }
+        readers.fetch_sub(1, std::memory_order_release);
+        return value;
+    }
+
+    // Inserts the key or replaces the value of an existing key.
+    void Insert(Key key, T* value) {
+        assert(key != kEmpty && key != kTombstone);
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        ReclaimRetiredTables();
+        Slot* slot = FindSlot(*live_table_, key);
+        if (slot) {
+            slot->value.store(value, std::memory_order_release);
+            return;
+        }
+        slot = FindFreeSlot(*live_table_, key);
+        if (slot->key.load(std::memory_order_relaxed) == kTombstone) {
+            --tombstones_;
+        } else if ((size_ + tombstones_ + 1) * 2 > live_table_->capacity) {
+            Rebuild(size_ + 1);
+            slot = FindFreeSlot(*live_table_, key);
+        }
+        // Publish the value before the key so a reader that sees the key sees the value.
+        slot->value.store(value, std::memory_order_release);
+        slot->key.store(key, std::memory_order_release);
+        ++size_;
+    }
+
+    void Erase(Key key) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        ReclaimRetiredTables();
+        Slot* slot = FindSlot(*live_table_, key);
+        if (!slot) {
+            return;
+        }
+        slot->value.store(nullptr, std::memory_order_release);
+        slot->key.store(kTombstone, std::memory_order_release);
+        --size_;
+        ++tombstones_;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        return size_;
+    }
+
+   private:
+    static constexpr Key kEmpty = 0;
+    static constexpr Key kTombstone = 1;
+    static constexpr size_t kReaderStripes = 16;
+
+    struct Slot {
+        std::atomic<Key> key{kEmpty};
+        std::atomic<T*> value{nullptr};
+    };
+
+    struct Table {
+        explicit Table(size_t capacity_) : capacity(capacity_), slots(new Slot[capacity_]) {}
+        const size_t capacity;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    struct alignas(64) ReaderStripe {
+        std::atomic<uint32_t> count{0};
+    };
+
+    static size_t ReaderStripeIndex() {
+        static std::atomic<size_t> next_index{0};
+        static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed) % kReaderStripes;
+        return index;
+    }
+
+    static size_t Hash(Key key) {
+        // Handles are pointers or aligned values, mix the bits so the low ones are useful.
+        uint64_t h = static_cast<uint64_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    // Returns the slot holding key, or nullptr.
+    static Slot* FindSlot(Table& table, Key key) {
+        const size_t mask = table.capacity - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Key slot_key = table.slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == key) {
+                return &table.slots[i];
+            }
+            if (slot_key == kEmpty) {
+                return nullptr;
+            }
+        }
+    }
+
+    // Returns the first empty or tombstone slot on key's probe sequence.
+    static Slot* FindFreeSlot(Table& table, Key key) {
+        const size_t mask = table.capacity - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Key slot_key = table.slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == kEmpty || slot_key == kTombstone) {
+                return &table.slots[i];
+            }
+        }
+    }
+
+    // Copies the live entries into a new table with room for min_size entries
+    // at a quarter load and publishes it. Must be called with writer_mutex_ held.
+    void Rebuild(size_t min_size) {
+        size_t capacity = initial_capacity_;
+        while (capacity < min_size * 4) {
+            capacity *= 2;
+        }
+        auto new_table = std::make_unique<Table>(capacity);
+        for (size_t i = 0; i < live_table_->capacity; ++i) {
+            Key key = live_table_->slots[i].key.load(std::memory_order_relaxed);
+            if (key == kEmpty || key == kTombstone) {
+                continue;
+            }
+            Slot* slot = FindFreeSlot(*new_table, key);
+            slot->value.store(live_table_->slots[i].value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            slot->key.store(key, std::memory_order_relaxed);
+        }
+        tombstones_ = 0;
+        table_.store(new_table.get());
+        retired_tables_.push_back(std::move(live_table_));
+        live_table_ = std::move(new_table);
+    }
+
+    // Frees the retired tables if no reader can still be probing them. Must be
+    // called with writer_mutex_ held.
+    void ReclaimRetiredTables() {
+        if (retired_tables_.empty()) {
+            return;
+        }
+        for (const auto& stripe : reader_stripes_) {
+            if (stripe.count.load() != 0) {
+                return;
+            }
+        }
+        retired_tables_.clear();
+    }
+
+    const size_t initial_capacity_;
+    std::atomic<Table*> table_{nullptr};
+    mutable ReaderStripe reader_stripes_[kReaderStripes];
+
+    mutable std::mutex writer_mutex_;
+    std::unique_ptr<Table> live_table_;
+    std::vector<std::unique_ptr<Table>> retired_tables_;
+    size_t size_{0};
+    size_t tombstones_{0};
+};
+
+}  // namespace crash_diagnostic_layer
@@ -28,9 +28,9 @@ namespace YAML {
 class Emitter;
 }  // namespace YAML
 
-namespace crash_diagnostic_layer {
+class ObjectInfoSnapshot;
 
-class Device;
+namespace crash_diagnostic_layer {
 
 // =============================================================================
 // ActiveDescriptorSets
@@ -42,7 +42,7 @@ class ActiveDescriptorSets {
     void Reset();
     void Bind(uint32_t first_set, uint32_t set_count, const VkDescriptorSet* sets);
 
-    YAML::Emitter& Print(Device& device, YAML::Emitter& stream) const;
+    DumpEmitter& Print(const ObjectInfoSnapshot& names, DumpEmitter& stream) const;
 
    private:
     void Insert(VkDescriptorSet set, uint32_t index);
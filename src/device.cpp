@@ -18,6 +18,7 @@
 #include "device.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cinttypes>
 #include <fstream>
 #include <iomanip>
@@ -36,7 +37,8 @@ Device::Device(Context& context, VkPhysicalDevice vk_gpu, VkDevice device, Devic
       vk_physical_device_(vk_gpu),
       vk_device_(device),
       extensions_present_(extensions_present),
-      device_create_info_(std::move(device_create_info)) {
+      device_create_info_(std::move(device_create_info)),
+      command_block_cache_(std::make_shared<LinearAllocatorBlockCache>(LinearAllocator<>::GetDefaultBlockSize())) {
     auto device_layer_data = GetDeviceLayerData(DataKey(device));
     device_dispatch_table_ = device_layer_data->dispatch_table;
 
@@ -49,14 +51,24 @@ Device::Device(Context& context, VkPhysicalDevice vk_gpu, VkDevice device, Devic
         context_.Dispatch().GetPhysicalDeviceQueueFamilyProperties(vk_physical_device_, &count,
                                                                    queue_family_properties_.data());
     }
+    // Checkpoints and the semaphore tracker share one marker manager, so the
+    // device has a single marker heap and at most one refill thread.
+    const bool buffer_marker_checkpoints =
+        !extensions_present_.nv_device_diagnostic_checkpoints && extensions_present_.amd_buffer_marker;
+    if (buffer_marker_checkpoints || context_.GetSettings().track_semaphores) {
+        markers_ = std::make_unique<BufferMarkerMgr>(*this);
+    }
     if (extensions_present_.nv_device_diagnostic_checkpoints) {
         checkpoints_ = std::make_unique<DiagnosticCheckpointMgr>(*this);
-    } else if (extensions_present_.amd_buffer_marker) {
-        checkpoints_ = std::make_unique<BufferMarkerCheckpointMgr>(*this);
+    } else if (buffer_marker_checkpoints) {
+        checkpoints_ = std::make_unique<BufferMarkerCheckpointMgr>(*markers_);
     }
     // Create a semaphore tracker
     if (context_.GetSettings().track_semaphores) {
-        semaphore_tracker_ = std::make_unique<SemaphoreTracker>(*this);
+        semaphore_tracker_ = std::make_unique<SemaphoreTracker>(*this, *markers_);
+    }
+    if (context_.GetSettings().progress_sample_ms > 0) {
+        progress_history_ = std::make_unique<ProgressHistory>();
     }
 }
 
@@ -86,31 +98,26 @@ void Device::FreeCommandBuffers(VkCommandPool command_pool, uint32_t command_buf
     Dispatch().FreeCommandBuffers(vk_device_, command_pool, command_buffer_count, command_buffers);
 }
 
-void Device::AddCommandBuffer(VkCommandBuffer vk_command_buffer) {
-    std::lock_guard<std::recursive_mutex> lock(command_buffers_mutex_);
-    assert(std::find(command_buffers_.begin(), command_buffers_.end(), vk_command_buffer) == command_buffers_.end());
-    command_buffers_.push_back(vk_command_buffer);
-}
-
-void Device::DumpCommandBuffers(YAML::Emitter& os) const {
+void Device::DumpCommandBuffers(DumpEmitter& os, const ObjectInfoSnapshot& names) const {
     auto dump_cbs = context_.GetSettings().dump_command_buffers;
     // Sort command buffers by submit info id
     std::map<uint64_t /* queue seq */, std::vector<CommandBuffer*>> sorted_command_buffers;
-    std::lock_guard<std::recursive_mutex> lock(command_buffers_mutex_);
-    for (auto cb : command_buffers_) {
-        auto p_cmd = GetCommandBuffer(cb);
-        if (p_cmd && p_cmd->IsPrimaryCommandBuffer()) {
+    std::lock_guard<std::mutex> lock(command_pools_mutex_);
+    for (const auto& pool : command_pools_) {
+        for (auto p_cmd : pool.second->GetCommandBuffers(VK_COMMAND_BUFFER_LEVEL_PRIMARY)) {
             bool dump_this_cb = false;
             switch (dump_cbs) {
                 case DumpCommands::kAll:
                     dump_this_cb = true;
                     break;
                 case DumpCommands::kRunning:
-                    dump_this_cb = p_cmd->GetCommandBufferState() == CommandBufferState::kSubmittedExecutionIncomplete;
+                    dump_this_cb =
+                        p_cmd->GetCommandBufferState() == CommandBufferState::kSubmittedExecutionIncomplete;
                     break;
                 case DumpCommands::kPending:
-                    dump_this_cb = p_cmd->WasSubmittedToQueue() &&
-                                   p_cmd->GetCommandBufferState() != CommandBufferState::kSubmittedExecutionNotStarted;
+                    dump_this_cb =
+                        p_cmd->WasSubmittedToQueue() &&
+                        p_cmd->GetCommandBufferState() != CommandBufferState::kSubmittedExecutionNotStarted;
                     break;
             }
             if (dump_this_cb) {
@@ -118,12 +125,14 @@ void Device::DumpCommandBuffers(YAML::Emitter& os) const {
             }
         }
     }
-    os << YAML::Key << "CommandBuffers" << YAML::Value << YAML::BeginSeq;
+    std::vector<CommandBuffer*> command_buffers;
     for (auto& it : sorted_command_buffers) {
-        for (auto p_cmd : it.second) {
-            p_cmd->DumpContents(os, context_.GetSettings());
-        }
+        command_buffers.insert(command_buffers.end(), it.second.begin(), it.second.end());
     }
+    os << YAML::Key << "CommandBuffers" << YAML::Value << YAML::BeginSeq;
+    os.WriteEntries(command_buffers.size(), [&](size_t index, DumpEmitter& entry_os) {
+        command_buffers[index]->DumpContents(entry_os, context_.GetSettings(), names);
+    });
     os << YAML::EndSeq;
     assert(os.good());
 }
@@ -144,26 +153,24 @@ CommandPool* Device::GetCommandPool(VkCommandPool vk_command_pool) {
 
 void Device::AllocateCommandBuffers(VkCommandPool vk_pool, const VkCommandBufferAllocateInfo* allocate_info,
                                     VkCommandBuffer* command_buffers) {
-    {
-        std::lock_guard<std::mutex> lock(command_pools_mutex_);
-        assert(command_pools_.find(vk_pool) != command_pools_.end());
-        command_pools_[vk_pool]->AllocateCommandBuffers(allocate_info, command_buffers);
-    }
-    // TODO locking here?
     // create command buffers tracking data
+    std::vector<CommandBuffer*> p_cmds;
+    p_cmds.reserve(allocate_info->commandBufferCount);
     for (uint32_t i = 0; i < allocate_info->commandBufferCount; ++i) {
         VkCommandBuffer vk_cmd = command_buffers[i];
 
         auto cmd = std::make_unique<CommandBuffer>(*this, vk_pool, vk_cmd, allocate_info, HasCheckpoints());
-        cmd->SetInstrumentAllCommands(context_.GetSettings().instrument_all_commands);
+        p_cmds.push_back(cmd.get());
 
         SetCommandBuffer(vk_cmd, std::move(cmd));
-        AddCommandBuffer(vk_cmd);
     }
+    std::lock_guard<std::mutex> lock(command_pools_mutex_);
+    assert(command_pools_.find(vk_pool) != command_pools_.end());
+    command_pools_[vk_pool]->AllocateCommandBuffers(allocate_info, p_cmds.data());
 }
 
 // Write out information about an invalid command buffer reset.
-void Device::DumpCommandBufferStateOnScreen(CommandBuffer* p_cmd, YAML::Emitter& os) const {
+void Device::DumpCommandBufferStateOnScreen(CommandBuffer* p_cmd, DumpEmitter& os) {
     Log().Error("Invalid Command Buffer Usage: Reset of VkCommandBuffer in use by GPU: %s",
                 GetObjectName((uint64_t)p_cmd->GetVkCommandBuffer()).c_str());
     auto submitted_fence = p_cmd->GetSubmittedFence();
@@ -183,15 +190,16 @@ void Device::DumpCommandBufferStateOnScreen(CommandBuffer* p_cmd, YAML::Emitter&
     // We do this because this is a race between the GPU and the logging and
     // often the logger will show the command buffer as completed where as
     // if we write a single command buffer it's less likely the GPU has completed.
-    YAML::Emitter error_report;
+    DumpEmitter error_report;
+    auto names = object_info_db_.Snapshot();
     error_report << YAML::BeginMap << YAML::Key << "InvalidCommandBuffer" << YAML::Value;
-    p_cmd->DumpContents(error_report, context_.GetSettings());
+    p_cmd->DumpContents(error_report, context_.GetSettings(), names);
     error_report << YAML::EndMap;
     Log().Error(error_report.c_str());
     os << error_report.c_str();
 }
 
-bool Device::ValidateCommandBufferNotInUse(CommandBuffer* p_cmd, YAML::Emitter& os) {
+bool Device::ValidateCommandBufferNotInUse(CommandBuffer* p_cmd, DumpEmitter& os) {
     assert(p_cmd);
     if (!HangDetected()) {
         if (p_cmd->HasCheckpoints() && p_cmd->WasSubmittedToQueue() && !p_cmd->CompletedExecution()) {
@@ -202,7 +210,7 @@ bool Device::ValidateCommandBufferNotInUse(CommandBuffer* p_cmd, YAML::Emitter&
     return true;
 }
 
-bool Device::ValidateCommandBufferNotInUse(VkCommandBuffer vk_command_buffer, YAML::Emitter& os) {
+bool Device::ValidateCommandBufferNotInUse(VkCommandBuffer vk_command_buffer, DumpEmitter& os) {
     auto p_cmd = GetCommandBuffer(vk_command_buffer);
     assert(p_cmd != nullptr);
     if (p_cmd != nullptr) {
@@ -213,64 +221,49 @@ bool Device::ValidateCommandBufferNotInUse(VkCommandBuffer vk_command_buffer, YA
     return true;
 }
 
-void Device::ValidateCommandPoolState(VkCommandPool vk_command_pool, YAML::Emitter& os) {
+void Device::ValidateCommandPoolState(VkCommandPool vk_command_pool, DumpEmitter& os) {
     std::lock_guard<std::mutex> lock(command_pools_mutex_);
     assert(command_pools_.find(vk_command_pool) != command_pools_.end());
     // Only validate primary command buffers. If a secondary command buffer is
     // hung, CDL catches the primary command buffer that the hung cb was recorded
     // to.
-    auto command_buffers = command_pools_[vk_command_pool]->GetCommandBuffers(VK_COMMAND_BUFFER_LEVEL_PRIMARY);
-    for (auto vk_cmd : command_buffers) {
-        auto p_cmd = GetCommandBuffer(vk_cmd);
-        if (p_cmd != nullptr) {
-            ValidateCommandBufferNotInUse(p_cmd, os);
-        }
+    for (auto p_cmd : command_pools_[vk_command_pool]->GetCommandBuffers(VK_COMMAND_BUFFER_LEVEL_PRIMARY)) {
+        ValidateCommandBufferNotInUse(p_cmd, os);
     }
 }
 
 void Device::ResetCommandPool(VkCommandPool vk_command_pool) {
     std::lock_guard<std::mutex> lock(command_pools_mutex_);
     assert(command_pools_.find(vk_command_pool) != command_pools_.end());
-    std::vector<VkCommandBufferLevel> cb_levels{VK_COMMAND_BUFFER_LEVEL_PRIMARY, VK_COMMAND_BUFFER_LEVEL_SECONDARY};
-    for (auto cb_level : cb_levels) {
-        auto command_buffers = command_pools_[vk_command_pool]->GetCommandBuffers(cb_level);
-        for (auto vk_cmd : command_buffers) {
-            auto p_cmd = GetCommandBuffer(vk_cmd);
-            if (p_cmd != nullptr) {
-                p_cmd->Reset();
-            }
-        }
-    }
+    command_pools_[vk_command_pool]->Reset();
+    // A pool reset is usually a frame boundary, drop blocks the last frame did not need.
+    command_block_cache_->Trim();
 }
 
 void Device::DeleteCommandPool(VkCommandPool vk_command_pool) {
     std::lock_guard<std::mutex> lock(command_pools_mutex_);
-    std::lock_guard<std::recursive_mutex> lock_commands(command_buffers_mutex_);
-    assert(command_pools_.find(vk_command_pool) != command_pools_.end());
+    auto pool = command_pools_.find(vk_command_pool);
+    assert(pool != command_pools_.end());
     std::vector<VkCommandBufferLevel> cb_levels{VK_COMMAND_BUFFER_LEVEL_PRIMARY, VK_COMMAND_BUFFER_LEVEL_SECONDARY};
     for (auto cb_level : cb_levels) {
-        auto command_buffers = command_pools_[vk_command_pool]->GetCommandBuffers(cb_level);
-        for (auto vk_cmd : command_buffers) {
-            auto p_cmd = GetCommandBuffer(vk_cmd);
-            if (p_cmd != nullptr) {
-                command_buffers_.erase(std::remove(command_buffers_.begin(), command_buffers_.end(), vk_cmd),
-                                       command_buffers_.end());
-                DeleteCommandBuffer(vk_cmd);
-            }
+        for (auto p_cmd : pool->second->GetCommandBuffers(cb_level)) {
+            RemoveObjectInfo((uint64_t)p_cmd->GetVkCommandBuffer());
+            DeleteCommandBuffer(p_cmd->GetVkCommandBuffer());
         }
     }
-    command_pools_.erase(vk_command_pool);
+    command_pools_.erase(pool);
+    RemoveObjectInfo((uint64_t)vk_command_pool);
+    command_block_cache_->Trim();
 }
 
 void Device::DeleteCommandBuffers(VkCommandPool vk_pool, const VkCommandBuffer* vk_cmds, uint32_t cb_count) {
-    GetCommandPool(vk_pool)->FreeCommandBuffers(cb_count, vk_cmds);
-    {
-        std::lock_guard<std::recursive_mutex> lock(command_buffers_mutex_);
-        for (uint32_t i = 0; i < cb_count; ++i) {
-            command_buffers_.erase(std::remove(command_buffers_.begin(), command_buffers_.end(), vk_cmds[i]),
-                                   command_buffers_.end());
-            DeleteCommandBuffer(vk_cmds[i]);
-        }
+    std::lock_guard<std::mutex> lock(command_pools_mutex_);
+    auto pool = command_pools_.find(vk_pool);
+    assert(pool != command_pools_.end());
+    pool->second->FreeCommandBuffers(cb_count, vk_cmds);
+    for (uint32_t i = 0; i < cb_count; ++i) {
+        RemoveObjectInfo((uint64_t)vk_cmds[i]);
+        DeleteCommandBuffer(vk_cmds[i]);
     }
 }
 
@@ -325,8 +318,11 @@ void Device::DumpShaderFromPipeline(VkPipeline pipeline) const {
 }
 
 void Device::DeletePipeline(VkPipeline pipeline) {
-    std::lock_guard<std::mutex> lock(pipelines_mutex_);
-    pipelines_.erase(pipeline);
+    {
+        std::lock_guard<std::mutex> lock(pipelines_mutex_);
+        pipelines_.erase(pipeline);
+    }
+    RemoveObjectInfo((uint64_t)pipeline);
 }
 
 void Device::CreateShaderModule(const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModule* pShaderModule,
@@ -358,8 +354,11 @@ const ShaderModule* Device::FindShaderModule(VkShaderModule shader_module) const
 }
 
 void Device::DeleteShaderModule(VkShaderModule shaderModule) {
-    std::lock_guard<std::mutex> lock(shader_modules_mutex_);
-    shader_modules_.erase(shaderModule);
+    {
+        std::lock_guard<std::mutex> lock(shader_modules_mutex_);
+        shader_modules_.erase(shaderModule);
+    }
+    RemoveObjectInfo((uint64_t)shaderModule);
 }
 
 void Device::RegisterQueue(VkQueue vk_queue, uint32_t queueFamilyIndex, uint32_t queueIndex) {
@@ -415,6 +414,8 @@ void Device::AddObjectInfo(uint64_t handle, VkObjectType type, const char* name)
 
 void Device::AddExtraInfo(uint64_t handle, ExtraObjectInfo info) { return object_info_db_.AddExtraInfo(handle, info); }
 
+void Device::RemoveObjectInfo(uint64_t handle) { object_info_db_.RemoveObjectInfo(handle); }
+
 std::string Device::GetObjectName(uint64_t handle, HandleDebugNamePreference handle_debug_name_preference) const {
     return object_info_db_.GetObjectName(handle, handle_debug_name_preference);
 }
@@ -431,6 +432,43 @@ bool Device::UpdateIdleState() {
     return result;
 }
 
+void Device::SampleProgress(int64_t time_ms) {
+    if (!progress_history_ || hang_detected_) {
+        return;
+    }
+    auto queues = GetAllQueues();
+    for (auto& q : queues) {
+        ProgressSample sample;
+        sample.time_ms = time_ms;
+        if (q->SampleProgress(sample)) {
+            progress_history_->Push(sample);
+        }
+    }
+}
+
+void Device::DumpProgressHistory(DumpEmitter& os, const ObjectInfoSnapshot& names) const {
+    if (!progress_history_) {
+        return;
+    }
+    using namespace std::chrono;
+    int64_t now_ms = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    os << YAML::Key << "ProgressHistory" << YAML::Value << YAML::BeginSeq;
+    for (const auto& sample : progress_history_->Read()) {
+        os << YAML::BeginMap;
+        os << YAML::Key << "queue" << YAML::Value;
+        names.PrintObjectInfo(os, (uint64_t)sample.queue);
+        os << YAML::Key << "msBeforeDump" << YAML::Value << (now_ms - sample.time_ms);
+        os << YAML::Key << "completedSeq" << YAML::Value << sample.completed_seq;
+        os << YAML::Key << "submittedSeq" << YAML::Value << sample.submitted_seq;
+        if (sample.has_checkpoint) {
+            os << YAML::Key << "topCheckpointValue" << YAML::Value << Uint32ToStr(sample.top_checkpoint);
+            os << YAML::Key << "bottomCheckpointValue" << YAML::Value << Uint32ToStr(sample.bottom_checkpoint);
+        }
+        os << YAML::EndMap;
+    }
+    os << YAML::EndSeq;
+}
+
 void Device::DeviceFault() {
     if (hang_detected_.exchange(true)) {
         // already hung.
@@ -444,7 +482,7 @@ void Device::DeviceFault() {
     context_.StopWatchdogTimer();
 }
 
-void Device::WatchdogTimeout(bool dump_prologue, YAML::Emitter& os) {
+void Device::WatchdogTimeout(DumpEmitter& os) {
     if (hang_detected_.exchange(true)) {
         // already hung.
         return;
@@ -452,13 +490,17 @@ void Device::WatchdogTimeout(bool dump_prologue, YAML::Emitter& os) {
     if (checkpoints_) {
         checkpoints_->Update();
     }
-    context_.DumpDeviceExecutionState(*this, dump_prologue, CrashSource::kWatchdogTimer, os);
+    context_.DumpDeviceExecutionState(*this, false, CrashSource::kWatchdogTimer, os);
 }
 
-YAML::Emitter& Device::Print(YAML::Emitter& os, const std::string& error_report) {
+DumpEmitter& Device::Print(DumpEmitter& os, const std::string& error_report) {
     UpdateIdleState();
+    // Resolve every handle in the dump against one copy of the object names,
+    // so printing neither takes the name database locks nor allocates per handle.
+    auto names = object_info_db_.Snapshot();
     os << YAML::Key << "Device" << YAML::Value << YAML::BeginMap;
-    os << YAML::Key << "handle" << YAML::Value << GetObjectInfo((uint64_t)vk_device_);
+    os << YAML::Key << "handle" << YAML::Value;
+    names.PrintObjectInfo(os, (uint64_t)vk_device_);
     os << YAML::Key << "deviceName" << YAML::Value << physical_device_properties_.deviceName;
 
     auto majorVersion = VK_VERSION_MAJOR(physical_device_properties_.apiVersion);
@@ -475,6 +517,7 @@ YAML::Emitter& Device::Print(YAML::Emitter& os, const std::string& error_report)
     os << YAML::Key << "driverVersion" << YAML::Value << icd.str();
     os << YAML::Key << "vendorID" << YAML::Value << Uint32ToStr(physical_device_properties_.vendorID);
     os << YAML::Key << "deviceID" << YAML::Value << Uint32ToStr(physical_device_properties_.deviceID);
+    os << YAML::Key << "namedObjects" << YAML::Value << names.Size();
 
     os << YAML::Key << "extensions" << YAML::Value << YAML::BeginSeq;
     const auto& create_info = device_create_info_->original;
@@ -488,17 +531,18 @@ YAML::Emitter& Device::Print(YAML::Emitter& os, const std::string& error_report)
     os << YAML::Key << "Queues" << YAML::BeginSeq;
     auto queues = GetAllQueues();
     for (auto& q : queues) {
-        q->Print(os);
+        q->Print(os, names);
     }
     os << YAML::EndSeq;
 
     if (semaphore_tracker_) {
-        semaphore_tracker_->DumpWaitingThreads(os);
+        semaphore_tracker_->DumpWaitingThreads(os, names);
     }
+    DumpProgressHistory(os, names);
     if (!error_report.empty()) {
         os << error_report;
     }
-    DumpCommandBuffers(os);
+    DumpCommandBuffers(os, names);
     os << YAML::EndMap;  // Device
     assert(os.good());
     return os;
@@ -514,8 +558,9 @@ static const char address_fault_strings[][32] = {
     "Instruction Pointer Fault",
 };
 
-static void DumpAddressRecord(YAML::Emitter& os, const vku::sparse::range<VkDeviceAddress>& range,
-                              const DeviceAddressRecord& rec) {
+static void DumpAddressRecord(DumpEmitter& os, const vku::sparse::range<VkDeviceAddress>& range,
+                              const DeviceAddressRecord& rec,
+                              std::chrono::time_point<std::chrono::high_resolution_clock> now) {
     os << YAML::BeginMap;
     os << YAML::Key << "begin" << YAML::Value << Uint64ToStr(range.begin);
     os << YAML::Key << "end" << YAML::Value << Uint64ToStr(range.end);
@@ -524,11 +569,12 @@ static void DumpAddressRecord(YAML::Emitter& os, const vku::sparse::range<VkDevi
     handle << Uint64ToStr(rec.object_handle) << "[" << rec.object_name << "]";
     os << YAML::Key << "handle" << YAML::Value << handle.str();
     os << YAML::Key << "currentlyBound" << YAML::Value << (rec.binding_type == VK_DEVICE_ADDRESS_BINDING_TYPE_BIND_EXT);
-    // TODO when
+    os << YAML::Key << "msBeforeDump" << YAML::Value
+       << std::chrono::duration_cast<std::chrono::milliseconds>(now - rec.when).count();
     os << YAML::EndMap;
 }
 
-void Device::DumpDeviceFaultInfo(YAML::Emitter& os) const {
+void Device::DumpDeviceFaultInfo(DumpEmitter& os) const {
     if (!extensions_present_.ext_device_fault) {
         return;
     }
@@ -561,6 +607,16 @@ void Device::DumpDeviceFaultInfo(YAML::Emitter& os) const {
         return;
     }
 
+    // Bind events keep arriving while we dump, work on a copy.
+    auto now = std::chrono::high_resolution_clock::now();
+    vku::sparse::range_map<VkDeviceAddress, DeviceAddressRecord> address_map;
+    std::deque<DeviceAddressRecord> unbound_history;
+    {
+        std::lock_guard<std::mutex> lock(address_mutex_);
+        address_map = address_map_;
+        unbound_history = unbound_history_;
+    }
+
     os << YAML::Key << "DeviceFaultInfo" << YAML::Value << YAML::BeginMap;
     os << YAML::Key << "description" << YAML::Value << fault_info.description;
     if (fault_counts.addressInfoCount > 0) {
@@ -576,23 +632,39 @@ void Device::DumpDeviceFaultInfo(YAML::Emitter& os) const {
             os << YAML::Key << "begin" << YAML::Value << Uint64ToStr(range.begin);
             os << YAML::Key << "end" << YAML::Value << Uint64ToStr(range.end);
 
-            auto lower = address_map_.lower_bound(range);
-            auto upper = address_map_.upper_bound(range);
+            auto lower = address_map.lower_bound(range);
+            auto upper = address_map.upper_bound(range);
             if (lower != upper) {
                 os << YAML::Key << "matchingAddressRecords" << YAML::Value << YAML::BeginSeq;
                 for (auto iter = lower; iter != upper; ++iter) {
-                    DumpAddressRecord(os, iter->first, iter->second);
+                    DumpAddressRecord(os, iter->first, iter->second, now);
                 }
                 os << YAML::EndSeq;
             }
-            if (lower != address_map_.begin()) {
+            if (lower != address_map.begin()) {
                 --lower;
                 os << YAML::Key << "priorAddressRecord" << YAML::Value;
-                DumpAddressRecord(os, lower->first, lower->second);
+                DumpAddressRecord(os, lower->first, lower->second, now);
             }
-            if (upper != address_map_.end()) {
+            if (upper != address_map.end()) {
                 os << YAML::Key << "nextAddressRecord" << YAML::Value;
-                DumpAddressRecord(os, upper->first, upper->second);
+                DumpAddressRecord(os, upper->first, upper->second, now);
+            }
+            // Ranges that were unbound recently, newest first.
+            bool unbound_found = false;
+            for (auto iter = unbound_history.rbegin(); iter != unbound_history.rend(); ++iter) {
+                vku::sparse::range<VkDeviceAddress> unbound_range(iter->base, iter->base + iter->size);
+                if (unbound_range.begin >= range.end || unbound_range.end <= range.begin) {
+                    continue;
+                }
+                if (!unbound_found) {
+                    os << YAML::Key << "unboundAddressRecords" << YAML::Value << YAML::BeginSeq;
+                    unbound_found = true;
+                }
+                DumpAddressRecord(os, unbound_range, *iter, now);
+            }
+            if (unbound_found) {
+                os << YAML::EndSeq;
             }
             os << YAML::EndMap;
         }
@@ -622,19 +694,38 @@ void Device::DumpDeviceFaultInfo(YAML::Emitter& os) const {
     assert(os.good());
 }
 
-void Device::MemoryBindEvent(const DeviceAddressRecord& rec, bool multi_device) {
-    // Because log callbacks are instance level, we'll get a stream of events
-    // for all devices in the system. Th.secondis code assumes there's only one.
-    // If there are multiple devices, each will need to filter events by looking
-    // up the vulkan handle. This will be slow.
-    assert(!multi_device);
-
+// Bind events are routed here by Context::MemoryBindEvent(), which looks up the
+// device that owns the reported object.
+void Device::MemoryBindEvent(const DeviceAddressRecord& rec) {
     vku::sparse::range<VkDeviceAddress> range(rec.base, rec.base + rec.size);
+    std::lock_guard<std::mutex> lock(address_mutex_);
     address_map_.overwrite_range(std::make_pair(range, rec));
+    if (rec.binding_type == VK_DEVICE_ADDRESS_BINDING_TYPE_UNBIND_EXT) {
+        if (unbound_history_.size() == kMaxUnboundHistory) {
+            unbound_history_.pop_front();
+        }
+        unbound_history_.push_back(rec);
+    }
 }
 
-std::unique_ptr<Checkpoint> Device::AllocateCheckpoint(uint32_t initial_value) {
-    return checkpoints_ ? checkpoints_->Allocate(initial_value) : nullptr;
+bool Device::HasAddressBindingReport() const { return extensions_present_.ext_device_address_binding_report; }
+
+void Device::AddBoundObject(uint64_t handle) {
+    if (handle && HasAddressBindingReport()) {
+        bound_objects_.Insert(handle, this);
+    }
+}
+
+void Device::RemoveBoundObject(uint64_t handle) {
+    if (handle && HasAddressBindingReport()) {
+        bound_objects_.Erase(handle);
+    }
+}
+
+bool Device::IsBoundObject(uint64_t handle) const { return handle && bound_objects_.Find(handle) != nullptr; }
+
+bool Device::AllocateCheckpoint(Checkpoint& checkpoint, uint32_t initial_value) {
+    return checkpoints_ && checkpoints_->Allocate(checkpoint, initial_value);
 }
 
 }  // namespace crash_diagnostic_layer
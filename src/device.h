@@ -20,18 +20,22 @@
 #include <vulkan/vulkan.h>
 
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
-#include <yaml-cpp/emitter.h>
 
 #include "command.h"
 #include "command_pool.h"
+#include "concurrent_pointer_map.h"
+#include "dump_emitter.h"
 #include "layer_base.h"
+#include "linear_allocator.h"
 #include "marker.h"
 #include "object_name_db.h"
 #include "pipeline.h"
+#include "progress_history.h"
 #include "queue.h"
 #include "semaphore_tracker.h"
 #include "shader_module.h"
@@ -83,7 +87,7 @@ class Device {
 
     bool HangDetected() const { return hang_detected_; }
     void DeviceFault();
-    void WatchdogTimeout(bool dump_prologue, YAML::Emitter& os);
+    void WatchdogTimeout(DumpEmitter& os);
 
     const Logger& Log() const;
     const DeviceDispatchTable& Dispatch() const { return device_dispatch_table_; }
@@ -96,33 +100,34 @@ class Device {
 
     void AddObjectInfo(uint64_t handle, VkObjectType type, const char* name);
     void AddExtraInfo(uint64_t handle, ExtraObjectInfo info);
-    const ObjectInfoDB& GetObjectInfoDB() const { return object_info_db_; }
+    void RemoveObjectInfo(uint64_t handle);
     std::string GetObjectName(uint64_t handle,
                               HandleDebugNamePreference handle_debug_name_preference = kReportBoth) const;
     std::string GetObjectInfo(uint64_t handle) const;
 
     bool HasCheckpoints() const;
-    std::unique_ptr<Checkpoint> AllocateCheckpoint(uint32_t initial_value);
+    bool AllocateCheckpoint(Checkpoint& checkpoint, uint32_t initial_value);
 
     VkResult CreateBuffer(VkDeviceSize size, VkBuffer* p_buffer, void** cpu_mapped_address);
 
     void FreeCommandBuffers(VkCommandPool command_pool, uint32_t command_buffer_count,
                             const VkCommandBuffer* command_buffers);
 
-    void AddCommandBuffer(VkCommandBuffer vk_command_buffer);
+    // Block cache shared by the command recorders of this device.
+    const std::shared_ptr<LinearAllocatorBlockCache>& GetCommandBlockCache() const { return command_block_cache_; }
 
-    bool ValidateCommandBufferNotInUse(CommandBuffer* p_cmd, YAML::Emitter& os);
-    bool ValidateCommandBufferNotInUse(VkCommandBuffer vk_command_buffer, YAML::Emitter& os);
+    bool ValidateCommandBufferNotInUse(CommandBuffer* p_cmd, DumpEmitter& os);
+    bool ValidateCommandBufferNotInUse(VkCommandBuffer vk_command_buffer, DumpEmitter& os);
     void DeleteCommandBuffers(VkCommandPool vk_pool, const VkCommandBuffer* vk_cmds, uint32_t cb_count);
 
-    void DumpCommandBuffers(YAML::Emitter& os) const;
-    void DumpCommandBufferStateOnScreen(CommandBuffer* p_cmd, YAML::Emitter& os) const;
+    void DumpCommandBuffers(DumpEmitter& os, const ObjectInfoSnapshot& names) const;
+    void DumpCommandBufferStateOnScreen(CommandBuffer* p_cmd, DumpEmitter& os);
 
     void SetCommandPool(VkCommandPool vk_command_pool, CommandPoolPtr command_pool);
     CommandPool* GetCommandPool(VkCommandPool vk_command_pool);
     void AllocateCommandBuffers(VkCommandPool vk_command_pool, const VkCommandBufferAllocateInfo* allocate_info,
                                 VkCommandBuffer* command_buffers);
-    void ValidateCommandPoolState(VkCommandPool vk_command_pool, YAML::Emitter& os);
+    void ValidateCommandPoolState(VkCommandPool vk_command_pool, DumpEmitter& os);
     void ResetCommandPool(VkCommandPool vk_command_pool);
     void DeleteCommandPool(VkCommandPool vk_command_pool);
 
@@ -148,11 +153,20 @@ class Device {
 
     void EraseCommandPools();
 
-    void DumpDeviceFaultInfo(YAML::Emitter& os) const;
+    void DumpDeviceFaultInfo(DumpEmitter& os) const;
 
-    YAML::Emitter& Print(YAML::Emitter& os, const std::string& error_report);
+    DumpEmitter& Print(DumpEmitter& os, const std::string& error_report);
 
-    void MemoryBindEvent(const DeviceAddressRecord& record, bool multi_device);
+    void MemoryBindEvent(const DeviceAddressRecord& record);
+
+    // Memory, buffers and images created on this device, so that address
+    // binding reports for them are recorded here. Only tracked when the
+    // device has VK_EXT_device_address_binding_report, otherwise no reports
+    // arrive.
+    bool HasAddressBindingReport() const;
+    void AddBoundObject(uint64_t handle);
+    void RemoveBoundObject(uint64_t handle);
+    bool IsBoundObject(uint64_t handle) const;
 
     VkResult QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
 
@@ -162,7 +176,12 @@ class Device {
 
     bool UpdateIdleState();
 
+    // Called by the progress sampler thread.
+    void SampleProgress(int64_t time_ms);
+
    private:
+    void DumpProgressHistory(DumpEmitter& os, const ObjectInfoSnapshot& names) const;
+
     Context& context_;
     DeviceDispatchTable device_dispatch_table_;
     VkPhysicalDevice vk_physical_device_{VK_NULL_HANDLE};
@@ -174,16 +193,21 @@ class Device {
 
     std::vector<VkQueueFamilyProperties> queue_family_properties_;
 
+    // Marker buffers for the buffer marker checkpoints and the semaphore
+    // tracker. Declared before both so it outlives them.
+    std::unique_ptr<BufferMarkerMgr> markers_;
+
     SemaphoreTrackerPtr semaphore_tracker_;
 
     std::unique_ptr<DeviceCreateInfo> device_create_info_;
 
     ObjectInfoDB object_info_db_;
 
-    mutable std::recursive_mutex command_buffers_mutex_;
-    std::vector<VkCommandBuffer> command_buffers_;
+    std::shared_ptr<LinearAllocatorBlockCache> command_block_cache_;
 
-    std::mutex command_pools_mutex_;
+    // Also guards the command buffer lists of the pools, the device wide list
+    // of command buffers is the union of them.
+    mutable std::mutex command_pools_mutex_;
     std::unordered_map<VkCommandPool, CommandPoolPtr> command_pools_;
 
     mutable std::mutex pipelines_mutex_;
@@ -195,9 +219,23 @@ class Device {
     mutable std::mutex queues_mutex_;
     std::unordered_map<VkQueue, QueuePtr> queues_;
 
+    // Guards address_map_ and unbound_history_. Bind events may arrive on any
+    // thread, dumps copy what they need under the lock and print the copy.
+    mutable std::mutex address_mutex_;
     vku::sparse::range_map<VkDeviceAddress, DeviceAddressRecord> address_map_;
+    // The most recent unbind events, oldest first. A later bind of the same
+    // range replaces the unbind in address_map_, these keep it around for
+    // use after free faults.
+    static constexpr size_t kMaxUnboundHistory = 256;
+    std::deque<DeviceAddressRecord> unbound_history_;
+    // Handles are only unique per device, so each device keeps its own set.
+    // The value is always this device, only the keys matter.
+    ConcurrentPointerMap<Device, uint64_t> bound_objects_;
 
     std::unique_ptr<CheckpointMgr> checkpoints_;
+
+    // Only allocated if progress sampling is enabled.
+    std::unique_ptr<ProgressHistory> progress_history_;
 };
 
 }  // namespace crash_diagnostic_layer
@@ -0,0 +1,273 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#include "dump_binary.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dump_emitter.h"
+
+namespace crash_diagnostic_layer {
+
+namespace {
+
+class BinaryDumpReader {
+   public:
+    BinaryDumpReader(std::string_view data, DumpEmitter& os) : data_(data), os_(os) {}
+
+    bool Read(std::string* error);
+
+   private:
+    bool Fail(const char* message) {
+        if (error_.empty()) {
+            error_ = std::string(message) + " at offset " + std::to_string(pos_);
+        }
+        return false;
+    }
+
+    bool ReadVarint(uint64_t& value);
+    bool ReadBytes(size_t size, std::string_view& bytes);
+    bool ReadString(std::string_view& value);
+    bool ReadEvent();
+
+    std::string_view data_;
+    DumpEmitter& os_;
+    size_t pos_{0};
+    std::vector<std::string_view> strings_;
+    // End offsets of the records being read.
+    std::vector<size_t> records_;
+    bool ended_{false};
+    std::string error_;
+};
+
+bool BinaryDumpReader::ReadVarint(uint64_t& value) {
+    value = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7) {
+        if (pos_ >= data_.size()) {
+            return Fail("Truncated varint");
+        }
+        uint8_t byte = static_cast<uint8_t>(data_[pos_++]);
+        value |= uint64_t(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return Fail("Bad varint");
+}
+
+bool BinaryDumpReader::ReadBytes(size_t size, std::string_view& bytes) {
+    if (size > data_.size() - pos_) {
+        return Fail("Truncated data");
+    }
+    bytes = data_.substr(pos_, size);
+    pos_ += size;
+    return true;
+}
+
+bool BinaryDumpReader::ReadString(std::string_view& value) {
+    if (pos_ >= data_.size()) {
+        return Fail("Truncated string");
+    }
+    uint8_t tag = static_cast<uint8_t>(data_[pos_++]);
+    uint64_t n = 0;
+    if (!ReadVarint(n)) {
+        return false;
+    }
+    if (tag == dump_binary::kStringRef) {
+        if (n >= strings_.size()) {
+            return Fail("Bad string id");
+        }
+        value = strings_[static_cast<size_t>(n)];
+        return true;
+    }
+    if (tag == dump_binary::kString) {
+        return ReadBytes(static_cast<size_t>(n), value);
+    }
+    return Fail("Expected a string");
+}
+
+bool BinaryDumpReader::ReadEvent() {
+    uint8_t tag = static_cast<uint8_t>(data_[pos_++]);
+    uint64_t value = 0;
+    std::string_view bytes;
+    switch (tag) {
+        case dump_binary::kBeginMap:
+            os_ << YAML::BeginMap;
+            return true;
+        case dump_binary::kEndMap:
+            os_ << YAML::EndMap;
+            return true;
+        case dump_binary::kBeginSeq:
+            os_ << YAML::BeginSeq;
+            return true;
+        case dump_binary::kEndSeq:
+            os_ << YAML::EndSeq;
+            return true;
+        case dump_binary::kFlow:
+            os_ << YAML::Flow;
+            return true;
+        case dump_binary::kBlock:
+            os_ << YAML::Block;
+            return true;
+        case dump_binary::kKey:
+            os_ << YAML::Key;
+            return true;
+        case dump_binary::kHex:
+            os_ << YAML::Hex;
+            return true;
+        case dump_binary::kDec:
+            os_ << YAML::Dec;
+            return true;
+        case dump_binary::kNewline:
+            os_ << YAML::Newline;
+            return true;
+        case dump_binary::kString:
+        case dump_binary::kStringRef:
+            --pos_;
+            if (!ReadString(bytes)) {
+                return false;
+            }
+            os_ << std::string(bytes);
+            return true;
+        case dump_binary::kStringDef:
+            if (!records_.empty()) {
+                return Fail("String table entry inside a record");
+            }
+            if (!ReadVarint(value) || !ReadBytes(static_cast<size_t>(value), bytes)) {
+                return false;
+            }
+            strings_.push_back(bytes);
+            return true;
+        case dump_binary::kComment:
+            if (!ReadString(bytes)) {
+                return false;
+            }
+            os_ << YAML::Comment(std::string(bytes));
+            return true;
+        case dump_binary::kSigned:
+            if (!ReadVarint(value)) {
+                return false;
+            }
+            os_ << static_cast<long long>((value >> 1) ^ (~(value & 1) + 1));
+            return true;
+        case dump_binary::kUnsigned:
+            if (!ReadVarint(value)) {
+                return false;
+            }
+            os_ << static_cast<unsigned long long>(value);
+            return true;
+        case dump_binary::kFloat:
+        case dump_binary::kDouble: {
+            size_t count = tag == dump_binary::kFloat ? 4 : 8;
+            if (!ReadBytes(count, bytes)) {
+                return false;
+            }
+            uint64_t bits = 0;
+            for (size_t i = 0; i < count; ++i) {
+                bits |= uint64_t(static_cast<uint8_t>(bytes[i])) << (8 * i);
+            }
+            if (count == 4) {
+                uint32_t bits32 = static_cast<uint32_t>(bits);
+                float f;
+                memcpy(&f, &bits32, sizeof(f));
+                os_ << f;
+            } else {
+                double d;
+                memcpy(&d, &bits, sizeof(d));
+                os_ << d;
+            }
+            return true;
+        }
+        case dump_binary::kFalse:
+            os_ << false;
+            return true;
+        case dump_binary::kTrue:
+            os_ << true;
+            return true;
+        case dump_binary::kEnd:
+            if (!records_.empty() || pos_ != data_.size()) {
+                return Fail("Data after the end of the dump");
+            }
+            ended_ = true;
+            return true;
+        case dump_binary::kRecord: {
+            uint64_t type = 0;
+            if (!ReadVarint(type) || !ReadVarint(value)) {
+                return false;
+            }
+            size_t end = records_.empty() ? data_.size() : records_.back();
+            if (value > end - pos_) {
+                return Fail("Truncated record");
+            }
+            os_.BeginRecord(static_cast<uint32_t>(type));
+            records_.push_back(pos_ + static_cast<size_t>(value));
+            return true;
+        }
+        default:
+            --pos_;
+            return Fail("Unknown tag");
+    }
+}
+
+bool BinaryDumpReader::Read(std::string* error) {
+    bool ok = IsBinaryDump(data_);
+    if (!ok) {
+        Fail("Not a binary dump");
+    } else {
+        pos_ = sizeof(dump_binary::kMagic) + 1;
+        while (ok) {
+            while (!records_.empty() && pos_ == records_.back()) {
+                records_.pop_back();
+                os_.EndRecord();
+            }
+            if (pos_ >= data_.size()) {
+                if (!ended_) {
+                    ok = Fail("Dump was cut short");
+                }
+                break;
+            }
+            ok = ReadEvent();
+            if (ok && !records_.empty() && pos_ > records_.back()) {
+                ok = Fail("Event crosses the end of its record");
+            }
+        }
+    }
+    while (!records_.empty()) {
+        records_.pop_back();
+        os_.EndRecord();
+    }
+    if (error) {
+        *error = error_;
+    }
+    return ok;
+}
+
+}  // namespace
+
+bool IsBinaryDump(std::string_view data) {
+    return data.size() > sizeof(dump_binary::kMagic) &&
+           memcmp(data.data(), dump_binary::kMagic, sizeof(dump_binary::kMagic)) == 0 &&
+           static_cast<uint8_t>(data[sizeof(dump_binary::kMagic)]) == dump_binary::kVersion;
+}
+
+bool ReadBinaryDump(std::string_view data, DumpEmitter& os, std::string* error) {
+    BinaryDumpReader reader(data, os);
+    return reader.Read(error);
+}
+
+}  // namespace crash_diagnostic_layer
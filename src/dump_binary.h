@@ -0,0 +1,81 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace crash_diagnostic_layer {
+namespace dump_binary {
+
+//
+// Binary dumps record the calls made on a DumpEmitter, so they hold exactly
+// what the YAML dump would, and ReadBinaryDump() can turn them back into it.
+//
+// A dump is the 4 byte kMagic followed by a kVersion byte and then a stream
+// of events. Each event starts with a one byte tag:
+//
+//   kBeginMap .. kNewline     the YAML manipulator of the same name
+//   kString <len> <bytes>     a string scalar
+//   kStringRef <id>           a string scalar from the string table
+//   kStringDef <len> <bytes>  adds the next entry to the string table, ids
+//                             start at 0. Not a scalar itself.
+//   kComment <string>         a comment, <string> is a kString or kStringRef
+//   kSigned <zigzag>          a signed integer
+//   kUnsigned <value>         an unsigned integer
+//   kFloat <4 bytes>          a float, little endian IEEE bits
+//   kDouble <8 bytes>         a double, little endian IEEE bits
+//   kFalse, kTrue             a bool
+//   kRecord <type> <len>      the next len bytes are the events of one
+//                             record, such as a command keyed by its
+//                             Command::Type. Records never hold kStringDef
+//                             so they can be skipped.
+//   kEnd                      the last event, missing if the dump was cut
+//                             short.
+//
+// <len>, <id>, <type> and <value> are unsigned LEB128 varints, and signed
+// integers are zigzag encoded first.
+//
+constexpr char kMagic[4] = {'C', 'D', 'L', 'B'};
+constexpr uint8_t kVersion = 1;
+
+enum Tag : uint8_t {
+    kBeginMap = 1,
+    kEndMap,
+    kBeginSeq,
+    kEndSeq,
+    kFlow,
+    kBlock,
+    kKey,
+    kHex,
+    kDec,
+    kNewline,
+    kString,
+    kStringRef,
+    kStringDef,
+    kComment,
+    kSigned,
+    kUnsigned,
+    kFloat,
+    kDouble,
+    kFalse,
+    kTrue,
+    kRecord,
+    kEnd,
+};
+
+}  // namespace dump_binary
+}  // namespace crash_diagnostic_layer
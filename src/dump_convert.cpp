@@ -0,0 +1,70 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+// cdl-dump-convert turns a binary dump file, written with dump_format set to
+// binary, into the YAML dump the layer would have written otherwise.
+//
+// Usage: cdl-dump-convert <cdl_dump.cdlb> [cdl_dump.yaml]
+//
+// The YAML goes to stdout if no output file is given.
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include "dump_emitter.h"
+
+using crash_diagnostic_layer::DumpEmitter;
+using crash_diagnostic_layer::DumpFormat;
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " <cdl_dump.cdlb> [cdl_dump.yaml]" << std::endl;
+        return 2;
+    }
+
+    std::ifstream in(argv[1], std::ios_base::in | std::ios_base::binary);
+    if (!in.is_open()) {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return 1;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (!crash_diagnostic_layer::IsBinaryDump(data)) {
+        std::cerr << argv[1] << " is not a binary dump file" << std::endl;
+        return 1;
+    }
+
+    bool ok = false;
+    std::string error;
+    {
+        constexpr int kStdoutFd = 1;
+        bool opened = true;
+        DumpEmitter os =
+            argc == 3 ? DumpEmitter::OpenFile(argv[2], DumpFormat::kYaml, &opened) : DumpEmitter(kStdoutFd, false);
+        if (!opened) {
+            std::cerr << "Unable to open " << argv[2] << std::endl;
+            return 1;
+        }
+        ok = crash_diagnostic_layer::ReadBinaryDump(data, os, &error);
+    }
+    if (!ok) {
+        // Dumps cut short still convert up to the point they stopped.
+        std::cerr << argv[1] << ": " << error << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,799 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#include "dump_emitter.h"
+
+#include "dump_binary.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#if defined(WIN32)
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace crash_diagnostic_layer {
+
+namespace {
+
+#if defined(WIN32)
+constexpr int kStderrFd = 2;
+int OpenForWrite(const std::filesystem::path& path) {
+    return _wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+}
+int WriteFd(int fd, const char* data, size_t size) {
+    return _write(fd, data, static_cast<unsigned int>(std::min<size_t>(size, INT32_MAX)));
+}
+void CloseFd(int fd) { _close(fd); }
+#else
+constexpr int kStderrFd = STDERR_FILENO;
+int OpenForWrite(const std::filesystem::path& path) {
+    return open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+}
+ssize_t WriteFd(int fd, const char* data, size_t size) { return write(fd, data, size); }
+void CloseFd(int fd) { close(fd); }
+#endif
+
+// Conservative check for whether value can be written without quotes.
+bool IsPlainSafe(std::string_view value, bool flow) {
+    if (value.empty() || value.front() == ' ' || value.back() == ' ') {
+        return false;
+    }
+    // Plain scalars that YAML reads back as null.
+    if (value == "~" || value == "null" || value == "Null" || value == "NULL") {
+        return false;
+    }
+    if (strchr("-?:,[]{}#&*!|>'\"%@`", value.front())) {
+        // A leading '-' is only an indicator when followed by a space, allow
+        // it so negative numbers in strings stay readable.
+        if (value.front() != '-' || value.size() == 1 || value[1] == ' ' || value[1] == '-') {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < value.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c < 0x20 || c == 0x7f) {
+            return false;
+        }
+        if (c == ':' && (i + 1 == value.size() || value[i + 1] == ' ')) {
+            return false;
+        }
+        if (c == '#' && value[i - 1] == ' ') {
+            return false;
+        }
+        if (flow && (c == ',' || c == '[' || c == ']' || c == '{' || c == '}')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+DumpEmitter::DumpEmitter() { frames_.reserve(16); }
+
+DumpEmitter::DumpEmitter(int fd, bool owns_fd, DumpFormat format)
+    : format_(format), fd_(fd), owns_fd_(owns_fd), buffer_(new char[kBufferSize]) {
+    frames_.reserve(16);
+    if (binary()) {
+        PutBytes(std::string_view(dump_binary::kMagic, sizeof(dump_binary::kMagic)));
+        PutTag(dump_binary::kVersion);
+    }
+}
+
+DumpEmitter::DumpEmitter(DumpEmitter&& other) noexcept
+    : format_(other.format_),
+      fd_(other.fd_),
+      owns_fd_(other.owns_fd_),
+      buffer_(std::move(other.buffer_)),
+      buffer_used_(other.buffer_used_),
+      memory_(std::move(other.memory_)),
+      frames_(std::move(other.frames_)),
+      column_(other.column_),
+      last_char_(other.last_char_),
+      line_has_comment_(other.line_has_comment_),
+      next_flow_(other.next_flow_),
+      hex_(other.hex_),
+      good_(other.good_),
+      size_(other.size_),
+      memory_limit_(other.memory_limit_),
+      string_storage_(std::move(other.string_storage_)),
+      strings_(std::move(other.strings_)),
+      record_depth_(other.record_depth_),
+      record_header_size_(other.record_header_size_),
+      record_(std::move(other.record_)) {
+    other.fd_ = -1;
+    other.owns_fd_ = false;
+    other.buffer_used_ = 0;
+}
+
+DumpEmitter::~DumpEmitter() {
+    if (fd_ < 0) {
+        return;
+    }
+    if (binary()) {
+        while (record_depth_ > 0) {
+            EndRecord();
+        }
+        PutTag(dump_binary::kEnd);
+    } else if (column_ > 0) {
+        Put('\n');
+    }
+    Flush();
+    if (owns_fd_) {
+        CloseFd(fd_);
+    }
+}
+
+DumpEmitter DumpEmitter::OpenFile(const std::filesystem::path& path, DumpFormat format, bool* opened) {
+    int fd = OpenForWrite(path);
+    if (opened) {
+        *opened = fd >= 0;
+    }
+    if (fd < 0) {
+        return DumpEmitter(kStderrFd, false);
+    }
+    return DumpEmitter(fd, true, format);
+}
+
+void DumpEmitter::Flush() {
+    if (buffer_used_ > 0) {
+        WriteToFile(buffer_.get(), buffer_used_);
+        buffer_used_ = 0;
+    }
+}
+
+void DumpEmitter::WriteToFile(const char* data, size_t size) {
+    while (size > 0 && good_) {
+        auto written = WriteFd(fd_, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            good_ = false;
+            break;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+void DumpEmitter::Put(std::string_view text) {
+    if (text.empty()) {
+        return;
+    }
+    size_ += text.size();
+    for (char c : text) {
+        column_ = c == '\n' ? 0 : column_ + 1;
+    }
+    last_char_ = text.back();
+    Append(text.data(), text.size());
+}
+
+void DumpEmitter::Put(char c) { Put(std::string_view(&c, 1)); }
+
+void DumpEmitter::Append(const char* data, size_t size) {
+    if (fd_ < 0) {
+        if (!good_) {
+            return;
+        }
+        if (memory_limit_ > 0 && memory_.size() + size > memory_limit_) {
+            good_ = false;
+            std::string().swap(memory_);
+            return;
+        }
+        memory_.append(data, size);
+        return;
+    }
+    if (buffer_used_ + size > kBufferSize) {
+        Flush();
+        if (size > kBufferSize) {
+            WriteToFile(data, size);
+            return;
+        }
+    }
+    memcpy(buffer_.get() + buffer_used_, data, size);
+    buffer_used_ += size;
+}
+
+void DumpEmitter::PutBytes(std::string_view bytes) {
+    if (record_depth_ > 0) {
+        record_.append(bytes.data(), bytes.size());
+    } else {
+        size_ += bytes.size();
+        Append(bytes.data(), bytes.size());
+    }
+}
+
+void DumpEmitter::PutTag(uint8_t tag) {
+    char c = static_cast<char>(tag);
+    PutBytes(std::string_view(&c, 1));
+}
+
+void DumpEmitter::PutVarint(uint64_t value) {
+    char bytes[10];
+    size_t count = 0;
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        bytes[count++] = static_cast<char>(value ? byte | 0x80 : byte);
+    } while (value);
+    PutBytes(std::string_view(bytes, count));
+}
+
+void DumpEmitter::PutString(std::string_view value, bool intern, bool comment) {
+    if (intern && value.size() <= kMaxInternedLength) {
+        auto iter = strings_.find(value);
+        if (iter == strings_.end() && strings_.size() < kMaxInternedStrings) {
+            // Table entries always go in the top level stream, ahead of any
+            // record being built, so records can be skipped.
+            uint32_t saved_depth = record_depth_;
+            record_depth_ = 0;
+            PutTag(dump_binary::kStringDef);
+            PutVarint(value.size());
+            PutBytes(value);
+            record_depth_ = saved_depth;
+            string_storage_.emplace_back(value);
+            iter = strings_.emplace(string_storage_.back(), static_cast<uint32_t>(strings_.size())).first;
+        }
+        if (iter != strings_.end()) {
+            if (comment) {
+                PutTag(dump_binary::kComment);
+            }
+            PutTag(dump_binary::kStringRef);
+            PutVarint(iter->second);
+            return;
+        }
+    }
+    if (comment) {
+        PutTag(dump_binary::kComment);
+    }
+    PutTag(dump_binary::kString);
+    PutVarint(value.size());
+    PutBytes(value);
+}
+
+void DumpEmitter::BeginRecord(uint32_t type) {
+    if (!binary()) {
+        return;
+    }
+    if (record_depth_ > 0) {
+        // Nested records are part of the outer one.
+        ++record_depth_;
+        return;
+    }
+    record_.clear();
+    record_depth_ = 1;
+    // The header goes in front of the events once their length is known.
+    PutVarint(type);
+    record_header_size_ = record_.size();
+}
+
+void DumpEmitter::EndRecord() {
+    if (record_depth_ == 0 || --record_depth_ > 0) {
+        return;
+    }
+    std::string_view header(record_.data(), record_header_size_);
+    std::string_view events(record_.data() + record_header_size_, record_.size() - record_header_size_);
+    PutTag(dump_binary::kRecord);
+    PutBytes(header);
+    PutVarint(events.size());
+    PutBytes(events);
+}
+
+void DumpEmitter::StartLine(uint32_t indent) {
+    if (column_ > 0) {
+        Put('\n');
+    }
+    line_has_comment_ = false;
+    static const char kSpaces[] = "                                                                ";
+    while (indent > 0) {
+        uint32_t n = std::min<uint32_t>(indent, sizeof(kSpaces) - 1);
+        Put(std::string_view(kSpaces, n));
+        indent -= n;
+    }
+}
+
+// Writes whatever has to come before the next node in the current collection.
+// Block collections defer their own opening until their first entry or their
+// end, so an empty one can still be written as [] or {}.
+void DumpEmitter::BeginNode(bool block_collection) {
+    if (frames_.empty()) {
+        if (column_ > 0) {
+            StartLine(0);
+        }
+        return;
+    }
+    Frame& parent = frames_.back();
+    bool is_value = parent.type == FrameType::kMap && (parent.count % 2) == 1;
+    if (parent.flow) {
+        if (is_value) {
+            Put(": ");
+        } else if (parent.count > 0) {
+            Put(", ");
+        }
+        return;
+    }
+    if (is_value) {
+        if (block_collection) {
+            return;
+        }
+        if (line_has_comment_) {
+            StartLine(parent.indent + 2);
+        } else {
+            Put(' ');
+        }
+        return;
+    }
+    if (parent.count > 0 || !parent.inline_first || line_has_comment_) {
+        StartLine(parent.indent);
+    }
+    if (parent.type == FrameType::kSeq) {
+        Put("- ");
+    }
+}
+
+void DumpEmitter::EndNode() {
+    hex_ = false;
+    if (frames_.empty()) {
+        return;
+    }
+    Frame& parent = frames_.back();
+    if (parent.type == FrameType::kMap && !parent.flow && (parent.count % 2) == 0) {
+        Put(':');
+    }
+    ++parent.count;
+}
+
+void DumpEmitter::BeginCollection(FrameType type) {
+    Frame frame{type, next_flow_, 0, false, 0};
+    next_flow_ = false;
+    if (!frames_.empty() && frames_.back().flow) {
+        frame.flow = true;
+    }
+    BeginNode(!frame.flow);
+    if (frame.flow) {
+        Put(type == FrameType::kMap ? '{' : '[');
+    } else if (frames_.empty()) {
+        frame.indent = 0;
+        frame.inline_first = true;
+    } else {
+        const Frame& parent = frames_.back();
+        bool is_value = parent.type == FrameType::kMap && (parent.count % 2) == 1;
+        frame.indent = parent.indent + 2;
+        frame.inline_first = !is_value;
+    }
+    frames_.push_back(frame);
+}
+
+void DumpEmitter::EndCollection(FrameType type) {
+    if (frames_.empty() || frames_.back().type != type) {
+        // Unbalanced, like YAML::Emitter ignore it rather than corrupt the output.
+        return;
+    }
+    Frame frame = frames_.back();
+    frames_.pop_back();
+    if (frame.type == FrameType::kMap && (frame.count % 2) == 1) {
+        // A key without a value.
+        Put(" ~");
+    }
+    if (frame.flow) {
+        Put(type == FrameType::kMap ? '}' : ']');
+    } else if (frame.count == 0) {
+        if (line_has_comment_) {
+            StartLine(frame.indent);
+        } else if (!frame.inline_first) {
+            Put(' ');
+        }
+        Put(type == FrameType::kMap ? "{}" : "[]");
+    }
+    EndNode();
+}
+
+DumpEmitter DumpEmitter::Fork(bool after_entry) const {
+    DumpEmitter fragment;
+    fragment.frames_ = frames_;
+    fragment.column_ = column_;
+    fragment.last_char_ = last_char_;
+    fragment.line_has_comment_ = line_has_comment_;
+    fragment.next_flow_ = next_flow_;
+    fragment.hex_ = hex_;
+    if (after_entry) {
+        // Only whether the collection has entries, and whether a map is
+        // between a key and its value, affect the output.
+        Frame& parent = fragment.frames_.back();
+        parent.count += parent.type == FrameType::kMap ? 2 : 1;
+        fragment.column_ = std::max<size_t>(column_, 1);
+        fragment.line_has_comment_ = false;
+    }
+    return fragment;
+}
+
+bool DumpEmitter::Join(const DumpEmitter& base, bool after_entry, const DumpEmitter& fragment) {
+    size_t level = base.frames_.size() - 1;
+    const Frame& base_parent = base.frames_[level];
+    uint32_t start_count = base_parent.count;
+    if (after_entry) {
+        start_count += base_parent.type == FrameType::kMap ? 2 : 1;
+        if (fragment.memory_.empty() && fragment.frames_.size() == base.frames_.size() &&
+            fragment.frames_[level].count == start_count && fragment.next_flow_ == base.next_flow_ &&
+            fragment.hex_ == base.hex_) {
+            // The entry wrote nothing.
+            return true;
+        }
+        // The fragment was written as if an entry came before it. That only
+        // gives the same text if this emitter has written one, and the
+        // fragment starts by moving to a new line.
+        if (frames_.size() != base.frames_.size() || next_flow_ != base.next_flow_ || hex_ != base.hex_ ||
+            fragment.memory_.empty() || fragment.memory_.front() != '\n' || column_ == 0) {
+            return false;
+        }
+        for (size_t i = 0; i <= level; ++i) {
+            const Frame& a = frames_[i];
+            const Frame& b = base.frames_[i];
+            if (a.type != b.type || a.flow != b.flow || a.indent != b.indent || a.inline_first != b.inline_first) {
+                return false;
+            }
+            if (i < level && a.count != b.count) {
+                return false;
+            }
+        }
+        const Frame& parent = frames_[level];
+        if (parent.count == 0 || (parent.type == FrameType::kMap && (parent.count % 2) != 0)) {
+            return false;
+        }
+    }
+    if (fragment.frames_.size() <= level) {
+        // The fragment closed the collection it was writing entries of.
+        return false;
+    }
+    uint32_t count = frames_[level].count + (fragment.frames_[level].count - start_count);
+    frames_ = fragment.frames_;
+    frames_[level].count = count;
+    column_ = fragment.column_;
+    last_char_ = fragment.last_char_;
+    line_has_comment_ = fragment.line_has_comment_;
+    next_flow_ = fragment.next_flow_;
+    hex_ = fragment.hex_;
+    size_ += fragment.memory_.size();
+    Append(fragment.memory_.data(), fragment.memory_.size());
+    return true;
+}
+
+void DumpEmitter::WriteEntries(size_t count, const std::function<void(size_t index, DumpEmitter& os)>& write_entry) {
+    size_t num_threads = std::min<size_t>(count, std::thread::hardware_concurrency());
+    // Only the emitter writing the file starts workers. Entries that are
+    // themselves formatted into memory write their nested entries in order, so
+    // one dump never runs more than one set of workers.
+    if (binary() || fd_ < 0 || num_threads < 2 || frames_.empty() || frames_.back().flow) {
+        // The binary string table has to be filled in order.
+        for (size_t index = 0; index < count; ++index) {
+            write_entry(index, *this);
+        }
+        return;
+    }
+
+    // Workers format the entries ahead of the one being written into
+    // fragments, until kMaxAheadSize bytes are waiting. A fragment that grows
+    // past kMaxFragmentSize is dropped. This thread writes the entry that is
+    // next in order straight to the file if no worker has started it, or if
+    // its fragment was dropped or can't be joined. Only the fragments and the
+    // counters are shared, under mutex.
+    const DumpEmitter base = Fork(false);
+    std::map<size_t, DumpEmitter> fragments;
+    size_t next = 0;
+    size_t buffered = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&] { return next >= count || buffered < kMaxAheadSize; });
+            if (next >= count) {
+                return;
+            }
+            size_t index = next++;
+            lock.unlock();
+            DumpEmitter fragment = base.Fork(index > 0);
+            fragment.memory_limit_ = kMaxFragmentSize;
+            write_entry(index, fragment);
+            lock.lock();
+            buffered += sizeof(DumpEmitter) + fragment.memory_.size();
+            fragments.emplace(index, std::move(fragment));
+            cv.notify_all();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (size_t i = 0; i + 1 < num_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    for (size_t index = 0; index < count; ++index) {
+        std::optional<DumpEmitter> fragment;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (next == index) {
+                ++next;
+            } else {
+                cv.wait(lock, [&] { return fragments.count(index) != 0; });
+                auto pos = fragments.find(index);
+                fragment.emplace(std::move(pos->second));
+                fragments.erase(pos);
+                buffered -= sizeof(DumpEmitter) + fragment->memory_.size();
+            }
+        }
+        cv.notify_all();
+        if (!fragment || !fragment->good() || !Join(base, index > 0, *fragment)) {
+            write_entry(index, *this);
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+DumpEmitter& DumpEmitter::operator<<(YAML::EMITTER_MANIP manip) {
+    if (binary()) {
+        switch (manip) {
+            case YAML::BeginMap:
+                PutTag(dump_binary::kBeginMap);
+                break;
+            case YAML::EndMap:
+                PutTag(dump_binary::kEndMap);
+                break;
+            case YAML::BeginSeq:
+                PutTag(dump_binary::kBeginSeq);
+                break;
+            case YAML::EndSeq:
+                PutTag(dump_binary::kEndSeq);
+                break;
+            case YAML::Flow:
+                PutTag(dump_binary::kFlow);
+                break;
+            case YAML::Block:
+                PutTag(dump_binary::kBlock);
+                break;
+            case YAML::Hex:
+                PutTag(dump_binary::kHex);
+                break;
+            case YAML::Dec:
+                PutTag(dump_binary::kDec);
+                break;
+            case YAML::Newline:
+                PutTag(dump_binary::kNewline);
+                break;
+            case YAML::Key:
+                PutTag(dump_binary::kKey);
+                break;
+            default:
+                // No effect on the text either.
+                break;
+        }
+        return *this;
+    }
+    switch (manip) {
+        case YAML::BeginMap:
+            BeginCollection(FrameType::kMap);
+            break;
+        case YAML::EndMap:
+            EndCollection(FrameType::kMap);
+            break;
+        case YAML::BeginSeq:
+            BeginCollection(FrameType::kSeq);
+            break;
+        case YAML::EndSeq:
+            EndCollection(FrameType::kSeq);
+            break;
+        case YAML::Flow:
+            next_flow_ = true;
+            break;
+        case YAML::Block:
+            next_flow_ = false;
+            break;
+        case YAML::Hex:
+            hex_ = true;
+            break;
+        case YAML::Dec:
+            hex_ = false;
+            break;
+        case YAML::Newline:
+            Put('\n');
+            line_has_comment_ = false;
+            break;
+        case YAML::Key:
+            // A key where a value is expected, the previous key had no value.
+            if (!frames_.empty() && frames_.back().type == FrameType::kMap && (frames_.back().count % 2) == 1) {
+                WriteScalar("~");
+            }
+            break;
+        default:
+            // YAML::Value and the formatting manipulators we don't use.
+            break;
+    }
+    return *this;
+}
+
+DumpEmitter& DumpEmitter::operator<<(const YAML::_Comment& comment) {
+    if (binary()) {
+        PutString(comment.content, true, true);
+        return *this;
+    }
+    if (column_ > 0 && last_char_ != ' ') {
+        Put("  ");
+    }
+    Put("# ");
+    for (char c : comment.content) {
+        Put(c == '\n' ? ' ' : c);
+    }
+    line_has_comment_ = true;
+    return *this;
+}
+
+DumpEmitter& DumpEmitter::WriteScalar(std::string_view text) {
+    BeginNode(false);
+    Put(text);
+    EndNode();
+    return *this;
+}
+
+DumpEmitter& DumpEmitter::WriteBool(bool value) {
+    if (binary()) {
+        PutTag(value ? dump_binary::kTrue : dump_binary::kFalse);
+        return *this;
+    }
+    return WriteScalar(value ? "true" : "false");
+}
+
+DumpEmitter& DumpEmitter::WriteSigned(long long value) {
+    if (binary()) {
+        auto bits = static_cast<unsigned long long>(value);
+        PutTag(dump_binary::kSigned);
+        PutVarint((bits << 1) ^ (value < 0 ? ~0ull : 0ull));
+        return *this;
+    }
+    if (hex_ && value >= 0) {
+        return WriteUnsigned(static_cast<unsigned long long>(value));
+    }
+    char text[24];
+    auto result = std::to_chars(text, text + sizeof(text), value);
+    return WriteScalar(std::string_view(text, static_cast<size_t>(result.ptr - text)));
+}
+
+DumpEmitter& DumpEmitter::WriteUnsigned(unsigned long long value) {
+    if (binary()) {
+        PutTag(dump_binary::kUnsigned);
+        PutVarint(value);
+        return *this;
+    }
+    char text[24] = {'0', 'x'};
+    char* begin = hex_ ? text + 2 : text;
+    auto result = std::to_chars(begin, text + sizeof(text), value, hex_ ? 16 : 10);
+    return WriteScalar(std::string_view(text, static_cast<size_t>(result.ptr - text)));
+}
+
+DumpEmitter& DumpEmitter::WriteFloat(double value, int precision) {
+    if (binary()) {
+        // The precision tells floats and doubles apart.
+        char bytes[8];
+        size_t count = 0;
+        uint64_t bits = 0;
+        if (precision == kFloatPrecision) {
+            float f = static_cast<float>(value);
+            uint32_t bits32;
+            memcpy(&bits32, &f, sizeof(bits32));
+            bits = bits32;
+            count = 4;
+        } else {
+            memcpy(&bits, &value, sizeof(bits));
+            count = 8;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            bytes[i] = static_cast<char>((bits >> (8 * i)) & 0xff);
+        }
+        PutTag(count == 4 ? dump_binary::kFloat : dump_binary::kDouble);
+        PutBytes(std::string_view(bytes, count));
+        return *this;
+    }
+    if (std::isnan(value)) {
+        return WriteScalar(".nan");
+    }
+    if (std::isinf(value)) {
+        return WriteScalar(value > 0 ? ".inf" : "-.inf");
+    }
+    char text[40];
+    int len = snprintf(text, sizeof(text), "%.*g", precision, value);
+    if (len < 0) {
+        return WriteScalar(".nan");
+    }
+    // The C locale may have been changed by the application.
+    for (int i = 0; i < len; ++i) {
+        if (text[i] == ',') {
+            text[i] = '.';
+        }
+    }
+    return WriteScalar(std::string_view(text, static_cast<size_t>(len)));
+}
+
+DumpEmitter& DumpEmitter::WriteString(std::string_view value, bool intern) {
+    if (binary()) {
+        PutString(value, intern);
+        return *this;
+    }
+    bool flow = !frames_.empty() && frames_.back().flow;
+    BeginNode(false);
+    if (IsPlainSafe(value, flow)) {
+        Put(value);
+    } else {
+        WriteQuoted(value);
+    }
+    EndNode();
+    return *this;
+}
+
+void DumpEmitter::WriteQuoted(std::string_view value) {
+    static const char kHex[] = "0123456789abcdef";
+    Put('"');
+    size_t run_start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != 0x7f && c != '"' && c != '\\') {
+            continue;
+        }
+        Put(value.substr(run_start, i - run_start));
+        run_start = i + 1;
+        switch (c) {
+            case '"':
+                Put("\\\"");
+                break;
+            case '\\':
+                Put("\\\\");
+                break;
+            case '\n':
+                Put("\\n");
+                break;
+            case '\t':
+                Put("\\t");
+                break;
+            case '\r':
+                Put("\\r");
+                break;
+            default: {
+                char escape[4] = {'\\', 'x', kHex[c >> 4], kHex[c & 0xf]};
+                Put(std::string_view(escape, sizeof(escape)));
+                break;
+            }
+        }
+    }
+    Put(value.substr(run_start));
+    Put('"');
+}
+
+}  // namespace crash_diagnostic_layer
@@ -0,0 +1,227 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <yaml-cpp/emittermanip.h>
+
+namespace crash_diagnostic_layer {
+
+enum class DumpFormat {
+    kYaml = 0,
+    // See dump_binary.h.
+    kBinary,
+};
+
+//
+// DumpEmitter writes block style YAML for crash dumps.
+//
+// It takes the same manipulators as YAML::Emitter (YAML::BeginMap, YAML::Key,
+// YAML::Comment(), ...) so printing code reads the same, but it never builds
+// the document in memory. Each scalar is formatted straight into a fixed size
+// buffer that is handed to write(2) when it fills up, and the only other state
+// is one small frame per open collection. Memory use does not depend on the
+// size of the dump.
+//
+// Like YAML::Emitter, map entries alternate between keys and values, so
+// YAML::Key and YAML::Value only document intent, and YAML::Hex only applies
+// to the next node. Collections that are still open at the end are left open,
+// which is valid for block style.
+//
+// A default constructed emitter keeps the document in memory instead, for the
+// short reports that are logged with c_str().
+//
+// In DumpFormat::kBinary the same calls are recorded as compact binary events
+// instead of text, see dump_binary.h. ReadBinaryDump() plays them back into a
+// YAML emitter to get the text this emitter would have written.
+//
+class DumpEmitter {
+   public:
+    DumpEmitter();
+    // Streams to fd, and closes it when done if owns_fd is set.
+    DumpEmitter(int fd, bool owns_fd, DumpFormat format = DumpFormat::kYaml);
+    DumpEmitter(DumpEmitter&& other) noexcept;
+    DumpEmitter& operator=(DumpEmitter&&) = delete;
+    DumpEmitter(const DumpEmitter&) = delete;
+    DumpEmitter& operator=(const DumpEmitter&) = delete;
+    ~DumpEmitter();
+
+    // Creates or truncates the file at path. Falls back to YAML on stderr if
+    // the file can't be opened.
+    static DumpEmitter OpenFile(const std::filesystem::path& path, DumpFormat format = DumpFormat::kYaml,
+                                bool* opened = nullptr);
+
+    // Hands the buffered output to the file. Called automatically when the
+    // buffer is full and on destruction.
+    void Flush();
+
+    // Writes count entries of the collection that is open, by calling
+    // write_entry for each index. Each call must write whole entries, such as
+    // one sequence element or map key and value, starting with the entry
+    // itself rather than a comment.
+    //
+    // The entries are formatted on worker threads into memory and written out
+    // in index order, so the output is the same as calling write_entry in
+    // order on this emitter. Entries that can't be formatted ahead, because
+    // the one before them changed the layout or they are too large to hold in
+    // memory, are formatted again here. write_entry may therefore be called
+    // more than once for an index, and from any thread, so it must only read
+    // the state it dumps. Binary dumps, in memory emitters and so nested
+    // calls are written in order on the calling thread.
+    void WriteEntries(size_t count, const std::function<void(size_t index, DumpEmitter& os)>& write_entry);
+
+    // Marks everything written until EndRecord() as one record of the given
+    // type, such as a Command::Type. Binary dumps store records length
+    // prefixed so readers can skip them. YAML output is not affected.
+    void BeginRecord(uint32_t type);
+    void EndRecord();
+
+    bool binary() const { return format_ == DumpFormat::kBinary; }
+    bool good() const { return good_; }
+    // Number of bytes written so far.
+    size_t size() const { return size_; }
+    // Only valid for in memory emitters.
+    const char* c_str() const { return memory_.c_str(); }
+
+    DumpEmitter& operator<<(YAML::EMITTER_MANIP manip);
+    DumpEmitter& operator<<(const YAML::_Comment& comment);
+
+    // Binary dumps store const char* strings, which are mostly literals, once
+    // in a string table. Other strings are stored where they are used.
+    DumpEmitter& operator<<(const std::string& value) { return WriteString(value, false); }
+    DumpEmitter& operator<<(const char* value) { return WriteString(value ? value : "", true); }
+    DumpEmitter& operator<<(char value) { return WriteString(std::string_view(&value, 1), false); }
+    DumpEmitter& operator<<(bool value) { return WriteBool(value); }
+
+    DumpEmitter& operator<<(signed char value) { return WriteSigned(value); }
+    DumpEmitter& operator<<(short value) { return WriteSigned(value); }
+    DumpEmitter& operator<<(int value) { return WriteSigned(value); }
+    DumpEmitter& operator<<(long value) { return WriteSigned(value); }
+    DumpEmitter& operator<<(long long value) { return WriteSigned(value); }
+    DumpEmitter& operator<<(unsigned char value) { return WriteUnsigned(value); }
+    DumpEmitter& operator<<(unsigned short value) { return WriteUnsigned(value); }
+    DumpEmitter& operator<<(unsigned int value) { return WriteUnsigned(value); }
+    DumpEmitter& operator<<(unsigned long value) { return WriteUnsigned(value); }
+    DumpEmitter& operator<<(unsigned long long value) { return WriteUnsigned(value); }
+
+    DumpEmitter& operator<<(float value) { return WriteFloat(value, kFloatPrecision); }
+    DumpEmitter& operator<<(double value) { return WriteFloat(value, kDoublePrecision); }
+
+   private:
+    static constexpr size_t kBufferSize = 64 * 1024;
+    // Enough significant digits to read back the same value.
+    static constexpr int kFloatPrecision = 9;
+    static constexpr int kDoublePrecision = 17;
+    // Limits on the binary string table, so unusual strings can't make it
+    // grow without bound. Strings that don't fit are stored inline.
+    static constexpr size_t kMaxInternedStrings = 64 * 1024;
+    static constexpr size_t kMaxInternedLength = 256;
+    // Bounds on the memory WriteEntries() uses for entries formatted ahead.
+    static constexpr size_t kMaxAheadSize = 16 * 1024 * 1024;
+    static constexpr size_t kMaxFragmentSize = 4 * 1024 * 1024;
+
+    enum class FrameType { kMap, kSeq };
+    struct Frame {
+        FrameType type;
+        bool flow;
+        // Column of the entries of a block collection.
+        uint32_t indent;
+        // The first entry goes on the current line, after "- " or at the
+        // start of the document.
+        bool inline_first;
+        // Number of keys and values written.
+        uint32_t count;
+    };
+
+    DumpEmitter& WriteSigned(long long value);
+    DumpEmitter& WriteUnsigned(unsigned long long value);
+    DumpEmitter& WriteFloat(double value, int precision);
+    DumpEmitter& WriteString(std::string_view value, bool intern);
+    DumpEmitter& WriteBool(bool value);
+    DumpEmitter& WriteScalar(std::string_view text);
+
+    // Returns an in memory emitter that formats as if it continued this one.
+    // With after_entry set, as if an entry had been written since.
+    DumpEmitter Fork(bool after_entry) const;
+    // Appends the output of a fragment forked from base, if it is what this
+    // emitter would have written itself, and takes on its state.
+    bool Join(const DumpEmitter& base, bool after_entry, const DumpEmitter& fragment);
+
+    void BeginNode(bool block_collection);
+    void EndNode();
+    void BeginCollection(FrameType type);
+    void EndCollection(FrameType type);
+    void StartLine(uint32_t indent);
+    void WriteQuoted(std::string_view value);
+
+    void Put(std::string_view text);
+    void Put(char c);
+    void Append(const char* data, size_t size);
+    void WriteToFile(const char* data, size_t size);
+
+    void PutTag(uint8_t tag);
+    void PutVarint(uint64_t value);
+    void PutBytes(std::string_view bytes);
+    // Writes a string scalar, or a comment, adding it to the string table
+    // first if needed.
+    void PutString(std::string_view value, bool intern, bool comment = false);
+
+    DumpFormat format_{DumpFormat::kYaml};
+    int fd_{-1};
+    bool owns_fd_{false};
+    std::unique_ptr<char[]> buffer_;
+    size_t buffer_used_{0};
+    std::string memory_;
+
+    std::vector<Frame> frames_;
+    size_t column_{0};
+    char last_char_{0};
+    bool line_has_comment_{false};
+    bool next_flow_{false};
+    bool hex_{false};
+    bool good_{true};
+    size_t size_{0};
+    // In memory emitters stop keeping output past this many bytes, and are no
+    // longer good. 0 means no limit.
+    size_t memory_limit_{0};
+
+    // Binary format state. string_storage_ owns the text of strings_ keys.
+    std::deque<std::string> string_storage_;
+    std::unordered_map<std::string_view, uint32_t> strings_;
+    uint32_t record_depth_{0};
+    size_t record_header_size_{0};
+    std::string record_;
+};
+
+// Plays back a binary dump into os, which is normally a YAML emitter. On
+// error, such as a dump cut short by the application exiting, everything
+// before the error is still played back and false is returned.
+bool ReadBinaryDump(std::string_view data, DumpEmitter& os, std::string* error = nullptr);
+
+// Checks for the binary dump file header.
+bool IsBinaryDump(std::string_view data);
+
+}  // namespace crash_diagnostic_layer
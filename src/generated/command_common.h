@@ -33,6 +33,14 @@
 #include <vector>
 #include <vulkan/vulkan.h>
 
+// Node of the debug label stack active when a command was recorded. Nodes are
+// allocated by the CommandRecorder and linked to their enclosing label, so
+// commands recorded in the same label region share a single node.
+struct CommandLabel {
+    const char* name;
+    const CommandLabel* parent;
+};
+
 // Enumerate commands that have one parameter of type VkCommandBuffer.
 struct Command {
     enum Type {
@@ -310,7 +318,7 @@ struct Command {
     Type type;
     uint32_t id;
     void* parameters;
-    std::vector<std::string> labels;
+    const CommandLabel* labels;
 };  // struct Command
 
 // Define structs for command parameters
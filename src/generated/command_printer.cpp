@@ -34,7 +34,7 @@
 
 // Define print functions.
 
-void CommandPrinter::PrintBeginCommandBufferArgs(YAML::Emitter &os, const BeginCommandBufferArgs &args) {
+void CommandPrinter::PrintBeginCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const BeginCommandBufferArgs &args) {
     os << YAML::Key << "pBeginInfo";
     // pointer
     if (args.pBeginInfo != nullptr) {
@@ -44,15 +44,15 @@ void CommandPrinter::PrintBeginCommandBufferArgs(YAML::Emitter &os, const BeginC
     }
 }
 
-void CommandPrinter::PrintEndCommandBufferArgs(YAML::Emitter &os, const EndCommandBufferArgs &args) {}
+void CommandPrinter::PrintEndCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const EndCommandBufferArgs &args) {}
 
-void CommandPrinter::PrintResetCommandBufferArgs(YAML::Emitter &os, const ResetCommandBufferArgs &args) {
+void CommandPrinter::PrintResetCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const ResetCommandBufferArgs &args) {
     os << YAML::Key << "flags";
     // flags -> Field -> VkCommandBufferResetFlags
     os << YAML::Value << args.flags;
 }
 
-void CommandPrinter::PrintCmdBindPipelineArgs(YAML::Emitter &os, const CmdBindPipelineArgs &args) {
+void CommandPrinter::PrintCmdBindPipelineArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindPipelineArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
     os << YAML::Value << args.pipelineBindPoint;
@@ -61,7 +61,7 @@ void CommandPrinter::PrintCmdBindPipelineArgs(YAML::Emitter &os, const CmdBindPi
     os << YAML::Value << args.pipeline;
 }
 
-void CommandPrinter::PrintCmdSetViewportArgs(YAML::Emitter &os, const CmdSetViewportArgs &args) {
+void CommandPrinter::PrintCmdSetViewportArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportArgs &args) {
     os << YAML::Key << "firstViewport";
     // firstViewport -> Field -> uint32_t
     os << YAML::Value << args.firstViewport;
@@ -85,7 +85,7 @@ void CommandPrinter::PrintCmdSetViewportArgs(YAML::Emitter &os, const CmdSetView
     }
 }
 
-void CommandPrinter::PrintCmdSetScissorArgs(YAML::Emitter &os, const CmdSetScissorArgs &args) {
+void CommandPrinter::PrintCmdSetScissorArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorArgs &args) {
     os << YAML::Key << "firstScissor";
     // firstScissor -> Field -> uint32_t
     os << YAML::Value << args.firstScissor;
@@ -109,13 +109,13 @@ void CommandPrinter::PrintCmdSetScissorArgs(YAML::Emitter &os, const CmdSetSciss
     }
 }
 
-void CommandPrinter::PrintCmdSetLineWidthArgs(YAML::Emitter &os, const CmdSetLineWidthArgs &args) {
+void CommandPrinter::PrintCmdSetLineWidthArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineWidthArgs &args) {
     os << YAML::Key << "lineWidth";
     // lineWidth -> Field -> float
     os << YAML::Value << args.lineWidth;
 }
 
-void CommandPrinter::PrintCmdSetDepthBiasArgs(YAML::Emitter &os, const CmdSetDepthBiasArgs &args) {
+void CommandPrinter::PrintCmdSetDepthBiasArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasArgs &args) {
     os << YAML::Key << "depthBiasConstantFactor";
     // depthBiasConstantFactor -> Field -> float
     os << YAML::Value << args.depthBiasConstantFactor;
@@ -127,7 +127,7 @@ void CommandPrinter::PrintCmdSetDepthBiasArgs(YAML::Emitter &os, const CmdSetDep
     os << YAML::Value << args.depthBiasSlopeFactor;
 }
 
-void CommandPrinter::PrintCmdSetBlendConstantsArgs(YAML::Emitter &os, const CmdSetBlendConstantsArgs &args) {
+void CommandPrinter::PrintCmdSetBlendConstantsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetBlendConstantsArgs &args) {
     os << YAML::Key << "blendConstants";
     // blendConstants -> Field -> ConstFixedArray(float)
     {
@@ -143,7 +143,7 @@ void CommandPrinter::PrintCmdSetBlendConstantsArgs(YAML::Emitter &os, const CmdS
     }
 }
 
-void CommandPrinter::PrintCmdSetDepthBoundsArgs(YAML::Emitter &os, const CmdSetDepthBoundsArgs &args) {
+void CommandPrinter::PrintCmdSetDepthBoundsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBoundsArgs &args) {
     os << YAML::Key << "minDepthBounds";
     // minDepthBounds -> Field -> float
     os << YAML::Value << args.minDepthBounds;
@@ -152,7 +152,7 @@ void CommandPrinter::PrintCmdSetDepthBoundsArgs(YAML::Emitter &os, const CmdSetD
     os << YAML::Value << args.maxDepthBounds;
 }
 
-void CommandPrinter::PrintCmdSetStencilCompareMaskArgs(YAML::Emitter &os, const CmdSetStencilCompareMaskArgs &args) {
+void CommandPrinter::PrintCmdSetStencilCompareMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilCompareMaskArgs &args) {
     os << YAML::Key << "faceMask";
     // faceMask -> Field -> VkStencilFaceFlags
     os << YAML::Value << args.faceMask;
@@ -161,7 +161,7 @@ void CommandPrinter::PrintCmdSetStencilCompareMaskArgs(YAML::Emitter &os, const
     os << YAML::Value << args.compareMask;
 }
 
-void CommandPrinter::PrintCmdSetStencilWriteMaskArgs(YAML::Emitter &os, const CmdSetStencilWriteMaskArgs &args) {
+void CommandPrinter::PrintCmdSetStencilWriteMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilWriteMaskArgs &args) {
     os << YAML::Key << "faceMask";
     // faceMask -> Field -> VkStencilFaceFlags
     os << YAML::Value << args.faceMask;
@@ -170,7 +170,7 @@ void CommandPrinter::PrintCmdSetStencilWriteMaskArgs(YAML::Emitter &os, const Cm
     os << YAML::Value << args.writeMask;
 }
 
-void CommandPrinter::PrintCmdSetStencilReferenceArgs(YAML::Emitter &os, const CmdSetStencilReferenceArgs &args) {
+void CommandPrinter::PrintCmdSetStencilReferenceArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilReferenceArgs &args) {
     os << YAML::Key << "faceMask";
     // faceMask -> Field -> VkStencilFaceFlags
     os << YAML::Value << args.faceMask;
@@ -179,7 +179,7 @@ void CommandPrinter::PrintCmdSetStencilReferenceArgs(YAML::Emitter &os, const Cm
     os << YAML::Value << args.reference;
 }
 
-void CommandPrinter::PrintCmdBindDescriptorSetsArgs(YAML::Emitter &os, const CmdBindDescriptorSetsArgs &args) {
+void CommandPrinter::PrintCmdBindDescriptorSetsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorSetsArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
     os << YAML::Value << args.pipelineBindPoint;
@@ -227,7 +227,7 @@ void CommandPrinter::PrintCmdBindDescriptorSetsArgs(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdBindIndexBufferArgs(YAML::Emitter &os, const CmdBindIndexBufferArgs &args) {
+void CommandPrinter::PrintCmdBindIndexBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindIndexBufferArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -239,7 +239,7 @@ void CommandPrinter::PrintCmdBindIndexBufferArgs(YAML::Emitter &os, const CmdBin
     os << YAML::Value << args.indexType;
 }
 
-void CommandPrinter::PrintCmdBindVertexBuffersArgs(YAML::Emitter &os, const CmdBindVertexBuffersArgs &args) {
+void CommandPrinter::PrintCmdBindVertexBuffersArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffersArgs &args) {
     os << YAML::Key << "firstBinding";
     // firstBinding -> Field -> uint32_t
     os << YAML::Value << args.firstBinding;
@@ -278,7 +278,7 @@ void CommandPrinter::PrintCmdBindVertexBuffersArgs(YAML::Emitter &os, const CmdB
     }
 }
 
-void CommandPrinter::PrintCmdDrawArgs(YAML::Emitter &os, const CmdDrawArgs &args) {
+void CommandPrinter::PrintCmdDrawArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawArgs &args) {
     os << YAML::Key << "vertexCount";
     // vertexCount -> Field -> uint32_t
     os << YAML::Value << args.vertexCount;
@@ -293,7 +293,7 @@ void CommandPrinter::PrintCmdDrawArgs(YAML::Emitter &os, const CmdDrawArgs &args
     os << YAML::Value << args.firstInstance;
 }
 
-void CommandPrinter::PrintCmdDrawIndexedArgs(YAML::Emitter &os, const CmdDrawIndexedArgs &args) {
+void CommandPrinter::PrintCmdDrawIndexedArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedArgs &args) {
     os << YAML::Key << "indexCount";
     // indexCount -> Field -> uint32_t
     os << YAML::Value << args.indexCount;
@@ -311,7 +311,7 @@ void CommandPrinter::PrintCmdDrawIndexedArgs(YAML::Emitter &os, const CmdDrawInd
     os << YAML::Value << args.firstInstance;
 }
 
-void CommandPrinter::PrintCmdDrawIndirectArgs(YAML::Emitter &os, const CmdDrawIndirectArgs &args) {
+void CommandPrinter::PrintCmdDrawIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -326,7 +326,7 @@ void CommandPrinter::PrintCmdDrawIndirectArgs(YAML::Emitter &os, const CmdDrawIn
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawIndexedIndirectArgs(YAML::Emitter &os, const CmdDrawIndexedIndirectArgs &args) {
+void CommandPrinter::PrintCmdDrawIndexedIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedIndirectArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -341,7 +341,7 @@ void CommandPrinter::PrintCmdDrawIndexedIndirectArgs(YAML::Emitter &os, const Cm
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDispatchArgs(YAML::Emitter &os, const CmdDispatchArgs &args) {
+void CommandPrinter::PrintCmdDispatchArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchArgs &args) {
     os << YAML::Key << "groupCountX";
     // groupCountX -> Field -> uint32_t
     os << YAML::Value << args.groupCountX;
@@ -353,7 +353,7 @@ void CommandPrinter::PrintCmdDispatchArgs(YAML::Emitter &os, const CmdDispatchAr
     os << YAML::Value << args.groupCountZ;
 }
 
-void CommandPrinter::PrintCmdDispatchIndirectArgs(YAML::Emitter &os, const CmdDispatchIndirectArgs &args) {
+void CommandPrinter::PrintCmdDispatchIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchIndirectArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -362,7 +362,7 @@ void CommandPrinter::PrintCmdDispatchIndirectArgs(YAML::Emitter &os, const CmdDi
     os << YAML::Value << args.offset;
 }
 
-void CommandPrinter::PrintCmdCopyBufferArgs(YAML::Emitter &os, const CmdCopyBufferArgs &args) {
+void CommandPrinter::PrintCmdCopyBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferArgs &args) {
     os << YAML::Key << "srcBuffer";
     // srcBuffer -> Field -> VkBuffer
     os << YAML::Value << args.srcBuffer;
@@ -389,7 +389,7 @@ void CommandPrinter::PrintCmdCopyBufferArgs(YAML::Emitter &os, const CmdCopyBuff
     }
 }
 
-void CommandPrinter::PrintCmdCopyImageArgs(YAML::Emitter &os, const CmdCopyImageArgs &args) {
+void CommandPrinter::PrintCmdCopyImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageArgs &args) {
     os << YAML::Key << "srcImage";
     // srcImage -> Field -> VkImage
     os << YAML::Value << args.srcImage;
@@ -422,7 +422,7 @@ void CommandPrinter::PrintCmdCopyImageArgs(YAML::Emitter &os, const CmdCopyImage
     }
 }
 
-void CommandPrinter::PrintCmdBlitImageArgs(YAML::Emitter &os, const CmdBlitImageArgs &args) {
+void CommandPrinter::PrintCmdBlitImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImageArgs &args) {
     os << YAML::Key << "srcImage";
     // srcImage -> Field -> VkImage
     os << YAML::Value << args.srcImage;
@@ -458,7 +458,7 @@ void CommandPrinter::PrintCmdBlitImageArgs(YAML::Emitter &os, const CmdBlitImage
     os << YAML::Value << args.filter;
 }
 
-void CommandPrinter::PrintCmdCopyBufferToImageArgs(YAML::Emitter &os, const CmdCopyBufferToImageArgs &args) {
+void CommandPrinter::PrintCmdCopyBufferToImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImageArgs &args) {
     os << YAML::Key << "srcBuffer";
     // srcBuffer -> Field -> VkBuffer
     os << YAML::Value << args.srcBuffer;
@@ -488,7 +488,7 @@ void CommandPrinter::PrintCmdCopyBufferToImageArgs(YAML::Emitter &os, const CmdC
     }
 }
 
-void CommandPrinter::PrintCmdCopyImageToBufferArgs(YAML::Emitter &os, const CmdCopyImageToBufferArgs &args) {
+void CommandPrinter::PrintCmdCopyImageToBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBufferArgs &args) {
     os << YAML::Key << "srcImage";
     // srcImage -> Field -> VkImage
     os << YAML::Value << args.srcImage;
@@ -518,7 +518,7 @@ void CommandPrinter::PrintCmdCopyImageToBufferArgs(YAML::Emitter &os, const CmdC
     }
 }
 
-void CommandPrinter::PrintCmdUpdateBufferArgs(YAML::Emitter &os, const CmdUpdateBufferArgs &args) {
+void CommandPrinter::PrintCmdUpdateBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdUpdateBufferArgs &args) {
     os << YAML::Key << "dstBuffer";
     // dstBuffer -> Field -> VkBuffer
     os << YAML::Value << args.dstBuffer;
@@ -543,7 +543,7 @@ void CommandPrinter::PrintCmdUpdateBufferArgs(YAML::Emitter &os, const CmdUpdate
     }
 }
 
-void CommandPrinter::PrintCmdFillBufferArgs(YAML::Emitter &os, const CmdFillBufferArgs &args) {
+void CommandPrinter::PrintCmdFillBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdFillBufferArgs &args) {
     os << YAML::Key << "dstBuffer";
     // dstBuffer -> Field -> VkBuffer
     os << YAML::Value << args.dstBuffer;
@@ -558,7 +558,7 @@ void CommandPrinter::PrintCmdFillBufferArgs(YAML::Emitter &os, const CmdFillBuff
     os << YAML::Value << args.data;
 }
 
-void CommandPrinter::PrintCmdClearColorImageArgs(YAML::Emitter &os, const CmdClearColorImageArgs &args) {
+void CommandPrinter::PrintCmdClearColorImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearColorImageArgs &args) {
     os << YAML::Key << "image";
     // image -> Field -> VkImage
     os << YAML::Value << args.image;
@@ -592,7 +592,7 @@ void CommandPrinter::PrintCmdClearColorImageArgs(YAML::Emitter &os, const CmdCle
     }
 }
 
-void CommandPrinter::PrintCmdClearDepthStencilImageArgs(YAML::Emitter &os, const CmdClearDepthStencilImageArgs &args) {
+void CommandPrinter::PrintCmdClearDepthStencilImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearDepthStencilImageArgs &args) {
     os << YAML::Key << "image";
     // image -> Field -> VkImage
     os << YAML::Value << args.image;
@@ -626,7 +626,7 @@ void CommandPrinter::PrintCmdClearDepthStencilImageArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdClearAttachmentsArgs(YAML::Emitter &os, const CmdClearAttachmentsArgs &args) {
+void CommandPrinter::PrintCmdClearAttachmentsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearAttachmentsArgs &args) {
     os << YAML::Key << "attachmentCount";
     // attachmentCount -> Field -> uint32_t
     os << YAML::Value << args.attachmentCount;
@@ -665,7 +665,7 @@ void CommandPrinter::PrintCmdClearAttachmentsArgs(YAML::Emitter &os, const CmdCl
     }
 }
 
-void CommandPrinter::PrintCmdResolveImageArgs(YAML::Emitter &os, const CmdResolveImageArgs &args) {
+void CommandPrinter::PrintCmdResolveImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImageArgs &args) {
     os << YAML::Key << "srcImage";
     // srcImage -> Field -> VkImage
     os << YAML::Value << args.srcImage;
@@ -698,7 +698,7 @@ void CommandPrinter::PrintCmdResolveImageArgs(YAML::Emitter &os, const CmdResolv
     }
 }
 
-void CommandPrinter::PrintCmdSetEventArgs(YAML::Emitter &os, const CmdSetEventArgs &args) {
+void CommandPrinter::PrintCmdSetEventArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEventArgs &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -707,7 +707,7 @@ void CommandPrinter::PrintCmdSetEventArgs(YAML::Emitter &os, const CmdSetEventAr
     os << YAML::Value << args.stageMask;
 }
 
-void CommandPrinter::PrintCmdResetEventArgs(YAML::Emitter &os, const CmdResetEventArgs &args) {
+void CommandPrinter::PrintCmdResetEventArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEventArgs &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -716,7 +716,7 @@ void CommandPrinter::PrintCmdResetEventArgs(YAML::Emitter &os, const CmdResetEve
     os << YAML::Value << args.stageMask;
 }
 
-void CommandPrinter::PrintCmdWaitEventsArgs(YAML::Emitter &os, const CmdWaitEventsArgs &args) {
+void CommandPrinter::PrintCmdWaitEventsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEventsArgs &args) {
     os << YAML::Key << "eventCount";
     // eventCount -> Field -> uint32_t
     os << YAML::Value << args.eventCount;
@@ -797,7 +797,7 @@ void CommandPrinter::PrintCmdWaitEventsArgs(YAML::Emitter &os, const CmdWaitEven
     }
 }
 
-void CommandPrinter::PrintCmdPipelineBarrierArgs(YAML::Emitter &os, const CmdPipelineBarrierArgs &args) {
+void CommandPrinter::PrintCmdPipelineBarrierArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrierArgs &args) {
     os << YAML::Key << "srcStageMask";
     // srcStageMask -> Field -> VkPipelineStageFlags
     os << YAML::Value << args.srcStageMask;
@@ -863,7 +863,7 @@ void CommandPrinter::PrintCmdPipelineBarrierArgs(YAML::Emitter &os, const CmdPip
     }
 }
 
-void CommandPrinter::PrintCmdBeginQueryArgs(YAML::Emitter &os, const CmdBeginQueryArgs &args) {
+void CommandPrinter::PrintCmdBeginQueryArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginQueryArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -875,7 +875,7 @@ void CommandPrinter::PrintCmdBeginQueryArgs(YAML::Emitter &os, const CmdBeginQue
     os << YAML::Value << args.flags;
 }
 
-void CommandPrinter::PrintCmdEndQueryArgs(YAML::Emitter &os, const CmdEndQueryArgs &args) {
+void CommandPrinter::PrintCmdEndQueryArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndQueryArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -884,7 +884,7 @@ void CommandPrinter::PrintCmdEndQueryArgs(YAML::Emitter &os, const CmdEndQueryAr
     os << YAML::Value << args.query;
 }
 
-void CommandPrinter::PrintCmdResetQueryPoolArgs(YAML::Emitter &os, const CmdResetQueryPoolArgs &args) {
+void CommandPrinter::PrintCmdResetQueryPoolArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetQueryPoolArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -896,7 +896,7 @@ void CommandPrinter::PrintCmdResetQueryPoolArgs(YAML::Emitter &os, const CmdRese
     os << YAML::Value << args.queryCount;
 }
 
-void CommandPrinter::PrintCmdWriteTimestampArgs(YAML::Emitter &os, const CmdWriteTimestampArgs &args) {
+void CommandPrinter::PrintCmdWriteTimestampArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestampArgs &args) {
     os << YAML::Key << "pipelineStage";
     // pipelineStage -> Field -> VkPipelineStageFlagBits
     os << YAML::Value << args.pipelineStage;
@@ -908,7 +908,7 @@ void CommandPrinter::PrintCmdWriteTimestampArgs(YAML::Emitter &os, const CmdWrit
     os << YAML::Value << args.query;
 }
 
-void CommandPrinter::PrintCmdCopyQueryPoolResultsArgs(YAML::Emitter &os, const CmdCopyQueryPoolResultsArgs &args) {
+void CommandPrinter::PrintCmdCopyQueryPoolResultsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyQueryPoolResultsArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -932,7 +932,7 @@ void CommandPrinter::PrintCmdCopyQueryPoolResultsArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.flags;
 }
 
-void CommandPrinter::PrintCmdPushConstantsArgs(YAML::Emitter &os, const CmdPushConstantsArgs &args) {
+void CommandPrinter::PrintCmdPushConstantsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushConstantsArgs &args) {
     os << YAML::Key << "layout";
     // layout -> Field -> VkPipelineLayout
     os << YAML::Value << args.layout;
@@ -960,7 +960,7 @@ void CommandPrinter::PrintCmdPushConstantsArgs(YAML::Emitter &os, const CmdPushC
     }
 }
 
-void CommandPrinter::PrintCmdBeginRenderPassArgs(YAML::Emitter &os, const CmdBeginRenderPassArgs &args) {
+void CommandPrinter::PrintCmdBeginRenderPassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPassArgs &args) {
     os << YAML::Key << "pRenderPassBegin";
     // pointer
     if (args.pRenderPassBegin != nullptr) {
@@ -973,15 +973,15 @@ void CommandPrinter::PrintCmdBeginRenderPassArgs(YAML::Emitter &os, const CmdBeg
     os << YAML::Value << args.contents;
 }
 
-void CommandPrinter::PrintCmdNextSubpassArgs(YAML::Emitter &os, const CmdNextSubpassArgs &args) {
+void CommandPrinter::PrintCmdNextSubpassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpassArgs &args) {
     os << YAML::Key << "contents";
     // contents -> Field -> VkSubpassContents
     os << YAML::Value << args.contents;
 }
 
-void CommandPrinter::PrintCmdEndRenderPassArgs(YAML::Emitter &os, const CmdEndRenderPassArgs &args) {}
+void CommandPrinter::PrintCmdEndRenderPassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPassArgs &args) {}
 
-void CommandPrinter::PrintCmdExecuteCommandsArgs(YAML::Emitter &os, const CmdExecuteCommandsArgs &args) {
+void CommandPrinter::PrintCmdExecuteCommandsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdExecuteCommandsArgs &args) {
     os << YAML::Key << "commandBufferCount";
     // commandBufferCount -> Field -> uint32_t
     os << YAML::Value << args.commandBufferCount;
@@ -1002,13 +1002,13 @@ void CommandPrinter::PrintCmdExecuteCommandsArgs(YAML::Emitter &os, const CmdExe
     }
 }
 
-void CommandPrinter::PrintCmdSetDeviceMaskArgs(YAML::Emitter &os, const CmdSetDeviceMaskArgs &args) {
+void CommandPrinter::PrintCmdSetDeviceMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDeviceMaskArgs &args) {
     os << YAML::Key << "deviceMask";
     // deviceMask -> Field -> uint32_t
     os << YAML::Value << args.deviceMask;
 }
 
-void CommandPrinter::PrintCmdDispatchBaseArgs(YAML::Emitter &os, const CmdDispatchBaseArgs &args) {
+void CommandPrinter::PrintCmdDispatchBaseArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchBaseArgs &args) {
     os << YAML::Key << "baseGroupX";
     // baseGroupX -> Field -> uint32_t
     os << YAML::Value << args.baseGroupX;
@@ -1029,7 +1029,7 @@ void CommandPrinter::PrintCmdDispatchBaseArgs(YAML::Emitter &os, const CmdDispat
     os << YAML::Value << args.groupCountZ;
 }
 
-void CommandPrinter::PrintCmdDrawIndirectCountArgs(YAML::Emitter &os, const CmdDrawIndirectCountArgs &args) {
+void CommandPrinter::PrintCmdDrawIndirectCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -1050,7 +1050,7 @@ void CommandPrinter::PrintCmdDrawIndirectCountArgs(YAML::Emitter &os, const CmdD
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawIndexedIndirectCountArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawIndexedIndirectCountArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdDrawIndexedIndirectCountArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -1072,7 +1072,7 @@ void CommandPrinter::PrintCmdDrawIndexedIndirectCountArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdBeginRenderPass2Args(YAML::Emitter &os, const CmdBeginRenderPass2Args &args) {
+void CommandPrinter::PrintCmdBeginRenderPass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPass2Args &args) {
     os << YAML::Key << "pRenderPassBegin";
     // pointer
     if (args.pRenderPassBegin != nullptr) {
@@ -1089,7 +1089,7 @@ void CommandPrinter::PrintCmdBeginRenderPass2Args(YAML::Emitter &os, const CmdBe
     }
 }
 
-void CommandPrinter::PrintCmdNextSubpass2Args(YAML::Emitter &os, const CmdNextSubpass2Args &args) {
+void CommandPrinter::PrintCmdNextSubpass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpass2Args &args) {
     os << YAML::Key << "pSubpassBeginInfo";
     // pointer
     if (args.pSubpassBeginInfo != nullptr) {
@@ -1106,7 +1106,7 @@ void CommandPrinter::PrintCmdNextSubpass2Args(YAML::Emitter &os, const CmdNextSu
     }
 }
 
-void CommandPrinter::PrintCmdEndRenderPass2Args(YAML::Emitter &os, const CmdEndRenderPass2Args &args) {
+void CommandPrinter::PrintCmdEndRenderPass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPass2Args &args) {
     os << YAML::Key << "pSubpassEndInfo";
     // pointer
     if (args.pSubpassEndInfo != nullptr) {
@@ -1116,7 +1116,7 @@ void CommandPrinter::PrintCmdEndRenderPass2Args(YAML::Emitter &os, const CmdEndR
     }
 }
 
-void CommandPrinter::PrintCmdSetEvent2Args(YAML::Emitter &os, const CmdSetEvent2Args &args) {
+void CommandPrinter::PrintCmdSetEvent2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEvent2Args &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -1129,7 +1129,7 @@ void CommandPrinter::PrintCmdSetEvent2Args(YAML::Emitter &os, const CmdSetEvent2
     }
 }
 
-void CommandPrinter::PrintCmdResetEvent2Args(YAML::Emitter &os, const CmdResetEvent2Args &args) {
+void CommandPrinter::PrintCmdResetEvent2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEvent2Args &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -1138,7 +1138,7 @@ void CommandPrinter::PrintCmdResetEvent2Args(YAML::Emitter &os, const CmdResetEv
     os << YAML::Value << args.stageMask;
 }
 
-void CommandPrinter::PrintCmdWaitEvents2Args(YAML::Emitter &os, const CmdWaitEvents2Args &args) {
+void CommandPrinter::PrintCmdWaitEvents2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEvents2Args &args) {
     os << YAML::Key << "eventCount";
     // eventCount -> Field -> uint32_t
     os << YAML::Value << args.eventCount;
@@ -1174,7 +1174,7 @@ void CommandPrinter::PrintCmdWaitEvents2Args(YAML::Emitter &os, const CmdWaitEve
     }
 }
 
-void CommandPrinter::PrintCmdPipelineBarrier2Args(YAML::Emitter &os, const CmdPipelineBarrier2Args &args) {
+void CommandPrinter::PrintCmdPipelineBarrier2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrier2Args &args) {
     os << YAML::Key << "pDependencyInfo";
     // pointer
     if (args.pDependencyInfo != nullptr) {
@@ -1184,7 +1184,7 @@ void CommandPrinter::PrintCmdPipelineBarrier2Args(YAML::Emitter &os, const CmdPi
     }
 }
 
-void CommandPrinter::PrintCmdWriteTimestamp2Args(YAML::Emitter &os, const CmdWriteTimestamp2Args &args) {
+void CommandPrinter::PrintCmdWriteTimestamp2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestamp2Args &args) {
     os << YAML::Key << "stage";
     // stage -> Field -> VkPipelineStageFlags2
     os << YAML::Value << args.stage;
@@ -1196,7 +1196,7 @@ void CommandPrinter::PrintCmdWriteTimestamp2Args(YAML::Emitter &os, const CmdWri
     os << YAML::Value << args.query;
 }
 
-void CommandPrinter::PrintCmdCopyBuffer2Args(YAML::Emitter &os, const CmdCopyBuffer2Args &args) {
+void CommandPrinter::PrintCmdCopyBuffer2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBuffer2Args &args) {
     os << YAML::Key << "pCopyBufferInfo";
     // pointer
     if (args.pCopyBufferInfo != nullptr) {
@@ -1206,7 +1206,7 @@ void CommandPrinter::PrintCmdCopyBuffer2Args(YAML::Emitter &os, const CmdCopyBuf
     }
 }
 
-void CommandPrinter::PrintCmdCopyImage2Args(YAML::Emitter &os, const CmdCopyImage2Args &args) {
+void CommandPrinter::PrintCmdCopyImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImage2Args &args) {
     os << YAML::Key << "pCopyImageInfo";
     // pointer
     if (args.pCopyImageInfo != nullptr) {
@@ -1216,7 +1216,7 @@ void CommandPrinter::PrintCmdCopyImage2Args(YAML::Emitter &os, const CmdCopyImag
     }
 }
 
-void CommandPrinter::PrintCmdCopyBufferToImage2Args(YAML::Emitter &os, const CmdCopyBufferToImage2Args &args) {
+void CommandPrinter::PrintCmdCopyBufferToImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImage2Args &args) {
     os << YAML::Key << "pCopyBufferToImageInfo";
     // pointer
     if (args.pCopyBufferToImageInfo != nullptr) {
@@ -1226,7 +1226,7 @@ void CommandPrinter::PrintCmdCopyBufferToImage2Args(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdCopyImageToBuffer2Args(YAML::Emitter &os, const CmdCopyImageToBuffer2Args &args) {
+void CommandPrinter::PrintCmdCopyImageToBuffer2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBuffer2Args &args) {
     os << YAML::Key << "pCopyImageToBufferInfo";
     // pointer
     if (args.pCopyImageToBufferInfo != nullptr) {
@@ -1236,7 +1236,7 @@ void CommandPrinter::PrintCmdCopyImageToBuffer2Args(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdBlitImage2Args(YAML::Emitter &os, const CmdBlitImage2Args &args) {
+void CommandPrinter::PrintCmdBlitImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImage2Args &args) {
     os << YAML::Key << "pBlitImageInfo";
     // pointer
     if (args.pBlitImageInfo != nullptr) {
@@ -1246,7 +1246,7 @@ void CommandPrinter::PrintCmdBlitImage2Args(YAML::Emitter &os, const CmdBlitImag
     }
 }
 
-void CommandPrinter::PrintCmdResolveImage2Args(YAML::Emitter &os, const CmdResolveImage2Args &args) {
+void CommandPrinter::PrintCmdResolveImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImage2Args &args) {
     os << YAML::Key << "pResolveImageInfo";
     // pointer
     if (args.pResolveImageInfo != nullptr) {
@@ -1256,7 +1256,7 @@ void CommandPrinter::PrintCmdResolveImage2Args(YAML::Emitter &os, const CmdResol
     }
 }
 
-void CommandPrinter::PrintCmdBeginRenderingArgs(YAML::Emitter &os, const CmdBeginRenderingArgs &args) {
+void CommandPrinter::PrintCmdBeginRenderingArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderingArgs &args) {
     os << YAML::Key << "pRenderingInfo";
     // pointer
     if (args.pRenderingInfo != nullptr) {
@@ -1266,27 +1266,27 @@ void CommandPrinter::PrintCmdBeginRenderingArgs(YAML::Emitter &os, const CmdBegi
     }
 }
 
-void CommandPrinter::PrintCmdEndRenderingArgs(YAML::Emitter &os, const CmdEndRenderingArgs &args) {}
+void CommandPrinter::PrintCmdEndRenderingArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderingArgs &args) {}
 
-void CommandPrinter::PrintCmdSetCullModeArgs(YAML::Emitter &os, const CmdSetCullModeArgs &args) {
+void CommandPrinter::PrintCmdSetCullModeArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCullModeArgs &args) {
     os << YAML::Key << "cullMode";
     // cullMode -> Field -> VkCullModeFlags
     os << YAML::Value << args.cullMode;
 }
 
-void CommandPrinter::PrintCmdSetFrontFaceArgs(YAML::Emitter &os, const CmdSetFrontFaceArgs &args) {
+void CommandPrinter::PrintCmdSetFrontFaceArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFrontFaceArgs &args) {
     os << YAML::Key << "frontFace";
     // frontFace -> Field -> VkFrontFace
     os << YAML::Value << args.frontFace;
 }
 
-void CommandPrinter::PrintCmdSetPrimitiveTopologyArgs(YAML::Emitter &os, const CmdSetPrimitiveTopologyArgs &args) {
+void CommandPrinter::PrintCmdSetPrimitiveTopologyArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPrimitiveTopologyArgs &args) {
     os << YAML::Key << "primitiveTopology";
     // primitiveTopology -> Field -> VkPrimitiveTopology
     os << YAML::Value << args.primitiveTopology;
 }
 
-void CommandPrinter::PrintCmdSetViewportWithCountArgs(YAML::Emitter &os, const CmdSetViewportWithCountArgs &args) {
+void CommandPrinter::PrintCmdSetViewportWithCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWithCountArgs &args) {
     os << YAML::Key << "viewportCount";
     // viewportCount -> Field -> uint32_t
     os << YAML::Value << args.viewportCount;
@@ -1307,7 +1307,7 @@ void CommandPrinter::PrintCmdSetViewportWithCountArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdSetScissorWithCountArgs(YAML::Emitter &os, const CmdSetScissorWithCountArgs &args) {
+void CommandPrinter::PrintCmdSetScissorWithCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorWithCountArgs &args) {
     os << YAML::Key << "scissorCount";
     // scissorCount -> Field -> uint32_t
     os << YAML::Value << args.scissorCount;
@@ -1328,7 +1328,7 @@ void CommandPrinter::PrintCmdSetScissorWithCountArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdBindVertexBuffers2Args(YAML::Emitter &os, const CmdBindVertexBuffers2Args &args) {
+void CommandPrinter::PrintCmdBindVertexBuffers2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffers2Args &args) {
     os << YAML::Key << "firstBinding";
     // firstBinding -> Field -> uint32_t
     os << YAML::Value << args.firstBinding;
@@ -1397,38 +1397,38 @@ void CommandPrinter::PrintCmdBindVertexBuffers2Args(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdSetDepthTestEnableArgs(YAML::Emitter &os, const CmdSetDepthTestEnableArgs &args) {
+void CommandPrinter::PrintCmdSetDepthTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthTestEnableArgs &args) {
     os << YAML::Key << "depthTestEnable";
     // depthTestEnable -> Field -> VkBool32
     os << YAML::Value << args.depthTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthWriteEnableArgs(YAML::Emitter &os, const CmdSetDepthWriteEnableArgs &args) {
+void CommandPrinter::PrintCmdSetDepthWriteEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthWriteEnableArgs &args) {
     os << YAML::Key << "depthWriteEnable";
     // depthWriteEnable -> Field -> VkBool32
     os << YAML::Value << args.depthWriteEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthCompareOpArgs(YAML::Emitter &os, const CmdSetDepthCompareOpArgs &args) {
+void CommandPrinter::PrintCmdSetDepthCompareOpArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthCompareOpArgs &args) {
     os << YAML::Key << "depthCompareOp";
     // depthCompareOp -> Field -> VkCompareOp
     os << YAML::Value << args.depthCompareOp;
 }
 
-void CommandPrinter::PrintCmdSetDepthBoundsTestEnableArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDepthBoundsTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdSetDepthBoundsTestEnableArgs &args) {
     os << YAML::Key << "depthBoundsTestEnable";
     // depthBoundsTestEnable -> Field -> VkBool32
     os << YAML::Value << args.depthBoundsTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetStencilTestEnableArgs(YAML::Emitter &os, const CmdSetStencilTestEnableArgs &args) {
+void CommandPrinter::PrintCmdSetStencilTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilTestEnableArgs &args) {
     os << YAML::Key << "stencilTestEnable";
     // stencilTestEnable -> Field -> VkBool32
     os << YAML::Value << args.stencilTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetStencilOpArgs(YAML::Emitter &os, const CmdSetStencilOpArgs &args) {
+void CommandPrinter::PrintCmdSetStencilOpArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilOpArgs &args) {
     os << YAML::Key << "faceMask";
     // faceMask -> Field -> VkStencilFaceFlags
     os << YAML::Value << args.faceMask;
@@ -1446,27 +1446,27 @@ void CommandPrinter::PrintCmdSetStencilOpArgs(YAML::Emitter &os, const CmdSetSte
     os << YAML::Value << args.compareOp;
 }
 
-void CommandPrinter::PrintCmdSetRasterizerDiscardEnableArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetRasterizerDiscardEnableArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetRasterizerDiscardEnableArgs &args) {
     os << YAML::Key << "rasterizerDiscardEnable";
     // rasterizerDiscardEnable -> Field -> VkBool32
     os << YAML::Value << args.rasterizerDiscardEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthBiasEnableArgs(YAML::Emitter &os, const CmdSetDepthBiasEnableArgs &args) {
+void CommandPrinter::PrintCmdSetDepthBiasEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasEnableArgs &args) {
     os << YAML::Key << "depthBiasEnable";
     // depthBiasEnable -> Field -> VkBool32
     os << YAML::Value << args.depthBiasEnable;
 }
 
-void CommandPrinter::PrintCmdSetPrimitiveRestartEnableArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPrimitiveRestartEnableArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetPrimitiveRestartEnableArgs &args) {
     os << YAML::Key << "primitiveRestartEnable";
     // primitiveRestartEnable -> Field -> VkBool32
     os << YAML::Value << args.primitiveRestartEnable;
 }
 
-void CommandPrinter::PrintCmdBeginVideoCodingKHRArgs(YAML::Emitter &os, const CmdBeginVideoCodingKHRArgs &args) {
+void CommandPrinter::PrintCmdBeginVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginVideoCodingKHRArgs &args) {
     os << YAML::Key << "pBeginInfo";
     // pointer
     if (args.pBeginInfo != nullptr) {
@@ -1476,7 +1476,7 @@ void CommandPrinter::PrintCmdBeginVideoCodingKHRArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdEndVideoCodingKHRArgs(YAML::Emitter &os, const CmdEndVideoCodingKHRArgs &args) {
+void CommandPrinter::PrintCmdEndVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndVideoCodingKHRArgs &args) {
     os << YAML::Key << "pEndCodingInfo";
     // pointer
     if (args.pEndCodingInfo != nullptr) {
@@ -1486,7 +1486,7 @@ void CommandPrinter::PrintCmdEndVideoCodingKHRArgs(YAML::Emitter &os, const CmdE
     }
 }
 
-void CommandPrinter::PrintCmdControlVideoCodingKHRArgs(YAML::Emitter &os, const CmdControlVideoCodingKHRArgs &args) {
+void CommandPrinter::PrintCmdControlVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdControlVideoCodingKHRArgs &args) {
     os << YAML::Key << "pCodingControlInfo";
     // pointer
     if (args.pCodingControlInfo != nullptr) {
@@ -1496,7 +1496,7 @@ void CommandPrinter::PrintCmdControlVideoCodingKHRArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdDecodeVideoKHRArgs(YAML::Emitter &os, const CmdDecodeVideoKHRArgs &args) {
+void CommandPrinter::PrintCmdDecodeVideoKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDecodeVideoKHRArgs &args) {
     os << YAML::Key << "pDecodeInfo";
     // pointer
     if (args.pDecodeInfo != nullptr) {
@@ -1506,7 +1506,7 @@ void CommandPrinter::PrintCmdDecodeVideoKHRArgs(YAML::Emitter &os, const CmdDeco
     }
 }
 
-void CommandPrinter::PrintCmdBeginRenderingKHRArgs(YAML::Emitter &os, const CmdBeginRenderingKHRArgs &args) {
+void CommandPrinter::PrintCmdBeginRenderingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderingKHRArgs &args) {
     os << YAML::Key << "pRenderingInfo";
     // pointer
     if (args.pRenderingInfo != nullptr) {
@@ -1516,15 +1516,15 @@ void CommandPrinter::PrintCmdBeginRenderingKHRArgs(YAML::Emitter &os, const CmdB
     }
 }
 
-void CommandPrinter::PrintCmdEndRenderingKHRArgs(YAML::Emitter &os, const CmdEndRenderingKHRArgs &args) {}
+void CommandPrinter::PrintCmdEndRenderingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderingKHRArgs &args) {}
 
-void CommandPrinter::PrintCmdSetDeviceMaskKHRArgs(YAML::Emitter &os, const CmdSetDeviceMaskKHRArgs &args) {
+void CommandPrinter::PrintCmdSetDeviceMaskKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDeviceMaskKHRArgs &args) {
     os << YAML::Key << "deviceMask";
     // deviceMask -> Field -> uint32_t
     os << YAML::Value << args.deviceMask;
 }
 
-void CommandPrinter::PrintCmdDispatchBaseKHRArgs(YAML::Emitter &os, const CmdDispatchBaseKHRArgs &args) {
+void CommandPrinter::PrintCmdDispatchBaseKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchBaseKHRArgs &args) {
     os << YAML::Key << "baseGroupX";
     // baseGroupX -> Field -> uint32_t
     os << YAML::Value << args.baseGroupX;
@@ -1545,7 +1545,7 @@ void CommandPrinter::PrintCmdDispatchBaseKHRArgs(YAML::Emitter &os, const CmdDis
     os << YAML::Value << args.groupCountZ;
 }
 
-void CommandPrinter::PrintCmdPushDescriptorSetKHRArgs(YAML::Emitter &os, const CmdPushDescriptorSetKHRArgs &args) {
+void CommandPrinter::PrintCmdPushDescriptorSetKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushDescriptorSetKHRArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
     os << YAML::Value << args.pipelineBindPoint;
@@ -1575,7 +1575,7 @@ void CommandPrinter::PrintCmdPushDescriptorSetKHRArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdPushDescriptorSetWithTemplateKHRArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdPushDescriptorSetWithTemplateKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                   const CmdPushDescriptorSetWithTemplateKHRArgs &args) {
     os << YAML::Key << "descriptorUpdateTemplate";
     // descriptorUpdateTemplate -> Field -> VkDescriptorUpdateTemplate
@@ -1591,7 +1591,7 @@ void CommandPrinter::PrintCmdPushDescriptorSetWithTemplateKHRArgs(YAML::Emitter
     os << YAML::Value << "NOT_AVAILABLE";
 }
 
-void CommandPrinter::PrintCmdBeginRenderPass2KHRArgs(YAML::Emitter &os, const CmdBeginRenderPass2KHRArgs &args) {
+void CommandPrinter::PrintCmdBeginRenderPass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPass2KHRArgs &args) {
     os << YAML::Key << "pRenderPassBegin";
     // pointer
     if (args.pRenderPassBegin != nullptr) {
@@ -1608,7 +1608,7 @@ void CommandPrinter::PrintCmdBeginRenderPass2KHRArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdNextSubpass2KHRArgs(YAML::Emitter &os, const CmdNextSubpass2KHRArgs &args) {
+void CommandPrinter::PrintCmdNextSubpass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpass2KHRArgs &args) {
     os << YAML::Key << "pSubpassBeginInfo";
     // pointer
     if (args.pSubpassBeginInfo != nullptr) {
@@ -1625,7 +1625,7 @@ void CommandPrinter::PrintCmdNextSubpass2KHRArgs(YAML::Emitter &os, const CmdNex
     }
 }
 
-void CommandPrinter::PrintCmdEndRenderPass2KHRArgs(YAML::Emitter &os, const CmdEndRenderPass2KHRArgs &args) {
+void CommandPrinter::PrintCmdEndRenderPass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPass2KHRArgs &args) {
     os << YAML::Key << "pSubpassEndInfo";
     // pointer
     if (args.pSubpassEndInfo != nullptr) {
@@ -1635,7 +1635,7 @@ void CommandPrinter::PrintCmdEndRenderPass2KHRArgs(YAML::Emitter &os, const CmdE
     }
 }
 
-void CommandPrinter::PrintCmdDrawIndirectCountKHRArgs(YAML::Emitter &os, const CmdDrawIndirectCountKHRArgs &args) {
+void CommandPrinter::PrintCmdDrawIndirectCountKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountKHRArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -1656,7 +1656,7 @@ void CommandPrinter::PrintCmdDrawIndirectCountKHRArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawIndexedIndirectCountKHRArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawIndexedIndirectCountKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdDrawIndexedIndirectCountKHRArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -1678,7 +1678,7 @@ void CommandPrinter::PrintCmdDrawIndexedIndirectCountKHRArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdSetFragmentShadingRateKHRArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetFragmentShadingRateKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetFragmentShadingRateKHRArgs &args) {
     os << YAML::Key << "pFragmentSize";
     // pointer
@@ -1703,7 +1703,7 @@ void CommandPrinter::PrintCmdSetFragmentShadingRateKHRArgs(YAML::Emitter &os,
 }
 
 void CommandPrinter::PrintCmdSetRenderingAttachmentLocationsKHRArgs(
-    YAML::Emitter &os, const CmdSetRenderingAttachmentLocationsKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetRenderingAttachmentLocationsKHRArgs &args) {
     os << YAML::Key << "pLocationInfo";
     // pointer
     if (args.pLocationInfo != nullptr) {
@@ -1714,7 +1714,7 @@ void CommandPrinter::PrintCmdSetRenderingAttachmentLocationsKHRArgs(
 }
 
 void CommandPrinter::PrintCmdSetRenderingInputAttachmentIndicesKHRArgs(
-    YAML::Emitter &os, const CmdSetRenderingInputAttachmentIndicesKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetRenderingInputAttachmentIndicesKHRArgs &args) {
     os << YAML::Key << "pInputAttachmentIndexInfo";
     // pointer
     if (args.pInputAttachmentIndexInfo != nullptr) {
@@ -1724,7 +1724,7 @@ void CommandPrinter::PrintCmdSetRenderingInputAttachmentIndicesKHRArgs(
     }
 }
 
-void CommandPrinter::PrintCmdEncodeVideoKHRArgs(YAML::Emitter &os, const CmdEncodeVideoKHRArgs &args) {
+void CommandPrinter::PrintCmdEncodeVideoKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEncodeVideoKHRArgs &args) {
     os << YAML::Key << "pEncodeInfo";
     // pointer
     if (args.pEncodeInfo != nullptr) {
@@ -1734,7 +1734,7 @@ void CommandPrinter::PrintCmdEncodeVideoKHRArgs(YAML::Emitter &os, const CmdEnco
     }
 }
 
-void CommandPrinter::PrintCmdSetEvent2KHRArgs(YAML::Emitter &os, const CmdSetEvent2KHRArgs &args) {
+void CommandPrinter::PrintCmdSetEvent2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEvent2KHRArgs &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -1747,7 +1747,7 @@ void CommandPrinter::PrintCmdSetEvent2KHRArgs(YAML::Emitter &os, const CmdSetEve
     }
 }
 
-void CommandPrinter::PrintCmdResetEvent2KHRArgs(YAML::Emitter &os, const CmdResetEvent2KHRArgs &args) {
+void CommandPrinter::PrintCmdResetEvent2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEvent2KHRArgs &args) {
     os << YAML::Key << "event";
     // event -> Field -> VkEvent
     os << YAML::Value << args.event;
@@ -1756,7 +1756,7 @@ void CommandPrinter::PrintCmdResetEvent2KHRArgs(YAML::Emitter &os, const CmdRese
     os << YAML::Value << args.stageMask;
 }
 
-void CommandPrinter::PrintCmdWaitEvents2KHRArgs(YAML::Emitter &os, const CmdWaitEvents2KHRArgs &args) {
+void CommandPrinter::PrintCmdWaitEvents2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEvents2KHRArgs &args) {
     os << YAML::Key << "eventCount";
     // eventCount -> Field -> uint32_t
     os << YAML::Value << args.eventCount;
@@ -1792,7 +1792,7 @@ void CommandPrinter::PrintCmdWaitEvents2KHRArgs(YAML::Emitter &os, const CmdWait
     }
 }
 
-void CommandPrinter::PrintCmdPipelineBarrier2KHRArgs(YAML::Emitter &os, const CmdPipelineBarrier2KHRArgs &args) {
+void CommandPrinter::PrintCmdPipelineBarrier2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrier2KHRArgs &args) {
     os << YAML::Key << "pDependencyInfo";
     // pointer
     if (args.pDependencyInfo != nullptr) {
@@ -1802,7 +1802,7 @@ void CommandPrinter::PrintCmdPipelineBarrier2KHRArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdWriteTimestamp2KHRArgs(YAML::Emitter &os, const CmdWriteTimestamp2KHRArgs &args) {
+void CommandPrinter::PrintCmdWriteTimestamp2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestamp2KHRArgs &args) {
     os << YAML::Key << "stage";
     // stage -> Field -> VkPipelineStageFlags2
     os << YAML::Value << args.stage;
@@ -1814,7 +1814,7 @@ void CommandPrinter::PrintCmdWriteTimestamp2KHRArgs(YAML::Emitter &os, const Cmd
     os << YAML::Value << args.query;
 }
 
-void CommandPrinter::PrintCmdWriteBufferMarker2AMDArgs(YAML::Emitter &os, const CmdWriteBufferMarker2AMDArgs &args) {
+void CommandPrinter::PrintCmdWriteBufferMarker2AMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteBufferMarker2AMDArgs &args) {
     os << YAML::Key << "stage";
     // stage -> Field -> VkPipelineStageFlags2
     os << YAML::Value << args.stage;
@@ -1829,7 +1829,7 @@ void CommandPrinter::PrintCmdWriteBufferMarker2AMDArgs(YAML::Emitter &os, const
     os << YAML::Value << args.marker;
 }
 
-void CommandPrinter::PrintCmdCopyBuffer2KHRArgs(YAML::Emitter &os, const CmdCopyBuffer2KHRArgs &args) {
+void CommandPrinter::PrintCmdCopyBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBuffer2KHRArgs &args) {
     os << YAML::Key << "pCopyBufferInfo";
     // pointer
     if (args.pCopyBufferInfo != nullptr) {
@@ -1839,7 +1839,7 @@ void CommandPrinter::PrintCmdCopyBuffer2KHRArgs(YAML::Emitter &os, const CmdCopy
     }
 }
 
-void CommandPrinter::PrintCmdCopyImage2KHRArgs(YAML::Emitter &os, const CmdCopyImage2KHRArgs &args) {
+void CommandPrinter::PrintCmdCopyImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImage2KHRArgs &args) {
     os << YAML::Key << "pCopyImageInfo";
     // pointer
     if (args.pCopyImageInfo != nullptr) {
@@ -1849,7 +1849,7 @@ void CommandPrinter::PrintCmdCopyImage2KHRArgs(YAML::Emitter &os, const CmdCopyI
     }
 }
 
-void CommandPrinter::PrintCmdCopyBufferToImage2KHRArgs(YAML::Emitter &os, const CmdCopyBufferToImage2KHRArgs &args) {
+void CommandPrinter::PrintCmdCopyBufferToImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImage2KHRArgs &args) {
     os << YAML::Key << "pCopyBufferToImageInfo";
     // pointer
     if (args.pCopyBufferToImageInfo != nullptr) {
@@ -1859,7 +1859,7 @@ void CommandPrinter::PrintCmdCopyBufferToImage2KHRArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdCopyImageToBuffer2KHRArgs(YAML::Emitter &os, const CmdCopyImageToBuffer2KHRArgs &args) {
+void CommandPrinter::PrintCmdCopyImageToBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBuffer2KHRArgs &args) {
     os << YAML::Key << "pCopyImageToBufferInfo";
     // pointer
     if (args.pCopyImageToBufferInfo != nullptr) {
@@ -1869,7 +1869,7 @@ void CommandPrinter::PrintCmdCopyImageToBuffer2KHRArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdBlitImage2KHRArgs(YAML::Emitter &os, const CmdBlitImage2KHRArgs &args) {
+void CommandPrinter::PrintCmdBlitImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImage2KHRArgs &args) {
     os << YAML::Key << "pBlitImageInfo";
     // pointer
     if (args.pBlitImageInfo != nullptr) {
@@ -1879,7 +1879,7 @@ void CommandPrinter::PrintCmdBlitImage2KHRArgs(YAML::Emitter &os, const CmdBlitI
     }
 }
 
-void CommandPrinter::PrintCmdResolveImage2KHRArgs(YAML::Emitter &os, const CmdResolveImage2KHRArgs &args) {
+void CommandPrinter::PrintCmdResolveImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImage2KHRArgs &args) {
     os << YAML::Key << "pResolveImageInfo";
     // pointer
     if (args.pResolveImageInfo != nullptr) {
@@ -1889,13 +1889,13 @@ void CommandPrinter::PrintCmdResolveImage2KHRArgs(YAML::Emitter &os, const CmdRe
     }
 }
 
-void CommandPrinter::PrintCmdTraceRaysIndirect2KHRArgs(YAML::Emitter &os, const CmdTraceRaysIndirect2KHRArgs &args) {
+void CommandPrinter::PrintCmdTraceRaysIndirect2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysIndirect2KHRArgs &args) {
     os << YAML::Key << "indirectDeviceAddress";
     // indirectDeviceAddress -> Field -> VkDeviceAddress
     os << YAML::Value << args.indirectDeviceAddress;
 }
 
-void CommandPrinter::PrintCmdBindIndexBuffer2KHRArgs(YAML::Emitter &os, const CmdBindIndexBuffer2KHRArgs &args) {
+void CommandPrinter::PrintCmdBindIndexBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindIndexBuffer2KHRArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -1910,7 +1910,7 @@ void CommandPrinter::PrintCmdBindIndexBuffer2KHRArgs(YAML::Emitter &os, const Cm
     os << YAML::Value << args.indexType;
 }
 
-void CommandPrinter::PrintCmdSetLineStippleKHRArgs(YAML::Emitter &os, const CmdSetLineStippleKHRArgs &args) {
+void CommandPrinter::PrintCmdSetLineStippleKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineStippleKHRArgs &args) {
     os << YAML::Key << "lineStippleFactor";
     // lineStippleFactor -> Field -> uint32_t
     os << YAML::Value << args.lineStippleFactor;
@@ -1919,7 +1919,7 @@ void CommandPrinter::PrintCmdSetLineStippleKHRArgs(YAML::Emitter &os, const CmdS
     os << YAML::Value << args.lineStipplePattern;
 }
 
-void CommandPrinter::PrintCmdBindDescriptorSets2KHRArgs(YAML::Emitter &os, const CmdBindDescriptorSets2KHRArgs &args) {
+void CommandPrinter::PrintCmdBindDescriptorSets2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorSets2KHRArgs &args) {
     os << YAML::Key << "pBindDescriptorSetsInfo";
     // pointer
     if (args.pBindDescriptorSetsInfo != nullptr) {
@@ -1929,7 +1929,7 @@ void CommandPrinter::PrintCmdBindDescriptorSets2KHRArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdPushConstants2KHRArgs(YAML::Emitter &os, const CmdPushConstants2KHRArgs &args) {
+void CommandPrinter::PrintCmdPushConstants2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushConstants2KHRArgs &args) {
     os << YAML::Key << "pPushConstantsInfo";
     // pointer
     if (args.pPushConstantsInfo != nullptr) {
@@ -1939,7 +1939,7 @@ void CommandPrinter::PrintCmdPushConstants2KHRArgs(YAML::Emitter &os, const CmdP
     }
 }
 
-void CommandPrinter::PrintCmdPushDescriptorSet2KHRArgs(YAML::Emitter &os, const CmdPushDescriptorSet2KHRArgs &args) {
+void CommandPrinter::PrintCmdPushDescriptorSet2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushDescriptorSet2KHRArgs &args) {
     os << YAML::Key << "pPushDescriptorSetInfo";
     // pointer
     if (args.pPushDescriptorSetInfo != nullptr) {
@@ -1950,7 +1950,7 @@ void CommandPrinter::PrintCmdPushDescriptorSet2KHRArgs(YAML::Emitter &os, const
 }
 
 void CommandPrinter::PrintCmdPushDescriptorSetWithTemplate2KHRArgs(
-    YAML::Emitter &os, const CmdPushDescriptorSetWithTemplate2KHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdPushDescriptorSetWithTemplate2KHRArgs &args) {
     os << YAML::Key << "pPushDescriptorSetWithTemplateInfo";
     // pointer
     if (args.pPushDescriptorSetWithTemplateInfo != nullptr) {
@@ -1960,7 +1960,7 @@ void CommandPrinter::PrintCmdPushDescriptorSetWithTemplate2KHRArgs(
     }
 }
 
-void CommandPrinter::PrintCmdSetDescriptorBufferOffsets2EXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDescriptorBufferOffsets2EXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                 const CmdSetDescriptorBufferOffsets2EXTArgs &args) {
     os << YAML::Key << "pSetDescriptorBufferOffsetsInfo";
     // pointer
@@ -1972,7 +1972,7 @@ void CommandPrinter::PrintCmdSetDescriptorBufferOffsets2EXTArgs(YAML::Emitter &o
 }
 
 void CommandPrinter::PrintCmdBindDescriptorBufferEmbeddedSamplers2EXTArgs(
-    YAML::Emitter &os, const CmdBindDescriptorBufferEmbeddedSamplers2EXTArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorBufferEmbeddedSamplers2EXTArgs &args) {
     os << YAML::Key << "pBindDescriptorBufferEmbeddedSamplersInfo";
     // pointer
     if (args.pBindDescriptorBufferEmbeddedSamplersInfo != nullptr) {
@@ -1982,7 +1982,7 @@ void CommandPrinter::PrintCmdBindDescriptorBufferEmbeddedSamplers2EXTArgs(
     }
 }
 
-void CommandPrinter::PrintCmdDebugMarkerBeginEXTArgs(YAML::Emitter &os, const CmdDebugMarkerBeginEXTArgs &args) {
+void CommandPrinter::PrintCmdDebugMarkerBeginEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerBeginEXTArgs &args) {
     os << YAML::Key << "pMarkerInfo";
     // pointer
     if (args.pMarkerInfo != nullptr) {
@@ -1992,9 +1992,9 @@ void CommandPrinter::PrintCmdDebugMarkerBeginEXTArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdDebugMarkerEndEXTArgs(YAML::Emitter &os, const CmdDebugMarkerEndEXTArgs &args) {}
+void CommandPrinter::PrintCmdDebugMarkerEndEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerEndEXTArgs &args) {}
 
-void CommandPrinter::PrintCmdDebugMarkerInsertEXTArgs(YAML::Emitter &os, const CmdDebugMarkerInsertEXTArgs &args) {
+void CommandPrinter::PrintCmdDebugMarkerInsertEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerInsertEXTArgs &args) {
     os << YAML::Key << "pMarkerInfo";
     // pointer
     if (args.pMarkerInfo != nullptr) {
@@ -2004,7 +2004,7 @@ void CommandPrinter::PrintCmdDebugMarkerInsertEXTArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdBindTransformFeedbackBuffersEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBindTransformFeedbackBuffersEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                  const CmdBindTransformFeedbackBuffersEXTArgs &args) {
     os << YAML::Key << "firstBinding";
     // firstBinding -> Field -> uint32_t
@@ -2059,7 +2059,7 @@ void CommandPrinter::PrintCmdBindTransformFeedbackBuffersEXTArgs(YAML::Emitter &
     }
 }
 
-void CommandPrinter::PrintCmdBeginTransformFeedbackEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBeginTransformFeedbackEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdBeginTransformFeedbackEXTArgs &args) {
     os << YAML::Key << "firstCounterBuffer";
     // firstCounterBuffer -> Field -> uint32_t
@@ -2099,7 +2099,7 @@ void CommandPrinter::PrintCmdBeginTransformFeedbackEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdEndTransformFeedbackEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdEndTransformFeedbackEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdEndTransformFeedbackEXTArgs &args) {
     os << YAML::Key << "firstCounterBuffer";
     // firstCounterBuffer -> Field -> uint32_t
@@ -2139,7 +2139,7 @@ void CommandPrinter::PrintCmdEndTransformFeedbackEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdBeginQueryIndexedEXTArgs(YAML::Emitter &os, const CmdBeginQueryIndexedEXTArgs &args) {
+void CommandPrinter::PrintCmdBeginQueryIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginQueryIndexedEXTArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -2154,7 +2154,7 @@ void CommandPrinter::PrintCmdBeginQueryIndexedEXTArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.index;
 }
 
-void CommandPrinter::PrintCmdEndQueryIndexedEXTArgs(YAML::Emitter &os, const CmdEndQueryIndexedEXTArgs &args) {
+void CommandPrinter::PrintCmdEndQueryIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndQueryIndexedEXTArgs &args) {
     os << YAML::Key << "queryPool";
     // queryPool -> Field -> VkQueryPool
     os << YAML::Value << args.queryPool;
@@ -2166,7 +2166,7 @@ void CommandPrinter::PrintCmdEndQueryIndexedEXTArgs(YAML::Emitter &os, const Cmd
     os << YAML::Value << args.index;
 }
 
-void CommandPrinter::PrintCmdDrawIndirectByteCountEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawIndirectByteCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdDrawIndirectByteCountEXTArgs &args) {
     os << YAML::Key << "instanceCount";
     // instanceCount -> Field -> uint32_t
@@ -2188,7 +2188,7 @@ void CommandPrinter::PrintCmdDrawIndirectByteCountEXTArgs(YAML::Emitter &os,
     os << YAML::Value << args.vertexStride;
 }
 
-void CommandPrinter::PrintCmdCuLaunchKernelNVXArgs(YAML::Emitter &os, const CmdCuLaunchKernelNVXArgs &args) {
+void CommandPrinter::PrintCmdCuLaunchKernelNVXArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCuLaunchKernelNVXArgs &args) {
     os << YAML::Key << "pLaunchInfo";
     // pointer
     if (args.pLaunchInfo != nullptr) {
@@ -2198,7 +2198,7 @@ void CommandPrinter::PrintCmdCuLaunchKernelNVXArgs(YAML::Emitter &os, const CmdC
     }
 }
 
-void CommandPrinter::PrintCmdDrawIndirectCountAMDArgs(YAML::Emitter &os, const CmdDrawIndirectCountAMDArgs &args) {
+void CommandPrinter::PrintCmdDrawIndirectCountAMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountAMDArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
     os << YAML::Value << args.buffer;
@@ -2219,7 +2219,7 @@ void CommandPrinter::PrintCmdDrawIndirectCountAMDArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawIndexedIndirectCountAMDArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawIndexedIndirectCountAMDArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdDrawIndexedIndirectCountAMDArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -2241,7 +2241,7 @@ void CommandPrinter::PrintCmdDrawIndexedIndirectCountAMDArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdBeginConditionalRenderingEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBeginConditionalRenderingEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdBeginConditionalRenderingEXTArgs &args) {
     os << YAML::Key << "pConditionalRenderingBegin";
     // pointer
@@ -2252,10 +2252,10 @@ void CommandPrinter::PrintCmdBeginConditionalRenderingEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdEndConditionalRenderingEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdEndConditionalRenderingEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdEndConditionalRenderingEXTArgs &args) {}
 
-void CommandPrinter::PrintCmdSetViewportWScalingNVArgs(YAML::Emitter &os, const CmdSetViewportWScalingNVArgs &args) {
+void CommandPrinter::PrintCmdSetViewportWScalingNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWScalingNVArgs &args) {
     os << YAML::Key << "firstViewport";
     // firstViewport -> Field -> uint32_t
     os << YAML::Value << args.firstViewport;
@@ -2279,7 +2279,7 @@ void CommandPrinter::PrintCmdSetViewportWScalingNVArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdSetDiscardRectangleEXTArgs(YAML::Emitter &os, const CmdSetDiscardRectangleEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDiscardRectangleEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDiscardRectangleEXTArgs &args) {
     os << YAML::Key << "firstDiscardRectangle";
     // firstDiscardRectangle -> Field -> uint32_t
     os << YAML::Value << args.firstDiscardRectangle;
@@ -2303,21 +2303,21 @@ void CommandPrinter::PrintCmdSetDiscardRectangleEXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdSetDiscardRectangleEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDiscardRectangleEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdSetDiscardRectangleEnableEXTArgs &args) {
     os << YAML::Key << "discardRectangleEnable";
     // discardRectangleEnable -> Field -> VkBool32
     os << YAML::Value << args.discardRectangleEnable;
 }
 
-void CommandPrinter::PrintCmdSetDiscardRectangleModeEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDiscardRectangleModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetDiscardRectangleModeEXTArgs &args) {
     os << YAML::Key << "discardRectangleMode";
     // discardRectangleMode -> Field -> VkDiscardRectangleModeEXT
     os << YAML::Value << args.discardRectangleMode;
 }
 
-void CommandPrinter::PrintCmdBeginDebugUtilsLabelEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBeginDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdBeginDebugUtilsLabelEXTArgs &args) {
     os << YAML::Key << "pLabelInfo";
     // pointer
@@ -2328,9 +2328,9 @@ void CommandPrinter::PrintCmdBeginDebugUtilsLabelEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdEndDebugUtilsLabelEXTArgs(YAML::Emitter &os, const CmdEndDebugUtilsLabelEXTArgs &args) {}
+void CommandPrinter::PrintCmdEndDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndDebugUtilsLabelEXTArgs &args) {}
 
-void CommandPrinter::PrintCmdInsertDebugUtilsLabelEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdInsertDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdInsertDebugUtilsLabelEXTArgs &args) {
     os << YAML::Key << "pLabelInfo";
     // pointer
@@ -2342,7 +2342,7 @@ void CommandPrinter::PrintCmdInsertDebugUtilsLabelEXTArgs(YAML::Emitter &os,
 }
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-void CommandPrinter::PrintCmdInitializeGraphScratchMemoryAMDXArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdInitializeGraphScratchMemoryAMDXArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                   const CmdInitializeGraphScratchMemoryAMDXArgs &args) {
     os << YAML::Key << "scratch";
     // scratch -> Field -> VkDeviceAddress
@@ -2351,7 +2351,7 @@ void CommandPrinter::PrintCmdInitializeGraphScratchMemoryAMDXArgs(YAML::Emitter
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-void CommandPrinter::PrintCmdDispatchGraphAMDXArgs(YAML::Emitter &os, const CmdDispatchGraphAMDXArgs &args) {
+void CommandPrinter::PrintCmdDispatchGraphAMDXArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchGraphAMDXArgs &args) {
     os << YAML::Key << "scratch";
     // scratch -> Field -> VkDeviceAddress
     os << YAML::Value << args.scratch;
@@ -2366,7 +2366,7 @@ void CommandPrinter::PrintCmdDispatchGraphAMDXArgs(YAML::Emitter &os, const CmdD
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-void CommandPrinter::PrintCmdDispatchGraphIndirectAMDXArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDispatchGraphIndirectAMDXArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdDispatchGraphIndirectAMDXArgs &args) {
     os << YAML::Key << "scratch";
     // scratch -> Field -> VkDeviceAddress
@@ -2382,7 +2382,7 @@ void CommandPrinter::PrintCmdDispatchGraphIndirectAMDXArgs(YAML::Emitter &os,
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-void CommandPrinter::PrintCmdDispatchGraphIndirectCountAMDXArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDispatchGraphIndirectCountAMDXArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                 const CmdDispatchGraphIndirectCountAMDXArgs &args) {
     os << YAML::Key << "scratch";
     // scratch -> Field -> VkDeviceAddress
@@ -2393,7 +2393,7 @@ void CommandPrinter::PrintCmdDispatchGraphIndirectCountAMDXArgs(YAML::Emitter &o
 }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
-void CommandPrinter::PrintCmdSetSampleLocationsEXTArgs(YAML::Emitter &os, const CmdSetSampleLocationsEXTArgs &args) {
+void CommandPrinter::PrintCmdSetSampleLocationsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetSampleLocationsEXTArgs &args) {
     os << YAML::Key << "pSampleLocationsInfo";
     // pointer
     if (args.pSampleLocationsInfo != nullptr) {
@@ -2403,7 +2403,7 @@ void CommandPrinter::PrintCmdSetSampleLocationsEXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdBindShadingRateImageNVArgs(YAML::Emitter &os, const CmdBindShadingRateImageNVArgs &args) {
+void CommandPrinter::PrintCmdBindShadingRateImageNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindShadingRateImageNVArgs &args) {
     os << YAML::Key << "imageView";
     // imageView -> Field -> VkImageView
     os << YAML::Value << args.imageView;
@@ -2412,7 +2412,7 @@ void CommandPrinter::PrintCmdBindShadingRateImageNVArgs(YAML::Emitter &os, const
     os << YAML::Value << args.imageLayout;
 }
 
-void CommandPrinter::PrintCmdSetViewportShadingRatePaletteNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetViewportShadingRatePaletteNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                  const CmdSetViewportShadingRatePaletteNVArgs &args) {
     os << YAML::Key << "firstViewport";
     // firstViewport -> Field -> uint32_t
@@ -2437,7 +2437,7 @@ void CommandPrinter::PrintCmdSetViewportShadingRatePaletteNVArgs(YAML::Emitter &
     }
 }
 
-void CommandPrinter::PrintCmdSetCoarseSampleOrderNVArgs(YAML::Emitter &os, const CmdSetCoarseSampleOrderNVArgs &args) {
+void CommandPrinter::PrintCmdSetCoarseSampleOrderNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoarseSampleOrderNVArgs &args) {
     os << YAML::Key << "sampleOrderType";
     // sampleOrderType -> Field -> VkCoarseSampleOrderTypeNV
     os << YAML::Value << args.sampleOrderType;
@@ -2461,7 +2461,7 @@ void CommandPrinter::PrintCmdSetCoarseSampleOrderNVArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdBuildAccelerationStructureNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBuildAccelerationStructureNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdBuildAccelerationStructureNVArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
@@ -2493,7 +2493,7 @@ void CommandPrinter::PrintCmdBuildAccelerationStructureNVArgs(YAML::Emitter &os,
     os << YAML::Value << args.scratchOffset;
 }
 
-void CommandPrinter::PrintCmdCopyAccelerationStructureNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdCopyAccelerationStructureNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdCopyAccelerationStructureNVArgs &args) {
     os << YAML::Key << "dst";
     // dst -> Field -> VkAccelerationStructureNV
@@ -2506,7 +2506,7 @@ void CommandPrinter::PrintCmdCopyAccelerationStructureNVArgs(YAML::Emitter &os,
     os << YAML::Value << args.mode;
 }
 
-void CommandPrinter::PrintCmdTraceRaysNVArgs(YAML::Emitter &os, const CmdTraceRaysNVArgs &args) {
+void CommandPrinter::PrintCmdTraceRaysNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysNVArgs &args) {
     os << YAML::Key << "raygenShaderBindingTableBuffer";
     // raygenShaderBindingTableBuffer -> Field -> VkBuffer
     os << YAML::Value << args.raygenShaderBindingTableBuffer;
@@ -2552,7 +2552,7 @@ void CommandPrinter::PrintCmdTraceRaysNVArgs(YAML::Emitter &os, const CmdTraceRa
 }
 
 void CommandPrinter::PrintCmdWriteAccelerationStructuresPropertiesNVArgs(
-    YAML::Emitter &os, const CmdWriteAccelerationStructuresPropertiesNVArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdWriteAccelerationStructuresPropertiesNVArgs &args) {
     os << YAML::Key << "accelerationStructureCount";
     // accelerationStructureCount -> Field -> uint32_t
     os << YAML::Value << args.accelerationStructureCount;
@@ -2582,7 +2582,7 @@ void CommandPrinter::PrintCmdWriteAccelerationStructuresPropertiesNVArgs(
     os << YAML::Value << args.firstQuery;
 }
 
-void CommandPrinter::PrintCmdWriteBufferMarkerAMDArgs(YAML::Emitter &os, const CmdWriteBufferMarkerAMDArgs &args) {
+void CommandPrinter::PrintCmdWriteBufferMarkerAMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteBufferMarkerAMDArgs &args) {
     os << YAML::Key << "pipelineStage";
     // pipelineStage -> Field -> VkPipelineStageFlagBits
     os << YAML::Value << args.pipelineStage;
@@ -2597,7 +2597,7 @@ void CommandPrinter::PrintCmdWriteBufferMarkerAMDArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.marker;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksNVArgs(YAML::Emitter &os, const CmdDrawMeshTasksNVArgs &args) {
+void CommandPrinter::PrintCmdDrawMeshTasksNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksNVArgs &args) {
     os << YAML::Key << "taskCount";
     // taskCount -> Field -> uint32_t
     os << YAML::Value << args.taskCount;
@@ -2606,7 +2606,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksNVArgs(YAML::Emitter &os, const CmdDra
     os << YAML::Value << args.firstTask;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksIndirectNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawMeshTasksIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdDrawMeshTasksIndirectNVArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -2622,7 +2622,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksIndirectNVArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdDrawMeshTasksIndirectCountNVArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -2644,7 +2644,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountNVArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdSetExclusiveScissorEnableNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetExclusiveScissorEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetExclusiveScissorEnableNVArgs &args) {
     os << YAML::Key << "firstExclusiveScissor";
     // firstExclusiveScissor -> Field -> uint32_t
@@ -2669,7 +2669,7 @@ void CommandPrinter::PrintCmdSetExclusiveScissorEnableNVArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetExclusiveScissorNVArgs(YAML::Emitter &os, const CmdSetExclusiveScissorNVArgs &args) {
+void CommandPrinter::PrintCmdSetExclusiveScissorNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetExclusiveScissorNVArgs &args) {
     os << YAML::Key << "firstExclusiveScissor";
     // firstExclusiveScissor -> Field -> uint32_t
     os << YAML::Value << args.firstExclusiveScissor;
@@ -2693,13 +2693,13 @@ void CommandPrinter::PrintCmdSetExclusiveScissorNVArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdSetCheckpointNVArgs(YAML::Emitter &os, const CmdSetCheckpointNVArgs &args) {
+void CommandPrinter::PrintCmdSetCheckpointNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCheckpointNVArgs &args) {
     os << YAML::Key << "pCheckpointMarker";
     // void
     os << YAML::Value << "NOT_AVAILABLE";
 }
 
-void CommandPrinter::PrintCmdSetPerformanceMarkerINTELArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPerformanceMarkerINTELArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetPerformanceMarkerINTELArgs &args) {
     os << YAML::Key << "pMarkerInfo";
     // pointer
@@ -2710,7 +2710,7 @@ void CommandPrinter::PrintCmdSetPerformanceMarkerINTELArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetPerformanceStreamMarkerINTELArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPerformanceStreamMarkerINTELArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                  const CmdSetPerformanceStreamMarkerINTELArgs &args) {
     os << YAML::Key << "pMarkerInfo";
     // pointer
@@ -2721,7 +2721,7 @@ void CommandPrinter::PrintCmdSetPerformanceStreamMarkerINTELArgs(YAML::Emitter &
     }
 }
 
-void CommandPrinter::PrintCmdSetPerformanceOverrideINTELArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPerformanceOverrideINTELArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetPerformanceOverrideINTELArgs &args) {
     os << YAML::Key << "pOverrideInfo";
     // pointer
@@ -2732,7 +2732,7 @@ void CommandPrinter::PrintCmdSetPerformanceOverrideINTELArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetLineStippleEXTArgs(YAML::Emitter &os, const CmdSetLineStippleEXTArgs &args) {
+void CommandPrinter::PrintCmdSetLineStippleEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineStippleEXTArgs &args) {
     os << YAML::Key << "lineStippleFactor";
     // lineStippleFactor -> Field -> uint32_t
     os << YAML::Value << args.lineStippleFactor;
@@ -2741,26 +2741,26 @@ void CommandPrinter::PrintCmdSetLineStippleEXTArgs(YAML::Emitter &os, const CmdS
     os << YAML::Value << args.lineStipplePattern;
 }
 
-void CommandPrinter::PrintCmdSetCullModeEXTArgs(YAML::Emitter &os, const CmdSetCullModeEXTArgs &args) {
+void CommandPrinter::PrintCmdSetCullModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCullModeEXTArgs &args) {
     os << YAML::Key << "cullMode";
     // cullMode -> Field -> VkCullModeFlags
     os << YAML::Value << args.cullMode;
 }
 
-void CommandPrinter::PrintCmdSetFrontFaceEXTArgs(YAML::Emitter &os, const CmdSetFrontFaceEXTArgs &args) {
+void CommandPrinter::PrintCmdSetFrontFaceEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFrontFaceEXTArgs &args) {
     os << YAML::Key << "frontFace";
     // frontFace -> Field -> VkFrontFace
     os << YAML::Value << args.frontFace;
 }
 
-void CommandPrinter::PrintCmdSetPrimitiveTopologyEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPrimitiveTopologyEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdSetPrimitiveTopologyEXTArgs &args) {
     os << YAML::Key << "primitiveTopology";
     // primitiveTopology -> Field -> VkPrimitiveTopology
     os << YAML::Value << args.primitiveTopology;
 }
 
-void CommandPrinter::PrintCmdSetViewportWithCountEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetViewportWithCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdSetViewportWithCountEXTArgs &args) {
     os << YAML::Key << "viewportCount";
     // viewportCount -> Field -> uint32_t
@@ -2782,7 +2782,7 @@ void CommandPrinter::PrintCmdSetViewportWithCountEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetScissorWithCountEXTArgs(YAML::Emitter &os, const CmdSetScissorWithCountEXTArgs &args) {
+void CommandPrinter::PrintCmdSetScissorWithCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorWithCountEXTArgs &args) {
     os << YAML::Key << "scissorCount";
     // scissorCount -> Field -> uint32_t
     os << YAML::Value << args.scissorCount;
@@ -2803,7 +2803,7 @@ void CommandPrinter::PrintCmdSetScissorWithCountEXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdBindVertexBuffers2EXTArgs(YAML::Emitter &os, const CmdBindVertexBuffers2EXTArgs &args) {
+void CommandPrinter::PrintCmdBindVertexBuffers2EXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffers2EXTArgs &args) {
     os << YAML::Key << "firstBinding";
     // firstBinding -> Field -> uint32_t
     os << YAML::Value << args.firstBinding;
@@ -2872,39 +2872,39 @@ void CommandPrinter::PrintCmdBindVertexBuffers2EXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdSetDepthTestEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthTestEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthTestEnableEXTArgs &args) {
     os << YAML::Key << "depthTestEnable";
     // depthTestEnable -> Field -> VkBool32
     os << YAML::Value << args.depthTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthWriteEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthWriteEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthWriteEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthWriteEnableEXTArgs &args) {
     os << YAML::Key << "depthWriteEnable";
     // depthWriteEnable -> Field -> VkBool32
     os << YAML::Value << args.depthWriteEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthCompareOpEXTArgs(YAML::Emitter &os, const CmdSetDepthCompareOpEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthCompareOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthCompareOpEXTArgs &args) {
     os << YAML::Key << "depthCompareOp";
     // depthCompareOp -> Field -> VkCompareOp
     os << YAML::Value << args.depthCompareOp;
 }
 
-void CommandPrinter::PrintCmdSetDepthBoundsTestEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDepthBoundsTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetDepthBoundsTestEnableEXTArgs &args) {
     os << YAML::Key << "depthBoundsTestEnable";
     // depthBoundsTestEnable -> Field -> VkBool32
     os << YAML::Value << args.depthBoundsTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetStencilTestEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetStencilTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdSetStencilTestEnableEXTArgs &args) {
     os << YAML::Key << "stencilTestEnable";
     // stencilTestEnable -> Field -> VkBool32
     os << YAML::Value << args.stencilTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetStencilOpEXTArgs(YAML::Emitter &os, const CmdSetStencilOpEXTArgs &args) {
+void CommandPrinter::PrintCmdSetStencilOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilOpEXTArgs &args) {
     os << YAML::Key << "faceMask";
     // faceMask -> Field -> VkStencilFaceFlags
     os << YAML::Value << args.faceMask;
@@ -2922,7 +2922,7 @@ void CommandPrinter::PrintCmdSetStencilOpEXTArgs(YAML::Emitter &os, const CmdSet
     os << YAML::Value << args.compareOp;
 }
 
-void CommandPrinter::PrintCmdPreprocessGeneratedCommandsNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdPreprocessGeneratedCommandsNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                const CmdPreprocessGeneratedCommandsNVArgs &args) {
     os << YAML::Key << "pGeneratedCommandsInfo";
     // pointer
@@ -2933,7 +2933,7 @@ void CommandPrinter::PrintCmdPreprocessGeneratedCommandsNVArgs(YAML::Emitter &os
     }
 }
 
-void CommandPrinter::PrintCmdExecuteGeneratedCommandsNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdExecuteGeneratedCommandsNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdExecuteGeneratedCommandsNVArgs &args) {
     os << YAML::Key << "isPreprocessed";
     // isPreprocessed -> Field -> VkBool32
@@ -2947,7 +2947,7 @@ void CommandPrinter::PrintCmdExecuteGeneratedCommandsNVArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdBindPipelineShaderGroupNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBindPipelineShaderGroupNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdBindPipelineShaderGroupNVArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
@@ -2960,7 +2960,7 @@ void CommandPrinter::PrintCmdBindPipelineShaderGroupNVArgs(YAML::Emitter &os,
     os << YAML::Value << args.groupIndex;
 }
 
-void CommandPrinter::PrintCmdSetDepthBias2EXTArgs(YAML::Emitter &os, const CmdSetDepthBias2EXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthBias2EXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBias2EXTArgs &args) {
     os << YAML::Key << "pDepthBiasInfo";
     // pointer
     if (args.pDepthBiasInfo != nullptr) {
@@ -2970,7 +2970,7 @@ void CommandPrinter::PrintCmdSetDepthBias2EXTArgs(YAML::Emitter &os, const CmdSe
     }
 }
 
-void CommandPrinter::PrintCmdCudaLaunchKernelNVArgs(YAML::Emitter &os, const CmdCudaLaunchKernelNVArgs &args) {
+void CommandPrinter::PrintCmdCudaLaunchKernelNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCudaLaunchKernelNVArgs &args) {
     os << YAML::Key << "pLaunchInfo";
     // pointer
     if (args.pLaunchInfo != nullptr) {
@@ -2980,7 +2980,7 @@ void CommandPrinter::PrintCmdCudaLaunchKernelNVArgs(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdBindDescriptorBuffersEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBindDescriptorBuffersEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdBindDescriptorBuffersEXTArgs &args) {
     os << YAML::Key << "bufferCount";
     // bufferCount -> Field -> uint32_t
@@ -3002,7 +3002,7 @@ void CommandPrinter::PrintCmdBindDescriptorBuffersEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetDescriptorBufferOffsetsEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDescriptorBufferOffsetsEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                const CmdSetDescriptorBufferOffsetsEXTArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
@@ -3049,7 +3049,7 @@ void CommandPrinter::PrintCmdSetDescriptorBufferOffsetsEXTArgs(YAML::Emitter &os
 }
 
 void CommandPrinter::PrintCmdBindDescriptorBufferEmbeddedSamplersEXTArgs(
-    YAML::Emitter &os, const CmdBindDescriptorBufferEmbeddedSamplersEXTArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorBufferEmbeddedSamplersEXTArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
     os << YAML::Value << args.pipelineBindPoint;
@@ -3061,7 +3061,7 @@ void CommandPrinter::PrintCmdBindDescriptorBufferEmbeddedSamplersEXTArgs(
     os << YAML::Value << args.set;
 }
 
-void CommandPrinter::PrintCmdSetFragmentShadingRateEnumNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetFragmentShadingRateEnumNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdSetFragmentShadingRateEnumNVArgs &args) {
     os << YAML::Key << "shadingRate";
     // shadingRate -> Field -> VkFragmentShadingRateNV
@@ -3081,7 +3081,7 @@ void CommandPrinter::PrintCmdSetFragmentShadingRateEnumNVArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetVertexInputEXTArgs(YAML::Emitter &os, const CmdSetVertexInputEXTArgs &args) {
+void CommandPrinter::PrintCmdSetVertexInputEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetVertexInputEXTArgs &args) {
     os << YAML::Key << "vertexBindingDescriptionCount";
     // vertexBindingDescriptionCount -> Field -> uint32_t
     os << YAML::Value << args.vertexBindingDescriptionCount;
@@ -3120,9 +3120,9 @@ void CommandPrinter::PrintCmdSetVertexInputEXTArgs(YAML::Emitter &os, const CmdS
     }
 }
 
-void CommandPrinter::PrintCmdSubpassShadingHUAWEIArgs(YAML::Emitter &os, const CmdSubpassShadingHUAWEIArgs &args) {}
+void CommandPrinter::PrintCmdSubpassShadingHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSubpassShadingHUAWEIArgs &args) {}
 
-void CommandPrinter::PrintCmdBindInvocationMaskHUAWEIArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBindInvocationMaskHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdBindInvocationMaskHUAWEIArgs &args) {
     os << YAML::Key << "imageView";
     // imageView -> Field -> VkImageView
@@ -3132,40 +3132,40 @@ void CommandPrinter::PrintCmdBindInvocationMaskHUAWEIArgs(YAML::Emitter &os,
     os << YAML::Value << args.imageLayout;
 }
 
-void CommandPrinter::PrintCmdSetPatchControlPointsEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPatchControlPointsEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdSetPatchControlPointsEXTArgs &args) {
     os << YAML::Key << "patchControlPoints";
     // patchControlPoints -> Field -> uint32_t
     os << YAML::Value << args.patchControlPoints;
 }
 
-void CommandPrinter::PrintCmdSetRasterizerDiscardEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetRasterizerDiscardEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                const CmdSetRasterizerDiscardEnableEXTArgs &args) {
     os << YAML::Key << "rasterizerDiscardEnable";
     // rasterizerDiscardEnable -> Field -> VkBool32
     os << YAML::Value << args.rasterizerDiscardEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthBiasEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthBiasEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthBiasEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasEnableEXTArgs &args) {
     os << YAML::Key << "depthBiasEnable";
     // depthBiasEnable -> Field -> VkBool32
     os << YAML::Value << args.depthBiasEnable;
 }
 
-void CommandPrinter::PrintCmdSetLogicOpEXTArgs(YAML::Emitter &os, const CmdSetLogicOpEXTArgs &args) {
+void CommandPrinter::PrintCmdSetLogicOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLogicOpEXTArgs &args) {
     os << YAML::Key << "logicOp";
     // logicOp -> Field -> VkLogicOp
     os << YAML::Value << args.logicOp;
 }
 
-void CommandPrinter::PrintCmdSetPrimitiveRestartEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetPrimitiveRestartEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdSetPrimitiveRestartEnableEXTArgs &args) {
     os << YAML::Key << "primitiveRestartEnable";
     // primitiveRestartEnable -> Field -> VkBool32
     os << YAML::Value << args.primitiveRestartEnable;
 }
 
-void CommandPrinter::PrintCmdSetColorWriteEnableEXTArgs(YAML::Emitter &os, const CmdSetColorWriteEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetColorWriteEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorWriteEnableEXTArgs &args) {
     os << YAML::Key << "attachmentCount";
     // attachmentCount -> Field -> uint32_t
     os << YAML::Value << args.attachmentCount;
@@ -3186,7 +3186,7 @@ void CommandPrinter::PrintCmdSetColorWriteEnableEXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdDrawMultiEXTArgs(YAML::Emitter &os, const CmdDrawMultiEXTArgs &args) {
+void CommandPrinter::PrintCmdDrawMultiEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMultiEXTArgs &args) {
     os << YAML::Key << "drawCount";
     // drawCount -> Field -> uint32_t
     os << YAML::Value << args.drawCount;
@@ -3216,7 +3216,7 @@ void CommandPrinter::PrintCmdDrawMultiEXTArgs(YAML::Emitter &os, const CmdDrawMu
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawMultiIndexedEXTArgs(YAML::Emitter &os, const CmdDrawMultiIndexedEXTArgs &args) {
+void CommandPrinter::PrintCmdDrawMultiIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMultiIndexedEXTArgs &args) {
     os << YAML::Key << "drawCount";
     // drawCount -> Field -> uint32_t
     os << YAML::Value << args.drawCount;
@@ -3253,7 +3253,7 @@ void CommandPrinter::PrintCmdDrawMultiIndexedEXTArgs(YAML::Emitter &os, const Cm
     }
 }
 
-void CommandPrinter::PrintCmdBuildMicromapsEXTArgs(YAML::Emitter &os, const CmdBuildMicromapsEXTArgs &args) {
+void CommandPrinter::PrintCmdBuildMicromapsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBuildMicromapsEXTArgs &args) {
     os << YAML::Key << "infoCount";
     // infoCount -> Field -> uint32_t
     os << YAML::Value << args.infoCount;
@@ -3274,7 +3274,7 @@ void CommandPrinter::PrintCmdBuildMicromapsEXTArgs(YAML::Emitter &os, const CmdB
     }
 }
 
-void CommandPrinter::PrintCmdCopyMicromapEXTArgs(YAML::Emitter &os, const CmdCopyMicromapEXTArgs &args) {
+void CommandPrinter::PrintCmdCopyMicromapEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMicromapEXTArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
     if (args.pInfo != nullptr) {
@@ -3284,7 +3284,7 @@ void CommandPrinter::PrintCmdCopyMicromapEXTArgs(YAML::Emitter &os, const CmdCop
     }
 }
 
-void CommandPrinter::PrintCmdCopyMicromapToMemoryEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdCopyMicromapToMemoryEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdCopyMicromapToMemoryEXTArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
@@ -3295,7 +3295,7 @@ void CommandPrinter::PrintCmdCopyMicromapToMemoryEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdCopyMemoryToMicromapEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdCopyMemoryToMicromapEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdCopyMemoryToMicromapEXTArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
@@ -3306,7 +3306,7 @@ void CommandPrinter::PrintCmdCopyMemoryToMicromapEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdWriteMicromapsPropertiesEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdWriteMicromapsPropertiesEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdWriteMicromapsPropertiesEXTArgs &args) {
     os << YAML::Key << "micromapCount";
     // micromapCount -> Field -> uint32_t
@@ -3337,7 +3337,7 @@ void CommandPrinter::PrintCmdWriteMicromapsPropertiesEXTArgs(YAML::Emitter &os,
     os << YAML::Value << args.firstQuery;
 }
 
-void CommandPrinter::PrintCmdDrawClusterHUAWEIArgs(YAML::Emitter &os, const CmdDrawClusterHUAWEIArgs &args) {
+void CommandPrinter::PrintCmdDrawClusterHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawClusterHUAWEIArgs &args) {
     os << YAML::Key << "groupCountX";
     // groupCountX -> Field -> uint32_t
     os << YAML::Value << args.groupCountX;
@@ -3349,7 +3349,7 @@ void CommandPrinter::PrintCmdDrawClusterHUAWEIArgs(YAML::Emitter &os, const CmdD
     os << YAML::Value << args.groupCountZ;
 }
 
-void CommandPrinter::PrintCmdDrawClusterIndirectHUAWEIArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawClusterIndirectHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdDrawClusterIndirectHUAWEIArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -3359,7 +3359,7 @@ void CommandPrinter::PrintCmdDrawClusterIndirectHUAWEIArgs(YAML::Emitter &os,
     os << YAML::Value << args.offset;
 }
 
-void CommandPrinter::PrintCmdCopyMemoryIndirectNVArgs(YAML::Emitter &os, const CmdCopyMemoryIndirectNVArgs &args) {
+void CommandPrinter::PrintCmdCopyMemoryIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMemoryIndirectNVArgs &args) {
     os << YAML::Key << "copyBufferAddress";
     // copyBufferAddress -> Field -> VkDeviceAddress
     os << YAML::Value << args.copyBufferAddress;
@@ -3371,7 +3371,7 @@ void CommandPrinter::PrintCmdCopyMemoryIndirectNVArgs(YAML::Emitter &os, const C
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdCopyMemoryToImageIndirectNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdCopyMemoryToImageIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdCopyMemoryToImageIndirectNVArgs &args) {
     os << YAML::Key << "copyBufferAddress";
     // copyBufferAddress -> Field -> VkDeviceAddress
@@ -3405,7 +3405,7 @@ void CommandPrinter::PrintCmdCopyMemoryToImageIndirectNVArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdDecompressMemoryNVArgs(YAML::Emitter &os, const CmdDecompressMemoryNVArgs &args) {
+void CommandPrinter::PrintCmdDecompressMemoryNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDecompressMemoryNVArgs &args) {
     os << YAML::Key << "decompressRegionCount";
     // decompressRegionCount -> Field -> uint32_t
     os << YAML::Value << args.decompressRegionCount;
@@ -3426,7 +3426,7 @@ void CommandPrinter::PrintCmdDecompressMemoryNVArgs(YAML::Emitter &os, const Cmd
     }
 }
 
-void CommandPrinter::PrintCmdDecompressMemoryIndirectCountNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDecompressMemoryIndirectCountNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                  const CmdDecompressMemoryIndirectCountNVArgs &args) {
     os << YAML::Key << "indirectCommandsAddress";
     // indirectCommandsAddress -> Field -> VkDeviceAddress
@@ -3439,7 +3439,7 @@ void CommandPrinter::PrintCmdDecompressMemoryIndirectCountNVArgs(YAML::Emitter &
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdUpdatePipelineIndirectBufferNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdUpdatePipelineIndirectBufferNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                 const CmdUpdatePipelineIndirectBufferNVArgs &args) {
     os << YAML::Key << "pipelineBindPoint";
     // pipelineBindPoint -> Field -> VkPipelineBindPoint
@@ -3449,26 +3449,26 @@ void CommandPrinter::PrintCmdUpdatePipelineIndirectBufferNVArgs(YAML::Emitter &o
     os << YAML::Value << args.pipeline;
 }
 
-void CommandPrinter::PrintCmdSetDepthClampEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthClampEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthClampEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthClampEnableEXTArgs &args) {
     os << YAML::Key << "depthClampEnable";
     // depthClampEnable -> Field -> VkBool32
     os << YAML::Value << args.depthClampEnable;
 }
 
-void CommandPrinter::PrintCmdSetPolygonModeEXTArgs(YAML::Emitter &os, const CmdSetPolygonModeEXTArgs &args) {
+void CommandPrinter::PrintCmdSetPolygonModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPolygonModeEXTArgs &args) {
     os << YAML::Key << "polygonMode";
     // polygonMode -> Field -> VkPolygonMode
     os << YAML::Value << args.polygonMode;
 }
 
-void CommandPrinter::PrintCmdSetRasterizationSamplesEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetRasterizationSamplesEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetRasterizationSamplesEXTArgs &args) {
     os << YAML::Key << "rasterizationSamples";
     // rasterizationSamples -> Field -> VkSampleCountFlagBits
     os << YAML::Value << args.rasterizationSamples;
 }
 
-void CommandPrinter::PrintCmdSetSampleMaskEXTArgs(YAML::Emitter &os, const CmdSetSampleMaskEXTArgs &args) {
+void CommandPrinter::PrintCmdSetSampleMaskEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetSampleMaskEXTArgs &args) {
     os << YAML::Key << "samples";
     // samples -> Field -> VkSampleCountFlagBits
     os << YAML::Value << args.samples;
@@ -3489,26 +3489,26 @@ void CommandPrinter::PrintCmdSetSampleMaskEXTArgs(YAML::Emitter &os, const CmdSe
     }
 }
 
-void CommandPrinter::PrintCmdSetAlphaToCoverageEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetAlphaToCoverageEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetAlphaToCoverageEnableEXTArgs &args) {
     os << YAML::Key << "alphaToCoverageEnable";
     // alphaToCoverageEnable -> Field -> VkBool32
     os << YAML::Value << args.alphaToCoverageEnable;
 }
 
-void CommandPrinter::PrintCmdSetAlphaToOneEnableEXTArgs(YAML::Emitter &os, const CmdSetAlphaToOneEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetAlphaToOneEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetAlphaToOneEnableEXTArgs &args) {
     os << YAML::Key << "alphaToOneEnable";
     // alphaToOneEnable -> Field -> VkBool32
     os << YAML::Value << args.alphaToOneEnable;
 }
 
-void CommandPrinter::PrintCmdSetLogicOpEnableEXTArgs(YAML::Emitter &os, const CmdSetLogicOpEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetLogicOpEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLogicOpEnableEXTArgs &args) {
     os << YAML::Key << "logicOpEnable";
     // logicOpEnable -> Field -> VkBool32
     os << YAML::Value << args.logicOpEnable;
 }
 
-void CommandPrinter::PrintCmdSetColorBlendEnableEXTArgs(YAML::Emitter &os, const CmdSetColorBlendEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetColorBlendEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorBlendEnableEXTArgs &args) {
     os << YAML::Key << "firstAttachment";
     // firstAttachment -> Field -> uint32_t
     os << YAML::Value << args.firstAttachment;
@@ -3532,7 +3532,7 @@ void CommandPrinter::PrintCmdSetColorBlendEnableEXTArgs(YAML::Emitter &os, const
     }
 }
 
-void CommandPrinter::PrintCmdSetColorBlendEquationEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetColorBlendEquationEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdSetColorBlendEquationEXTArgs &args) {
     os << YAML::Key << "firstAttachment";
     // firstAttachment -> Field -> uint32_t
@@ -3557,7 +3557,7 @@ void CommandPrinter::PrintCmdSetColorBlendEquationEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetColorWriteMaskEXTArgs(YAML::Emitter &os, const CmdSetColorWriteMaskEXTArgs &args) {
+void CommandPrinter::PrintCmdSetColorWriteMaskEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorWriteMaskEXTArgs &args) {
     os << YAML::Key << "firstAttachment";
     // firstAttachment -> Field -> uint32_t
     os << YAML::Value << args.firstAttachment;
@@ -3581,14 +3581,14 @@ void CommandPrinter::PrintCmdSetColorWriteMaskEXTArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdSetTessellationDomainOriginEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetTessellationDomainOriginEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                 const CmdSetTessellationDomainOriginEXTArgs &args) {
     os << YAML::Key << "domainOrigin";
     // domainOrigin -> Field -> VkTessellationDomainOrigin
     os << YAML::Value << args.domainOrigin;
 }
 
-void CommandPrinter::PrintCmdSetRasterizationStreamEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetRasterizationStreamEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetRasterizationStreamEXTArgs &args) {
     os << YAML::Key << "rasterizationStream";
     // rasterizationStream -> Field -> uint32_t
@@ -3596,33 +3596,33 @@ void CommandPrinter::PrintCmdSetRasterizationStreamEXTArgs(YAML::Emitter &os,
 }
 
 void CommandPrinter::PrintCmdSetConservativeRasterizationModeEXTArgs(
-    YAML::Emitter &os, const CmdSetConservativeRasterizationModeEXTArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetConservativeRasterizationModeEXTArgs &args) {
     os << YAML::Key << "conservativeRasterizationMode";
     // conservativeRasterizationMode -> Field -> VkConservativeRasterizationModeEXT
     os << YAML::Value << args.conservativeRasterizationMode;
 }
 
 void CommandPrinter::PrintCmdSetExtraPrimitiveOverestimationSizeEXTArgs(
-    YAML::Emitter &os, const CmdSetExtraPrimitiveOverestimationSizeEXTArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetExtraPrimitiveOverestimationSizeEXTArgs &args) {
     os << YAML::Key << "extraPrimitiveOverestimationSize";
     // extraPrimitiveOverestimationSize -> Field -> float
     os << YAML::Value << args.extraPrimitiveOverestimationSize;
 }
 
-void CommandPrinter::PrintCmdSetDepthClipEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthClipEnableEXTArgs &args) {
+void CommandPrinter::PrintCmdSetDepthClipEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthClipEnableEXTArgs &args) {
     os << YAML::Key << "depthClipEnable";
     // depthClipEnable -> Field -> VkBool32
     os << YAML::Value << args.depthClipEnable;
 }
 
-void CommandPrinter::PrintCmdSetSampleLocationsEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetSampleLocationsEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetSampleLocationsEnableEXTArgs &args) {
     os << YAML::Key << "sampleLocationsEnable";
     // sampleLocationsEnable -> Field -> VkBool32
     os << YAML::Value << args.sampleLocationsEnable;
 }
 
-void CommandPrinter::PrintCmdSetColorBlendAdvancedEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetColorBlendAdvancedEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdSetColorBlendAdvancedEXTArgs &args) {
     os << YAML::Key << "firstAttachment";
     // firstAttachment -> Field -> uint32_t
@@ -3647,42 +3647,42 @@ void CommandPrinter::PrintCmdSetColorBlendAdvancedEXTArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetProvokingVertexModeEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetProvokingVertexModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetProvokingVertexModeEXTArgs &args) {
     os << YAML::Key << "provokingVertexMode";
     // provokingVertexMode -> Field -> VkProvokingVertexModeEXT
     os << YAML::Value << args.provokingVertexMode;
 }
 
-void CommandPrinter::PrintCmdSetLineRasterizationModeEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetLineRasterizationModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetLineRasterizationModeEXTArgs &args) {
     os << YAML::Key << "lineRasterizationMode";
     // lineRasterizationMode -> Field -> VkLineRasterizationModeEXT
     os << YAML::Value << args.lineRasterizationMode;
 }
 
-void CommandPrinter::PrintCmdSetLineStippleEnableEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetLineStippleEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdSetLineStippleEnableEXTArgs &args) {
     os << YAML::Key << "stippledLineEnable";
     // stippledLineEnable -> Field -> VkBool32
     os << YAML::Value << args.stippledLineEnable;
 }
 
-void CommandPrinter::PrintCmdSetDepthClipNegativeOneToOneEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetDepthClipNegativeOneToOneEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                  const CmdSetDepthClipNegativeOneToOneEXTArgs &args) {
     os << YAML::Key << "negativeOneToOne";
     // negativeOneToOne -> Field -> VkBool32
     os << YAML::Value << args.negativeOneToOne;
 }
 
-void CommandPrinter::PrintCmdSetViewportWScalingEnableNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetViewportWScalingEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetViewportWScalingEnableNVArgs &args) {
     os << YAML::Key << "viewportWScalingEnable";
     // viewportWScalingEnable -> Field -> VkBool32
     os << YAML::Value << args.viewportWScalingEnable;
 }
 
-void CommandPrinter::PrintCmdSetViewportSwizzleNVArgs(YAML::Emitter &os, const CmdSetViewportSwizzleNVArgs &args) {
+void CommandPrinter::PrintCmdSetViewportSwizzleNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportSwizzleNVArgs &args) {
     os << YAML::Key << "firstViewport";
     // firstViewport -> Field -> uint32_t
     os << YAML::Value << args.firstViewport;
@@ -3706,21 +3706,21 @@ void CommandPrinter::PrintCmdSetViewportSwizzleNVArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdSetCoverageToColorEnableNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetCoverageToColorEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetCoverageToColorEnableNVArgs &args) {
     os << YAML::Key << "coverageToColorEnable";
     // coverageToColorEnable -> Field -> VkBool32
     os << YAML::Value << args.coverageToColorEnable;
 }
 
-void CommandPrinter::PrintCmdSetCoverageToColorLocationNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetCoverageToColorLocationNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdSetCoverageToColorLocationNVArgs &args) {
     os << YAML::Key << "coverageToColorLocation";
     // coverageToColorLocation -> Field -> uint32_t
     os << YAML::Value << args.coverageToColorLocation;
 }
 
-void CommandPrinter::PrintCmdSetCoverageModulationModeNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetCoverageModulationModeNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetCoverageModulationModeNVArgs &args) {
     os << YAML::Key << "coverageModulationMode";
     // coverageModulationMode -> Field -> VkCoverageModulationModeNV
@@ -3728,13 +3728,13 @@ void CommandPrinter::PrintCmdSetCoverageModulationModeNVArgs(YAML::Emitter &os,
 }
 
 void CommandPrinter::PrintCmdSetCoverageModulationTableEnableNVArgs(
-    YAML::Emitter &os, const CmdSetCoverageModulationTableEnableNVArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageModulationTableEnableNVArgs &args) {
     os << YAML::Key << "coverageModulationTableEnable";
     // coverageModulationTableEnable -> Field -> VkBool32
     os << YAML::Value << args.coverageModulationTableEnable;
 }
 
-void CommandPrinter::PrintCmdSetCoverageModulationTableNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetCoverageModulationTableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdSetCoverageModulationTableNVArgs &args) {
     os << YAML::Key << "coverageModulationTableCount";
     // coverageModulationTableCount -> Field -> uint32_t
@@ -3756,7 +3756,7 @@ void CommandPrinter::PrintCmdSetCoverageModulationTableNVArgs(YAML::Emitter &os,
     }
 }
 
-void CommandPrinter::PrintCmdSetShadingRateImageEnableNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetShadingRateImageEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                              const CmdSetShadingRateImageEnableNVArgs &args) {
     os << YAML::Key << "shadingRateImageEnable";
     // shadingRateImageEnable -> Field -> VkBool32
@@ -3764,20 +3764,20 @@ void CommandPrinter::PrintCmdSetShadingRateImageEnableNVArgs(YAML::Emitter &os,
 }
 
 void CommandPrinter::PrintCmdSetRepresentativeFragmentTestEnableNVArgs(
-    YAML::Emitter &os, const CmdSetRepresentativeFragmentTestEnableNVArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetRepresentativeFragmentTestEnableNVArgs &args) {
     os << YAML::Key << "representativeFragmentTestEnable";
     // representativeFragmentTestEnable -> Field -> VkBool32
     os << YAML::Value << args.representativeFragmentTestEnable;
 }
 
-void CommandPrinter::PrintCmdSetCoverageReductionModeNVArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdSetCoverageReductionModeNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetCoverageReductionModeNVArgs &args) {
     os << YAML::Key << "coverageReductionMode";
     // coverageReductionMode -> Field -> VkCoverageReductionModeNV
     os << YAML::Value << args.coverageReductionMode;
 }
 
-void CommandPrinter::PrintCmdOpticalFlowExecuteNVArgs(YAML::Emitter &os, const CmdOpticalFlowExecuteNVArgs &args) {
+void CommandPrinter::PrintCmdOpticalFlowExecuteNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdOpticalFlowExecuteNVArgs &args) {
     os << YAML::Key << "session";
     // session -> Field -> VkOpticalFlowSessionNV
     os << YAML::Value << args.session;
@@ -3790,7 +3790,7 @@ void CommandPrinter::PrintCmdOpticalFlowExecuteNVArgs(YAML::Emitter &os, const C
     }
 }
 
-void CommandPrinter::PrintCmdBindShadersEXTArgs(YAML::Emitter &os, const CmdBindShadersEXTArgs &args) {
+void CommandPrinter::PrintCmdBindShadersEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindShadersEXTArgs &args) {
     os << YAML::Key << "stageCount";
     // stageCount -> Field -> uint32_t
     os << YAML::Value << args.stageCount;
@@ -3827,13 +3827,13 @@ void CommandPrinter::PrintCmdBindShadersEXTArgs(YAML::Emitter &os, const CmdBind
 }
 
 void CommandPrinter::PrintCmdSetAttachmentFeedbackLoopEnableEXTArgs(
-    YAML::Emitter &os, const CmdSetAttachmentFeedbackLoopEnableEXTArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetAttachmentFeedbackLoopEnableEXTArgs &args) {
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
     os << YAML::Value << args.aspectMask;
 }
 
-void CommandPrinter::PrintCmdBuildAccelerationStructuresKHRArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdBuildAccelerationStructuresKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                 const CmdBuildAccelerationStructuresKHRArgs &args) {
     os << YAML::Key << "infoCount";
     // infoCount -> Field -> uint32_t
@@ -3871,7 +3871,7 @@ void CommandPrinter::PrintCmdBuildAccelerationStructuresKHRArgs(YAML::Emitter &o
 }
 
 void CommandPrinter::PrintCmdBuildAccelerationStructuresIndirectKHRArgs(
-    YAML::Emitter &os, const CmdBuildAccelerationStructuresIndirectKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdBuildAccelerationStructuresIndirectKHRArgs &args) {
     os << YAML::Key << "infoCount";
     // infoCount -> Field -> uint32_t
     os << YAML::Value << args.infoCount;
@@ -3937,7 +3937,7 @@ void CommandPrinter::PrintCmdBuildAccelerationStructuresIndirectKHRArgs(
     }
 }
 
-void CommandPrinter::PrintCmdCopyAccelerationStructureKHRArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdCopyAccelerationStructureKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                               const CmdCopyAccelerationStructureKHRArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
@@ -3949,7 +3949,7 @@ void CommandPrinter::PrintCmdCopyAccelerationStructureKHRArgs(YAML::Emitter &os,
 }
 
 void CommandPrinter::PrintCmdCopyAccelerationStructureToMemoryKHRArgs(
-    YAML::Emitter &os, const CmdCopyAccelerationStructureToMemoryKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdCopyAccelerationStructureToMemoryKHRArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
     if (args.pInfo != nullptr) {
@@ -3960,7 +3960,7 @@ void CommandPrinter::PrintCmdCopyAccelerationStructureToMemoryKHRArgs(
 }
 
 void CommandPrinter::PrintCmdCopyMemoryToAccelerationStructureKHRArgs(
-    YAML::Emitter &os, const CmdCopyMemoryToAccelerationStructureKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMemoryToAccelerationStructureKHRArgs &args) {
     os << YAML::Key << "pInfo";
     // pointer
     if (args.pInfo != nullptr) {
@@ -3971,7 +3971,7 @@ void CommandPrinter::PrintCmdCopyMemoryToAccelerationStructureKHRArgs(
 }
 
 void CommandPrinter::PrintCmdWriteAccelerationStructuresPropertiesKHRArgs(
-    YAML::Emitter &os, const CmdWriteAccelerationStructuresPropertiesKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdWriteAccelerationStructuresPropertiesKHRArgs &args) {
     os << YAML::Key << "accelerationStructureCount";
     // accelerationStructureCount -> Field -> uint32_t
     os << YAML::Value << args.accelerationStructureCount;
@@ -4001,7 +4001,7 @@ void CommandPrinter::PrintCmdWriteAccelerationStructuresPropertiesKHRArgs(
     os << YAML::Value << args.firstQuery;
 }
 
-void CommandPrinter::PrintCmdTraceRaysKHRArgs(YAML::Emitter &os, const CmdTraceRaysKHRArgs &args) {
+void CommandPrinter::PrintCmdTraceRaysKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysKHRArgs &args) {
     os << YAML::Key << "pRaygenShaderBindingTable";
     // pointer
     if (args.pRaygenShaderBindingTable != nullptr) {
@@ -4041,7 +4041,7 @@ void CommandPrinter::PrintCmdTraceRaysKHRArgs(YAML::Emitter &os, const CmdTraceR
     os << YAML::Value << args.depth;
 }
 
-void CommandPrinter::PrintCmdTraceRaysIndirectKHRArgs(YAML::Emitter &os, const CmdTraceRaysIndirectKHRArgs &args) {
+void CommandPrinter::PrintCmdTraceRaysIndirectKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysIndirectKHRArgs &args) {
     os << YAML::Key << "pRaygenShaderBindingTable";
     // pointer
     if (args.pRaygenShaderBindingTable != nullptr) {
@@ -4076,13 +4076,13 @@ void CommandPrinter::PrintCmdTraceRaysIndirectKHRArgs(YAML::Emitter &os, const C
 }
 
 void CommandPrinter::PrintCmdSetRayTracingPipelineStackSizeKHRArgs(
-    YAML::Emitter &os, const CmdSetRayTracingPipelineStackSizeKHRArgs &args) {
+    crash_diagnostic_layer::DumpEmitter &os, const CmdSetRayTracingPipelineStackSizeKHRArgs &args) {
     os << YAML::Key << "pipelineStackSize";
     // pipelineStackSize -> Field -> uint32_t
     os << YAML::Value << args.pipelineStackSize;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksEXTArgs(YAML::Emitter &os, const CmdDrawMeshTasksEXTArgs &args) {
+void CommandPrinter::PrintCmdDrawMeshTasksEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksEXTArgs &args) {
     os << YAML::Key << "groupCountX";
     // groupCountX -> Field -> uint32_t
     os << YAML::Value << args.groupCountX;
@@ -4094,7 +4094,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksEXTArgs(YAML::Emitter &os, const CmdDr
     os << YAML::Value << args.groupCountZ;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksIndirectEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawMeshTasksIndirectEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdDrawMeshTasksIndirectEXTArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -4110,7 +4110,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksIndirectEXTArgs(YAML::Emitter &os,
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountEXTArgs(YAML::Emitter &os,
+void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                                const CmdDrawMeshTasksIndirectCountEXTArgs &args) {
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -4132,7 +4132,7 @@ void CommandPrinter::PrintCmdDrawMeshTasksIndirectCountEXTArgs(YAML::Emitter &os
     os << YAML::Value << args.stride;
 }
 
-void CommandPrinter::PrintCommandParameters(YAML::Emitter &os, const Command &cmd) {
+void CommandPrinter::PrintCommandParameters(crash_diagnostic_layer::DumpEmitter &os, const Command &cmd) {
     switch (cmd.type) {
         default:
         case Command::Type::kUnknown:
@@ -27,10 +27,10 @@
 
 #pragma once
 
-#include <yaml-cpp/emitter.h>
 #include <vulkan/vulkan.h>
 
 #include "command_common.h"
+#include "dump_emitter.h"
 #include "object_name_db.h"
 
 struct VkStruct {
@@ -39,1861 +39,1861 @@ struct VkStruct {
 };
 
 // Declare generic struct printer.
-YAML::Emitter &PrintVkStruct(YAML::Emitter &os, const VkStruct *pStruct);
+crash_diagnostic_layer::DumpEmitter &PrintVkStruct(crash_diagnostic_layer::DumpEmitter &os, const VkStruct *pStruct);
 
 // Declare pNext chain printer.
-YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext);
+crash_diagnostic_layer::DumpEmitter &PrintNextPtr(crash_diagnostic_layer::DumpEmitter &os, const void *pNext);
 
 // Declare Handle stream operators
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBuffer &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBuffer &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkImage &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkImage &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkInstance &a);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice &a);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDevice &a);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueue &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkInstance &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDevice &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueue &a);
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphore &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphore &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCommandBuffer &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCommandBuffer &a);
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFence &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFence &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDeviceMemory &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDeviceMemory &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkEvent &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkEvent &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkQueryPool &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkQueryPool &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkBufferView &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkBufferView &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkImageView &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkImageView &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkShaderModule &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkShaderModule &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkPipelineCache &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkPipelineCache &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkPipelineLayout &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkPipelineLayout &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkPipeline &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkPipeline &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkRenderPass &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkRenderPass &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDescriptorSetLayout &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDescriptorSetLayout &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkSampler &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkSampler &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDescriptorSet &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDescriptorSet &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDescriptorPool &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDescriptorPool &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkFramebuffer &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkFramebuffer &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCommandPool &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCommandPool &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkSamplerYcbcrConversion &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkSamplerYcbcrConversion &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDescriptorUpdateTemplate &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDescriptorUpdateTemplate &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkPrivateDataSlot &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkPrivateDataSlot &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkSurfaceKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkSurfaceKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkSwapchainKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkSwapchainKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDisplayKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDisplayKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDisplayModeKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDisplayModeKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkVideoSessionKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkVideoSessionKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkVideoSessionParametersKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkVideoSessionParametersKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDeferredOperationKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDeferredOperationKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDebugReportCallbackEXT &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDebugReportCallbackEXT &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCuModuleNVX &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCuModuleNVX &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCuFunctionNVX &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCuFunctionNVX &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkDebugUtilsMessengerEXT &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkDebugUtilsMessengerEXT &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkValidationCacheEXT &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkValidationCacheEXT &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkAccelerationStructureNV &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkAccelerationStructureNV &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkPerformanceConfigurationINTEL &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkPerformanceConfigurationINTEL &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkIndirectCommandsLayoutNV &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkIndirectCommandsLayoutNV &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCudaModuleNV &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCudaModuleNV &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkCudaFunctionNV &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkCudaFunctionNV &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkAccelerationStructureKHR &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkAccelerationStructureKHR &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkBufferCollectionFUCHSIA &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkBufferCollectionFUCHSIA &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkMicromapEXT &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkMicromapEXT &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkOpticalFlowSessionNV &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkOpticalFlowSessionNV &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 #if VK_USE_64_BIT_PTR_DEFINES
-YAML::Emitter &operator<<(YAML::Emitter& os, const VkShaderEXT &a);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter& os, const VkShaderEXT &a);
 #endif //VK_USE_64_BIT_PTR_DEFINES
 
 
 
 // Declare stream operators for enums.
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkResult &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStructureType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheHeaderVersion &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageLayout &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkObjectType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVendorId &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSystemAllocationScope &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInternalAllocationType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormat &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageTiling &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSharingMode &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComponentSwizzle &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlendFactor &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlendOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCompareOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDynamicState &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFrontFace &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputRate &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPrimitiveTopology &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPolygonMode &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStencilOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLogicOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBorderColor &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFilter &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerAddressMode &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerMipmapMode &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentLoadOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentStoreOp &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineBindPoint &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferLevel &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndexType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassContents &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPointClippingBehavior &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTessellationDomainOrigin &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrModelConversion &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrRange &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkChromaLocation &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDriverId &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderFloatControlsIndependence &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerReductionMode &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentModeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorSpaceKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryResultStatusKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterUnitKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterScopeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterStorageKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueGlobalPriorityKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateCombinerOpKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatisticFormatKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeTuningModeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComponentTypeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScopeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLineRasterizationModeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTimeDomainKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugReportObjectTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRasterizationOrderAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderInfoTypeAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationCheckEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRobustnessBufferBehaviorEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRobustnessImageBehaviorEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPowerStateEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceEventTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayEventTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportCoordinateSwizzleNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDiscardRectangleModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkConservativeRasterizationModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlendOverlapEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoverageModulationModeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationCacheHeaderVersionEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShadingRatePaletteEntryNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleOrderTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupTypeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryTypeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTypeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureModeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMemoryRequirementsTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryOverallocationBehaviorAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceConfigurationTypeINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolSamplingModeINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceOverrideTypeINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceParameterTypeINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueTypeINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFeatureEnableEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFeatureDisableEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoverageReductionModeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkProvokingVertexModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkResult &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStructureType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCacheHeaderVersion &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageLayout &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkObjectType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVendorId &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSystemAllocationScope &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInternalAllocationType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormat &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageTiling &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSharingMode &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComponentSwizzle &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlendFactor &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlendOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCompareOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDynamicState &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFrontFace &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputRate &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPrimitiveTopology &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPolygonMode &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStencilOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLogicOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBorderColor &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFilter &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerAddressMode &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerMipmapMode &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentLoadOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentStoreOp &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineBindPoint &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferLevel &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndexType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassContents &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPointClippingBehavior &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTessellationDomainOrigin &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrModelConversion &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrRange &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkChromaLocation &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorUpdateTemplateType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDriverId &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderFloatControlsIndependence &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerReductionMode &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentModeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkColorSpaceKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryResultStatusKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterUnitKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterScopeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterStorageKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueGlobalPriorityKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFragmentShadingRateCombinerOpKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableStatisticFormatKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeTuningModeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComponentTypeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScopeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLineRasterizationModeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTimeDomainKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugReportObjectTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRasterizationOrderAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderInfoTypeAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationCheckEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRobustnessBufferBehaviorEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRobustnessImageBehaviorEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPowerStateEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceEventTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayEventTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewportCoordinateSwizzleNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDiscardRectangleModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkConservativeRasterizationModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlendOverlapEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoverageModulationModeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationCacheHeaderVersionEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShadingRatePaletteEntryNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoarseSampleOrderTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingShaderGroupTypeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryTypeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureTypeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyAccelerationStructureModeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMemoryRequirementsTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryOverallocationBehaviorAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceConfigurationTypeINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolSamplingModeINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceOverrideTypeINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceParameterTypeINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceValueTypeINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFeatureEnableEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFeatureDisableEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoverageReductionModeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkProvokingVertexModeEXT &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFullScreenExclusiveEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFullScreenExclusiveEXT &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsTokenTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasRepresentationEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryReportEventTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInstanceTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultAddressTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorBinaryHeaderVersionEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceAddressBindingTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBuildMicromapModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpacityMicromapFormatEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpacityMicromapSpecialIndexEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCompatibilityKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildTypeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsTokenTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDepthBiasRepresentationEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryReportEventTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFragmentShadingRateTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFragmentShadingRateNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInstanceTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultAddressTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultVendorBinaryHeaderVersionEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceAddressBindingTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBuildMicromapModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMicromapModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpacityMicromapFormatEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpacityMicromapSpecialIndexEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCompatibilityKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildTypeKHR &t);
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplacementMicromapFormatNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplacementMicromapFormatNV &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassMergeStatusEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingModeLUNARG &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowPerformanceLevelNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionBindingPointNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderCodeTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingInvocationReorderModeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingTypeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencyMarkerNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOutOfBandQueueTypeNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlockMatchWindowCompareModeQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCubicFilterWeightsQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayeredDriverUnderlyingApiMSFT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBuildAccelerationStructureModeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderGroupShaderKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassMergeStatusEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectDriverLoadingModeLUNARG &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowPerformanceLevelNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowSessionBindingPointNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderCodeTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingInvocationReorderModeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerSettingTypeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencyMarkerNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOutOfBandQueueTypeNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlockMatchWindowCompareModeQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCubicFilterWeightsQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayeredDriverUnderlyingApiMSFT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBuildAccelerationStructureModeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderGroupShaderKHR &t);
 
 // Declare all stream operators.
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent2D &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent3D &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset2D &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset3D &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRect2D &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseInStructure &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseOutStructure &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchIndirectCommand &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndexedIndirectCommand &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndirectCommand &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceRange &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheHeaderVersionOne &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAllocationCallbacks &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkApplicationInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInstanceCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHeap &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryType &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLimits &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparseProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtensionProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMappedMemoryRange &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseMemoryBind &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseBufferMemoryBindInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageOpaqueMemoryBindInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBind &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBindInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindSparseInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequirements &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkEventCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferViewCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComponentMapping &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationMapEntry &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescription &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescription &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInputAssemblyStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewport &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineMultisampleStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStencilOpState &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDepthStencilStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAttachmentState &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDynamicStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantRange &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLayoutCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyDescriptorSet &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorImageInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolSize &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBinding &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandPoolCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceLayers &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearColorValue &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearDepthStencilValue &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearValue &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearAttachment &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearRect &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice16BitStorageFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedRequirements &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateFlagsInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupRenderPassBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupCommandBufferBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupBindSparseInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryDeviceGroupInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryDeviceGroupInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGroupProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupDeviceCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryRequirementsInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryRequirementsInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSparseMemoryRequirementsInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequirements2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageFormatInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparseImageFormatInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePointClippingProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInputAttachmentAspectReference &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassInputAttachmentAspectCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewUsageCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationDomainOriginStateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassMultiviewCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVariablePointersFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemoryFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemoryProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkProtectedSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImagePlaneMemoryInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePlaneMemoryRequirementsInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerYcbcrConversionFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionImageFormatProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateEntry &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalImageFormatInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalBufferInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalBufferProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIDProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryBufferCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFenceInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFenceProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalSemaphoreInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalSemaphoreProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance3Properties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutSupport &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDrawParametersFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Properties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkConformanceVersion &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Properties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatListCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassEndInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice8BitStorageFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDriverProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicInt64Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloat16Int8Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFloatControlsProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBindingFlagsCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorIndexingFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorIndexingProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescriptorCountAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescriptorCountLayoutSupport &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescriptionDepthStencilResolve &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthStencilResolveProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceScalarBlockLayoutFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageStencilUsageCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerReductionModeCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerFilterMinmaxProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkanMemoryModelFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImagelessFramebufferFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentImageInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentsCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassAttachmentBeginInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReferenceStencilLayout &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescriptionStencilLayout &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostQueryResetFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemaphoreFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemaphoreProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreTypeCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTimelineSemaphoreSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreWaitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSignalInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceAddressFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferOpaqueCaptureAddressCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryOpaqueCaptureAddressAllocateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOpaqueCaptureAddressInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Properties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedback &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedbackCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTerminateInvocationFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceToolProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrivateDataFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDevicePrivateDataCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPrivateDataSlotCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineCreationCacheControlFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDependencyInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferSubmitInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSynchronization2Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageRobustnessFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferToImageInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToBufferInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkResolveImageInfo2 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeControlFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeControlProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniformBlockFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniformBlockProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetInlineUniformBlock &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolInlineUniformBlockCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRenderingCreateInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRenderingInfo &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerDotProductFeatures &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerDotProductProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAlignmentProperties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties3 &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4Features &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4Properties &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceBufferMemoryRequirements &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageMemoryRequirements &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormatKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSwapchainCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemorySwapchainInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireNextImageInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSwapchainCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeParametersKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlanePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplaySurfaceCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPresentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtent2D &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtent3D &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOffset2D &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOffset3D &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRect2D &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBaseInStructure &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBaseOutStructure &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryBarrier &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchIndirectCommand &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawIndexedIndirectCommand &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawIndirectCommand &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresourceRange &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryBarrier &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryBarrier &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCacheHeaderVersionOne &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAllocationCallbacks &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkApplicationInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInstanceCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryHeap &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryType &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLimits &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSparseProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtensionProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMappedMemoryRange &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryRequirements &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseMemoryBind &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseBufferMemoryBindInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageOpaqueMemoryBindInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresource &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryBind &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryBindInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindSparseInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageFormatProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryRequirements &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkEventCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferViewCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceLayout &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComponentMapping &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCacheCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSpecializationMapEntry &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSpecializationInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComputePipelineCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDescription &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputAttributeDescription &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineVertexInputStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineInputAssemblyStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineTessellationStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewport &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineMultisampleStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStencilOpState &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDepthStencilStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendAttachmentState &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDynamicStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushConstantRange &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineLayoutCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyDescriptorSet &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorImageInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolSize &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutBinding &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSet &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescription &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReference &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescription &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDependency &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandPoolCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCopy &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresourceLayers &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferImageCopy &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearColorValue &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearDepthStencilValue &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearValue &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearAttachment &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearRect &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageBlit &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCopy &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageResolve &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindBufferMemoryInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemoryInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice16BitStorageFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryDedicatedRequirements &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryDedicatedAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryAllocateFlagsInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupRenderPassBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupCommandBufferBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupBindSparseInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindBufferMemoryDeviceGroupInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemoryDeviceGroupInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGroupProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupDeviceCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryRequirementsInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryRequirementsInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSparseMemoryRequirementsInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryRequirements2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryRequirements2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFeatures2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageFormatInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageFormatProperties2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSparseImageFormatInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePointClippingProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInputAttachmentAspectReference &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassInputAttachmentAspectCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewUsageCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineTessellationDomainOriginStateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassMultiviewCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVariablePointersFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProtectedMemoryFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProtectedMemoryProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkProtectedSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImagePlaneMemoryInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImagePlaneMemoryRequirementsInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSamplerYcbcrConversionFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionImageFormatProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorUpdateTemplateEntry &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorUpdateTemplateCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalImageFormatInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalImageFormatProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalBufferInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalBufferProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceIDProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryImageCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryBufferCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFenceInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFenceProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportFenceCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportSemaphoreCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalSemaphoreInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalSemaphoreProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance3Properties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutSupport &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderDrawParametersFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan11Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan11Properties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan12Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkConformanceVersion &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan12Properties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatListCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescription2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReference2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescription2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDependency2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreateInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassEndInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice8BitStorageFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDriverProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicInt64Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderFloat16Int8Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFloatControlsProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutBindingFlagsCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorIndexingFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorIndexingProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetVariableDescriptorCountAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetVariableDescriptorCountLayoutSupport &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescriptionDepthStencilResolve &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthStencilResolveProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceScalarBlockLayoutFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageStencilUsageCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerReductionModeCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSamplerFilterMinmaxProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkanMemoryModelFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImagelessFramebufferFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferAttachmentImageInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferAttachmentsCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassAttachmentBeginInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReferenceStencilLayout &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescriptionStencilLayout &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostQueryResetFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTimelineSemaphoreFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTimelineSemaphoreProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreTypeCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTimelineSemaphoreSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreWaitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreSignalInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBufferDeviceAddressFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferDeviceAddressInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferOpaqueCaptureAddressCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryOpaqueCaptureAddressAllocateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryOpaqueCaptureAddressInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan13Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan13Properties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreationFeedback &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreationFeedbackCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTerminateInvocationFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceToolProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrivateDataFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDevicePrivateDataCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPrivateDataSlotCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineCreationCacheControlFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryBarrier2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryBarrier2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryBarrier2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDependencyInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferSubmitInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubmitInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSynchronization2Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageRobustnessFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCopy2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyBufferInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCopy2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferImageCopy2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyBufferToImageInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToBufferInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageBlit2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlitImageInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageResolve2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkResolveImageInfo2 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupSizeControlFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupSizeControlProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInlineUniformBlockFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInlineUniformBlockProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetInlineUniformBlock &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolInlineUniformBlockCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAttachmentInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRenderingCreateInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceRenderingInfo &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerDotProductFeatures &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerDotProductProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTexelBufferAlignmentProperties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties3 &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance4Features &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance4Properties &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceBufferMemoryRequirements &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceImageMemoryRequirements &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFormatKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSwapchainCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemorySwapchainInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAcquireNextImageInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupPresentCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupPresentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupSwapchainCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeParametersKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlanePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplaySurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPresentInfoKHR &t);
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXlibSurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXlibSurfaceCreateInfoKHR &t);
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 #ifdef VK_USE_PLATFORM_XCB_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXcbSurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXcbSurfaceCreateInfoKHR &t);
 #endif  // VK_USE_PLATFORM_XCB_KHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWaylandSurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWaylandSurfaceCreateInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WAYLAND_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidSurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidSurfaceCreateInfoKHR &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32SurfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32SurfaceCreateInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyQueryResultStatusPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyVideoPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileListInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoFormatInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoFormatPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoPictureResourceInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoReferenceSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionMemoryRequirementsKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVideoSessionMemoryInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersUpdateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoBeginCodingInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEndCodingInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCodingControlInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeUsageInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264CapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QpKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QualityLevelPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersAddInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersGetInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersFeedbackInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264NaluSliceInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264PictureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264DpbSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264ProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264FrameSizeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlLayerInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264GopRemainingFrameInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265CapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QpKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QualityLevelPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersAddInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersGetInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersFeedbackInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265NaluSliceSegmentInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265PictureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265DpbSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265ProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265FrameSizeKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlLayerInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265GopRemainingFrameInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264ProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264CapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParametersAddInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264PictureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264DpbSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentShadingRateAttachmentInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentDensityMapAttachmentInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleCountInfoAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewAttributesInfoNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyQueryResultStatusPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyVideoPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoProfileListInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoFormatInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoFormatPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoPictureResourceInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoReferenceSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionMemoryRequirementsKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindVideoSessionMemoryInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionParametersUpdateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoBeginCodingInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEndCodingInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoCodingControlInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeUsageInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264CapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264QpKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264QualityLevelPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersAddInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersGetInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersFeedbackInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264NaluSliceInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264PictureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264DpbSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264ProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264RateControlInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264FrameSizeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264RateControlLayerInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264GopRemainingFrameInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265CapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265QpKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265QualityLevelPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersAddInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersGetInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersFeedbackInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265NaluSliceSegmentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265PictureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265DpbSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265ProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265RateControlInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265FrameSizeKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265RateControlLayerInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265GopRemainingFrameInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264ProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264CapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264SessionParametersAddInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264SessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264PictureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264DpbSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingFragmentShadingRateAttachmentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingFragmentDensityMapAttachmentInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentSampleCountInfoAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiviewPerViewAttributesInfoNVX &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryWin32HandlePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryWin32HandlePropertiesKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryFdInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryFdPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryFdPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetFdInfoKHR &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireReleaseInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32KeyedMutexAcquireReleaseInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportSemaphoreWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkD3D12FenceSubmitInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkD3D12FenceSubmitInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreFdInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetFdInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePushDescriptorPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRectLayerKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionsKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSharedPresentSurfaceCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePushDescriptorPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRectLayerKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentRegionKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentRegionsKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSharedPresentSurfaceCapabilitiesKHR &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportFenceWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportFenceWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetWin32HandleInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceGetWin32HandleInfoKHR &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceFdInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetFdInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQueryFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQueryPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterDescriptionKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterResultKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireProfilingLockInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceQuerySubmitInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSurfaceInfo2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormat2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayProperties2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneProperties2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeProperties2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneInfo2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilities2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportFenceFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceGetFdInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerformanceQueryFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerformanceQueryPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterDescriptionKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolPerformanceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterResultKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAcquireProfilingLockInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceQuerySubmitInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSurfaceInfo2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilities2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFormat2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayProperties2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneProperties2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeProperties2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneInfo2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneCapabilities2KHR &t);
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySubsetFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePortabilitySubsetFeaturesKHR &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySubsetPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePortabilitySubsetPropertiesKHR &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderClockFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265ProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265CapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParametersAddInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265PictureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265DpbSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueGlobalPriorityCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyGlobalPriorityPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateAttachmentInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRateStateCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentLocationInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInputAttachmentIndexInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderQuadControlFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceProtectedCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentWaitFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutablePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatisticValueKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatisticKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInternalRepresentationKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryUnmapInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLibraryCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentIdKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentIdFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeCapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeUsageInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlLayerInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParametersGetInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParametersFeedbackInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointProperties2NV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointData2NV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommand2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5PropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAreaInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageSubresourceInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout2KHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreateFlags2CreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferUsageFlags2CreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1ProfileInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1CapabilitiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1SessionParametersCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1PictureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1DpbSlotInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoMaintenance1FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoInlineQueryInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDivisorDescriptionKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputDivisorStateCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloatControls2FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIndexTypeUint8FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasterizationFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasterizationPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationLineStateCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCalibratedTimestampInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderExpectAssumeFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6PropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindMemoryStatusKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorSetsInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantsInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetWithTemplateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetDescriptorBufferOffsetsInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7FeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7PropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPropertiesListKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiVulkanPropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugReportCallbackCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateRasterizationOrderAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectNameInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectTagInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerMarkerInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationImageCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationBufferCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationMemoryAllocateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeedbackFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeedbackPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateStreamCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuModuleCreateInfoNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuFunctionCreateInfoNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuLaunchInfoNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewHandleInfoNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewAddressPropertiesNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTextureLODGatherFormatPropertiesAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderResourceUsageAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderStatisticsInfoAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderClockFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265ProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265CapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265SessionParametersAddInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265SessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265PictureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265DpbSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueGlobalPriorityCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyGlobalPriorityPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFragmentShadingRateAttachmentInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineFragmentShadingRateStateCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAttachmentLocationInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingInputAttachmentIndexInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderQuadControlFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceProtectedCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentWaitFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutablePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableStatisticValueKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableStatisticKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableInternalRepresentationKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryMapInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryUnmapInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineLibraryCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentIdKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentIdFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeCapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeUsageInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeRateControlLayerInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeRateControlInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeQualityLevelPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeQualityLevelInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeSessionParametersGetInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeSessionParametersFeedbackInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyCheckpointProperties2NV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCheckpointData2NV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTraceRaysIndirectCommand2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance5FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance5PropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAreaInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresource2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceImageSubresourceInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceLayout2KHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreateFlags2CreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferUsageFlags2CreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCooperativeMatrixPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1ProfileInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1CapabilitiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1SessionParametersCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1PictureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1DpbSlotInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoMaintenance1FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoInlineQueryInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDivisorDescriptionKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineVertexInputDivisorStateCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderFloatControls2FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceIndexTypeUint8FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLineRasterizationFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLineRasterizationPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationLineStateCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCalibratedTimestampInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderExpectAssumeFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance6FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance6PropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindMemoryStatusKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindDescriptorSetsInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushConstantsInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushDescriptorSetInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushDescriptorSetWithTemplateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetDescriptorBufferOffsetsInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance7FeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance7PropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiPropertiesListKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiVulkanPropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugReportCallbackCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateRasterizationOrderAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerObjectNameInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerObjectTagInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerMarkerInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationImageCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationBufferCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationMemoryAllocateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTransformFeedbackFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTransformFeedbackPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateStreamCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuModuleCreateInfoNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuFunctionCreateInfoNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuLaunchInfoNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewHandleInfoNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewAddressPropertiesNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTextureLODGatherFormatPropertiesAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderResourceUsageAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderStatisticsInfoAMD &t);
 #ifdef VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStreamDescriptorSurfaceCreateInfoGGP &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStreamDescriptorSurfaceCreateInfoGGP &t);
 #endif  // VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCornerSampledImageFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCornerSampledImageFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalImageFormatPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryImageCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryAllocateInfoNV &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryWin32HandleInfoNV &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryWin32HandleInfoNV &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireReleaseInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32KeyedMutexAcquireReleaseInfoNV &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFlagsEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFlagsEXT &t);
 #ifdef VK_USE_PLATFORM_VI_NN
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViSurfaceCreateInfoNN &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViSurfaceCreateInfoNN &t);
 #endif  // VK_USE_PLATFORM_VI_NN
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewASTCDecodeModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceASTCDecodeFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobustnessFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobustnessPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRobustnessCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkConditionalRenderingBeginInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConditionalRenderingFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceConditionalRenderingInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportWScalingNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportWScalingStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2EXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPowerInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceEventInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayEventInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCounterCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRefreshCycleDurationGOOGLE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPastPresentationTimingGOOGLE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimeGOOGLE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimesInfoGOOGLE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportSwizzleNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportSwizzleStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiscardRectanglePropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDiscardRectangleStateCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationConservativeStateCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipEnableFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationDepthClipStateCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXYColorEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHdrMetadataEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewASTCDecodeModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceASTCDecodeFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineRobustnessFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineRobustnessPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRobustnessCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkConditionalRenderingBeginInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceConditionalRenderingFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceConditionalRenderingInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewportWScalingNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportWScalingStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilities2EXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPowerInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceEventInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayEventInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainCounterCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRefreshCycleDurationGOOGLE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPastPresentationTimingGOOGLE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentTimeGOOGLE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentTimesInfoGOOGLE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewportSwizzleNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportSwizzleStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDiscardRectanglePropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDiscardRectangleStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationConservativeStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClipEnableFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationDepthClipStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXYColorEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHdrMetadataEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG &t);
 #ifdef VK_USE_PLATFORM_IOS_MVK
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIOSSurfaceCreateInfoMVK &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIOSSurfaceCreateInfoMVK &t);
 #endif  // VK_USE_PLATFORM_IOS_MVK
 #ifdef VK_USE_PLATFORM_MACOS_MVK
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMacOSSurfaceCreateInfoMVK &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMacOSSurfaceCreateInfoMVK &t);
 #endif  // VK_USE_PLATFORM_MACOS_MVK
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsLabelEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectNameInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCallbackDataEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectTagInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsLabelEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsObjectNameInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsMessengerCallbackDataEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsMessengerCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsObjectTagInfoEXT &t);
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferUsageANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferUsageANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferPropertiesANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferPropertiesANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatPropertiesANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatPropertiesANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportAndroidHardwareBufferInfoANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportAndroidHardwareBufferInfoANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetAndroidHardwareBufferInfoANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetAndroidHardwareBufferInfoANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFormatANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatProperties2ANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatProperties2ANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueueFeaturesAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEnqueueFeaturesAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueuePropertiesAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEnqueuePropertiesAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineScratchSizeAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExecutionGraphPipelineScratchSizeAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineCreateInfoAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExecutionGraphPipelineCreateInfoAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressConstAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphInfoAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchGraphInfoAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphCountInfoAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchGraphCountInfoAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageNodeCreateInfoAMDX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageNodeCreateInfoAMDX &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationsInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleLocationsEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassSampleLocationsEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSampleLocationsBeginInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineSampleLocationsStateCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSampleLocationsPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisamplePropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAdvancedStateCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageToColorStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageModulationStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesListEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierListCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierExplicitCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties2EXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesList2EXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationCacheCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleValidationCacheCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShadingRatePaletteNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportShadingRateImageStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateImageFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateImagePropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleLocationNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleOrderCustomNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryTrianglesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryAABBNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryDataNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindAccelerationStructureMemoryInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerationStructureNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMemoryRequirementsInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTransformMatrixKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAabbPositionsKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInstanceKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewImageFormatInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFilterCubicImageViewImageFormatPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryHostPointerInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHostPointerPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCompilerControlCreateInfoAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePropertiesAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOverallocationCreateInfoAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSampleLocationEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSampleLocationsInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentSampleLocationsEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassSampleLocationsEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSampleLocationsBeginInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineSampleLocationsStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSampleLocationsPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultisamplePropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendAdvancedStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageToColorStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageModulationStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesListEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierListCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierExplicitCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierProperties2EXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesList2EXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationCacheCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleValidationCacheCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShadingRatePaletteNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportShadingRateImageStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShadingRateImageFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShadingRateImagePropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoarseSampleLocationNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoarseSampleOrderCustomNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingShaderGroupCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryTrianglesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryAABBNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryDataNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindAccelerationStructureMemoryInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetAccelerationStructureNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMemoryRequirementsInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTransformMatrixKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAabbPositionsKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureInstanceKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageViewImageFormatInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFilterCubicImageViewImageFormatPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryHostPointerInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryHostPointerPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCompilerControlCreateInfoAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCorePropertiesAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryOverallocationCreateInfoAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT &t);
 #ifdef VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentFrameTokenGGP &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentFrameTokenGGP &t);
 #endif  // VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageFootprintFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportExclusiveScissorStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExclusiveScissorFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointDataNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueDataINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInitializePerformanceApiInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceQueryCreateInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceMarkerInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceStreamMarkerInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceOverrideInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceConfigurationAcquireInfoINTEL &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePCIBusInfoPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayNativeHdrSurfaceCapabilitiesAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainDisplayNativeHdrCreateInfoAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawMeshTasksIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderImageFootprintFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportExclusiveScissorStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExclusiveScissorFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyCheckpointPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCheckpointDataNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceValueDataINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceValueINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInitializePerformanceApiInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolPerformanceQueryCreateInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceMarkerInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceStreamMarkerInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceOverrideInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceConfigurationAcquireInfoINTEL &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePCIBusInfoPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayNativeHdrSurfaceCapabilitiesAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainDisplayNativeHdrCreateInfoAMD &t);
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePipeSurfaceCreateInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImagePipeSurfaceCreateInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMetalSurfaceCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMetalSurfaceCreateInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassFragmentDensityMapCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreProperties2AMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoherentMemoryFeaturesAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryBudgetPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryPriorityFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryPriorityAllocateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoverageReductionModeFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageReductionStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferMixedSamplesCombinationNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVertexFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVertexPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassFragmentDensityMapCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreProperties2AMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCoherentMemoryFeaturesAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryBudgetPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryPriorityFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryPriorityAllocateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferDeviceAddressCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCooperativeMatrixPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCoverageReductionModeFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageReductionStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferMixedSamplesCombinationNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProvokingVertexFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProvokingVertexPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT &t);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFullScreenExclusiveInfoEXT &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesFullScreenExclusiveEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesFullScreenExclusiveEXT &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveWin32InfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFullScreenExclusiveWin32InfoEXT &t);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHeadlessSurfaceCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopyFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopyPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryToImageCopyEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageToMemoryCopyEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToMemoryInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToImageInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageLayoutTransitionInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceHostMemcpySizeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageCopyDevicePerformanceQueryEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlacedFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlacedPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapPlacedInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentScalingCapabilitiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeCompatibilityEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentFenceInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModesCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModeInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentScalingCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkReleaseSwapchainImagesInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsShaderGroupCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineShaderGroupsCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindShaderGroupIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindIndexBufferIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVertexBufferIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetStateFlagsIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsStreamNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutTokenNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsMemoryRequirementsInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceViewportScissorInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassTransformBeginInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthBiasControlFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasRepresentationInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryReportCallbackDataEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDeviceMemoryReportCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2PropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCustomBorderColorCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderColorPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderColorFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentBarrierFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesPresentBarrierNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentBarrierCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDiagnosticsConfigCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaModuleCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaFunctionCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaLaunchInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLaunchFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLaunchPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryLowLatencySupportNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHeadlessSurfaceCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostImageCopyFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostImageCopyPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryToImageCopyEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageToMemoryCopyEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToImageInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToMemoryInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToImageInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHostImageLayoutTransitionInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceHostMemcpySizeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHostImageCopyDevicePerformanceQueryEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMapMemoryPlacedFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMapMemoryPlacedPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryMapPlacedInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentModeEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentScalingCapabilitiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentModeCompatibilityEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentFenceInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentModesCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentModeInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentScalingCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkReleaseSwapchainImagesInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsShaderGroupCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineShaderGroupsCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindShaderGroupIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindIndexBufferIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindVertexBufferIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetStateFlagsIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsStreamNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsLayoutTokenNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsLayoutCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeneratedCommandsInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeneratedCommandsMemoryRequirementsInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceViewportScissorInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassTransformBeginInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthBiasControlFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDepthBiasInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDepthBiasRepresentationInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryReportCallbackDataEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceDeviceMemoryReportCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRobustness2FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRobustness2PropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCustomBorderColorCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCustomBorderColorPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCustomBorderColorFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentBarrierFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesPresentBarrierNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentBarrierCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceDiagnosticsConfigCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaModuleCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaFunctionCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaLaunchInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCudaKernelLaunchFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCudaKernelLaunchPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryLowLatencySupportNV &t);
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalObjectCreateInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectsInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalObjectsInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalDeviceInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalDeviceInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalCommandQueueInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalCommandQueueInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalBufferInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalBufferInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalBufferInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalBufferInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalTextureInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalTextureInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalTextureInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalTextureInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalIOSurfaceInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalIOSurfaceInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalIOSurfaceInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalIOSurfaceInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalSharedEventInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalSharedEventInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalSharedEventInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalSharedEventInfoEXT &t);
 #endif  // VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorAddressInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorDataEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorGetInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCaptureDescriptorDataInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCaptureDescriptorDataInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCaptureDescriptorDataInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCaptureDescriptorDataInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpaqueCaptureDescriptorDataCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCaptureDescriptorDataInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineLibraryCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryMotionTrianglesDataNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMatrixMotionInstanceNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSRTDataNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureSRTMotionInstanceNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInstanceDataNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInstanceNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyCommandTransformInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompressionControlFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionControlEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice4444FormatsFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFaultFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultCountsEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultAddressInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorBinaryHeaderVersionOneEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorAddressInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferBindingInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorDataEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorGetInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCaptureDescriptorDataInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCaptureDescriptorDataInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewCaptureDescriptorDataInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCaptureDescriptorDataInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpaqueCaptureDescriptorDataCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCaptureDescriptorDataInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineLibraryCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressConstKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryMotionTrianglesDataNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMatrixMotionInstanceNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSRTDataNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureSRTMotionInstanceNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInstanceDataNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInstanceNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyCommandTransformInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageCompressionControlFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCompressionControlEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCompressionPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice4444FormatsFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFaultFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultCountsEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultAddressInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultVendorInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultVendorBinaryHeaderVersionOneEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT &t);
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectFBSurfaceCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectFBSurfaceCreateInfoEXT &t);
 #endif  // VK_USE_PLATFORM_DIRECTFB_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeListEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescription2EXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescription2EXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDrmPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAddressBindingReportFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceAddressBindingCallbackDataEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipControlFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportDepthClipControlCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMutableDescriptorTypeListEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMutableDescriptorTypeCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDescription2EXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputAttributeDescription2EXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDrmPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAddressBindingReportFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceAddressBindingCallbackDataEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClipControlFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportDepthClipControlCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT &t);
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryZirconHandleInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryZirconHandleInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryZirconHandlePropertiesFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryZirconHandlePropertiesFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetZirconHandleInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetZirconHandleInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreZirconHandleInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreZirconHandleInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetZirconHandleInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetZirconHandleInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionCreateInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionCreateInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryBufferCollectionFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryBufferCollectionFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionImageCreateInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionImageCreateInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionConstraintsInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionConstraintsInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferConstraintsInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferConstraintsInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionBufferCreateInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionBufferCreateInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSysmemColorSpaceFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSysmemColorSpaceFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionPropertiesFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionPropertiesFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatConstraintsInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatConstraintsInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageConstraintsInfoFUCHSIA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageConstraintsInfoFUCHSIA &t);
 #endif  // VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassShadingPipelineCreateInfoHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetRemoteAddressInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelinePropertiesIdentifierEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelinePropertiesFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFrameBoundaryFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFrameBoundaryEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassResolvePerformanceQueryEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisampledRenderToSingleSampledInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassShadingPipelineCreateInfoHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetRemoteAddressInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelinePropertiesIdentifierEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelinePropertiesFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFrameBoundaryFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFrameBoundaryEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassResolvePerformanceQueryEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultisampledRenderToSingleSampledInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT &t);
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenSurfaceCreateInfoQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenSurfaceCreateInfoQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceColorWriteEnableFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorWriteCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewMinLodFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewMinLodCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawIndexedInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileImageFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileImagePropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapUsageEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicromapFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicromapPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapVersionInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapToMemoryInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToMicromapInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildSizesInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTrianglesOpacityMicromapEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapTriangleEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceColorWriteEnableFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorWriteCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageViewMinLodFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewMinLodCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiDrawFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiDrawPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiDrawInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiDrawIndexedInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTileImageFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTileImagePropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapUsageEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapBuildInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpacityMicromapFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpacityMicromapPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapVersionInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMicromapToMemoryInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToMicromapInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMicromapInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapBuildSizesInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureTrianglesOpacityMicromapEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapTriangleEXT &t);
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementMicromapFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDisplacementMicromapFeaturesNV &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementMicromapPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDisplacementMicromapPropertiesNV &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTrianglesDisplacementMicromapNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureTrianglesDisplacementMicromapNV &t);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBorderColorComponentMappingCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePropertiesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueShaderCoreControlCreateInfoARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingControlsFeaturesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingControlsPropertiesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSlicedCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetBindingReferenceVALVE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutHostMappingInfoVALVE &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStripedFeaturesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStripedPropertiesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeInfoARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeBeginInfoARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeSubmitInfoARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassFragmentDensityMapOffsetEndInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDecompressMemoryRegionNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompressionFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompressionPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineIndirectBufferInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineIndirectDeviceAddressInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindPipelineIndirectCommandNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLinearColorAttachmentFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSampleWeightCreateInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessingFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessingPropertiesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommandBufferFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommandBufferPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryAcquireUnmodifiedEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendEquationEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendAdvancedEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationControlEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingInfoLUNARG &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingListLUNARG &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageModuleIdentifierCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleIdentifierEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreatePrivateDataInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowExecuteInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyDitheringFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerBorderColorComponentMappingCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCorePropertiesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueShaderCoreControlCreateInfoARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSchedulingControlsFeaturesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSchedulingControlsPropertiesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewSlicedCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetBindingReferenceVALVE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutHostMappingInfoVALVE &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRenderPassStripedFeaturesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRenderPassStripedPropertiesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeInfoARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeBeginInfoARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeSubmitInfoARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassFragmentDensityMapOffsetEndInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToImageIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDecompressMemoryRegionNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryDecompressionFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryDecompressionPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComputePipelineIndirectBufferInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineIndirectDeviceAddressInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindPipelineIndirectCommandNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLinearColorAttachmentFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewSampleWeightCreateInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessingFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessingPropertiesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNestedCommandBufferFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNestedCommandBufferPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryAcquireUnmodifiedEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkColorBlendEquationEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkColorBlendAdvancedEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationControlEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationFeedbackInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationFeedbackCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSubpassFeedbackInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSubpassFeedbackCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectDriverLoadingInfoLUNARG &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectDriverLoadingListLUNARG &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageModuleIdentifierCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleIdentifierEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpticalFlowFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpticalFlowPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowImageFormatInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowImageFormatPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowSessionCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowSessionCreatePrivateDataInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowExecuteInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyDitheringFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT &t);
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFormatResolveFeaturesANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFormatResolveFeaturesANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFormatResolvePropertiesANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFormatResolvePropertiesANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatResolvePropertiesANDROID &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatResolvePropertiesANDROID &t);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTilePropertiesFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTilePropertiesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAmigoProfilingFeaturesSEC &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAmigoProfilingSubmitInfoSEC &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingsCreateInfoEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepModeInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetLatencyMarkerInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencyTimingsFrameReportNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGetLatencyMarkerInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySubmissionPresentIdNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainLatencyCreateInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOutOfBandQueueTypeInfoNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySurfaceCapabilitiesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerStageDescriptorSetFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessing2FeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessing2PropertiesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBlockMatchWindowCreateInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicWeightsFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCubicWeightsCreateInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageCubicWeightsInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicClampFeaturesQCOM &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderObjectFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderObjectPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTilePropertiesFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTilePropertiesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAmigoProfilingFeaturesSEC &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAmigoProfilingSubmitInfoSEC &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerSettingEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerSettingsCreateInfoEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySleepModeInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySleepInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetLatencyMarkerInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencyTimingsFrameReportNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGetLatencyMarkerInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySubmissionPresentIdNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainLatencyCreateInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOutOfBandQueueTypeInfoNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySurfaceCapabilitiesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerStageDescriptorSetFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessing2FeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessing2PropertiesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerBlockMatchWindowCreateInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCubicWeightsFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCubicWeightsCreateInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlitImageCubicWeightsInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCubicClampFeaturesQCOM &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT &t);
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferPropertiesQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenBufferPropertiesQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferFormatPropertiesQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenBufferFormatPropertiesQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportScreenBufferInfoQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportScreenBufferInfoQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFormatQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX &t);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredDriverPropertiesMSFT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRawAccessChainsFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingValidationFeaturesNV &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmentControlFeaturesMESA &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmentControlPropertiesMESA &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageAlignmentControlCreateInfoMESA &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildRangeInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryTrianglesDataKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryAabbsDataKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryInstancesDataKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryDataKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildGeometryInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerationStructureKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationStructureFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationStructurePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureDeviceAddressInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureVersionInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureToMemoryInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToAccelerationStructureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildSizesInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineInterfaceCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInfoKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPipelineFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPipelinePropertiesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStridedDeviceAddressRegionKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommandKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayQueryFeaturesKHR &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFeaturesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPropertiesEXT &t);
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectCommandEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredDriverPropertiesMSFT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRawAccessChainsFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingValidationFeaturesNV &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageAlignmentControlFeaturesMESA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageAlignmentControlPropertiesMESA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageAlignmentControlCreateInfoMESA &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildRangeInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryTrianglesDataKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryAabbsDataKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryInstancesDataKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryDataKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildGeometryInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetAccelerationStructureKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAccelerationStructureFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAccelerationStructurePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureDeviceAddressInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureVersionInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyAccelerationStructureToMemoryInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToAccelerationStructureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyAccelerationStructureInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildSizesInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingShaderGroupCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineInterfaceCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineCreateInfoKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPipelineFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPipelinePropertiesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStridedDeviceAddressRegionKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTraceRaysIndirectCommandKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayQueryFeaturesKHR &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderFeaturesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderPropertiesEXT &t);
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawMeshTasksIndirectCommandEXT &t);
 
 // Declare print functions.
-class ObjectInfoDB;
+class ObjectInfoSnapshot;
 class CommandPrinter {
    public:
-    void SetNameResolver(const ObjectInfoDB *name_resolver);
-    void PrintCommandParameters(YAML::Emitter &os, const Command &cmd);
-    void PrintBeginCommandBufferArgs(YAML::Emitter &os, const BeginCommandBufferArgs &args);
-    void PrintEndCommandBufferArgs(YAML::Emitter &os, const EndCommandBufferArgs &args);
-    void PrintResetCommandBufferArgs(YAML::Emitter &os, const ResetCommandBufferArgs &args);
-    void PrintCmdBindPipelineArgs(YAML::Emitter &os, const CmdBindPipelineArgs &args);
-    void PrintCmdSetViewportArgs(YAML::Emitter &os, const CmdSetViewportArgs &args);
-    void PrintCmdSetScissorArgs(YAML::Emitter &os, const CmdSetScissorArgs &args);
-    void PrintCmdSetLineWidthArgs(YAML::Emitter &os, const CmdSetLineWidthArgs &args);
-    void PrintCmdSetDepthBiasArgs(YAML::Emitter &os, const CmdSetDepthBiasArgs &args);
-    void PrintCmdSetBlendConstantsArgs(YAML::Emitter &os, const CmdSetBlendConstantsArgs &args);
-    void PrintCmdSetDepthBoundsArgs(YAML::Emitter &os, const CmdSetDepthBoundsArgs &args);
-    void PrintCmdSetStencilCompareMaskArgs(YAML::Emitter &os, const CmdSetStencilCompareMaskArgs &args);
-    void PrintCmdSetStencilWriteMaskArgs(YAML::Emitter &os, const CmdSetStencilWriteMaskArgs &args);
-    void PrintCmdSetStencilReferenceArgs(YAML::Emitter &os, const CmdSetStencilReferenceArgs &args);
-    void PrintCmdBindDescriptorSetsArgs(YAML::Emitter &os, const CmdBindDescriptorSetsArgs &args);
-    void PrintCmdBindIndexBufferArgs(YAML::Emitter &os, const CmdBindIndexBufferArgs &args);
-    void PrintCmdBindVertexBuffersArgs(YAML::Emitter &os, const CmdBindVertexBuffersArgs &args);
-    void PrintCmdDrawArgs(YAML::Emitter &os, const CmdDrawArgs &args);
-    void PrintCmdDrawIndexedArgs(YAML::Emitter &os, const CmdDrawIndexedArgs &args);
-    void PrintCmdDrawIndirectArgs(YAML::Emitter &os, const CmdDrawIndirectArgs &args);
-    void PrintCmdDrawIndexedIndirectArgs(YAML::Emitter &os, const CmdDrawIndexedIndirectArgs &args);
-    void PrintCmdDispatchArgs(YAML::Emitter &os, const CmdDispatchArgs &args);
-    void PrintCmdDispatchIndirectArgs(YAML::Emitter &os, const CmdDispatchIndirectArgs &args);
-    void PrintCmdCopyBufferArgs(YAML::Emitter &os, const CmdCopyBufferArgs &args);
-    void PrintCmdCopyImageArgs(YAML::Emitter &os, const CmdCopyImageArgs &args);
-    void PrintCmdBlitImageArgs(YAML::Emitter &os, const CmdBlitImageArgs &args);
-    void PrintCmdCopyBufferToImageArgs(YAML::Emitter &os, const CmdCopyBufferToImageArgs &args);
-    void PrintCmdCopyImageToBufferArgs(YAML::Emitter &os, const CmdCopyImageToBufferArgs &args);
-    void PrintCmdUpdateBufferArgs(YAML::Emitter &os, const CmdUpdateBufferArgs &args);
-    void PrintCmdFillBufferArgs(YAML::Emitter &os, const CmdFillBufferArgs &args);
-    void PrintCmdClearColorImageArgs(YAML::Emitter &os, const CmdClearColorImageArgs &args);
-    void PrintCmdClearDepthStencilImageArgs(YAML::Emitter &os, const CmdClearDepthStencilImageArgs &args);
-    void PrintCmdClearAttachmentsArgs(YAML::Emitter &os, const CmdClearAttachmentsArgs &args);
-    void PrintCmdResolveImageArgs(YAML::Emitter &os, const CmdResolveImageArgs &args);
-    void PrintCmdSetEventArgs(YAML::Emitter &os, const CmdSetEventArgs &args);
-    void PrintCmdResetEventArgs(YAML::Emitter &os, const CmdResetEventArgs &args);
-    void PrintCmdWaitEventsArgs(YAML::Emitter &os, const CmdWaitEventsArgs &args);
-    void PrintCmdPipelineBarrierArgs(YAML::Emitter &os, const CmdPipelineBarrierArgs &args);
-    void PrintCmdBeginQueryArgs(YAML::Emitter &os, const CmdBeginQueryArgs &args);
-    void PrintCmdEndQueryArgs(YAML::Emitter &os, const CmdEndQueryArgs &args);
-    void PrintCmdResetQueryPoolArgs(YAML::Emitter &os, const CmdResetQueryPoolArgs &args);
-    void PrintCmdWriteTimestampArgs(YAML::Emitter &os, const CmdWriteTimestampArgs &args);
-    void PrintCmdCopyQueryPoolResultsArgs(YAML::Emitter &os, const CmdCopyQueryPoolResultsArgs &args);
-    void PrintCmdPushConstantsArgs(YAML::Emitter &os, const CmdPushConstantsArgs &args);
-    void PrintCmdBeginRenderPassArgs(YAML::Emitter &os, const CmdBeginRenderPassArgs &args);
-    void PrintCmdNextSubpassArgs(YAML::Emitter &os, const CmdNextSubpassArgs &args);
-    void PrintCmdEndRenderPassArgs(YAML::Emitter &os, const CmdEndRenderPassArgs &args);
-    void PrintCmdExecuteCommandsArgs(YAML::Emitter &os, const CmdExecuteCommandsArgs &args);
-    void PrintCmdSetDeviceMaskArgs(YAML::Emitter &os, const CmdSetDeviceMaskArgs &args);
-    void PrintCmdDispatchBaseArgs(YAML::Emitter &os, const CmdDispatchBaseArgs &args);
-    void PrintCmdDrawIndirectCountArgs(YAML::Emitter &os, const CmdDrawIndirectCountArgs &args);
-    void PrintCmdDrawIndexedIndirectCountArgs(YAML::Emitter &os, const CmdDrawIndexedIndirectCountArgs &args);
-    void PrintCmdBeginRenderPass2Args(YAML::Emitter &os, const CmdBeginRenderPass2Args &args);
-    void PrintCmdNextSubpass2Args(YAML::Emitter &os, const CmdNextSubpass2Args &args);
-    void PrintCmdEndRenderPass2Args(YAML::Emitter &os, const CmdEndRenderPass2Args &args);
-    void PrintCmdSetEvent2Args(YAML::Emitter &os, const CmdSetEvent2Args &args);
-    void PrintCmdResetEvent2Args(YAML::Emitter &os, const CmdResetEvent2Args &args);
-    void PrintCmdWaitEvents2Args(YAML::Emitter &os, const CmdWaitEvents2Args &args);
-    void PrintCmdPipelineBarrier2Args(YAML::Emitter &os, const CmdPipelineBarrier2Args &args);
-    void PrintCmdWriteTimestamp2Args(YAML::Emitter &os, const CmdWriteTimestamp2Args &args);
-    void PrintCmdCopyBuffer2Args(YAML::Emitter &os, const CmdCopyBuffer2Args &args);
-    void PrintCmdCopyImage2Args(YAML::Emitter &os, const CmdCopyImage2Args &args);
-    void PrintCmdCopyBufferToImage2Args(YAML::Emitter &os, const CmdCopyBufferToImage2Args &args);
-    void PrintCmdCopyImageToBuffer2Args(YAML::Emitter &os, const CmdCopyImageToBuffer2Args &args);
-    void PrintCmdBlitImage2Args(YAML::Emitter &os, const CmdBlitImage2Args &args);
-    void PrintCmdResolveImage2Args(YAML::Emitter &os, const CmdResolveImage2Args &args);
-    void PrintCmdBeginRenderingArgs(YAML::Emitter &os, const CmdBeginRenderingArgs &args);
-    void PrintCmdEndRenderingArgs(YAML::Emitter &os, const CmdEndRenderingArgs &args);
-    void PrintCmdSetCullModeArgs(YAML::Emitter &os, const CmdSetCullModeArgs &args);
-    void PrintCmdSetFrontFaceArgs(YAML::Emitter &os, const CmdSetFrontFaceArgs &args);
-    void PrintCmdSetPrimitiveTopologyArgs(YAML::Emitter &os, const CmdSetPrimitiveTopologyArgs &args);
-    void PrintCmdSetViewportWithCountArgs(YAML::Emitter &os, const CmdSetViewportWithCountArgs &args);
-    void PrintCmdSetScissorWithCountArgs(YAML::Emitter &os, const CmdSetScissorWithCountArgs &args);
-    void PrintCmdBindVertexBuffers2Args(YAML::Emitter &os, const CmdBindVertexBuffers2Args &args);
-    void PrintCmdSetDepthTestEnableArgs(YAML::Emitter &os, const CmdSetDepthTestEnableArgs &args);
-    void PrintCmdSetDepthWriteEnableArgs(YAML::Emitter &os, const CmdSetDepthWriteEnableArgs &args);
-    void PrintCmdSetDepthCompareOpArgs(YAML::Emitter &os, const CmdSetDepthCompareOpArgs &args);
-    void PrintCmdSetDepthBoundsTestEnableArgs(YAML::Emitter &os, const CmdSetDepthBoundsTestEnableArgs &args);
-    void PrintCmdSetStencilTestEnableArgs(YAML::Emitter &os, const CmdSetStencilTestEnableArgs &args);
-    void PrintCmdSetStencilOpArgs(YAML::Emitter &os, const CmdSetStencilOpArgs &args);
-    void PrintCmdSetRasterizerDiscardEnableArgs(YAML::Emitter &os, const CmdSetRasterizerDiscardEnableArgs &args);
-    void PrintCmdSetDepthBiasEnableArgs(YAML::Emitter &os, const CmdSetDepthBiasEnableArgs &args);
-    void PrintCmdSetPrimitiveRestartEnableArgs(YAML::Emitter &os, const CmdSetPrimitiveRestartEnableArgs &args);
-    void PrintCmdBeginVideoCodingKHRArgs(YAML::Emitter &os, const CmdBeginVideoCodingKHRArgs &args);
-    void PrintCmdEndVideoCodingKHRArgs(YAML::Emitter &os, const CmdEndVideoCodingKHRArgs &args);
-    void PrintCmdControlVideoCodingKHRArgs(YAML::Emitter &os, const CmdControlVideoCodingKHRArgs &args);
-    void PrintCmdDecodeVideoKHRArgs(YAML::Emitter &os, const CmdDecodeVideoKHRArgs &args);
-    void PrintCmdBeginRenderingKHRArgs(YAML::Emitter &os, const CmdBeginRenderingKHRArgs &args);
-    void PrintCmdEndRenderingKHRArgs(YAML::Emitter &os, const CmdEndRenderingKHRArgs &args);
-    void PrintCmdSetDeviceMaskKHRArgs(YAML::Emitter &os, const CmdSetDeviceMaskKHRArgs &args);
-    void PrintCmdDispatchBaseKHRArgs(YAML::Emitter &os, const CmdDispatchBaseKHRArgs &args);
-    void PrintCmdPushDescriptorSetKHRArgs(YAML::Emitter &os, const CmdPushDescriptorSetKHRArgs &args);
-    void PrintCmdPushDescriptorSetWithTemplateKHRArgs(YAML::Emitter &os,
+    void SetNameResolver(const ObjectInfoSnapshot *name_resolver);
+    void PrintCommandParameters(crash_diagnostic_layer::DumpEmitter &os, const Command &cmd);
+    void PrintBeginCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const BeginCommandBufferArgs &args);
+    void PrintEndCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const EndCommandBufferArgs &args);
+    void PrintResetCommandBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const ResetCommandBufferArgs &args);
+    void PrintCmdBindPipelineArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindPipelineArgs &args);
+    void PrintCmdSetViewportArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportArgs &args);
+    void PrintCmdSetScissorArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorArgs &args);
+    void PrintCmdSetLineWidthArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineWidthArgs &args);
+    void PrintCmdSetDepthBiasArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasArgs &args);
+    void PrintCmdSetBlendConstantsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetBlendConstantsArgs &args);
+    void PrintCmdSetDepthBoundsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBoundsArgs &args);
+    void PrintCmdSetStencilCompareMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilCompareMaskArgs &args);
+    void PrintCmdSetStencilWriteMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilWriteMaskArgs &args);
+    void PrintCmdSetStencilReferenceArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilReferenceArgs &args);
+    void PrintCmdBindDescriptorSetsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorSetsArgs &args);
+    void PrintCmdBindIndexBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindIndexBufferArgs &args);
+    void PrintCmdBindVertexBuffersArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffersArgs &args);
+    void PrintCmdDrawArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawArgs &args);
+    void PrintCmdDrawIndexedArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedArgs &args);
+    void PrintCmdDrawIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectArgs &args);
+    void PrintCmdDrawIndexedIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedIndirectArgs &args);
+    void PrintCmdDispatchArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchArgs &args);
+    void PrintCmdDispatchIndirectArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchIndirectArgs &args);
+    void PrintCmdCopyBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferArgs &args);
+    void PrintCmdCopyImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageArgs &args);
+    void PrintCmdBlitImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImageArgs &args);
+    void PrintCmdCopyBufferToImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImageArgs &args);
+    void PrintCmdCopyImageToBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBufferArgs &args);
+    void PrintCmdUpdateBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdUpdateBufferArgs &args);
+    void PrintCmdFillBufferArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdFillBufferArgs &args);
+    void PrintCmdClearColorImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearColorImageArgs &args);
+    void PrintCmdClearDepthStencilImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearDepthStencilImageArgs &args);
+    void PrintCmdClearAttachmentsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdClearAttachmentsArgs &args);
+    void PrintCmdResolveImageArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImageArgs &args);
+    void PrintCmdSetEventArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEventArgs &args);
+    void PrintCmdResetEventArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEventArgs &args);
+    void PrintCmdWaitEventsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEventsArgs &args);
+    void PrintCmdPipelineBarrierArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrierArgs &args);
+    void PrintCmdBeginQueryArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginQueryArgs &args);
+    void PrintCmdEndQueryArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndQueryArgs &args);
+    void PrintCmdResetQueryPoolArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetQueryPoolArgs &args);
+    void PrintCmdWriteTimestampArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestampArgs &args);
+    void PrintCmdCopyQueryPoolResultsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyQueryPoolResultsArgs &args);
+    void PrintCmdPushConstantsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushConstantsArgs &args);
+    void PrintCmdBeginRenderPassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPassArgs &args);
+    void PrintCmdNextSubpassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpassArgs &args);
+    void PrintCmdEndRenderPassArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPassArgs &args);
+    void PrintCmdExecuteCommandsArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdExecuteCommandsArgs &args);
+    void PrintCmdSetDeviceMaskArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDeviceMaskArgs &args);
+    void PrintCmdDispatchBaseArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchBaseArgs &args);
+    void PrintCmdDrawIndirectCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountArgs &args);
+    void PrintCmdDrawIndexedIndirectCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedIndirectCountArgs &args);
+    void PrintCmdBeginRenderPass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPass2Args &args);
+    void PrintCmdNextSubpass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpass2Args &args);
+    void PrintCmdEndRenderPass2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPass2Args &args);
+    void PrintCmdSetEvent2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEvent2Args &args);
+    void PrintCmdResetEvent2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEvent2Args &args);
+    void PrintCmdWaitEvents2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEvents2Args &args);
+    void PrintCmdPipelineBarrier2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrier2Args &args);
+    void PrintCmdWriteTimestamp2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestamp2Args &args);
+    void PrintCmdCopyBuffer2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBuffer2Args &args);
+    void PrintCmdCopyImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImage2Args &args);
+    void PrintCmdCopyBufferToImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImage2Args &args);
+    void PrintCmdCopyImageToBuffer2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBuffer2Args &args);
+    void PrintCmdBlitImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImage2Args &args);
+    void PrintCmdResolveImage2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImage2Args &args);
+    void PrintCmdBeginRenderingArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderingArgs &args);
+    void PrintCmdEndRenderingArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderingArgs &args);
+    void PrintCmdSetCullModeArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCullModeArgs &args);
+    void PrintCmdSetFrontFaceArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFrontFaceArgs &args);
+    void PrintCmdSetPrimitiveTopologyArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPrimitiveTopologyArgs &args);
+    void PrintCmdSetViewportWithCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWithCountArgs &args);
+    void PrintCmdSetScissorWithCountArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorWithCountArgs &args);
+    void PrintCmdBindVertexBuffers2Args(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffers2Args &args);
+    void PrintCmdSetDepthTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthTestEnableArgs &args);
+    void PrintCmdSetDepthWriteEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthWriteEnableArgs &args);
+    void PrintCmdSetDepthCompareOpArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthCompareOpArgs &args);
+    void PrintCmdSetDepthBoundsTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBoundsTestEnableArgs &args);
+    void PrintCmdSetStencilTestEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilTestEnableArgs &args);
+    void PrintCmdSetStencilOpArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilOpArgs &args);
+    void PrintCmdSetRasterizerDiscardEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetRasterizerDiscardEnableArgs &args);
+    void PrintCmdSetDepthBiasEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasEnableArgs &args);
+    void PrintCmdSetPrimitiveRestartEnableArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPrimitiveRestartEnableArgs &args);
+    void PrintCmdBeginVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginVideoCodingKHRArgs &args);
+    void PrintCmdEndVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndVideoCodingKHRArgs &args);
+    void PrintCmdControlVideoCodingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdControlVideoCodingKHRArgs &args);
+    void PrintCmdDecodeVideoKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDecodeVideoKHRArgs &args);
+    void PrintCmdBeginRenderingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderingKHRArgs &args);
+    void PrintCmdEndRenderingKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderingKHRArgs &args);
+    void PrintCmdSetDeviceMaskKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDeviceMaskKHRArgs &args);
+    void PrintCmdDispatchBaseKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchBaseKHRArgs &args);
+    void PrintCmdPushDescriptorSetKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushDescriptorSetKHRArgs &args);
+    void PrintCmdPushDescriptorSetWithTemplateKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                       const CmdPushDescriptorSetWithTemplateKHRArgs &args);
-    void PrintCmdBeginRenderPass2KHRArgs(YAML::Emitter &os, const CmdBeginRenderPass2KHRArgs &args);
-    void PrintCmdNextSubpass2KHRArgs(YAML::Emitter &os, const CmdNextSubpass2KHRArgs &args);
-    void PrintCmdEndRenderPass2KHRArgs(YAML::Emitter &os, const CmdEndRenderPass2KHRArgs &args);
-    void PrintCmdDrawIndirectCountKHRArgs(YAML::Emitter &os, const CmdDrawIndirectCountKHRArgs &args);
-    void PrintCmdDrawIndexedIndirectCountKHRArgs(YAML::Emitter &os, const CmdDrawIndexedIndirectCountKHRArgs &args);
-    void PrintCmdSetFragmentShadingRateKHRArgs(YAML::Emitter &os, const CmdSetFragmentShadingRateKHRArgs &args);
-    void PrintCmdSetRenderingAttachmentLocationsKHRArgs(YAML::Emitter &os,
+    void PrintCmdBeginRenderPass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginRenderPass2KHRArgs &args);
+    void PrintCmdNextSubpass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdNextSubpass2KHRArgs &args);
+    void PrintCmdEndRenderPass2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndRenderPass2KHRArgs &args);
+    void PrintCmdDrawIndirectCountKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountKHRArgs &args);
+    void PrintCmdDrawIndexedIndirectCountKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedIndirectCountKHRArgs &args);
+    void PrintCmdSetFragmentShadingRateKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFragmentShadingRateKHRArgs &args);
+    void PrintCmdSetRenderingAttachmentLocationsKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                         const CmdSetRenderingAttachmentLocationsKHRArgs &args);
-    void PrintCmdSetRenderingInputAttachmentIndicesKHRArgs(YAML::Emitter &os,
+    void PrintCmdSetRenderingInputAttachmentIndicesKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetRenderingInputAttachmentIndicesKHRArgs &args);
-    void PrintCmdEncodeVideoKHRArgs(YAML::Emitter &os, const CmdEncodeVideoKHRArgs &args);
-    void PrintCmdSetEvent2KHRArgs(YAML::Emitter &os, const CmdSetEvent2KHRArgs &args);
-    void PrintCmdResetEvent2KHRArgs(YAML::Emitter &os, const CmdResetEvent2KHRArgs &args);
-    void PrintCmdWaitEvents2KHRArgs(YAML::Emitter &os, const CmdWaitEvents2KHRArgs &args);
-    void PrintCmdPipelineBarrier2KHRArgs(YAML::Emitter &os, const CmdPipelineBarrier2KHRArgs &args);
-    void PrintCmdWriteTimestamp2KHRArgs(YAML::Emitter &os, const CmdWriteTimestamp2KHRArgs &args);
-    void PrintCmdWriteBufferMarker2AMDArgs(YAML::Emitter &os, const CmdWriteBufferMarker2AMDArgs &args);
-    void PrintCmdCopyBuffer2KHRArgs(YAML::Emitter &os, const CmdCopyBuffer2KHRArgs &args);
-    void PrintCmdCopyImage2KHRArgs(YAML::Emitter &os, const CmdCopyImage2KHRArgs &args);
-    void PrintCmdCopyBufferToImage2KHRArgs(YAML::Emitter &os, const CmdCopyBufferToImage2KHRArgs &args);
-    void PrintCmdCopyImageToBuffer2KHRArgs(YAML::Emitter &os, const CmdCopyImageToBuffer2KHRArgs &args);
-    void PrintCmdBlitImage2KHRArgs(YAML::Emitter &os, const CmdBlitImage2KHRArgs &args);
-    void PrintCmdResolveImage2KHRArgs(YAML::Emitter &os, const CmdResolveImage2KHRArgs &args);
-    void PrintCmdTraceRaysIndirect2KHRArgs(YAML::Emitter &os, const CmdTraceRaysIndirect2KHRArgs &args);
-    void PrintCmdBindIndexBuffer2KHRArgs(YAML::Emitter &os, const CmdBindIndexBuffer2KHRArgs &args);
-    void PrintCmdSetLineStippleKHRArgs(YAML::Emitter &os, const CmdSetLineStippleKHRArgs &args);
-    void PrintCmdBindDescriptorSets2KHRArgs(YAML::Emitter &os, const CmdBindDescriptorSets2KHRArgs &args);
-    void PrintCmdPushConstants2KHRArgs(YAML::Emitter &os, const CmdPushConstants2KHRArgs &args);
-    void PrintCmdPushDescriptorSet2KHRArgs(YAML::Emitter &os, const CmdPushDescriptorSet2KHRArgs &args);
-    void PrintCmdPushDescriptorSetWithTemplate2KHRArgs(YAML::Emitter &os,
+    void PrintCmdEncodeVideoKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEncodeVideoKHRArgs &args);
+    void PrintCmdSetEvent2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetEvent2KHRArgs &args);
+    void PrintCmdResetEvent2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResetEvent2KHRArgs &args);
+    void PrintCmdWaitEvents2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWaitEvents2KHRArgs &args);
+    void PrintCmdPipelineBarrier2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPipelineBarrier2KHRArgs &args);
+    void PrintCmdWriteTimestamp2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteTimestamp2KHRArgs &args);
+    void PrintCmdWriteBufferMarker2AMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteBufferMarker2AMDArgs &args);
+    void PrintCmdCopyBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBuffer2KHRArgs &args);
+    void PrintCmdCopyImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImage2KHRArgs &args);
+    void PrintCmdCopyBufferToImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyBufferToImage2KHRArgs &args);
+    void PrintCmdCopyImageToBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyImageToBuffer2KHRArgs &args);
+    void PrintCmdBlitImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBlitImage2KHRArgs &args);
+    void PrintCmdResolveImage2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdResolveImage2KHRArgs &args);
+    void PrintCmdTraceRaysIndirect2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysIndirect2KHRArgs &args);
+    void PrintCmdBindIndexBuffer2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindIndexBuffer2KHRArgs &args);
+    void PrintCmdSetLineStippleKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineStippleKHRArgs &args);
+    void PrintCmdBindDescriptorSets2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorSets2KHRArgs &args);
+    void PrintCmdPushConstants2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushConstants2KHRArgs &args);
+    void PrintCmdPushDescriptorSet2KHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPushDescriptorSet2KHRArgs &args);
+    void PrintCmdPushDescriptorSetWithTemplate2KHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                        const CmdPushDescriptorSetWithTemplate2KHRArgs &args);
-    void PrintCmdSetDescriptorBufferOffsets2EXTArgs(YAML::Emitter &os,
+    void PrintCmdSetDescriptorBufferOffsets2EXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                     const CmdSetDescriptorBufferOffsets2EXTArgs &args);
     void PrintCmdBindDescriptorBufferEmbeddedSamplers2EXTArgs(
-        YAML::Emitter &os, const CmdBindDescriptorBufferEmbeddedSamplers2EXTArgs &args);
-    void PrintCmdDebugMarkerBeginEXTArgs(YAML::Emitter &os, const CmdDebugMarkerBeginEXTArgs &args);
-    void PrintCmdDebugMarkerEndEXTArgs(YAML::Emitter &os, const CmdDebugMarkerEndEXTArgs &args);
-    void PrintCmdDebugMarkerInsertEXTArgs(YAML::Emitter &os, const CmdDebugMarkerInsertEXTArgs &args);
-    void PrintCmdBindTransformFeedbackBuffersEXTArgs(YAML::Emitter &os,
+        crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorBufferEmbeddedSamplers2EXTArgs &args);
+    void PrintCmdDebugMarkerBeginEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerBeginEXTArgs &args);
+    void PrintCmdDebugMarkerEndEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerEndEXTArgs &args);
+    void PrintCmdDebugMarkerInsertEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDebugMarkerInsertEXTArgs &args);
+    void PrintCmdBindTransformFeedbackBuffersEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                      const CmdBindTransformFeedbackBuffersEXTArgs &args);
-    void PrintCmdBeginTransformFeedbackEXTArgs(YAML::Emitter &os, const CmdBeginTransformFeedbackEXTArgs &args);
-    void PrintCmdEndTransformFeedbackEXTArgs(YAML::Emitter &os, const CmdEndTransformFeedbackEXTArgs &args);
-    void PrintCmdBeginQueryIndexedEXTArgs(YAML::Emitter &os, const CmdBeginQueryIndexedEXTArgs &args);
-    void PrintCmdEndQueryIndexedEXTArgs(YAML::Emitter &os, const CmdEndQueryIndexedEXTArgs &args);
-    void PrintCmdDrawIndirectByteCountEXTArgs(YAML::Emitter &os, const CmdDrawIndirectByteCountEXTArgs &args);
-    void PrintCmdCuLaunchKernelNVXArgs(YAML::Emitter &os, const CmdCuLaunchKernelNVXArgs &args);
-    void PrintCmdDrawIndirectCountAMDArgs(YAML::Emitter &os, const CmdDrawIndirectCountAMDArgs &args);
-    void PrintCmdDrawIndexedIndirectCountAMDArgs(YAML::Emitter &os, const CmdDrawIndexedIndirectCountAMDArgs &args);
-    void PrintCmdBeginConditionalRenderingEXTArgs(YAML::Emitter &os, const CmdBeginConditionalRenderingEXTArgs &args);
-    void PrintCmdEndConditionalRenderingEXTArgs(YAML::Emitter &os, const CmdEndConditionalRenderingEXTArgs &args);
-    void PrintCmdSetViewportWScalingNVArgs(YAML::Emitter &os, const CmdSetViewportWScalingNVArgs &args);
-    void PrintCmdSetDiscardRectangleEXTArgs(YAML::Emitter &os, const CmdSetDiscardRectangleEXTArgs &args);
-    void PrintCmdSetDiscardRectangleEnableEXTArgs(YAML::Emitter &os, const CmdSetDiscardRectangleEnableEXTArgs &args);
-    void PrintCmdSetDiscardRectangleModeEXTArgs(YAML::Emitter &os, const CmdSetDiscardRectangleModeEXTArgs &args);
-    void PrintCmdBeginDebugUtilsLabelEXTArgs(YAML::Emitter &os, const CmdBeginDebugUtilsLabelEXTArgs &args);
-    void PrintCmdEndDebugUtilsLabelEXTArgs(YAML::Emitter &os, const CmdEndDebugUtilsLabelEXTArgs &args);
-    void PrintCmdInsertDebugUtilsLabelEXTArgs(YAML::Emitter &os, const CmdInsertDebugUtilsLabelEXTArgs &args);
+    void PrintCmdBeginTransformFeedbackEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginTransformFeedbackEXTArgs &args);
+    void PrintCmdEndTransformFeedbackEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndTransformFeedbackEXTArgs &args);
+    void PrintCmdBeginQueryIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginQueryIndexedEXTArgs &args);
+    void PrintCmdEndQueryIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndQueryIndexedEXTArgs &args);
+    void PrintCmdDrawIndirectByteCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectByteCountEXTArgs &args);
+    void PrintCmdCuLaunchKernelNVXArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCuLaunchKernelNVXArgs &args);
+    void PrintCmdDrawIndirectCountAMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndirectCountAMDArgs &args);
+    void PrintCmdDrawIndexedIndirectCountAMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawIndexedIndirectCountAMDArgs &args);
+    void PrintCmdBeginConditionalRenderingEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginConditionalRenderingEXTArgs &args);
+    void PrintCmdEndConditionalRenderingEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndConditionalRenderingEXTArgs &args);
+    void PrintCmdSetViewportWScalingNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWScalingNVArgs &args);
+    void PrintCmdSetDiscardRectangleEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDiscardRectangleEXTArgs &args);
+    void PrintCmdSetDiscardRectangleEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDiscardRectangleEnableEXTArgs &args);
+    void PrintCmdSetDiscardRectangleModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDiscardRectangleModeEXTArgs &args);
+    void PrintCmdBeginDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBeginDebugUtilsLabelEXTArgs &args);
+    void PrintCmdEndDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdEndDebugUtilsLabelEXTArgs &args);
+    void PrintCmdInsertDebugUtilsLabelEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdInsertDebugUtilsLabelEXTArgs &args);
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    void PrintCmdInitializeGraphScratchMemoryAMDXArgs(YAML::Emitter &os,
+    void PrintCmdInitializeGraphScratchMemoryAMDXArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                       const CmdInitializeGraphScratchMemoryAMDXArgs &args);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    void PrintCmdDispatchGraphAMDXArgs(YAML::Emitter &os, const CmdDispatchGraphAMDXArgs &args);
+    void PrintCmdDispatchGraphAMDXArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchGraphAMDXArgs &args);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    void PrintCmdDispatchGraphIndirectAMDXArgs(YAML::Emitter &os, const CmdDispatchGraphIndirectAMDXArgs &args);
+    void PrintCmdDispatchGraphIndirectAMDXArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDispatchGraphIndirectAMDXArgs &args);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    void PrintCmdDispatchGraphIndirectCountAMDXArgs(YAML::Emitter &os,
+    void PrintCmdDispatchGraphIndirectCountAMDXArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                     const CmdDispatchGraphIndirectCountAMDXArgs &args);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
-    void PrintCmdSetSampleLocationsEXTArgs(YAML::Emitter &os, const CmdSetSampleLocationsEXTArgs &args);
-    void PrintCmdBindShadingRateImageNVArgs(YAML::Emitter &os, const CmdBindShadingRateImageNVArgs &args);
-    void PrintCmdSetViewportShadingRatePaletteNVArgs(YAML::Emitter &os,
+    void PrintCmdSetSampleLocationsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetSampleLocationsEXTArgs &args);
+    void PrintCmdBindShadingRateImageNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindShadingRateImageNVArgs &args);
+    void PrintCmdSetViewportShadingRatePaletteNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                      const CmdSetViewportShadingRatePaletteNVArgs &args);
-    void PrintCmdSetCoarseSampleOrderNVArgs(YAML::Emitter &os, const CmdSetCoarseSampleOrderNVArgs &args);
-    void PrintCmdBuildAccelerationStructureNVArgs(YAML::Emitter &os, const CmdBuildAccelerationStructureNVArgs &args);
-    void PrintCmdCopyAccelerationStructureNVArgs(YAML::Emitter &os, const CmdCopyAccelerationStructureNVArgs &args);
-    void PrintCmdTraceRaysNVArgs(YAML::Emitter &os, const CmdTraceRaysNVArgs &args);
+    void PrintCmdSetCoarseSampleOrderNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoarseSampleOrderNVArgs &args);
+    void PrintCmdBuildAccelerationStructureNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBuildAccelerationStructureNVArgs &args);
+    void PrintCmdCopyAccelerationStructureNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyAccelerationStructureNVArgs &args);
+    void PrintCmdTraceRaysNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysNVArgs &args);
     void PrintCmdWriteAccelerationStructuresPropertiesNVArgs(
-        YAML::Emitter &os, const CmdWriteAccelerationStructuresPropertiesNVArgs &args);
-    void PrintCmdWriteBufferMarkerAMDArgs(YAML::Emitter &os, const CmdWriteBufferMarkerAMDArgs &args);
-    void PrintCmdDrawMeshTasksNVArgs(YAML::Emitter &os, const CmdDrawMeshTasksNVArgs &args);
-    void PrintCmdDrawMeshTasksIndirectNVArgs(YAML::Emitter &os, const CmdDrawMeshTasksIndirectNVArgs &args);
-    void PrintCmdDrawMeshTasksIndirectCountNVArgs(YAML::Emitter &os, const CmdDrawMeshTasksIndirectCountNVArgs &args);
-    void PrintCmdSetExclusiveScissorEnableNVArgs(YAML::Emitter &os, const CmdSetExclusiveScissorEnableNVArgs &args);
-    void PrintCmdSetExclusiveScissorNVArgs(YAML::Emitter &os, const CmdSetExclusiveScissorNVArgs &args);
-    void PrintCmdSetCheckpointNVArgs(YAML::Emitter &os, const CmdSetCheckpointNVArgs &args);
-    void PrintCmdSetPerformanceMarkerINTELArgs(YAML::Emitter &os, const CmdSetPerformanceMarkerINTELArgs &args);
-    void PrintCmdSetPerformanceStreamMarkerINTELArgs(YAML::Emitter &os,
+        crash_diagnostic_layer::DumpEmitter &os, const CmdWriteAccelerationStructuresPropertiesNVArgs &args);
+    void PrintCmdWriteBufferMarkerAMDArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteBufferMarkerAMDArgs &args);
+    void PrintCmdDrawMeshTasksNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksNVArgs &args);
+    void PrintCmdDrawMeshTasksIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksIndirectNVArgs &args);
+    void PrintCmdDrawMeshTasksIndirectCountNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksIndirectCountNVArgs &args);
+    void PrintCmdSetExclusiveScissorEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetExclusiveScissorEnableNVArgs &args);
+    void PrintCmdSetExclusiveScissorNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetExclusiveScissorNVArgs &args);
+    void PrintCmdSetCheckpointNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCheckpointNVArgs &args);
+    void PrintCmdSetPerformanceMarkerINTELArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPerformanceMarkerINTELArgs &args);
+    void PrintCmdSetPerformanceStreamMarkerINTELArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                      const CmdSetPerformanceStreamMarkerINTELArgs &args);
-    void PrintCmdSetPerformanceOverrideINTELArgs(YAML::Emitter &os, const CmdSetPerformanceOverrideINTELArgs &args);
-    void PrintCmdSetLineStippleEXTArgs(YAML::Emitter &os, const CmdSetLineStippleEXTArgs &args);
-    void PrintCmdSetCullModeEXTArgs(YAML::Emitter &os, const CmdSetCullModeEXTArgs &args);
-    void PrintCmdSetFrontFaceEXTArgs(YAML::Emitter &os, const CmdSetFrontFaceEXTArgs &args);
-    void PrintCmdSetPrimitiveTopologyEXTArgs(YAML::Emitter &os, const CmdSetPrimitiveTopologyEXTArgs &args);
-    void PrintCmdSetViewportWithCountEXTArgs(YAML::Emitter &os, const CmdSetViewportWithCountEXTArgs &args);
-    void PrintCmdSetScissorWithCountEXTArgs(YAML::Emitter &os, const CmdSetScissorWithCountEXTArgs &args);
-    void PrintCmdBindVertexBuffers2EXTArgs(YAML::Emitter &os, const CmdBindVertexBuffers2EXTArgs &args);
-    void PrintCmdSetDepthTestEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthTestEnableEXTArgs &args);
-    void PrintCmdSetDepthWriteEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthWriteEnableEXTArgs &args);
-    void PrintCmdSetDepthCompareOpEXTArgs(YAML::Emitter &os, const CmdSetDepthCompareOpEXTArgs &args);
-    void PrintCmdSetDepthBoundsTestEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthBoundsTestEnableEXTArgs &args);
-    void PrintCmdSetStencilTestEnableEXTArgs(YAML::Emitter &os, const CmdSetStencilTestEnableEXTArgs &args);
-    void PrintCmdSetStencilOpEXTArgs(YAML::Emitter &os, const CmdSetStencilOpEXTArgs &args);
-    void PrintCmdPreprocessGeneratedCommandsNVArgs(YAML::Emitter &os, const CmdPreprocessGeneratedCommandsNVArgs &args);
-    void PrintCmdExecuteGeneratedCommandsNVArgs(YAML::Emitter &os, const CmdExecuteGeneratedCommandsNVArgs &args);
-    void PrintCmdBindPipelineShaderGroupNVArgs(YAML::Emitter &os, const CmdBindPipelineShaderGroupNVArgs &args);
-    void PrintCmdSetDepthBias2EXTArgs(YAML::Emitter &os, const CmdSetDepthBias2EXTArgs &args);
-    void PrintCmdCudaLaunchKernelNVArgs(YAML::Emitter &os, const CmdCudaLaunchKernelNVArgs &args);
-    void PrintCmdBindDescriptorBuffersEXTArgs(YAML::Emitter &os, const CmdBindDescriptorBuffersEXTArgs &args);
-    void PrintCmdSetDescriptorBufferOffsetsEXTArgs(YAML::Emitter &os, const CmdSetDescriptorBufferOffsetsEXTArgs &args);
+    void PrintCmdSetPerformanceOverrideINTELArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPerformanceOverrideINTELArgs &args);
+    void PrintCmdSetLineStippleEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineStippleEXTArgs &args);
+    void PrintCmdSetCullModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCullModeEXTArgs &args);
+    void PrintCmdSetFrontFaceEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFrontFaceEXTArgs &args);
+    void PrintCmdSetPrimitiveTopologyEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPrimitiveTopologyEXTArgs &args);
+    void PrintCmdSetViewportWithCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWithCountEXTArgs &args);
+    void PrintCmdSetScissorWithCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetScissorWithCountEXTArgs &args);
+    void PrintCmdBindVertexBuffers2EXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindVertexBuffers2EXTArgs &args);
+    void PrintCmdSetDepthTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthTestEnableEXTArgs &args);
+    void PrintCmdSetDepthWriteEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthWriteEnableEXTArgs &args);
+    void PrintCmdSetDepthCompareOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthCompareOpEXTArgs &args);
+    void PrintCmdSetDepthBoundsTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBoundsTestEnableEXTArgs &args);
+    void PrintCmdSetStencilTestEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilTestEnableEXTArgs &args);
+    void PrintCmdSetStencilOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetStencilOpEXTArgs &args);
+    void PrintCmdPreprocessGeneratedCommandsNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdPreprocessGeneratedCommandsNVArgs &args);
+    void PrintCmdExecuteGeneratedCommandsNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdExecuteGeneratedCommandsNVArgs &args);
+    void PrintCmdBindPipelineShaderGroupNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindPipelineShaderGroupNVArgs &args);
+    void PrintCmdSetDepthBias2EXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBias2EXTArgs &args);
+    void PrintCmdCudaLaunchKernelNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCudaLaunchKernelNVArgs &args);
+    void PrintCmdBindDescriptorBuffersEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorBuffersEXTArgs &args);
+    void PrintCmdSetDescriptorBufferOffsetsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDescriptorBufferOffsetsEXTArgs &args);
     void PrintCmdBindDescriptorBufferEmbeddedSamplersEXTArgs(
-        YAML::Emitter &os, const CmdBindDescriptorBufferEmbeddedSamplersEXTArgs &args);
-    void PrintCmdSetFragmentShadingRateEnumNVArgs(YAML::Emitter &os, const CmdSetFragmentShadingRateEnumNVArgs &args);
-    void PrintCmdSetVertexInputEXTArgs(YAML::Emitter &os, const CmdSetVertexInputEXTArgs &args);
-    void PrintCmdSubpassShadingHUAWEIArgs(YAML::Emitter &os, const CmdSubpassShadingHUAWEIArgs &args);
-    void PrintCmdBindInvocationMaskHUAWEIArgs(YAML::Emitter &os, const CmdBindInvocationMaskHUAWEIArgs &args);
-    void PrintCmdSetPatchControlPointsEXTArgs(YAML::Emitter &os, const CmdSetPatchControlPointsEXTArgs &args);
-    void PrintCmdSetRasterizerDiscardEnableEXTArgs(YAML::Emitter &os, const CmdSetRasterizerDiscardEnableEXTArgs &args);
-    void PrintCmdSetDepthBiasEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthBiasEnableEXTArgs &args);
-    void PrintCmdSetLogicOpEXTArgs(YAML::Emitter &os, const CmdSetLogicOpEXTArgs &args);
-    void PrintCmdSetPrimitiveRestartEnableEXTArgs(YAML::Emitter &os, const CmdSetPrimitiveRestartEnableEXTArgs &args);
-    void PrintCmdSetColorWriteEnableEXTArgs(YAML::Emitter &os, const CmdSetColorWriteEnableEXTArgs &args);
-    void PrintCmdDrawMultiEXTArgs(YAML::Emitter &os, const CmdDrawMultiEXTArgs &args);
-    void PrintCmdDrawMultiIndexedEXTArgs(YAML::Emitter &os, const CmdDrawMultiIndexedEXTArgs &args);
-    void PrintCmdBuildMicromapsEXTArgs(YAML::Emitter &os, const CmdBuildMicromapsEXTArgs &args);
-    void PrintCmdCopyMicromapEXTArgs(YAML::Emitter &os, const CmdCopyMicromapEXTArgs &args);
-    void PrintCmdCopyMicromapToMemoryEXTArgs(YAML::Emitter &os, const CmdCopyMicromapToMemoryEXTArgs &args);
-    void PrintCmdCopyMemoryToMicromapEXTArgs(YAML::Emitter &os, const CmdCopyMemoryToMicromapEXTArgs &args);
-    void PrintCmdWriteMicromapsPropertiesEXTArgs(YAML::Emitter &os, const CmdWriteMicromapsPropertiesEXTArgs &args);
-    void PrintCmdDrawClusterHUAWEIArgs(YAML::Emitter &os, const CmdDrawClusterHUAWEIArgs &args);
-    void PrintCmdDrawClusterIndirectHUAWEIArgs(YAML::Emitter &os, const CmdDrawClusterIndirectHUAWEIArgs &args);
-    void PrintCmdCopyMemoryIndirectNVArgs(YAML::Emitter &os, const CmdCopyMemoryIndirectNVArgs &args);
-    void PrintCmdCopyMemoryToImageIndirectNVArgs(YAML::Emitter &os, const CmdCopyMemoryToImageIndirectNVArgs &args);
-    void PrintCmdDecompressMemoryNVArgs(YAML::Emitter &os, const CmdDecompressMemoryNVArgs &args);
-    void PrintCmdDecompressMemoryIndirectCountNVArgs(YAML::Emitter &os,
+        crash_diagnostic_layer::DumpEmitter &os, const CmdBindDescriptorBufferEmbeddedSamplersEXTArgs &args);
+    void PrintCmdSetFragmentShadingRateEnumNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetFragmentShadingRateEnumNVArgs &args);
+    void PrintCmdSetVertexInputEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetVertexInputEXTArgs &args);
+    void PrintCmdSubpassShadingHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSubpassShadingHUAWEIArgs &args);
+    void PrintCmdBindInvocationMaskHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindInvocationMaskHUAWEIArgs &args);
+    void PrintCmdSetPatchControlPointsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPatchControlPointsEXTArgs &args);
+    void PrintCmdSetRasterizerDiscardEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetRasterizerDiscardEnableEXTArgs &args);
+    void PrintCmdSetDepthBiasEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthBiasEnableEXTArgs &args);
+    void PrintCmdSetLogicOpEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLogicOpEXTArgs &args);
+    void PrintCmdSetPrimitiveRestartEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPrimitiveRestartEnableEXTArgs &args);
+    void PrintCmdSetColorWriteEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorWriteEnableEXTArgs &args);
+    void PrintCmdDrawMultiEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMultiEXTArgs &args);
+    void PrintCmdDrawMultiIndexedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMultiIndexedEXTArgs &args);
+    void PrintCmdBuildMicromapsEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBuildMicromapsEXTArgs &args);
+    void PrintCmdCopyMicromapEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMicromapEXTArgs &args);
+    void PrintCmdCopyMicromapToMemoryEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMicromapToMemoryEXTArgs &args);
+    void PrintCmdCopyMemoryToMicromapEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMemoryToMicromapEXTArgs &args);
+    void PrintCmdWriteMicromapsPropertiesEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdWriteMicromapsPropertiesEXTArgs &args);
+    void PrintCmdDrawClusterHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawClusterHUAWEIArgs &args);
+    void PrintCmdDrawClusterIndirectHUAWEIArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawClusterIndirectHUAWEIArgs &args);
+    void PrintCmdCopyMemoryIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMemoryIndirectNVArgs &args);
+    void PrintCmdCopyMemoryToImageIndirectNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyMemoryToImageIndirectNVArgs &args);
+    void PrintCmdDecompressMemoryNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDecompressMemoryNVArgs &args);
+    void PrintCmdDecompressMemoryIndirectCountNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                      const CmdDecompressMemoryIndirectCountNVArgs &args);
-    void PrintCmdUpdatePipelineIndirectBufferNVArgs(YAML::Emitter &os,
+    void PrintCmdUpdatePipelineIndirectBufferNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                     const CmdUpdatePipelineIndirectBufferNVArgs &args);
-    void PrintCmdSetDepthClampEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthClampEnableEXTArgs &args);
-    void PrintCmdSetPolygonModeEXTArgs(YAML::Emitter &os, const CmdSetPolygonModeEXTArgs &args);
-    void PrintCmdSetRasterizationSamplesEXTArgs(YAML::Emitter &os, const CmdSetRasterizationSamplesEXTArgs &args);
-    void PrintCmdSetSampleMaskEXTArgs(YAML::Emitter &os, const CmdSetSampleMaskEXTArgs &args);
-    void PrintCmdSetAlphaToCoverageEnableEXTArgs(YAML::Emitter &os, const CmdSetAlphaToCoverageEnableEXTArgs &args);
-    void PrintCmdSetAlphaToOneEnableEXTArgs(YAML::Emitter &os, const CmdSetAlphaToOneEnableEXTArgs &args);
-    void PrintCmdSetLogicOpEnableEXTArgs(YAML::Emitter &os, const CmdSetLogicOpEnableEXTArgs &args);
-    void PrintCmdSetColorBlendEnableEXTArgs(YAML::Emitter &os, const CmdSetColorBlendEnableEXTArgs &args);
-    void PrintCmdSetColorBlendEquationEXTArgs(YAML::Emitter &os, const CmdSetColorBlendEquationEXTArgs &args);
-    void PrintCmdSetColorWriteMaskEXTArgs(YAML::Emitter &os, const CmdSetColorWriteMaskEXTArgs &args);
-    void PrintCmdSetTessellationDomainOriginEXTArgs(YAML::Emitter &os,
+    void PrintCmdSetDepthClampEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthClampEnableEXTArgs &args);
+    void PrintCmdSetPolygonModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetPolygonModeEXTArgs &args);
+    void PrintCmdSetRasterizationSamplesEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetRasterizationSamplesEXTArgs &args);
+    void PrintCmdSetSampleMaskEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetSampleMaskEXTArgs &args);
+    void PrintCmdSetAlphaToCoverageEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetAlphaToCoverageEnableEXTArgs &args);
+    void PrintCmdSetAlphaToOneEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetAlphaToOneEnableEXTArgs &args);
+    void PrintCmdSetLogicOpEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLogicOpEnableEXTArgs &args);
+    void PrintCmdSetColorBlendEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorBlendEnableEXTArgs &args);
+    void PrintCmdSetColorBlendEquationEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorBlendEquationEXTArgs &args);
+    void PrintCmdSetColorWriteMaskEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorWriteMaskEXTArgs &args);
+    void PrintCmdSetTessellationDomainOriginEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                     const CmdSetTessellationDomainOriginEXTArgs &args);
-    void PrintCmdSetRasterizationStreamEXTArgs(YAML::Emitter &os, const CmdSetRasterizationStreamEXTArgs &args);
-    void PrintCmdSetConservativeRasterizationModeEXTArgs(YAML::Emitter &os,
+    void PrintCmdSetRasterizationStreamEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetRasterizationStreamEXTArgs &args);
+    void PrintCmdSetConservativeRasterizationModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                          const CmdSetConservativeRasterizationModeEXTArgs &args);
-    void PrintCmdSetExtraPrimitiveOverestimationSizeEXTArgs(YAML::Emitter &os,
+    void PrintCmdSetExtraPrimitiveOverestimationSizeEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdSetExtraPrimitiveOverestimationSizeEXTArgs &args);
-    void PrintCmdSetDepthClipEnableEXTArgs(YAML::Emitter &os, const CmdSetDepthClipEnableEXTArgs &args);
-    void PrintCmdSetSampleLocationsEnableEXTArgs(YAML::Emitter &os, const CmdSetSampleLocationsEnableEXTArgs &args);
-    void PrintCmdSetColorBlendAdvancedEXTArgs(YAML::Emitter &os, const CmdSetColorBlendAdvancedEXTArgs &args);
-    void PrintCmdSetProvokingVertexModeEXTArgs(YAML::Emitter &os, const CmdSetProvokingVertexModeEXTArgs &args);
-    void PrintCmdSetLineRasterizationModeEXTArgs(YAML::Emitter &os, const CmdSetLineRasterizationModeEXTArgs &args);
-    void PrintCmdSetLineStippleEnableEXTArgs(YAML::Emitter &os, const CmdSetLineStippleEnableEXTArgs &args);
-    void PrintCmdSetDepthClipNegativeOneToOneEXTArgs(YAML::Emitter &os,
+    void PrintCmdSetDepthClipEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetDepthClipEnableEXTArgs &args);
+    void PrintCmdSetSampleLocationsEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetSampleLocationsEnableEXTArgs &args);
+    void PrintCmdSetColorBlendAdvancedEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetColorBlendAdvancedEXTArgs &args);
+    void PrintCmdSetProvokingVertexModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetProvokingVertexModeEXTArgs &args);
+    void PrintCmdSetLineRasterizationModeEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineRasterizationModeEXTArgs &args);
+    void PrintCmdSetLineStippleEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetLineStippleEnableEXTArgs &args);
+    void PrintCmdSetDepthClipNegativeOneToOneEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                      const CmdSetDepthClipNegativeOneToOneEXTArgs &args);
-    void PrintCmdSetViewportWScalingEnableNVArgs(YAML::Emitter &os, const CmdSetViewportWScalingEnableNVArgs &args);
-    void PrintCmdSetViewportSwizzleNVArgs(YAML::Emitter &os, const CmdSetViewportSwizzleNVArgs &args);
-    void PrintCmdSetCoverageToColorEnableNVArgs(YAML::Emitter &os, const CmdSetCoverageToColorEnableNVArgs &args);
-    void PrintCmdSetCoverageToColorLocationNVArgs(YAML::Emitter &os, const CmdSetCoverageToColorLocationNVArgs &args);
-    void PrintCmdSetCoverageModulationModeNVArgs(YAML::Emitter &os, const CmdSetCoverageModulationModeNVArgs &args);
-    void PrintCmdSetCoverageModulationTableEnableNVArgs(YAML::Emitter &os,
+    void PrintCmdSetViewportWScalingEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportWScalingEnableNVArgs &args);
+    void PrintCmdSetViewportSwizzleNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetViewportSwizzleNVArgs &args);
+    void PrintCmdSetCoverageToColorEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageToColorEnableNVArgs &args);
+    void PrintCmdSetCoverageToColorLocationNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageToColorLocationNVArgs &args);
+    void PrintCmdSetCoverageModulationModeNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageModulationModeNVArgs &args);
+    void PrintCmdSetCoverageModulationTableEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                         const CmdSetCoverageModulationTableEnableNVArgs &args);
-    void PrintCmdSetCoverageModulationTableNVArgs(YAML::Emitter &os, const CmdSetCoverageModulationTableNVArgs &args);
-    void PrintCmdSetShadingRateImageEnableNVArgs(YAML::Emitter &os, const CmdSetShadingRateImageEnableNVArgs &args);
-    void PrintCmdSetRepresentativeFragmentTestEnableNVArgs(YAML::Emitter &os,
+    void PrintCmdSetCoverageModulationTableNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageModulationTableNVArgs &args);
+    void PrintCmdSetShadingRateImageEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetShadingRateImageEnableNVArgs &args);
+    void PrintCmdSetRepresentativeFragmentTestEnableNVArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                            const CmdSetRepresentativeFragmentTestEnableNVArgs &args);
-    void PrintCmdSetCoverageReductionModeNVArgs(YAML::Emitter &os, const CmdSetCoverageReductionModeNVArgs &args);
-    void PrintCmdOpticalFlowExecuteNVArgs(YAML::Emitter &os, const CmdOpticalFlowExecuteNVArgs &args);
-    void PrintCmdBindShadersEXTArgs(YAML::Emitter &os, const CmdBindShadersEXTArgs &args);
-    void PrintCmdSetAttachmentFeedbackLoopEnableEXTArgs(YAML::Emitter &os,
+    void PrintCmdSetCoverageReductionModeNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdSetCoverageReductionModeNVArgs &args);
+    void PrintCmdOpticalFlowExecuteNVArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdOpticalFlowExecuteNVArgs &args);
+    void PrintCmdBindShadersEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdBindShadersEXTArgs &args);
+    void PrintCmdSetAttachmentFeedbackLoopEnableEXTArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                         const CmdSetAttachmentFeedbackLoopEnableEXTArgs &args);
-    void PrintCmdBuildAccelerationStructuresKHRArgs(YAML::Emitter &os,
+    void PrintCmdBuildAccelerationStructuresKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                     const CmdBuildAccelerationStructuresKHRArgs &args);
-    void PrintCmdBuildAccelerationStructuresIndirectKHRArgs(YAML::Emitter &os,
+    void PrintCmdBuildAccelerationStructuresIndirectKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                             const CmdBuildAccelerationStructuresIndirectKHRArgs &args);
-    void PrintCmdCopyAccelerationStructureKHRArgs(YAML::Emitter &os, const CmdCopyAccelerationStructureKHRArgs &args);
-    void PrintCmdCopyAccelerationStructureToMemoryKHRArgs(YAML::Emitter &os,
+    void PrintCmdCopyAccelerationStructureKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdCopyAccelerationStructureKHRArgs &args);
+    void PrintCmdCopyAccelerationStructureToMemoryKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdCopyAccelerationStructureToMemoryKHRArgs &args);
-    void PrintCmdCopyMemoryToAccelerationStructureKHRArgs(YAML::Emitter &os,
+    void PrintCmdCopyMemoryToAccelerationStructureKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                           const CmdCopyMemoryToAccelerationStructureKHRArgs &args);
     void PrintCmdWriteAccelerationStructuresPropertiesKHRArgs(
-        YAML::Emitter &os, const CmdWriteAccelerationStructuresPropertiesKHRArgs &args);
-    void PrintCmdTraceRaysKHRArgs(YAML::Emitter &os, const CmdTraceRaysKHRArgs &args);
-    void PrintCmdTraceRaysIndirectKHRArgs(YAML::Emitter &os, const CmdTraceRaysIndirectKHRArgs &args);
-    void PrintCmdSetRayTracingPipelineStackSizeKHRArgs(YAML::Emitter &os,
+        crash_diagnostic_layer::DumpEmitter &os, const CmdWriteAccelerationStructuresPropertiesKHRArgs &args);
+    void PrintCmdTraceRaysKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysKHRArgs &args);
+    void PrintCmdTraceRaysIndirectKHRArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdTraceRaysIndirectKHRArgs &args);
+    void PrintCmdSetRayTracingPipelineStackSizeKHRArgs(crash_diagnostic_layer::DumpEmitter &os,
                                                        const CmdSetRayTracingPipelineStackSizeKHRArgs &args);
-    void PrintCmdDrawMeshTasksEXTArgs(YAML::Emitter &os, const CmdDrawMeshTasksEXTArgs &args);
-    void PrintCmdDrawMeshTasksIndirectEXTArgs(YAML::Emitter &os, const CmdDrawMeshTasksIndirectEXTArgs &args);
-    void PrintCmdDrawMeshTasksIndirectCountEXTArgs(YAML::Emitter &os, const CmdDrawMeshTasksIndirectCountEXTArgs &args);
+    void PrintCmdDrawMeshTasksEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksEXTArgs &args);
+    void PrintCmdDrawMeshTasksIndirectEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksIndirectEXTArgs &args);
+    void PrintCmdDrawMeshTasksIndirectCountEXTArgs(crash_diagnostic_layer::DumpEmitter &os, const CmdDrawMeshTasksIndirectCountEXTArgs &args);
 };
 
 // NOLINTEND
@@ -32,7 +32,7 @@
 #include "command_printer.h"
 #include "util.h"
 
-YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext) {
+crash_diagnostic_layer::DumpEmitter &PrintNextPtr(crash_diagnostic_layer::DumpEmitter &os, const void *pNext) {
     if (pNext == nullptr) {
         os << "nullptr";
         return os;
@@ -45,7 +45,7 @@ YAML::Emitter &PrintNextPtr(YAML::Emitter &os, const void *pNext) {
 
 // Define all stream operators.
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent2D &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtent2D &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "width";
     // width -> Field -> uint32_t
@@ -57,7 +57,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent2D &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent3D &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtent3D &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "width";
     // width -> Field -> uint32_t
@@ -72,7 +72,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtent3D &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset2D &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOffset2D &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> int32_t
@@ -84,7 +84,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset2D &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset3D &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOffset3D &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> int32_t
@@ -99,7 +99,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOffset3D &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRect2D &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRect2D &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "offset";
     // offset -> Field -> VkOffset2D
@@ -111,7 +111,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRect2D &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseInStructure &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBaseInStructure &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -125,7 +125,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseInStructure &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseOutStructure &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBaseOutStructure &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -139,7 +139,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBaseOutStructure &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryBarrier &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -174,7 +174,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchIndirectCommand &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchIndirectCommand &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> uint32_t
@@ -189,7 +189,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchIndirectCommand &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndexedIndirectCommand &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawIndexedIndirectCommand &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "indexCount";
     // indexCount -> Field -> uint32_t
@@ -210,7 +210,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndexedIndirectCommand
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndirectCommand &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawIndirectCommand &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "vertexCount";
     // vertexCount -> Field -> uint32_t
@@ -228,7 +228,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawIndirectCommand &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceRange &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresourceRange &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
@@ -249,7 +249,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceRange &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryBarrier &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -287,7 +287,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryBarrier &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -307,7 +307,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheHeaderVersionOne &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCacheHeaderVersionOne &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "headerSize";
     // headerSize -> Field -> uint32_t
@@ -338,7 +338,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheHeaderVersionO
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAllocationCallbacks &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAllocationCallbacks &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "pUserData";
     // void
@@ -382,7 +382,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAllocationCallbacks &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkApplicationInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkApplicationInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -411,7 +411,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkApplicationInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "linearTilingFeatures";
     // linearTilingFeatures -> Field -> VkFormatFeatureFlags
@@ -426,7 +426,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "maxExtent";
     // maxExtent -> Field -> VkExtent3D
@@ -447,7 +447,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInstanceCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInstanceCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -483,7 +483,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkInstanceCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHeap &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryHeap &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "size";
     // size -> Field -> VkDeviceSize
@@ -495,7 +495,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHeap &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryType &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryType &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "propertyFlags";
     // propertyFlags -> Field -> VkMemoryPropertyFlags
@@ -507,7 +507,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryType &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "robustBufferAccess";
     // robustBufferAccess -> Field -> VkBool32
@@ -678,7 +678,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLimits &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLimits &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "maxImageDimension1D";
     // maxImageDimension1D -> Field -> uint32_t
@@ -1062,7 +1062,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLimits &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "memoryTypeCount";
     // memoryTypeCount -> Field -> uint32_t
@@ -1104,7 +1104,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryPropert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparseProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSparseProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "residencyStandard2DBlockShape";
     // residencyStandard2DBlockShape -> Field -> VkBool32
@@ -1125,7 +1125,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparsePropert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "apiVersion";
     // apiVersion -> Field -> uint32_t
@@ -1168,7 +1168,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "queueFlags";
     // queueFlags -> Field -> VkQueueFlags
@@ -1186,7 +1186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1224,7 +1224,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1278,7 +1278,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtensionProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExtensionProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "extensionName";
     // extensionName -> Field -> FixedArray(char)
@@ -1290,7 +1290,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExtensionProperties &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "layerName";
     // layerName -> Field -> FixedArray(char)
@@ -1308,7 +1308,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerProperties &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1391,7 +1391,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMappedMemoryRange &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMappedMemoryRange &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1414,7 +1414,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMappedMemoryRange &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1434,7 +1434,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryRequirements &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "size";
     // size -> Field -> VkDeviceSize
@@ -1449,7 +1449,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseMemoryBind &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseMemoryBind &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "resourceOffset";
     // resourceOffset -> Field -> VkDeviceSize
@@ -1470,7 +1470,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseMemoryBind &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseBufferMemoryBindInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseBufferMemoryBindInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -1497,7 +1497,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseBufferMemoryBindInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageOpaqueMemoryBindInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageOpaqueMemoryBindInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "image";
     // image -> Field -> VkImage
@@ -1524,7 +1524,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageOpaqueMemoryBind
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresource &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
@@ -1539,7 +1539,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBind &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryBind &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "subresource";
     // subresource -> Field -> VkImageSubresource
@@ -1563,7 +1563,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBind &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBindInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryBindInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "image";
     // image -> Field -> VkImage
@@ -1590,7 +1590,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryBindInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindSparseInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindSparseInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1694,7 +1694,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindSparseInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageFormatProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
@@ -1709,7 +1709,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequirements &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryRequirements &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "formatProperties";
     // formatProperties -> Field -> VkSparseImageFormatProperties
@@ -1730,7 +1730,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequiremen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1747,7 +1747,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1764,7 +1764,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkEventCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkEventCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1781,7 +1781,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkEventCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1807,7 +1807,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1851,7 +1851,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferViewCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferViewCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1880,7 +1880,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferViewCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -1945,7 +1945,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceLayout &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "offset";
     // offset -> Field -> VkDeviceSize
@@ -1966,7 +1966,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComponentMapping &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComponentMapping &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "r";
     // r -> Field -> VkComponentSwizzle
@@ -1984,7 +1984,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkComponentMapping &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2016,7 +2016,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2051,7 +2051,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleCreateInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCacheCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2084,7 +2084,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCacheCreateInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationMapEntry &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSpecializationMapEntry &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "constantID";
     // constantID -> Field -> uint32_t
@@ -2099,7 +2099,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationMapEntry &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSpecializationInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "mapEntryCount";
     // mapEntryCount -> Field -> uint32_t
@@ -2139,7 +2139,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSpecializationInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2172,7 +2172,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComputePipelineCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2201,7 +2201,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineCreateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescription &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDescription &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "binding";
     // binding -> Field -> uint32_t
@@ -2216,7 +2216,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescripti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescription &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputAttributeDescription &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "location";
     // location -> Field -> uint32_t
@@ -2234,7 +2234,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescrip
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineVertexInputStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2287,7 +2287,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputStateCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInputAssemblyStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineInputAssemblyStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2310,7 +2310,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInputAssemblyStateC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineTessellationStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2330,7 +2330,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationStateCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewport &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewport &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> float
@@ -2354,7 +2354,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewport &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2407,7 +2407,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportStateCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2454,7 +2454,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineMultisampleStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineMultisampleStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2501,7 +2501,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineMultisampleStateCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStencilOpState &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStencilOpState &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "failOp";
     // failOp -> Field -> VkStencilOp
@@ -2528,7 +2528,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkStencilOpState &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDepthStencilStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDepthStencilStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2572,7 +2572,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDepthStencilStateCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAttachmentState &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendAttachmentState &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "blendEnable";
     // blendEnable -> Field -> VkBool32
@@ -2602,7 +2602,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAttachmen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2656,7 +2656,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendStateCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDynamicStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDynamicStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2691,7 +2691,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDynamicStateCreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2804,7 +2804,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineCreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantRange &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushConstantRange &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "stageFlags";
     // stageFlags -> Field -> VkShaderStageFlags
@@ -2819,7 +2819,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantRange &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLayoutCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineLayoutCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2872,7 +2872,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLayoutCreateInfo &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2934,7 +2934,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyDescriptorSet &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyDescriptorSet &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -2969,7 +2969,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyDescriptorSet &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -2984,7 +2984,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorImageInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorImageInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sampler";
     // sampler -> Field -> VkSampler
@@ -2999,7 +2999,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorImageInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolSize &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolSize &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "type";
     // type -> Field -> VkDescriptorType
@@ -3011,7 +3011,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolSize &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3049,7 +3049,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolCreateInfo &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3084,7 +3084,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetAllocateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBinding &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutBinding &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "binding";
     // binding -> Field -> uint32_t
@@ -3117,7 +3117,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBinding
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3152,7 +3152,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescription &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "flags";
     // flags -> Field -> VkAttachmentDescriptionFlags
@@ -3185,7 +3185,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReference &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "attachment";
     // attachment -> Field -> uint32_t
@@ -3197,7 +3197,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3244,7 +3244,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescription &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "flags";
     // flags -> Field -> VkSubpassDescriptionFlags
@@ -3332,7 +3332,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDependency &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcSubpass";
     // srcSubpass -> Field -> uint32_t
@@ -3359,7 +3359,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3430,7 +3430,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandPoolCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandPoolCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3450,7 +3450,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandPoolCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3473,7 +3473,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferAllocateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3505,7 +3505,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3529,7 +3529,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferBeginInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCopy &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcOffset";
     // srcOffset -> Field -> VkDeviceSize
@@ -3544,7 +3544,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceLayers &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresourceLayers &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
@@ -3562,7 +3562,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresourceLayers &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferImageCopy &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "bufferOffset";
     // bufferOffset -> Field -> VkDeviceSize
@@ -3586,7 +3586,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearColorValue &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearColorValue &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "float32";
     // float32 -> Field -> FixedArray(float)
@@ -3631,7 +3631,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearColorValue &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearDepthStencilValue &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearDepthStencilValue &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "depth";
     // depth -> Field -> float
@@ -3643,7 +3643,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearDepthStencilValue &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearValue &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearValue &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "color";
     // color -> Field -> VkClearColorValue
@@ -3655,7 +3655,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearValue &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearAttachment &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearAttachment &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "aspectMask";
     // aspectMask -> Field -> VkImageAspectFlags
@@ -3670,7 +3670,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearAttachment &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearRect &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkClearRect &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "rect";
     // rect -> Field -> VkRect2D
@@ -3685,7 +3685,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkClearRect &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageBlit &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcSubresource";
     // srcSubresource -> Field -> VkImageSubresourceLayers
@@ -3723,7 +3723,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCopy &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcSubresource";
     // srcSubresource -> Field -> VkImageSubresourceLayers
@@ -3744,7 +3744,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageResolve &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcSubresource";
     // srcSubresource -> Field -> VkImageSubresourceLayers
@@ -3765,7 +3765,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3806,7 +3806,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassBeginInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3832,7 +3832,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupPrope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindBufferMemoryInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3855,7 +3855,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemoryInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3878,7 +3878,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice16BitStorageFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice16BitStorageFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3904,7 +3904,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice16BitStorageF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedRequirements &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryDedicatedRequirements &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3924,7 +3924,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedRequirements
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryDedicatedAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3944,7 +3944,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryDedicatedAllocateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateFlagsInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryAllocateFlagsInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3964,7 +3964,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryAllocateFlagsInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupRenderPassBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupRenderPassBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -3999,7 +3999,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupRenderPassBeginI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupCommandBufferBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupCommandBufferBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4016,7 +4016,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupCommandBufferBeg
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4084,7 +4084,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSubmitInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupBindSparseInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupBindSparseInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4104,7 +4104,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupBindSparseInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryDeviceGroupInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindBufferMemoryDeviceGroupInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4136,7 +4136,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindBufferMemoryDeviceGroup
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryDeviceGroupInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemoryDeviceGroupInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4186,7 +4186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemoryDeviceGroupI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGroupProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGroupProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4221,7 +4221,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGroupProperti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupDeviceCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupDeviceCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4253,7 +4253,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupDeviceCreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryRequirementsInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryRequirementsInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4270,7 +4270,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryRequirementsInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryRequirementsInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryRequirementsInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4287,7 +4287,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryRequirementsInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSparseMemoryRequirementsInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSparseMemoryRequirementsInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4304,7 +4304,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSparseMemoryRequiremen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryRequirements2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4321,7 +4321,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryRequirements2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequirements2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageMemoryRequirements2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4338,7 +4338,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageMemoryRequiremen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFeatures2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4355,7 +4355,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFeatures2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4372,7 +4372,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProperties2 &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4389,7 +4389,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4406,7 +4406,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatProperties2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageFormatInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageFormatInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4435,7 +4435,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageFormatIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4452,7 +4452,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyProperties2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4469,7 +4469,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryPropert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSparseImageFormatProperties2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4486,7 +4486,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSparseImageFormatProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparseImageFormatInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSparseImageFormatInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4515,7 +4515,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSparseImageFo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePointClippingProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePointClippingProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4532,7 +4532,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePointClipping
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInputAttachmentAspectReference &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInputAttachmentAspectReference &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "subpass";
     // subpass -> Field -> uint32_t
@@ -4547,7 +4547,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkInputAttachmentAspectRefere
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassInputAttachmentAspectCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassInputAttachmentAspectCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4579,7 +4579,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassInputAttachmentAs
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewUsageCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewUsageCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4596,7 +4596,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewUsageCreateInfo &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationDomainOriginStateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineTessellationDomainOriginStateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4613,7 +4613,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineTessellationDomainO
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassMultiviewCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassMultiviewCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4681,7 +4681,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassMultiviewCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4704,7 +4704,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewFeat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4724,7 +4724,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewProp
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVariablePointersFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVariablePointersFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4744,7 +4744,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVariablePoint
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemoryFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProtectedMemoryFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4761,7 +4761,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemoryProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProtectedMemoryProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4778,7 +4778,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProtectedMemo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4801,7 +4801,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkProtectedSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkProtectedSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4818,7 +4818,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkProtectedSubmitInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4856,7 +4856,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4873,7 +4873,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImagePlaneMemoryInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImagePlaneMemoryInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4890,7 +4890,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImagePlaneMemoryInfo &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePlaneMemoryRequirementsInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImagePlaneMemoryRequirementsInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4907,7 +4907,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePlaneMemoryRequirement
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerYcbcrConversionFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSamplerYcbcrConversionFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4924,7 +4924,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerYcbcrC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionImageFormatProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionImageFormatProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -4941,7 +4941,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionImage
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateEntry &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorUpdateTemplateEntry &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "dstBinding";
     // dstBinding -> Field -> uint32_t
@@ -4965,7 +4965,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateEnt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorUpdateTemplateCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5015,7 +5015,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorUpdateTemplateCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "externalMemoryFeatures";
     // externalMemoryFeatures -> Field -> VkExternalMemoryFeatureFlags
@@ -5030,7 +5030,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryProperties &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalImageFormatInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalImageFormatInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5047,7 +5047,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalImage
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalImageFormatProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5064,7 +5064,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatProperti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalBufferInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalBufferInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5087,7 +5087,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalBuffe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalBufferProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalBufferProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5104,7 +5104,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalBufferProperties &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIDProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceIDProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5163,7 +5163,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIDProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryImageCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5180,7 +5180,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryBufferCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryBufferCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5197,7 +5197,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryBufferCreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5214,7 +5214,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfo &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFenceInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFenceInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5231,7 +5231,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFence
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFenceProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFenceProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5254,7 +5254,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFenceProperties &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportFenceCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5271,7 +5271,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceCreateInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportSemaphoreCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5288,7 +5288,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreCreateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalSemaphoreInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalSemaphoreInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5305,7 +5305,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalSemap
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalSemaphoreProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalSemaphoreProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5328,7 +5328,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalSemaphoreProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance3Properties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance3Properties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5348,7 +5348,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance3P
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutSupport &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutSupport &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5365,7 +5365,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutSupport
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDrawParametersFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderDrawParametersFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5382,7 +5382,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDrawPar
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan11Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5432,7 +5432,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Featu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Properties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan11Properties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5521,7 +5521,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan11Prope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan12Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5676,7 +5676,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Featu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkConformanceVersion &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkConformanceVersion &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "major";
     // major -> Field -> uint8_t
@@ -5694,7 +5694,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkConformanceVersion &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Properties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan12Properties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5864,7 +5864,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan12Prope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatListCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatListCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5896,7 +5896,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatListCreateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescription2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5937,7 +5937,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescription2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReference2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -5960,7 +5960,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReference2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescription2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6059,7 +6059,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescription2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDependency2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6097,7 +6097,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDependency2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreateInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6186,7 +6186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreateInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6203,7 +6203,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassBeginInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassEndInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassEndInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6217,7 +6217,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassEndInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice8BitStorageFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice8BitStorageFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6240,7 +6240,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice8BitStorageFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDriverProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDriverProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6266,7 +6266,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDriverPropert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicInt64Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicInt64Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6286,7 +6286,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloat16Int8Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderFloat16Int8Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6306,7 +6306,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloat16
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFloatControlsProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFloatControlsProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6371,7 +6371,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFloatControls
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBindingFlagsCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutBindingFlagsCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6403,7 +6403,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutBindingF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorIndexingFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorIndexingFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6477,7 +6477,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorInd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorIndexingProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorIndexingProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6560,7 +6560,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorInd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescriptorCountAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetVariableDescriptorCountAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6592,7 +6592,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescri
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescriptorCountLayoutSupport &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetVariableDescriptorCountLayoutSupport &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6609,7 +6609,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetVariableDescri
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescriptionDepthStencilResolve &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassDescriptionDepthStencilResolve &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6636,7 +6636,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassDescriptionDepthSten
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthStencilResolveProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthStencilResolveProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6662,7 +6662,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthStencilR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceScalarBlockLayoutFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceScalarBlockLayoutFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6679,7 +6679,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceScalarBlockLa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageStencilUsageCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageStencilUsageCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6696,7 +6696,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageStencilUsageCreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerReductionModeCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerReductionModeCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6713,7 +6713,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerReductionModeCreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerFilterMinmaxProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSamplerFilterMinmaxProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6733,7 +6733,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSamplerFilter
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkanMemoryModelFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkanMemoryModelFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6756,7 +6756,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkanMemoryM
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImagelessFramebufferFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImagelessFramebufferFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6773,7 +6773,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImagelessFram
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentImageInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferAttachmentImageInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6820,7 +6820,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentImageI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentsCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferAttachmentsCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6852,7 +6852,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferAttachmentsCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassAttachmentBeginInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassAttachmentBeginInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6884,7 +6884,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassAttachmentBeginIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6901,7 +6901,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceUniformBuffer
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6918,7 +6918,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgrou
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6935,7 +6935,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSeparateDepth
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReferenceStencilLayout &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentReferenceStencilLayout &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6952,7 +6952,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentReferenceStencilL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescriptionStencilLayout &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentDescriptionStencilLayout &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6972,7 +6972,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentDescriptionStenci
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostQueryResetFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostQueryResetFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -6989,7 +6989,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostQueryRese
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemaphoreFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTimelineSemaphoreFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7006,7 +7006,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemap
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemaphoreProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTimelineSemaphoreProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7023,7 +7023,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTimelineSemap
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreTypeCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreTypeCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7043,7 +7043,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreTypeCreateInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTimelineSemaphoreSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTimelineSemaphoreSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7093,7 +7093,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTimelineSemaphoreSubmitInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreWaitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreWaitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7143,7 +7143,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreWaitInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSignalInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreSignalInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7163,7 +7163,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSignalInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceAddressFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBufferDeviceAddressFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7186,7 +7186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferDeviceAddressInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7203,7 +7203,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferOpaqueCaptureAddressCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferOpaqueCaptureAddressCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7220,7 +7220,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferOpaqueCaptureAddressC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryOpaqueCaptureAddressAllocateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryOpaqueCaptureAddressAllocateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7237,7 +7237,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryOpaqueCaptureAddressA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOpaqueCaptureAddressInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryOpaqueCaptureAddressInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7254,7 +7254,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOpaqueCaptureAd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan13Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7313,7 +7313,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Featu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Properties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVulkan13Properties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7462,7 +7462,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVulkan13Prope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedback &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreationFeedback &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "flags";
     // flags -> Field -> VkPipelineCreationFeedbackFlags
@@ -7474,7 +7474,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedback &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedbackCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreationFeedbackCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7513,7 +7513,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreationFeedbackCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTerminateInvocationFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTerminateInvocationFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7530,7 +7530,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTermina
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceToolProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceToolProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7559,7 +7559,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceToolPropertie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7576,7 +7576,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderDemoteT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrivateDataFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrivateDataFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7593,7 +7593,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrivateDataFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDevicePrivateDataCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDevicePrivateDataCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7610,7 +7610,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDevicePrivateDataCreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPrivateDataSlotCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPrivateDataSlotCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7627,7 +7627,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPrivateDataSlotCreateInfo &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineCreationCacheControlFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineCreationCacheControlFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7644,7 +7644,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryBarrier2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7670,7 +7670,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryBarrier2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferMemoryBarrier2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7711,7 +7711,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferMemoryBarrier2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageMemoryBarrier2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7755,7 +7755,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageMemoryBarrier2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDependencyInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDependencyInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7826,7 +7826,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDependencyInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7852,7 +7852,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreSubmitInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferSubmitInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferSubmitInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7872,7 +7872,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferSubmitInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubmitInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7943,7 +7943,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubmitInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSynchronization2Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSynchronization2Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7960,7 +7960,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSynchronizati
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7977,7 +7977,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceZeroInitializ
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageRobustnessFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageRobustnessFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -7994,7 +7994,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageRobustne
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCopy2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8017,7 +8017,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCopy2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyBufferInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8055,7 +8055,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCopy2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8084,7 +8084,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCopy2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8128,7 +8128,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferImageCopy2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8160,7 +8160,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferImageCopy2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferToImageInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyBufferToImageInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8201,7 +8201,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyBufferToImageInfo2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToBufferInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToBufferInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8242,7 +8242,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToBufferInfo2 &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageBlit2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8288,7 +8288,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageBlit2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlitImageInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8335,7 +8335,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageResolve2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8364,7 +8364,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageResolve2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkResolveImageInfo2 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkResolveImageInfo2 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8408,7 +8408,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkResolveImageInfo2 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeControlFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupSizeControlFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8428,7 +8428,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeControlProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubgroupSizeControlProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8454,7 +8454,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubgroupSizeC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8471,7 +8471,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageRequired
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniformBlockFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInlineUniformBlockFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8491,7 +8491,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniform
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniformBlockProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInlineUniformBlockProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8520,7 +8520,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInlineUniform
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetInlineUniformBlock &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetInlineUniformBlock &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8550,7 +8550,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetInlineUni
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolInlineUniformBlockCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorPoolInlineUniformBlockCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8567,7 +8567,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorPoolInlineUniform
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8584,7 +8584,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTextureCompre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAttachmentInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8622,7 +8622,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentInfo &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8680,7 +8680,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInfo &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRenderingCreateInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRenderingCreateInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8721,7 +8721,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRenderingCreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8738,7 +8738,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRender
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRenderingInfo &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceRenderingInfo &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8785,7 +8785,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerDotProductFeatures &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerDotProductFeatures &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8802,7 +8802,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderInteger
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerDotProductProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerDotProductProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8906,7 +8906,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderInteger
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAlignmentProperties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTexelBufferAlignmentProperties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8932,7 +8932,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAl
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties3 &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFormatProperties3 &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8955,7 +8955,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFormatProperties3 &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4Features &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance4Features &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8972,7 +8972,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4F
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4Properties &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance4Properties &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -8989,7 +8989,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance4P
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceBufferMemoryRequirements &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceBufferMemoryRequirements &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9010,7 +9010,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceBufferMemoryRequireme
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageMemoryRequirements &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceImageMemoryRequirements &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9034,7 +9034,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageMemoryRequiremen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "minImageCount";
     // minImageCount -> Field -> uint32_t
@@ -9070,7 +9070,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormatKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFormatKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "format";
     // format -> Field -> VkFormat
@@ -9082,7 +9082,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormatKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9156,7 +9156,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCreateInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9236,7 +9236,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSwapchainCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSwapchainCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9253,7 +9253,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSwapchainCreateInfoKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemorySwapchainInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindImageMemorySwapchainInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9273,7 +9273,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindImageMemorySwapchainInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireNextImageInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAcquireNextImageInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9302,7 +9302,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireNextImageInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupPresentCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9332,7 +9332,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentCapabilit
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupPresentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9367,7 +9367,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupPresentInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSwapchainCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceGroupSwapchainCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9384,7 +9384,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceGroupSwapchainCreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeParametersKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeParametersKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "visibleRegion";
     // visibleRegion -> Field -> VkExtent2D
@@ -9396,7 +9396,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeParametersKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9416,7 +9416,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeCreateInfoKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "displayMode";
     // displayMode -> Field -> VkDisplayModeKHR
@@ -9428,7 +9428,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModePropertiesKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "supportedAlpha";
     // supportedAlpha -> Field -> VkDisplayPlaneAlphaFlagsKHR
@@ -9461,7 +9461,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilitiesKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlanePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlanePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "currentDisplay";
     // currentDisplay -> Field -> VkDisplayKHR
@@ -9473,7 +9473,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlanePropertiesKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "display";
     // display -> Field -> VkDisplayKHR
@@ -9500,7 +9500,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPropertiesKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplaySurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplaySurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9538,7 +9538,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplaySurfaceCreateInfoKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPresentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPresentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9562,7 +9562,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPresentInfoKHR &t) {
 }
 
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXlibSurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXlibSurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9587,7 +9587,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkXlibSurfaceCreateInfoKHR &t
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 
 #ifdef VK_USE_PLATFORM_XCB_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXcbSurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXcbSurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9612,7 +9612,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkXcbSurfaceCreateInfoKHR &t)
 #endif  // VK_USE_PLATFORM_XCB_KHR
 
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWaylandSurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWaylandSurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9637,7 +9637,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWaylandSurfaceCreateInfoKHR
 #endif  // VK_USE_PLATFORM_WAYLAND_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidSurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidSurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9659,7 +9659,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidSurfaceCreateInfoKHR
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32SurfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32SurfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9683,7 +9683,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32SurfaceCreateInfoKHR &
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyQueryResultStatusPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyQueryResultStatusPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9700,7 +9700,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyQueryResultStatu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyVideoPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyVideoPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9717,7 +9717,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyVideoPropertiesK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9743,7 +9743,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileListInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoProfileListInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9775,7 +9775,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoProfileListInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9816,7 +9816,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCapabilitiesKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoFormatInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoFormatInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9833,7 +9833,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoFormatIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoFormatPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoFormatPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9865,7 +9865,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoFormatPropertiesKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoPictureResourceInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoPictureResourceInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9891,7 +9891,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoPictureResourceInfoKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoReferenceSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoReferenceSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9915,7 +9915,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoReferenceSlotInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionMemoryRequirementsKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionMemoryRequirementsKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9935,7 +9935,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionMemoryRequireme
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVideoSessionMemoryInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindVideoSessionMemoryInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -9961,7 +9961,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVideoSessionMemoryInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10010,7 +10010,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionCreateInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10033,7 +10033,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersUpdateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoSessionParametersUpdateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10050,7 +10050,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoSessionParametersUpdat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoBeginCodingInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoBeginCodingInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10091,7 +10091,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoBeginCodingInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEndCodingInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEndCodingInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10108,7 +10108,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEndCodingInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCodingControlInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoCodingControlInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10125,7 +10125,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoCodingControlInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10142,7 +10142,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeCapabilitiesKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeUsageInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeUsageInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10159,7 +10159,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeUsageInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10213,7 +10213,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264CapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264CapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10266,7 +10266,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264Capabilities
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QpKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264QpKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "qpI";
     // qpI -> Field -> int32_t
@@ -10281,7 +10281,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QpKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QualityLevelPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264QualityLevelPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10322,7 +10322,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264QualityLevel
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10342,7 +10342,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersAddInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersAddInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10378,7 +10378,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10405,7 +10405,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersGetInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersGetInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10431,7 +10431,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParametersFeedbackInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264SessionParametersFeedbackInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10451,7 +10451,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264NaluSliceInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264NaluSliceInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10471,7 +10471,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264NaluSliceInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264PictureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264PictureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10509,7 +10509,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264PictureInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264DpbSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264DpbSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10526,7 +10526,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264DpbSlotInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264ProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264ProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10543,7 +10543,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264ProfileInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264RateControlInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10572,7 +10572,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264FrameSizeKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264FrameSizeKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "frameISize";
     // frameISize -> Field -> uint32_t
@@ -10587,7 +10587,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264FrameSizeKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlLayerInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264RateControlLayerInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10619,7 +10619,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264RateControlL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264GopRemainingFrameInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH264GopRemainingFrameInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10645,7 +10645,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH264GopRemaining
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265CapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265CapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10707,7 +10707,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265Capabilities
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10727,7 +10727,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QpKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265QpKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "qpI";
     // qpI -> Field -> int32_t
@@ -10742,7 +10742,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QpKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QualityLevelPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265QualityLevelPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10780,7 +10780,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265QualityLevel
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersAddInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersAddInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10827,7 +10827,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10857,7 +10857,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersGetInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersGetInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10889,7 +10889,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParametersFeedbackInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265SessionParametersFeedbackInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10912,7 +10912,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265NaluSliceSegmentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265NaluSliceSegmentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10932,7 +10932,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265NaluSliceSeg
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265PictureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265PictureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10967,7 +10967,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265PictureInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265DpbSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265DpbSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -10984,7 +10984,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265DpbSlotInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265ProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265ProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11001,7 +11001,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265ProfileInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265RateControlInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11030,7 +11030,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265FrameSizeKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265FrameSizeKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "frameISize";
     // frameISize -> Field -> uint32_t
@@ -11045,7 +11045,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265FrameSizeKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlLayerInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265RateControlLayerInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11077,7 +11077,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265RateControlL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265GopRemainingFrameInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeH265GopRemainingFrameInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11103,7 +11103,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeH265GopRemaining
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264ProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264ProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11123,7 +11123,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264ProfileInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264CapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264CapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11143,7 +11143,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264Capabilities
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParametersAddInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264SessionParametersAddInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11179,7 +11179,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264SessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11206,7 +11206,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264PictureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264PictureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11241,7 +11241,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264PictureInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264DpbSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH264DpbSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11258,7 +11258,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH264DpbSlotInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentShadingRateAttachmentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingFragmentShadingRateAttachmentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11281,7 +11281,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentShadingRat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentDensityMapAttachmentInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingFragmentDensityMapAttachmentInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11301,7 +11301,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingFragmentDensityMap
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleCountInfoAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentSampleCountInfoAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11336,7 +11336,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleCountInfoAM
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewAttributesInfoNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiviewPerViewAttributesInfoNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11357,7 +11357,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewAttributesI
 }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11382,7 +11382,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfo
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11407,7 +11407,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfo
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryWin32HandlePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryWin32HandlePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11426,7 +11426,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryWin32HandleProperties
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11447,7 +11447,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetWin32HandleInfoKHR
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11467,7 +11467,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryFdInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryFdPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryFdPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11484,7 +11484,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryFdPropertiesKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11505,7 +11505,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetFdInfoKHR &t) {
 }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireReleaseInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32KeyedMutexAcquireReleaseInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11602,7 +11602,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireRelea
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11633,7 +11633,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreWin32HandleI
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportSemaphoreWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11658,7 +11658,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportSemaphoreWin32HandleI
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkD3D12FenceSubmitInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkD3D12FenceSubmitInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11710,7 +11710,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkD3D12FenceSubmitInfoKHR &t)
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11731,7 +11731,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetWin32HandleInfo
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11757,7 +11757,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreFdInfoKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11777,7 +11777,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetFdInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePushDescriptorPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePushDescriptorPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11794,7 +11794,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePushDescripto
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRectLayerKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRectLayerKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "offset";
     // offset -> Field -> VkOffset2D
@@ -11809,7 +11809,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRectLayerKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentRegionKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "rectangleCount";
     // rectangleCount -> Field -> uint32_t
@@ -11833,7 +11833,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionsKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentRegionsKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11865,7 +11865,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentRegionsKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSharedPresentSurfaceCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSharedPresentSurfaceCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11883,7 +11883,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSharedPresentSurfaceCapabil
 }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportFenceWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11914,7 +11914,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceWin32HandleInfoK
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportFenceWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11939,7 +11939,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportFenceWin32HandleInfoK
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetWin32HandleInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceGetWin32HandleInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11960,7 +11960,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetWin32HandleInfoKHR
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportFenceFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -11986,7 +11986,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportFenceFdInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetFdInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFenceGetFdInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12006,7 +12006,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFenceGetFdInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQueryFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerformanceQueryFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12026,7 +12026,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQueryPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerformanceQueryPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12043,7 +12043,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerformanceQu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12079,7 +12079,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterDescriptionKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterDescriptionKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12105,7 +12105,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterDescripti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolPerformanceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12140,7 +12140,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceCreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterResultKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceCounterResultKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "int32";
     // int32 -> Field -> int32_t
@@ -12164,7 +12164,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceCounterResultKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireProfilingLockInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAcquireProfilingLockInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12184,7 +12184,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAcquireProfilingLockInfoKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceQuerySubmitInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceQuerySubmitInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12201,7 +12201,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceQuerySubmitInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSurfaceInfo2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSurfaceInfo2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12218,7 +12218,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSurfaceInfo2K
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilities2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12235,7 +12235,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2KHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormat2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFormat2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12252,7 +12252,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFormat2KHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayProperties2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayProperties2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12269,7 +12269,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayProperties2KHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneProperties2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneProperties2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12286,7 +12286,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneProperties2KHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeProperties2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayModeProperties2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12303,7 +12303,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayModeProperties2KHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneInfo2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneInfo2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12323,7 +12323,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneInfo2KHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilities2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPlaneCapabilities2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12341,7 +12341,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPlaneCapabilities2KH
 }
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySubsetFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePortabilitySubsetFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12402,7 +12402,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySu
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySubsetPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePortabilitySubsetPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12420,7 +12420,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePortabilitySu
 }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderClockFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderClockFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12440,7 +12440,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderClockFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265ProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265ProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12457,7 +12457,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265ProfileInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265CapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265CapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12474,7 +12474,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265Capabilities
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParametersAddInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265SessionParametersAddInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12521,7 +12521,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265SessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12551,7 +12551,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265SessionParam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265PictureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265PictureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12586,7 +12586,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265PictureInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265DpbSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeH265DpbSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12603,7 +12603,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeH265DpbSlotInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueGlobalPriorityCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueGlobalPriorityCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12620,7 +12620,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueGlobalPriorityCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12637,7 +12637,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGlobalPriorit
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyGlobalPriorityPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyGlobalPriorityPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12669,7 +12669,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyGlobalPriorityPr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateAttachmentInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFragmentShadingRateAttachmentInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12693,7 +12693,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFragmentShadingRateAttachme
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRateStateCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineFragmentShadingRateStateCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12723,7 +12723,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12746,7 +12746,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12811,7 +12811,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12831,7 +12831,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingLocalReadFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12848,7 +12848,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRender
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentLocationInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAttachmentLocationInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12880,7 +12880,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAttachmentLocation
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInputAttachmentIndexInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingInputAttachmentIndexInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12926,7 +12926,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingInputAttachmentInd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderQuadControlFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderQuadControlFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12943,7 +12943,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderQuadCon
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceProtectedCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceProtectedCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12960,7 +12960,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceProtectedCapabilitie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentWaitFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentWaitFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12977,7 +12977,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentWaitFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -12994,7 +12994,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineExecu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13011,7 +13011,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutablePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutablePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13037,7 +13037,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutablePropertie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13057,7 +13057,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatisticValueKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableStatisticValueKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "b32";
     // b32 -> Field -> VkBool32
@@ -13075,7 +13075,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatistic
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatisticKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableStatisticKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13101,7 +13101,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableStatistic
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInternalRepresentationKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineExecutableInternalRepresentationKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13140,7 +13140,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineExecutableInternalR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryMapInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13166,7 +13166,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryUnmapInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryUnmapInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13186,7 +13186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryUnmapInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLibraryCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineLibraryCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13218,7 +13218,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineLibraryCreateInfoKH
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentIdKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentIdKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13250,7 +13250,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentIdKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentIdFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentIdFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13267,7 +13267,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentIdFeat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13324,7 +13324,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeCapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeCapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13359,7 +13359,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeCapabilitiesKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13376,7 +13376,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolVideoEncodeFeedbac
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeUsageInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeUsageInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13399,7 +13399,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeUsageInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlLayerInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeRateControlLayerInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13425,7 +13425,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlLayer
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeRateControlInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13469,7 +13469,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeRateControlInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13493,7 +13493,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoEncodeQu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeQualityLevelPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13513,7 +13513,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelProp
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeQualityLevelInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13530,7 +13530,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeQualityLevelInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParametersGetInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeSessionParametersGetInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13547,7 +13547,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParameter
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParametersFeedbackInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoEncodeSessionParametersFeedbackInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13564,7 +13564,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoEncodeSessionParameter
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointProperties2NV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyCheckpointProperties2NV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13581,7 +13581,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointProper
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointData2NV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCheckpointData2NV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13601,7 +13601,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointData2NV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13618,7 +13618,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShade
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13635,7 +13635,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShade
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13652,7 +13652,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgrou
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13678,7 +13678,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceWorkgroupMemo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13698,7 +13698,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMai
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommand2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTraceRaysIndirectCommand2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "raygenShaderRecordAddress";
     // raygenShaderRecordAddress -> Field -> VkDeviceAddress
@@ -13746,7 +13746,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommand2KH
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSubgroupRotateFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13766,7 +13766,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSubgrou
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13783,7 +13783,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderMaximal
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance5FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13800,7 +13800,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5F
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5PropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance5PropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13832,7 +13832,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance5P
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAreaInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderingAreaInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13873,7 +13873,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderingAreaInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageSubresource2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13890,7 +13890,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageSubresource2KHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageSubresourceInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceImageSubresourceInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13918,7 +13918,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceImageSubresourceInfoK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout2KHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceLayout2KHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13935,7 +13935,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceLayout2KHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreateFlags2CreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCreateFlags2CreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13952,7 +13952,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCreateFlags2CreateI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferUsageFlags2CreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferUsageFlags2CreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13969,7 +13969,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferUsageFlags2CreateInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -13986,7 +13986,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPos
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCooperativeMatrixPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14027,7 +14027,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14047,7 +14047,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14064,7 +14064,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1ProfileInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1ProfileInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14084,7 +14084,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1ProfileInfoKH
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1CapabilitiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1CapabilitiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14101,7 +14101,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1CapabilitiesK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1SessionParametersCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1SessionParametersCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14118,7 +14118,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1SessionParame
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1PictureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1PictureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14184,7 +14184,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1PictureInfoKH
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1DpbSlotInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoDecodeAV1DpbSlotInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14201,7 +14201,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoDecodeAV1DpbSlotInfoKH
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoMaintenance1FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVideoMaintenance1FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14218,7 +14218,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVideoMaintena
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoInlineQueryInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVideoInlineQueryInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14241,7 +14241,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVideoInlineQueryInfoKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14261,7 +14261,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttribu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDivisorDescriptionKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDivisorDescriptionKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "binding";
     // binding -> Field -> uint32_t
@@ -14273,7 +14273,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDivisorDe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputDivisorStateCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineVertexInputDivisorStateCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14305,7 +14305,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineVertexInputDivisorS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14325,7 +14325,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttribu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloatControls2FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderFloatControls2FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14342,7 +14342,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderFloatCo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIndexTypeUint8FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceIndexTypeUint8FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14359,7 +14359,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceIndexTypeUint
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasterizationFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLineRasterizationFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14391,7 +14391,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasteriza
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasterizationPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLineRasterizationPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14408,7 +14408,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLineRasteriza
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationLineStateCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationLineStateCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14434,7 +14434,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationLineSt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCalibratedTimestampInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCalibratedTimestampInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14451,7 +14451,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCalibratedTimestampInfoKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderExpectAssumeFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderExpectAssumeFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14468,7 +14468,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderExpectA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance6FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14485,7 +14485,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6F
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6PropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance6PropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14508,7 +14508,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance6P
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindMemoryStatusKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindMemoryStatusKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14529,7 +14529,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindMemoryStatusKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorSetsInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindDescriptorSetsInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14588,7 +14588,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorSetsInfoKHR &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantsInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushConstantsInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14627,7 +14627,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushConstantsInfoKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushDescriptorSetInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14668,7 +14668,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetInfoKHR &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetWithTemplateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPushDescriptorSetWithTemplateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14694,7 +14694,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPushDescriptorSetWithTempla
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetDescriptorBufferOffsetsInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetDescriptorBufferOffsetsInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14750,7 +14750,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetDescriptorBufferOffsetsI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14773,7 +14773,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindDescriptorBufferEmbedde
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14790,7 +14790,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderRelaxed
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7FeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance7FeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14807,7 +14807,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7F
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7PropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMaintenance7PropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14845,7 +14845,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMaintenance7P
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14871,7 +14871,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPropertiesListKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiPropertiesListKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14903,7 +14903,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiVulkanPropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredApiVulkanPropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14920,7 +14920,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredApiVul
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugReportCallbackCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugReportCallbackCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14947,7 +14947,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugReportCallbackCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateRasterizationOrderAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateRasterizationOrderAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14964,7 +14964,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectNameInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerObjectNameInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -14987,7 +14987,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectNameInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectTagInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerObjectTagInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15026,7 +15026,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerObjectTagInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerMarkerInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugMarkerMarkerInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15056,7 +15056,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugMarkerMarkerInfoEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationImageCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationImageCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15073,7 +15073,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationImageCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationBufferCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationBufferCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15090,7 +15090,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationBufferCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationMemoryAllocateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDedicatedAllocationMemoryAllocateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15110,7 +15110,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDedicatedAllocationMemoryAl
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeedbackFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTransformFeedbackFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15130,7 +15130,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeed
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeedbackPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTransformFeedbackPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15174,7 +15174,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTransformFeed
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateStreamCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationStateStreamCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15194,7 +15194,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationStateS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuModuleCreateInfoNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuModuleCreateInfoNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15224,7 +15224,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuModuleCreateInfoNVX &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuFunctionCreateInfoNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuFunctionCreateInfoNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15244,7 +15244,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuFunctionCreateInfoNVX &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuLaunchInfoNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCuLaunchInfoNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15314,7 +15314,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCuLaunchInfoNVX &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewHandleInfoNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewHandleInfoNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15337,7 +15337,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewHandleInfoNVX &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewAddressPropertiesNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewAddressPropertiesNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15357,7 +15357,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewAddressPropertiesN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTextureLODGatherFormatPropertiesAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTextureLODGatherFormatPropertiesAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15374,7 +15374,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTextureLODGatherFormatPrope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderResourceUsageAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderResourceUsageAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "numUsedVgprs";
     // numUsedVgprs -> Field -> uint32_t
@@ -15395,7 +15395,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderResourceUsageAMD &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderStatisticsInfoAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderStatisticsInfoAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "shaderStageMask";
     // shaderStageMask -> Field -> VkShaderStageFlags
@@ -15433,7 +15433,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderStatisticsInfoAMD &t)
 }
 
 #ifdef VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStreamDescriptorSurfaceCreateInfoGGP &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStreamDescriptorSurfaceCreateInfoGGP &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15454,7 +15454,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkStreamDescriptorSurfaceCrea
 }
 #endif  // VK_USE_PLATFORM_GGP
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCornerSampledImageFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCornerSampledImageFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15471,7 +15471,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCornerSampled
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalImageFormatPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "imageFormatProperties";
     // imageFormatProperties -> Field -> VkImageFormatProperties
@@ -15489,7 +15489,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalImageFormatProperti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryImageCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15506,7 +15506,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryImageCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryAllocateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15524,7 +15524,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryAllocateInfoNV
 }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryWin32HandleInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15546,7 +15546,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryWin32HandleInfo
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMemoryWin32HandleInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15568,7 +15568,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMemoryWin32HandleInfo
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireReleaseInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWin32KeyedMutexAcquireReleaseInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15664,7 +15664,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWin32KeyedMutexAcquireRelea
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFlagsEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFlagsEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15697,7 +15697,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFlagsEXT &t) {
 }
 
 #ifdef VK_USE_PLATFORM_VI_NN
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViSurfaceCreateInfoNN &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViSurfaceCreateInfoNN &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15718,7 +15718,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkViSurfaceCreateInfoNN &t) {
 }
 #endif  // VK_USE_PLATFORM_VI_NN
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewASTCDecodeModeEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewASTCDecodeModeEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15735,7 +15735,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewASTCDecodeModeEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceASTCDecodeFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceASTCDecodeFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15752,7 +15752,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceASTCDecodeFea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobustnessFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineRobustnessFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15769,7 +15769,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobus
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobustnessPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineRobustnessPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15795,7 +15795,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineRobus
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRobustnessCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRobustnessCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15821,7 +15821,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRobustnessCreateInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkConditionalRenderingBeginInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkConditionalRenderingBeginInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15844,7 +15844,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkConditionalRenderingBeginIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConditionalRenderingFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceConditionalRenderingFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15864,7 +15864,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConditionalRe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceConditionalRenderingInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceConditionalRenderingInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15881,7 +15881,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceCon
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportWScalingNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewportWScalingNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "xcoeff";
     // xcoeff -> Field -> float
@@ -15893,7 +15893,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportWScalingNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportWScalingStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportWScalingStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15928,7 +15928,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportWScalingSta
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2EXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilities2EXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15975,7 +15975,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilities2EXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPowerInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayPowerInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -15992,7 +15992,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayPowerInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceEventInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceEventInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16009,7 +16009,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceEventInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayEventInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayEventInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16026,7 +16026,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayEventInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCounterCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainCounterCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16043,7 +16043,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainCounterCreateInfoE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRefreshCycleDurationGOOGLE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRefreshCycleDurationGOOGLE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "refreshDuration";
     // refreshDuration -> Field -> uint64_t
@@ -16052,7 +16052,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRefreshCycleDurationGOOGLE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPastPresentationTimingGOOGLE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPastPresentationTimingGOOGLE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "presentID";
     // presentID -> Field -> uint32_t
@@ -16073,7 +16073,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPastPresentationTimingGOOGL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimeGOOGLE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentTimeGOOGLE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "presentID";
     // presentID -> Field -> uint32_t
@@ -16085,7 +16085,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimeGOOGLE &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimesInfoGOOGLE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentTimesInfoGOOGLE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16117,7 +16117,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentTimesInfoGOOGLE &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16134,7 +16134,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportSwizzleNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkViewportSwizzleNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> VkViewportCoordinateSwizzleNV
@@ -16152,7 +16152,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkViewportSwizzleNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportSwizzleStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportSwizzleStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16187,7 +16187,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportSwizzleStat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiscardRectanglePropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDiscardRectanglePropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16204,7 +16204,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiscardRectan
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDiscardRectangleStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineDiscardRectangleStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16242,7 +16242,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineDiscardRectangleSta
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16283,7 +16283,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceConservativeR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationConservativeStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationConservativeStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16306,7 +16306,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationConser
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipEnableFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClipEnableFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16323,7 +16323,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipEnab
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationDepthClipStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationDepthClipStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16343,7 +16343,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationDepthC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkXYColorEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkXYColorEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> float
@@ -16355,7 +16355,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkXYColorEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHdrMetadataEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHdrMetadataEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16393,7 +16393,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkHdrMetadataEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRelaxedLineRasterizationFeaturesIMG &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16411,7 +16411,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRelaxedLineRa
 }
 
 #ifdef VK_USE_PLATFORM_IOS_MVK
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIOSSurfaceCreateInfoMVK &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIOSSurfaceCreateInfoMVK &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16433,7 +16433,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkIOSSurfaceCreateInfoMVK &t)
 #endif  // VK_USE_PLATFORM_IOS_MVK
 
 #ifdef VK_USE_PLATFORM_MACOS_MVK
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMacOSSurfaceCreateInfoMVK &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMacOSSurfaceCreateInfoMVK &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16454,7 +16454,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMacOSSurfaceCreateInfoMVK &
 }
 #endif  // VK_USE_PLATFORM_MACOS_MVK
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsLabelEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsLabelEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16484,7 +16484,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsLabelEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectNameInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsObjectNameInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16507,7 +16507,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectNameInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCallbackDataEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsMessengerCallbackDataEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16587,7 +16587,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCallback
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsMessengerCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16620,7 +16620,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsMessengerCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectTagInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDebugUtilsObjectTagInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16660,7 +16660,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDebugUtilsObjectTagInfoEXT
 }
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferUsageANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferUsageANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16679,7 +16679,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferUsageA
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferPropertiesANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferPropertiesANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16701,7 +16701,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferProper
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatPropertiesANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatPropertiesANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16741,7 +16741,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormat
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportAndroidHardwareBufferInfoANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportAndroidHardwareBufferInfoANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16764,7 +16764,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportAndroidHardwareBuffer
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetAndroidHardwareBufferInfoANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetAndroidHardwareBufferInfoANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16783,7 +16783,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetAndroidHardwareBuf
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFormatANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16802,7 +16802,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatANDROID &t) {
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatProperties2ANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatProperties2ANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16842,7 +16842,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormat
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueueFeaturesAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEnqueueFeaturesAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16861,7 +16861,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueue
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueuePropertiesAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEnqueuePropertiesAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16892,7 +16892,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEnqueue
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineScratchSizeAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExecutionGraphPipelineScratchSizeAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16911,7 +16911,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineScrat
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineCreateInfoAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExecutionGraphPipelineCreateInfoAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -16964,7 +16964,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExecutionGraphPipelineCreat
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressConstAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "deviceAddress";
     // deviceAddress -> Field -> VkDeviceAddress
@@ -16978,7 +16978,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstAMD
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphInfoAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchGraphInfoAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "nodeIndex";
     // nodeIndex -> Field -> uint32_t
@@ -16998,7 +16998,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphInfoAMDX &t) {
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphCountInfoAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDispatchGraphCountInfoAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "count";
     // count -> Field -> uint32_t
@@ -17015,7 +17015,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDispatchGraphCountInfoAMDX
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageNodeCreateInfoAMDX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageNodeCreateInfoAMDX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17036,7 +17036,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageNodeCrea
 }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSampleLocationEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "x";
     // x -> Field -> float
@@ -17048,7 +17048,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationsInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSampleLocationsInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17086,7 +17086,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSampleLocationsInfoEXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleLocationsEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAttachmentSampleLocationsEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "attachmentIndex";
     // attachmentIndex -> Field -> uint32_t
@@ -17098,7 +17098,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAttachmentSampleLocationsEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassSampleLocationsEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassSampleLocationsEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "subpassIndex";
     // subpassIndex -> Field -> uint32_t
@@ -17110,7 +17110,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassSampleLocationsEXT &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSampleLocationsBeginInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSampleLocationsBeginInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17160,7 +17160,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSampleLocationsBe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineSampleLocationsStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineSampleLocationsStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17180,7 +17180,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineSampleLocationsStat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSampleLocationsPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSampleLocationsPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17219,7 +17219,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSampleLocatio
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisamplePropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultisamplePropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17236,7 +17236,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisamplePropertiesEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17253,7 +17253,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperatio
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17285,7 +17285,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBlendOperatio
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAdvancedStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorBlendAdvancedStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17308,7 +17308,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorBlendAdvancedS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageToColorStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageToColorStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17331,7 +17331,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageToColorStat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageModulationStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageModulationStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17372,7 +17372,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageModulationS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17392,7 +17392,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuilt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17409,7 +17409,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderSMBuilt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "drmFormatModifier";
     // drmFormatModifier -> Field -> uint64_t
@@ -17424,7 +17424,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesListEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesListEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17456,7 +17456,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17494,7 +17494,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageDrmForma
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierListCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierListCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17526,7 +17526,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierListC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierExplicitCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierExplicitCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17561,7 +17561,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierExpli
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageDrmFormatModifierPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17578,7 +17578,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageDrmFormatModifierPrope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties2EXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierProperties2EXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "drmFormatModifier";
     // drmFormatModifier -> Field -> uint64_t
@@ -17593,7 +17593,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierPropertiesList2EXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrmFormatModifierPropertiesList2EXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17625,7 +17625,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrmFormatModifierProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationCacheCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationCacheCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17658,7 +17658,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationCacheCreateInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleValidationCacheCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleValidationCacheCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17675,7 +17675,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleValidationCache
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShadingRatePaletteNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShadingRatePaletteNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "shadingRatePaletteEntryCount";
     // shadingRatePaletteEntryCount -> Field -> uint32_t
@@ -17699,7 +17699,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShadingRatePaletteNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportShadingRateImageStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportShadingRateImageStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17734,7 +17734,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportShadingRate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateImageFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShadingRateImageFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17754,7 +17754,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateIm
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateImagePropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShadingRateImagePropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17777,7 +17777,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShadingRateIm
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleLocationNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoarseSampleLocationNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "pixelX";
     // pixelX -> Field -> uint32_t
@@ -17792,7 +17792,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleLocationNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleOrderCustomNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCoarseSampleOrderCustomNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "shadingRate";
     // shadingRate -> Field -> VkShadingRatePaletteEntryNV
@@ -17822,7 +17822,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCoarseSampleOrderCustomNV &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17857,7 +17857,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportCoarseSampl
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingShaderGroupCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17886,7 +17886,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17951,7 +17951,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryTrianglesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryTrianglesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -17998,7 +17998,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryTrianglesNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryAABBNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryAABBNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18024,7 +18024,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryAABBNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryDataNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryDataNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "triangles";
     // triangles -> Field -> VkGeometryTrianglesNV
@@ -18036,7 +18036,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryDataNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeometryNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18059,7 +18059,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeometryNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18100,7 +18100,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInfoNV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18120,7 +18120,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindAccelerationStructureMemoryInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindAccelerationStructureMemoryInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18161,7 +18161,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindAccelerationStructureMe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerationStructureNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetAccelerationStructureNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18193,7 +18193,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMemoryRequirementsInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMemoryRequirementsInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18213,7 +18213,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMemory
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18251,7 +18251,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTransformMatrixKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTransformMatrixKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "matrix";
     // matrix -> Field -> FixedArray(FixedArray(float))
@@ -18274,7 +18274,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTransformMatrixKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAabbPositionsKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAabbPositionsKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "minX";
     // minX -> Field -> float
@@ -18298,7 +18298,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAabbPositionsKHR &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInstanceKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureInstanceKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "transform";
     // transform -> Field -> VkTransformMatrixKHR
@@ -18322,7 +18322,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureInstan
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18339,7 +18339,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRepresentativ
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18356,7 +18356,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRepresentativeFragm
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewImageFormatInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageViewImageFormatInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18373,7 +18373,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewImag
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFilterCubicImageViewImageFormatPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFilterCubicImageViewImageFormatPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18393,7 +18393,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFilterCubicImageViewImageFo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryHostPointerInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryHostPointerInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18413,7 +18413,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryHostPointerInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHostPointerPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryHostPointerPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18430,7 +18430,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryHostPointerProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18447,7 +18447,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemor
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCompilerControlCreateInfoAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCompilerControlCreateInfoAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18464,7 +18464,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCompilerControlCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePropertiesAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCorePropertiesAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18520,7 +18520,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOverallocationCreateInfoAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryOverallocationCreateInfoAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18537,7 +18537,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryOverallocationC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18555,7 +18555,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexAttribu
 }
 
 #ifdef VK_USE_PLATFORM_GGP
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentFrameTokenGGP &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPresentFrameTokenGGP &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18573,7 +18573,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPresentFrameTokenGGP &t) {
 }
 #endif  // VK_USE_PLATFORM_GGP
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18593,7 +18593,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceComputeShader
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18613,7 +18613,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18686,7 +18686,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawMeshTasksIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "taskCount";
     // taskCount -> Field -> uint32_t
@@ -18698,7 +18698,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectComman
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageFootprintFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderImageFootprintFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18715,7 +18715,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageFo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportExclusiveScissorStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportExclusiveScissorStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18747,7 +18747,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportExclusiveSc
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExclusiveScissorFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExclusiveScissorFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18764,7 +18764,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExclusiveScis
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueueFamilyCheckpointPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18781,7 +18781,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueueFamilyCheckpointProper
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointDataNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCheckpointDataNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18801,7 +18801,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCheckpointDataNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18818,7 +18818,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderInteger
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueDataINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceValueDataINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "value32";
     // value32 -> Field -> uint32_t
@@ -18839,7 +18839,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueDataINTEL &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceValueINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "type";
     // type -> Field -> VkPerformanceValueTypeINTEL
@@ -18851,7 +18851,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceValueINTEL &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkInitializePerformanceApiInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkInitializePerformanceApiInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18868,7 +18868,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkInitializePerformanceApiInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceQueryCreateInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryPoolPerformanceQueryCreateInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18885,7 +18885,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryPoolPerformanceQueryCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceMarkerInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceMarkerInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18902,7 +18902,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceMarkerInfoINTEL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceStreamMarkerInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceStreamMarkerInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18919,7 +18919,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceStreamMarkerInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceOverrideInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceOverrideInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18942,7 +18942,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceOverrideInfoINTE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceConfigurationAcquireInfoINTEL &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPerformanceConfigurationAcquireInfoINTEL &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18959,7 +18959,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPerformanceConfigurationAcq
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePCIBusInfoPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePCIBusInfoPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -18985,7 +18985,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePCIBusInfoPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayNativeHdrSurfaceCapabilitiesAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDisplayNativeHdrSurfaceCapabilitiesAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19002,7 +19002,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDisplayNativeHdrSurfaceCapa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainDisplayNativeHdrCreateInfoAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainDisplayNativeHdrCreateInfoAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19020,7 +19020,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainDisplayNativeHdrCr
 }
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePipeSurfaceCreateInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImagePipeSurfaceCreateInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19042,7 +19042,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImagePipeSurfaceCreateInfoF
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMetalSurfaceCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMetalSurfaceCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19063,7 +19063,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMetalSurfaceCreateInfoEXT &
 }
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19086,7 +19086,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19109,7 +19109,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassFragmentDensityMapCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassFragmentDensityMapCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19126,7 +19126,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassFragmentDensityMa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreProperties2AMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreProperties2AMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19146,7 +19146,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoherentMemoryFeaturesAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCoherentMemoryFeaturesAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19163,7 +19163,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoherentMemor
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19183,7 +19183,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderImageAt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryBudgetPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryBudgetPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19223,7 +19223,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryBudgetP
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryPriorityFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryPriorityFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19240,7 +19240,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryPriorit
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryPriorityAllocateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryPriorityAllocateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19257,7 +19257,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryPriorityAllocateInfoE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19274,7 +19274,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDedicatedAllo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19297,7 +19297,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBufferDeviceA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferDeviceAddressCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19314,7 +19314,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferDeviceAddressCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkValidationFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19364,7 +19364,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkValidationFeaturesEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCooperativeMatrixPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19402,7 +19402,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCooperativeMatrixProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19422,7 +19422,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCooperativeMatrixPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19439,7 +19439,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCooperativeMa
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoverageReductionModeFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCoverageReductionModeFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19456,7 +19456,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCoverageReduc
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageReductionStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineCoverageReductionStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19476,7 +19476,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineCoverageReductionSt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferMixedSamplesCombinationNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFramebufferMixedSamplesCombinationNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19502,7 +19502,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFramebufferMixedSamplesComb
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19525,7 +19525,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShade
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19542,7 +19542,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrImageArr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVertexFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProvokingVertexFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19562,7 +19562,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVertexPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceProvokingVertexPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19582,7 +19582,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceProvokingVert
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19600,7 +19600,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineRasterizationProvok
 }
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFullScreenExclusiveInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19619,7 +19619,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveI
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesFullScreenExclusiveEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesFullScreenExclusiveEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19638,7 +19638,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesFullScre
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveWin32InfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceFullScreenExclusiveWin32InfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19656,7 +19656,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceFullScreenExclusiveW
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHeadlessSurfaceCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHeadlessSurfaceCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19673,7 +19673,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkHeadlessSurfaceCreateInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19723,7 +19723,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19740,7 +19740,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopyFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostImageCopyFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19757,7 +19757,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopy
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopyPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceHostImageCopyPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19823,7 +19823,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceHostImageCopy
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryToImageCopyEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryToImageCopyEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19855,7 +19855,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryToImageCopyEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageToMemoryCopyEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageToMemoryCopyEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19887,7 +19887,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageToMemoryCopyEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToImageInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19928,7 +19928,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageInfoEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToMemoryInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToMemoryInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -19969,7 +19969,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToMemoryInfoEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToImageInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyImageToImageInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20016,7 +20016,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyImageToImageInfoEXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageLayoutTransitionInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHostImageLayoutTransitionInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20042,7 +20042,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageLayoutTransitionIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceHostMemcpySizeEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubresourceHostMemcpySizeEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20059,7 +20059,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubresourceHostMemcpySizeEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageCopyDevicePerformanceQueryEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkHostImageCopyDevicePerformanceQueryEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20079,7 +20079,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkHostImageCopyDevicePerforma
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlacedFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMapMemoryPlacedFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20102,7 +20102,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlac
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlacedPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMapMemoryPlacedPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20119,7 +20119,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMapMemoryPlac
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapPlacedInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryMapPlacedInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20136,7 +20136,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryMapPlacedInfoEXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20186,7 +20186,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentModeEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20203,7 +20203,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentScalingCapabilitiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentScalingCapabilitiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20232,7 +20232,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentScalingCapabi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeCompatibilityEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfacePresentModeCompatibilityEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20264,7 +20264,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfacePresentModeCompatibi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20281,7 +20281,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSwapchainMain
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentFenceInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentFenceInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20313,7 +20313,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentFenceInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModesCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentModesCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20345,7 +20345,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModesCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModeInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentModeInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20377,7 +20377,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentModeInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentScalingCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentScalingCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20400,7 +20400,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentScalingCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkReleaseSwapchainImagesInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkReleaseSwapchainImagesInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20435,7 +20435,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkReleaseSwapchainImagesInfoE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20476,7 +20476,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGenerat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20493,7 +20493,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGenerat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsShaderGroupCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsShaderGroupCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20539,7 +20539,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsShaderGroupCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineShaderGroupsCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineShaderGroupsCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20589,7 +20589,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineShaderGroup
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindShaderGroupIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindShaderGroupIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "groupIndex";
     // groupIndex -> Field -> uint32_t
@@ -20598,7 +20598,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindShaderGroupIndirectComm
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindIndexBufferIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindIndexBufferIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "bufferAddress";
     // bufferAddress -> Field -> VkDeviceAddress
@@ -20613,7 +20613,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindIndexBufferIndirectComm
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVertexBufferIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindVertexBufferIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "bufferAddress";
     // bufferAddress -> Field -> VkDeviceAddress
@@ -20628,7 +20628,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindVertexBufferIndirectCom
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetStateFlagsIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetStateFlagsIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "data";
     // data -> Field -> uint32_t
@@ -20637,7 +20637,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetStateFlagsIndirectComman
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsStreamNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsStreamNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "buffer";
     // buffer -> Field -> VkBuffer
@@ -20649,7 +20649,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsStreamNV &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutTokenNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsLayoutTokenNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20726,7 +20726,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutToken
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkIndirectCommandsLayoutCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20782,7 +20782,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkIndirectCommandsLayoutCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeneratedCommandsInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20847,7 +20847,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsInfoNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsMemoryRequirementsInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGeneratedCommandsMemoryRequirementsInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20873,7 +20873,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGeneratedCommandsMemoryRequ
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInheritedViewportScissorFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20890,7 +20890,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInheritedView
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceViewportScissorInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceViewportScissorInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20917,7 +20917,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceVie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20934,7 +20934,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTexelBufferAl
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassTransformBeginInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassTransformBeginInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20951,7 +20951,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassTransformBeginInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20971,7 +20971,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCommandBufferInheritanceRen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthBiasControlFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthBiasControlFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -20997,7 +20997,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthBiasCont
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDepthBiasInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21020,7 +21020,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasRepresentationInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDepthBiasRepresentationInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21040,7 +21040,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDepthBiasRepresentationInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21057,7 +21057,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceMemoryR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryReportCallbackDataEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceMemoryReportCallbackDataEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21092,7 +21092,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceMemoryReportCallbackD
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDeviceMemoryReportCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceDeviceMemoryReportCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21119,7 +21119,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDeviceMemoryReportCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRobustness2FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21142,7 +21142,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2Fe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2PropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRobustness2PropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21162,7 +21162,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRobustness2Pr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCustomBorderColorCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCustomBorderColorCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21182,7 +21182,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCustomBorderColorCre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderColorPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCustomBorderColorPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21199,7 +21199,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderColorFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCustomBorderColorFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21219,7 +21219,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCustomBorderC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentBarrierFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePresentBarrierFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21236,7 +21236,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePresentBarrie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesPresentBarrierNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSurfaceCapabilitiesPresentBarrierNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21253,7 +21253,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSurfaceCapabilitiesPresentB
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentBarrierCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainPresentBarrierCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21270,7 +21270,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainPresentBarrierCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21287,7 +21287,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDiagnosticsCo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDiagnosticsConfigCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceDiagnosticsConfigCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21304,7 +21304,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceDiagnosticsConfigCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaModuleCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaModuleCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21334,7 +21334,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaModuleCreateInfoNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaFunctionCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaFunctionCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21354,7 +21354,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaFunctionCreateInfoNV &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaLaunchInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCudaLaunchInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21424,7 +21424,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCudaLaunchInfoNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLaunchFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCudaKernelLaunchFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21441,7 +21441,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLau
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLaunchPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCudaKernelLaunchPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21461,7 +21461,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCudaKernelLau
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryLowLatencySupportNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkQueryLowLatencySupportNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21479,7 +21479,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkQueryLowLatencySupportNV &t
 }
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalObjectCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21498,7 +21498,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectCreateInfo
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectsInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalObjectsInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21514,7 +21514,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalObjectsInfoEXT &
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalDeviceInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalDeviceInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21533,7 +21533,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalDeviceInfoEXT &t
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalCommandQueueInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalCommandQueueInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21555,7 +21555,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalCommandQueueInfo
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalBufferInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalBufferInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21577,7 +21577,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalBufferInfoEXT &t
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalBufferInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalBufferInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21596,7 +21596,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalBufferInfoEXT &t
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalTextureInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalTextureInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21627,7 +21627,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalTextureInfoEXT &
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalTextureInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalTextureInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21649,7 +21649,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalTextureInfoEXT &
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalIOSurfaceInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalIOSurfaceInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21671,7 +21671,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalIOSurfaceInfoEXT
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalIOSurfaceInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalIOSurfaceInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21690,7 +21690,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalIOSurfaceInfoEXT
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalSharedEventInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExportMetalSharedEventInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21715,7 +21715,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExportMetalSharedEventInfoE
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalSharedEventInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMetalSharedEventInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21733,7 +21733,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMetalSharedEventInfoE
 }
 #endif  // VK_USE_PLATFORM_METAL_EXT
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21846,7 +21846,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBuf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21863,7 +21863,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBuf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBufferFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorBufferFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21889,7 +21889,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorBuf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorAddressInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorAddressInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21912,7 +21912,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorAddressInfoEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferBindingInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21932,7 +21932,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingInfo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -21949,7 +21949,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorBufferBindingPush
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorDataEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorDataEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "pSampler";
     // pointer
@@ -22021,7 +22021,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorDataEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorGetInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorGetInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22041,7 +22041,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorGetInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCaptureDescriptorDataInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCaptureDescriptorDataInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22058,7 +22058,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCaptureDescriptorData
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCaptureDescriptorDataInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCaptureDescriptorDataInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22075,7 +22075,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCaptureDescriptorDataI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCaptureDescriptorDataInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewCaptureDescriptorDataInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22092,7 +22092,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewCaptureDescriptorD
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCaptureDescriptorDataInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCaptureDescriptorDataInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22109,7 +22109,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCaptureDescriptorDat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpaqueCaptureDescriptorDataCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpaqueCaptureDescriptorDataCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22126,7 +22126,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpaqueCaptureDescriptorData
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCaptureDescriptorDataInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCaptureDescriptorDataInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22146,7 +22146,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCaptur
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22163,7 +22163,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipel
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22183,7 +22183,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceGraphicsPipel
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineLibraryCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGraphicsPipelineLibraryCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22200,7 +22200,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGraphicsPipelineLibraryCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22217,7 +22217,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderEarlyAn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22240,7 +22240,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22257,7 +22257,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentShadi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22290,7 +22290,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineFragmentShadingRate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressConstKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "deviceAddress";
     // deviceAddress -> Field -> VkDeviceAddress
@@ -22302,7 +22302,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressConstKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryMotionTrianglesDataNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryMotionTrianglesDataNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22319,7 +22319,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22339,7 +22339,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotion
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMatrixMotionInstanceNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMatrixMotionInstanceNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "transformT0";
     // transformT0 -> Field -> VkTransformMatrixKHR
@@ -22366,7 +22366,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMatrix
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSRTDataNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSRTDataNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sx";
     // sx -> Field -> float
@@ -22420,7 +22420,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSRTDataNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureSRTMotionInstanceNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureSRTMotionInstanceNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "transformT0";
     // transformT0 -> Field -> VkSRTDataNV
@@ -22447,7 +22447,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureSRTMot
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInstanceDataNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInstanceDataNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "staticInstance";
     // staticInstance -> Field -> VkAccelerationStructureInstanceKHR
@@ -22462,7 +22462,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotion
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotionInstanceNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureMotionInstanceNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "type";
     // type -> Field -> VkAccelerationStructureMotionInstanceTypeNV
@@ -22477,7 +22477,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureMotion
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22497,7 +22497,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingMot
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22514,7 +22514,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcr2Plane44
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22531,7 +22531,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22557,7 +22557,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyCommandTransformInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyCommandTransformInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22574,7 +22574,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyCommandTransformInfoQCO
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompressionControlFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageCompressionControlFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22591,7 +22591,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompress
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionControlEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCompressionControlEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22626,7 +22626,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionControlEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageCompressionPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22646,7 +22646,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageCompressionPropertiesE
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22663,7 +22663,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFee
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice4444FormatsFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevice4444FormatsFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22683,7 +22683,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevice4444FormatsFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFaultFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFaultFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22703,7 +22703,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFaultFeatures
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultCountsEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultCountsEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22726,7 +22726,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultCountsEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultAddressInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultAddressInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "addressType";
     // addressType -> Field -> VkDeviceFaultAddressTypeEXT
@@ -22741,7 +22741,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultAddressInfoEXT &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultVendorInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "description";
     // description -> Field -> FixedArray(char)
@@ -22756,7 +22756,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorInfoEXT &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22790,7 +22790,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorBinaryHeaderVersionOneEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceFaultVendorBinaryHeaderVersionOneEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "headerSize";
     // headerSize -> Field -> uint32_t
@@ -22839,7 +22839,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceFaultVendorBinaryHead
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22862,7 +22862,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRasterization
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22880,7 +22880,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRGBA10X6Forma
 }
 
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectFBSurfaceCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectFBSurfaceCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22912,7 +22912,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectFBSurfaceCreateInfoEX
 }
 #endif  // VK_USE_PLATFORM_DIRECTFB_EXT
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22929,7 +22929,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMutableDescri
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeListEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMutableDescriptorTypeListEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "descriptorTypeCount";
     // descriptorTypeCount -> Field -> uint32_t
@@ -22953,7 +22953,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeListEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMutableDescriptorTypeCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -22985,7 +22985,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMutableDescriptorTypeCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23002,7 +23002,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceVertexInputDy
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescription2EXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputBindingDescription2EXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23028,7 +23028,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputBindingDescripti
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescription2EXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkVertexInputAttributeDescription2EXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23054,7 +23054,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkVertexInputAttributeDescrip
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDrmPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDrmPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23086,7 +23086,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDrmProperties
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAddressBindingReportFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAddressBindingReportFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23103,7 +23103,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAddressBindin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceAddressBindingCallbackDataEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceAddressBindingCallbackDataEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23129,7 +23129,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceAddressBindingCallbac
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipControlFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClipControlFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23146,7 +23146,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClipCont
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportDepthClipControlCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineViewportDepthClipControlCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23163,7 +23163,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineViewportDepthClipCo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23184,7 +23184,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitiveTopo
 }
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryZirconHandleInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryZirconHandleInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23206,7 +23206,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryZirconHandleInf
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryZirconHandlePropertiesFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryZirconHandlePropertiesFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23225,7 +23225,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryZirconHandlePropertie
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetZirconHandleInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetZirconHandleInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23247,7 +23247,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetZirconHandleInfoFU
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreZirconHandleInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportSemaphoreZirconHandleInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23275,7 +23275,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportSemaphoreZirconHandle
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetZirconHandleInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSemaphoreGetZirconHandleInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23297,7 +23297,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSemaphoreGetZirconHandleInf
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionCreateInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionCreateInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23316,7 +23316,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionCreateInfoF
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryBufferCollectionFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportMemoryBufferCollectionFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23338,7 +23338,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportMemoryBufferCollectio
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionImageCreateInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionImageCreateInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23360,7 +23360,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionImageCreate
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionConstraintsInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionConstraintsInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23391,7 +23391,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionConstraints
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferConstraintsInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferConstraintsInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23416,7 +23416,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferConstraintsInfoFUCHSI
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionBufferCreateInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionBufferCreateInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23438,7 +23438,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionBufferCreat
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSysmemColorSpaceFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSysmemColorSpaceFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23457,7 +23457,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSysmemColorSpaceFUCHSIA &t)
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionPropertiesFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBufferCollectionPropertiesFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23506,7 +23506,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBufferCollectionPropertiesF
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatConstraintsInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageFormatConstraintsInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23552,7 +23552,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageFormatConstraintsInfoF
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
 #ifdef VK_USE_PLATFORM_FUCHSIA
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageConstraintsInfoFUCHSIA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageConstraintsInfoFUCHSIA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23591,7 +23591,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageConstraintsInfoFUCHSIA
 }
 #endif  // VK_USE_PLATFORM_FUCHSIA
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassShadingPipelineCreateInfoHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassShadingPipelineCreateInfoHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23611,7 +23611,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassShadingPipelineCreat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23628,7 +23628,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23645,7 +23645,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassShadin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23662,7 +23662,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceInvocationMas
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetRemoteAddressInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMemoryGetRemoteAddressInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23682,7 +23682,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMemoryGetRemoteAddressInfoN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23699,7 +23699,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemor
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelinePropertiesIdentifierEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelinePropertiesIdentifierEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23726,7 +23726,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelinePropertiesIdentifie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelinePropertiesFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelinePropertiesFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23743,7 +23743,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelinePrope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFrameBoundaryFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFrameBoundaryFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23760,7 +23760,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFrameBoundary
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkFrameBoundaryEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkFrameBoundaryEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23835,7 +23835,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkFrameBoundaryEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23852,7 +23852,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultisampledR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassResolvePerformanceQueryEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassResolvePerformanceQueryEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23869,7 +23869,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassResolvePerformanceQu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisampledRenderToSingleSampledInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultisampledRenderToSingleSampledInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23889,7 +23889,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultisampledRenderToSingleS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23913,7 +23913,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynam
 }
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenSurfaceCreateInfoQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenSurfaceCreateInfoQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23945,7 +23945,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenSurfaceCreateInfoQNX
 }
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceColorWriteEnableFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceColorWriteEnableFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23962,7 +23962,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceColorWriteEna
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorWriteCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineColorWriteCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -23994,7 +23994,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineColorWriteCreateInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24017,7 +24017,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePrimitivesGen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewMinLodFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageViewMinLodFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24034,7 +24034,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageViewMinL
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewMinLodCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewMinLodCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24051,7 +24051,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewMinLodCreateInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiDrawFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24068,7 +24068,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawFeat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiDrawPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24085,7 +24085,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiDrawProp
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiDrawInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "firstVertex";
     // firstVertex -> Field -> uint32_t
@@ -24097,7 +24097,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawIndexedInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiDrawIndexedInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "firstIndex";
     // firstIndex -> Field -> uint32_t
@@ -24112,7 +24112,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiDrawIndexedInfoEXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24132,7 +24132,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImage2DViewOf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileImageFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTileImageFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24155,7 +24155,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileIma
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileImagePropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderTileImagePropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24178,7 +24178,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderTileIma
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapUsageEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapUsageEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "count";
     // count -> Field -> uint32_t
@@ -24193,7 +24193,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapUsageEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceOrHostAddressKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "deviceAddress";
     // deviceAddress -> Field -> VkDeviceAddress
@@ -24205,7 +24205,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceOrHostAddressKHR &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapBuildInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24276,7 +24276,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24308,7 +24308,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapCreateInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicromapFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpacityMicromapFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24331,7 +24331,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicrom
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicromapPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpacityMicromapPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24351,7 +24351,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpacityMicrom
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapVersionInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapVersionInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24380,7 +24380,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapVersionInfoEXT &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapToMemoryInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMicromapToMemoryInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24403,7 +24403,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapToMemoryInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToMicromapInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToMicromapInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24426,7 +24426,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToMicromapInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMicromapInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24449,7 +24449,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMicromapInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildSizesInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapBuildSizesInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24472,7 +24472,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapBuildSizesInfoEXT &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTrianglesOpacityMicromapEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureTrianglesOpacityMicromapEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24534,7 +24534,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTriang
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapTriangleEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMicromapTriangleEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "dataOffset";
     // dataOffset -> Field -> uint32_t
@@ -24550,7 +24550,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMicromapTriangleEXT &t) {
 }
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementMicromapFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDisplacementMicromapFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24569,7 +24569,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementM
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementMicromapPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDisplacementMicromapPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24588,7 +24588,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDisplacementM
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTrianglesDisplacementMicromapNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureTrianglesDisplacementMicromapNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24675,7 +24675,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureTriang
 }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24695,7 +24695,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24741,7 +24741,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceClusterCullingShaderVrsFeaturesHUAWEI &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24758,7 +24758,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceClusterCullin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24778,7 +24778,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceBorderColorSw
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBorderColorComponentMappingCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerBorderColorComponentMappingCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24798,7 +24798,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBorderColorComponent
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24815,7 +24815,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePageableDevic
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePropertiesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCorePropertiesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24838,7 +24838,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCorePro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueShaderCoreControlCreateInfoARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDeviceQueueShaderCoreControlCreateInfoARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24855,7 +24855,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDeviceQueueShaderCoreContro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingControlsFeaturesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSchedulingControlsFeaturesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24872,7 +24872,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingCon
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingControlsPropertiesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSchedulingControlsPropertiesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24889,7 +24889,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSchedulingCon
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24906,7 +24906,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageSlicedVi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSlicedCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewSlicedCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24926,7 +24926,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSlicedCreateInfoEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24943,7 +24943,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorSet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetBindingReferenceVALVE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetBindingReferenceVALVE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24963,7 +24963,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetBindingReferen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutHostMappingInfoVALVE &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDescriptorSetLayoutHostMappingInfoVALVE &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -24983,7 +24983,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDescriptorSetLayoutHostMapp
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25000,7 +25000,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDepthClampZer
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25017,7 +25017,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNonSeamlessCu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStripedFeaturesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRenderPassStripedFeaturesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25034,7 +25034,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStripedPropertiesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRenderPassStripedPropertiesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25054,7 +25054,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRenderPassStr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeInfoARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeInfoARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25071,7 +25071,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeInfoARM &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeBeginInfoARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeBeginInfoARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25103,7 +25103,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeBeginInfoAR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeSubmitInfoARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassStripeSubmitInfoARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25135,7 +25135,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassStripeSubmitInfoA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25152,7 +25152,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25169,7 +25169,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceFragmentDensi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassFragmentDensityMapOffsetEndInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSubpassFragmentDensityMapOffsetEndInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25201,7 +25201,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSubpassFragmentDensityMapOf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcAddress";
     // srcAddress -> Field -> VkDeviceAddress
@@ -25216,7 +25216,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryIndirectCommandNV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToImageIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcAddress";
     // srcAddress -> Field -> VkDeviceAddress
@@ -25240,7 +25240,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToImageIndirectCo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25257,7 +25257,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryInd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25274,7 +25274,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCopyMemoryInd
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDecompressMemoryRegionNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDecompressMemoryRegionNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcAddress";
     // srcAddress -> Field -> VkDeviceAddress
@@ -25295,7 +25295,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDecompressMemoryRegionNV &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompressionFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryDecompressionFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25312,7 +25312,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompressionPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMemoryDecompressionPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25332,7 +25332,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMemoryDecompr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDeviceGeneratedCommandsComputeFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25355,7 +25355,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDeviceGenerat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineIndirectBufferInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkComputePipelineIndirectBufferInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25378,7 +25378,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkComputePipelineIndirectBuff
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineIndirectDeviceAddressInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineIndirectDeviceAddressInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25398,7 +25398,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineIndirectDeviceAddre
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindPipelineIndirectCommandNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBindPipelineIndirectCommandNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "pipelineAddress";
     // pipelineAddress -> Field -> VkDeviceAddress
@@ -25407,7 +25407,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBindPipelineIndirectCommand
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLinearColorAttachmentFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLinearColorAttachmentFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25424,7 +25424,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLinearColorAt
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25441,7 +25441,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageCompress
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSampleWeightCreateInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageViewSampleWeightCreateInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25464,7 +25464,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageViewSampleWeightCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessingFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessingFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25487,7 +25487,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessingPropertiesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessingPropertiesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25513,7 +25513,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommandBufferFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNestedCommandBufferFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25536,7 +25536,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommand
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommandBufferPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceNestedCommandBufferPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25553,7 +25553,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceNestedCommand
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryAcquireUnmodifiedEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalMemoryAcquireUnmodifiedEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25570,7 +25570,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalMemoryAcquireUnmodi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25677,7 +25677,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25694,7 +25694,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedDynam
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendEquationEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkColorBlendEquationEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "srcColorBlendFactor";
     // srcColorBlendFactor -> Field -> VkBlendFactor
@@ -25718,7 +25718,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendEquationEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendAdvancedEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkColorBlendAdvancedEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "advancedBlendOp";
     // advancedBlendOp -> Field -> VkBlendOp
@@ -25739,7 +25739,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkColorBlendAdvancedEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25756,7 +25756,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceSubpassMergeF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationControlEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationControlEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25773,7 +25773,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationControlEX
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationFeedbackInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "postMergeSubpassCount";
     // postMergeSubpassCount -> Field -> uint32_t
@@ -25782,7 +25782,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassCreationFeedbackCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25803,7 +25803,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassCreationFeedbackC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSubpassFeedbackInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "subpassMergeStatus";
     // subpassMergeStatus -> Field -> VkSubpassMergeStatusEXT
@@ -25818,7 +25818,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRenderPassSubpassFeedbackCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25839,7 +25839,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRenderPassSubpassFeedbackCr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingInfoLUNARG &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectDriverLoadingInfoLUNARG &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25863,7 +25863,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingInfoLUNA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingListLUNARG &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDirectDriverLoadingListLUNARG &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25898,7 +25898,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDirectDriverLoadingListLUNA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25915,7 +25915,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25942,7 +25942,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderModuleI
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageModuleIdentifierCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPipelineShaderStageModuleIdentifierCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -25974,7 +25974,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPipelineShaderStageModuleId
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleIdentifierEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderModuleIdentifierEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26006,7 +26006,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderModuleIdentifierEXT &
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpticalFlowFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26023,7 +26023,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowFe
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceOpticalFlowPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26070,7 +26070,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceOpticalFlowPr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowImageFormatInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26087,7 +26087,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatInfoN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowImageFormatPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26104,7 +26104,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowImageFormatPrope
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowSessionCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26145,7 +26145,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreateInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreatePrivateDataInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowSessionCreatePrivateDataInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26168,7 +26168,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowSessionCreatePri
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowExecuteInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOpticalFlowExecuteInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26203,7 +26203,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOpticalFlowExecuteInfoNV &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyDitheringFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyDitheringFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26220,7 +26220,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyDitheri
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26238,7 +26238,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineProte
 }
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFormatResolveFeaturesANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFormatResolveFeaturesANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26257,7 +26257,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalForma
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalFormatResolvePropertiesANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalFormatResolvePropertiesANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26282,7 +26282,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalForma
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormatResolvePropertiesANDROID &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAndroidHardwareBufferFormatResolvePropertiesANDROID &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26300,7 +26300,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAndroidHardwareBufferFormat
 }
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderObjectFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26317,7 +26317,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderObjectPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26347,7 +26347,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderObjectP
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkShaderCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26435,7 +26435,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkShaderCreateInfoEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTilePropertiesFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceTilePropertiesFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26452,7 +26452,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceTilePropertie
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTilePropertiesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTilePropertiesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26475,7 +26475,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTilePropertiesQCOM &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAmigoProfilingFeaturesSEC &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAmigoProfilingFeaturesSEC &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26492,7 +26492,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAmigoProfilin
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAmigoProfilingSubmitInfoSEC &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAmigoProfilingSubmitInfoSEC &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26512,7 +26512,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAmigoProfilingSubmitInfoSEC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26529,7 +26529,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26546,7 +26546,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInv
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26563,7 +26563,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingInv
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedSparseAddressSpaceFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26580,7 +26580,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSpars
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExtendedSparseAddressSpacePropertiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26603,7 +26603,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExtendedSpars
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26620,7 +26620,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26637,7 +26637,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLegacyVertexA
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerSettingEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "pLayerName";
     // pLayerName -> Field -> string
@@ -26668,7 +26668,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingEXT &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingsCreateInfoEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLayerSettingsCreateInfoEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26700,7 +26700,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLayerSettingsCreateInfoEXT
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26717,7 +26717,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBui
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26740,7 +26740,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderCoreBui
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26757,7 +26757,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePipelineLibra
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26774,7 +26774,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDynamicRender
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepModeInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySleepModeInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26797,7 +26797,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepModeInfoNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySleepInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26817,7 +26817,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySleepInfoNV &t) {
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetLatencyMarkerInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSetLatencyMarkerInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26837,7 +26837,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSetLatencyMarkerInfoNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencyTimingsFrameReportNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencyTimingsFrameReportNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26893,7 +26893,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencyTimingsFrameReportNV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkGetLatencyMarkerInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkGetLatencyMarkerInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26925,7 +26925,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkGetLatencyMarkerInfoNV &t)
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySubmissionPresentIdNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySubmissionPresentIdNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26942,7 +26942,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySubmissionPresentIdN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainLatencyCreateInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSwapchainLatencyCreateInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26959,7 +26959,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSwapchainLatencyCreateInfoN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkOutOfBandQueueTypeInfoNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkOutOfBandQueueTypeInfoNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -26976,7 +26976,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkOutOfBandQueueTypeInfoNV &t
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySurfaceCapabilitiesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkLatencySurfaceCapabilitiesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27008,7 +27008,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkLatencySurfaceCapabilitiesN
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27025,7 +27025,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMultiviewPerV
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27057,7 +27057,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkMultiviewPerViewRenderAreas
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerStageDescriptorSetFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDevicePerStageDescriptorSetFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27077,7 +27077,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDevicePerStageDescr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessing2FeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessing2FeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27094,7 +27094,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessing2PropertiesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageProcessing2PropertiesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27111,7 +27111,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageProcessi
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBlockMatchWindowCreateInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerBlockMatchWindowCreateInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27131,7 +27131,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerBlockMatchWindowCrea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicWeightsFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCubicWeightsFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27148,7 +27148,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicWeightsF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCubicWeightsCreateInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerCubicWeightsCreateInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27165,7 +27165,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerCubicWeightsCreateIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageCubicWeightsInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkBlitImageCubicWeightsInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27182,7 +27182,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkBlitImageCubicWeightsInfoQC
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceYcbcrDegammaFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27199,7 +27199,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceYcbcrDegammaF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkSamplerYcbcrConversionYcbcrDegammaCreateInfoQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27219,7 +27219,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkSamplerYcbcrConversionYcbcr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicClampFeaturesQCOM &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceCubicClampFeaturesQCOM &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27236,7 +27236,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceCubicClampFea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27254,7 +27254,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAttachmentFee
 }
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferPropertiesQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenBufferPropertiesQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27276,7 +27276,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferPropertiesQNX &
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferFormatPropertiesQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkScreenBufferFormatPropertiesQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27319,7 +27319,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkScreenBufferFormatPropertie
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportScreenBufferInfoQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImportScreenBufferInfoQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27342,7 +27342,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImportScreenBufferInfoQNX &
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkExternalFormatQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27361,7 +27361,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkExternalFormatQNX &t) {
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceExternalMemoryScreenBufferFeaturesQNX &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27379,7 +27379,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceExternalMemor
 }
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredDriverPropertiesMSFT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceLayeredDriverPropertiesMSFT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27396,7 +27396,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceLayeredDriver
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceDescriptorPoolOverallocationFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27413,7 +27413,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceDescriptorPoo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRawAccessChainsFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRawAccessChainsFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27430,7 +27430,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRawAccessChai
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderAtomicFloat16VectorFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27447,7 +27447,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderAtomicF
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27464,7 +27464,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceShaderReplica
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingValidationFeaturesNV &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingValidationFeaturesNV &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27481,7 +27481,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingVal
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmentControlFeaturesMESA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageAlignmentControlFeaturesMESA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27498,7 +27498,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmentControlPropertiesMESA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceImageAlignmentControlPropertiesMESA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27515,7 +27515,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceImageAlignmen
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageAlignmentControlCreateInfoMESA &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkImageAlignmentControlCreateInfoMESA &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27532,7 +27532,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkImageAlignmentControlCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildRangeInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildRangeInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "primitiveCount";
     // primitiveCount -> Field -> uint32_t
@@ -27550,7 +27550,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryTrianglesDataKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryTrianglesDataKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27585,7 +27585,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryAabbsDataKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryAabbsDataKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27605,7 +27605,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryInstancesDataKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryInstancesDataKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27625,7 +27625,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryDataKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryDataKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "triangles";
     // triangles -> Field -> VkAccelerationStructureGeometryTrianglesDataKHR
@@ -27640,7 +27640,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeometryKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureGeometryKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27663,7 +27663,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureGeomet
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildGeometryInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildGeometryInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27728,7 +27728,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildG
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27760,7 +27760,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerationStructureKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSetAccelerationStructureKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27792,7 +27792,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSetAccelerat
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationStructureFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAccelerationStructureFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27821,7 +27821,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationStructurePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceAccelerationStructurePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27859,7 +27859,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceAccelerationS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureDeviceAddressInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureDeviceAddressInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27876,7 +27876,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureDevice
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureVersionInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureVersionInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27905,7 +27905,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureVersio
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureToMemoryInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyAccelerationStructureToMemoryInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27928,7 +27928,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureTo
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToAccelerationStructureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyMemoryToAccelerationStructureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27951,7 +27951,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyMemoryToAccelerationStr
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkCopyAccelerationStructureInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27974,7 +27974,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkCopyAccelerationStructureIn
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildSizesInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkAccelerationStructureBuildSizesInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -27997,7 +27997,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkAccelerationStructureBuildS
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingShaderGroupCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28029,7 +28029,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingShaderGroupCreate
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineInterfaceCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineInterfaceCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28049,7 +28049,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineInterface
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInfoKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkRayTracingPipelineCreateInfoKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28135,7 +28135,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkRayTracingPipelineCreateInf
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPipelineFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPipelineFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28164,7 +28164,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPip
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPipelinePropertiesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayTracingPipelinePropertiesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28202,7 +28202,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayTracingPip
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkStridedDeviceAddressRegionKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkStridedDeviceAddressRegionKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "deviceAddress";
     // deviceAddress -> Field -> VkDeviceAddress
@@ -28217,7 +28217,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkStridedDeviceAddressRegionK
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommandKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkTraceRaysIndirectCommandKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "width";
     // width -> Field -> uint32_t
@@ -28232,7 +28232,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkTraceRaysIndirectCommandKHR
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayQueryFeaturesKHR &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceRayQueryFeaturesKHR &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28249,7 +28249,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceRayQueryFeatu
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFeaturesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderFeaturesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28278,7 +28278,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderFea
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPropertiesEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkPhysicalDeviceMeshShaderPropertiesEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType";
     // sType -> Field -> VkStructureType
@@ -28416,7 +28416,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkPhysicalDeviceMeshShaderPro
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectCommandEXT &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkDrawMeshTasksIndirectCommandEXT &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "groupCountX";
     // groupCountX -> Field -> uint32_t
@@ -28431,7 +28431,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkDrawMeshTasksIndirectComman
     return os;
 }
 
-YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
+crash_diagnostic_layer::DumpEmitter &operator<<(crash_diagnostic_layer::DumpEmitter &os, const VkWriteDescriptorSet &t) {
     os << YAML::BeginMap;
     os << YAML::Key << "sType" << YAML::Value << t.sType;
 
@@ -28488,7 +28488,7 @@ YAML::Emitter &operator<<(YAML::Emitter &os, const VkWriteDescriptorSet &t) {
 }
 
 //  Print out a VkStruct
-YAML::Emitter &PrintVkStruct(YAML::Emitter &os, const VkStruct *pStruct) {
+crash_diagnostic_layer::DumpEmitter &PrintVkStruct(crash_diagnostic_layer::DumpEmitter &os, const VkStruct *pStruct) {
     switch (pStruct->sType) {
         case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER:
             os << *reinterpret_cast<const VkBufferMemoryBarrier *>(pStruct);
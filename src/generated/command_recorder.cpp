@@ -2151,30 +2151,6 @@ BeginCommandBufferArgs* CommandRecorder::RecordBeginCommandBuffer(VkCommandBuffe
     return args;
 }
 
-EndCommandBufferArgs* CommandRecorder::RecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<EndCommandBufferArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
-ResetCommandBufferArgs* CommandRecorder::RecordResetCommandBuffer(VkCommandBuffer commandBuffer,
-                                                                  VkCommandBufferResetFlags flags) {
-    auto* args = Alloc<ResetCommandBufferArgs>();
-    args->commandBuffer = commandBuffer;
-    args->flags = flags;
-    return args;
-}
-
-CmdBindPipelineArgs* CommandRecorder::RecordCmdBindPipeline(VkCommandBuffer commandBuffer,
-                                                            VkPipelineBindPoint pipelineBindPoint,
-                                                            VkPipeline pipeline) {
-    auto* args = Alloc<CmdBindPipelineArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineBindPoint = pipelineBindPoint;
-    args->pipeline = pipeline;
-    return args;
-}
-
 CmdSetViewportArgs* CommandRecorder::RecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                           uint32_t viewportCount, const VkViewport* pViewports) {
     auto* args = Alloc<CmdSetViewportArgs>();
@@ -2199,24 +2175,6 @@ CmdSetScissorArgs* CommandRecorder::RecordCmdSetScissor(VkCommandBuffer commandB
     return args;
 }
 
-CmdSetLineWidthArgs* CommandRecorder::RecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
-    auto* args = Alloc<CmdSetLineWidthArgs>();
-    args->commandBuffer = commandBuffer;
-    args->lineWidth = lineWidth;
-    return args;
-}
-
-CmdSetDepthBiasArgs* CommandRecorder::RecordCmdSetDepthBias(VkCommandBuffer commandBuffer,
-                                                            float depthBiasConstantFactor, float depthBiasClamp,
-                                                            float depthBiasSlopeFactor) {
-    auto* args = Alloc<CmdSetDepthBiasArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthBiasConstantFactor = depthBiasConstantFactor;
-    args->depthBiasClamp = depthBiasClamp;
-    args->depthBiasSlopeFactor = depthBiasSlopeFactor;
-    return args;
-}
-
 CmdSetBlendConstantsArgs* CommandRecorder::RecordCmdSetBlendConstants(VkCommandBuffer commandBuffer,
                                                                       const float blendConstants[4]) {
     auto* args = Alloc<CmdSetBlendConstantsArgs>();
@@ -2227,45 +2185,6 @@ CmdSetBlendConstantsArgs* CommandRecorder::RecordCmdSetBlendConstants(VkCommandB
     return args;
 }
 
-CmdSetDepthBoundsArgs* CommandRecorder::RecordCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
-                                                                float maxDepthBounds) {
-    auto* args = Alloc<CmdSetDepthBoundsArgs>();
-    args->commandBuffer = commandBuffer;
-    args->minDepthBounds = minDepthBounds;
-    args->maxDepthBounds = maxDepthBounds;
-    return args;
-}
-
-CmdSetStencilCompareMaskArgs* CommandRecorder::RecordCmdSetStencilCompareMask(VkCommandBuffer commandBuffer,
-                                                                              VkStencilFaceFlags faceMask,
-                                                                              uint32_t compareMask) {
-    auto* args = Alloc<CmdSetStencilCompareMaskArgs>();
-    args->commandBuffer = commandBuffer;
-    args->faceMask = faceMask;
-    args->compareMask = compareMask;
-    return args;
-}
-
-CmdSetStencilWriteMaskArgs* CommandRecorder::RecordCmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
-                                                                          VkStencilFaceFlags faceMask,
-                                                                          uint32_t writeMask) {
-    auto* args = Alloc<CmdSetStencilWriteMaskArgs>();
-    args->commandBuffer = commandBuffer;
-    args->faceMask = faceMask;
-    args->writeMask = writeMask;
-    return args;
-}
-
-CmdSetStencilReferenceArgs* CommandRecorder::RecordCmdSetStencilReference(VkCommandBuffer commandBuffer,
-                                                                          VkStencilFaceFlags faceMask,
-                                                                          uint32_t reference) {
-    auto* args = Alloc<CmdSetStencilReferenceArgs>();
-    args->commandBuffer = commandBuffer;
-    args->faceMask = faceMask;
-    args->reference = reference;
-    return args;
-}
-
 CmdBindDescriptorSetsArgs* CommandRecorder::RecordCmdBindDescriptorSets(
     VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet,
     uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
@@ -2288,16 +2207,6 @@ CmdBindDescriptorSetsArgs* CommandRecorder::RecordCmdBindDescriptorSets(
     return args;
 }
 
-CmdBindIndexBufferArgs* CommandRecorder::RecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                                  VkDeviceSize offset, VkIndexType indexType) {
-    auto* args = Alloc<CmdBindIndexBufferArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->indexType = indexType;
-    return args;
-}
-
 CmdBindVertexBuffersArgs* CommandRecorder::RecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer,
                                                                       uint32_t firstBinding, uint32_t bindingCount,
                                                                       const VkBuffer* pBuffers,
@@ -2315,72 +2224,6 @@ CmdBindVertexBuffersArgs* CommandRecorder::RecordCmdBindVertexBuffers(VkCommandB
     return args;
 }
 
-CmdDrawArgs* CommandRecorder::RecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
-                                            uint32_t firstVertex, uint32_t firstInstance) {
-    auto* args = Alloc<CmdDrawArgs>();
-    args->commandBuffer = commandBuffer;
-    args->vertexCount = vertexCount;
-    args->instanceCount = instanceCount;
-    args->firstVertex = firstVertex;
-    args->firstInstance = firstInstance;
-    return args;
-}
-
-CmdDrawIndexedArgs* CommandRecorder::RecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount,
-                                                          uint32_t instanceCount, uint32_t firstIndex,
-                                                          int32_t vertexOffset, uint32_t firstInstance) {
-    auto* args = Alloc<CmdDrawIndexedArgs>();
-    args->commandBuffer = commandBuffer;
-    args->indexCount = indexCount;
-    args->instanceCount = instanceCount;
-    args->firstIndex = firstIndex;
-    args->vertexOffset = vertexOffset;
-    args->firstInstance = firstInstance;
-    return args;
-}
-
-CmdDrawIndirectArgs* CommandRecorder::RecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                            VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndirectArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->drawCount = drawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawIndexedIndirectArgs* CommandRecorder::RecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
-                                                                          VkBuffer buffer, VkDeviceSize offset,
-                                                                          uint32_t drawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndexedIndirectArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->drawCount = drawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDispatchArgs* CommandRecorder::RecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX,
-                                                    uint32_t groupCountY, uint32_t groupCountZ) {
-    auto* args = Alloc<CmdDispatchArgs>();
-    args->commandBuffer = commandBuffer;
-    args->groupCountX = groupCountX;
-    args->groupCountY = groupCountY;
-    args->groupCountZ = groupCountZ;
-    return args;
-}
-
-CmdDispatchIndirectArgs* CommandRecorder::RecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                                    VkDeviceSize offset) {
-    auto* args = Alloc<CmdDispatchIndirectArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    return args;
-}
-
 CmdCopyBufferArgs* CommandRecorder::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer,
                                                         VkBuffer dstBuffer, uint32_t regionCount,
                                                         const VkBufferCopy* pRegions) {
@@ -2475,17 +2318,6 @@ CmdUpdateBufferArgs* CommandRecorder::RecordCmdUpdateBuffer(VkCommandBuffer comm
     return args;
 }
 
-CmdFillBufferArgs* CommandRecorder::RecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer,
-                                                        VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
-    auto* args = Alloc<CmdFillBufferArgs>();
-    args->commandBuffer = commandBuffer;
-    args->dstBuffer = dstBuffer;
-    args->dstOffset = dstOffset;
-    args->size = size;
-    args->data = data;
-    return args;
-}
-
 CmdClearColorImageArgs* CommandRecorder::RecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image,
                                                                   VkImageLayout imageLayout,
                                                                   const VkClearColorValue* pColor, uint32_t rangeCount,
@@ -2555,24 +2387,6 @@ CmdResolveImageArgs* CommandRecorder::RecordCmdResolveImage(VkCommandBuffer comm
     return args;
 }
 
-CmdSetEventArgs* CommandRecorder::RecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event,
-                                                    VkPipelineStageFlags stageMask) {
-    auto* args = Alloc<CmdSetEventArgs>();
-    args->commandBuffer = commandBuffer;
-    args->event = event;
-    args->stageMask = stageMask;
-    return args;
-}
-
-CmdResetEventArgs* CommandRecorder::RecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event,
-                                                        VkPipelineStageFlags stageMask) {
-    auto* args = Alloc<CmdResetEventArgs>();
-    args->commandBuffer = commandBuffer;
-    args->event = event;
-    args->stageMask = stageMask;
-    return args;
-}
-
 CmdWaitEventsArgs* CommandRecorder::RecordCmdWaitEvents(
     VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask,
     VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
@@ -2632,63 +2446,6 @@ CmdPipelineBarrierArgs* CommandRecorder::RecordCmdPipelineBarrier(
     return args;
 }
 
-CmdBeginQueryArgs* CommandRecorder::RecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
-                                                        uint32_t query, VkQueryControlFlags flags) {
-    auto* args = Alloc<CmdBeginQueryArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->query = query;
-    args->flags = flags;
-    return args;
-}
-
-CmdEndQueryArgs* CommandRecorder::RecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
-                                                    uint32_t query) {
-    auto* args = Alloc<CmdEndQueryArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->query = query;
-    return args;
-}
-
-CmdResetQueryPoolArgs* CommandRecorder::RecordCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
-                                                                uint32_t firstQuery, uint32_t queryCount) {
-    auto* args = Alloc<CmdResetQueryPoolArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->firstQuery = firstQuery;
-    args->queryCount = queryCount;
-    return args;
-}
-
-CmdWriteTimestampArgs* CommandRecorder::RecordCmdWriteTimestamp(VkCommandBuffer commandBuffer,
-                                                                VkPipelineStageFlagBits pipelineStage,
-                                                                VkQueryPool queryPool, uint32_t query) {
-    auto* args = Alloc<CmdWriteTimestampArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineStage = pipelineStage;
-    args->queryPool = queryPool;
-    args->query = query;
-    return args;
-}
-
-CmdCopyQueryPoolResultsArgs* CommandRecorder::RecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer,
-                                                                            VkQueryPool queryPool, uint32_t firstQuery,
-                                                                            uint32_t queryCount, VkBuffer dstBuffer,
-                                                                            VkDeviceSize dstOffset, VkDeviceSize stride,
-                                                                            VkQueryResultFlags flags) {
-    auto* args = Alloc<CmdCopyQueryPoolResultsArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->firstQuery = firstQuery;
-    args->queryCount = queryCount;
-    args->dstBuffer = dstBuffer;
-    args->dstOffset = dstOffset;
-    args->stride = stride;
-    args->flags = flags;
-    return args;
-}
-
 CmdPushConstantsArgs* CommandRecorder::RecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
                                                               VkShaderStageFlags stageFlags, uint32_t offset,
                                                               uint32_t size, const void* pValues) {
@@ -2715,19 +2472,6 @@ CmdBeginRenderPassArgs* CommandRecorder::RecordCmdBeginRenderPass(VkCommandBuffe
     return args;
 }
 
-CmdNextSubpassArgs* CommandRecorder::RecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
-    auto* args = Alloc<CmdNextSubpassArgs>();
-    args->commandBuffer = commandBuffer;
-    args->contents = contents;
-    return args;
-}
-
-CmdEndRenderPassArgs* CommandRecorder::RecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdEndRenderPassArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
 CmdExecuteCommandsArgs* CommandRecorder::RecordCmdExecuteCommands(VkCommandBuffer commandBuffer,
                                                                   uint32_t commandBufferCount,
                                                                   const VkCommandBuffer* pCommandBuffers) {
@@ -2741,57 +2485,6 @@ CmdExecuteCommandsArgs* CommandRecorder::RecordCmdExecuteCommands(VkCommandBuffe
     return args;
 }
 
-CmdSetDeviceMaskArgs* CommandRecorder::RecordCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
-    auto* args = Alloc<CmdSetDeviceMaskArgs>();
-    args->commandBuffer = commandBuffer;
-    args->deviceMask = deviceMask;
-    return args;
-}
-
-CmdDispatchBaseArgs* CommandRecorder::RecordCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX,
-                                                            uint32_t baseGroupY, uint32_t baseGroupZ,
-                                                            uint32_t groupCountX, uint32_t groupCountY,
-                                                            uint32_t groupCountZ) {
-    auto* args = Alloc<CmdDispatchBaseArgs>();
-    args->commandBuffer = commandBuffer;
-    args->baseGroupX = baseGroupX;
-    args->baseGroupY = baseGroupY;
-    args->baseGroupZ = baseGroupZ;
-    args->groupCountX = groupCountX;
-    args->groupCountY = groupCountY;
-    args->groupCountZ = groupCountZ;
-    return args;
-}
-
-CmdDrawIndirectCountArgs* CommandRecorder::RecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                                      VkDeviceSize offset, VkBuffer countBuffer,
-                                                                      VkDeviceSize countBufferOffset,
-                                                                      uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndirectCountArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawIndexedIndirectCountArgs* CommandRecorder::RecordCmdDrawIndexedIndirectCount(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-    VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndexedIndirectCountArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
 CmdBeginRenderPass2Args* CommandRecorder::RecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer,
                                                                     const VkRenderPassBeginInfo* pRenderPassBegin,
                                                                     const VkSubpassBeginInfo* pSubpassBeginInfo) {
@@ -2841,15 +2534,6 @@ CmdSetEvent2Args* CommandRecorder::RecordCmdSetEvent2(VkCommandBuffer commandBuf
     return args;
 }
 
-CmdResetEvent2Args* CommandRecorder::RecordCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
-                                                          VkPipelineStageFlags2 stageMask) {
-    auto* args = Alloc<CmdResetEvent2Args>();
-    args->commandBuffer = commandBuffer;
-    args->event = event;
-    args->stageMask = stageMask;
-    return args;
-}
-
 CmdWaitEvents2Args* CommandRecorder::RecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount,
                                                           const VkEvent* pEvents,
                                                           const VkDependencyInfo* pDependencyInfos) {
@@ -2875,17 +2559,6 @@ CmdPipelineBarrier2Args* CommandRecorder::RecordCmdPipelineBarrier2(VkCommandBuf
     return args;
 }
 
-CmdWriteTimestamp2Args* CommandRecorder::RecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer,
-                                                                  VkPipelineStageFlags2 stage, VkQueryPool queryPool,
-                                                                  uint32_t query) {
-    auto* args = Alloc<CmdWriteTimestamp2Args>();
-    args->commandBuffer = commandBuffer;
-    args->stage = stage;
-    args->queryPool = queryPool;
-    args->query = query;
-    return args;
-}
-
 CmdCopyBuffer2Args* CommandRecorder::RecordCmdCopyBuffer2(VkCommandBuffer commandBuffer,
                                                           const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto* args = Alloc<CmdCopyBuffer2Args>();
@@ -2958,34 +2631,6 @@ CmdBeginRenderingArgs* CommandRecorder::RecordCmdBeginRendering(VkCommandBuffer
     return args;
 }
 
-CmdEndRenderingArgs* CommandRecorder::RecordCmdEndRendering(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdEndRenderingArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
-CmdSetCullModeArgs* CommandRecorder::RecordCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
-    auto* args = Alloc<CmdSetCullModeArgs>();
-    args->commandBuffer = commandBuffer;
-    args->cullMode = cullMode;
-    return args;
-}
-
-CmdSetFrontFaceArgs* CommandRecorder::RecordCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
-    auto* args = Alloc<CmdSetFrontFaceArgs>();
-    args->commandBuffer = commandBuffer;
-    args->frontFace = frontFace;
-    return args;
-}
-
-CmdSetPrimitiveTopologyArgs* CommandRecorder::RecordCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer,
-                                                                            VkPrimitiveTopology primitiveTopology) {
-    auto* args = Alloc<CmdSetPrimitiveTopologyArgs>();
-    args->commandBuffer = commandBuffer;
-    args->primitiveTopology = primitiveTopology;
-    return args;
-}
-
 CmdSetViewportWithCountArgs* CommandRecorder::RecordCmdSetViewportWithCount(VkCommandBuffer commandBuffer,
                                                                             uint32_t viewportCount,
                                                                             const VkViewport* pViewports) {
@@ -3032,83 +2677,6 @@ CmdBindVertexBuffers2Args* CommandRecorder::RecordCmdBindVertexBuffers2(
     return args;
 }
 
-CmdSetDepthTestEnableArgs* CommandRecorder::RecordCmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
-                                                                        VkBool32 depthTestEnable) {
-    auto* args = Alloc<CmdSetDepthTestEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthTestEnable = depthTestEnable;
-    return args;
-}
-
-CmdSetDepthWriteEnableArgs* CommandRecorder::RecordCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
-                                                                          VkBool32 depthWriteEnable) {
-    auto* args = Alloc<CmdSetDepthWriteEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthWriteEnable = depthWriteEnable;
-    return args;
-}
-
-CmdSetDepthCompareOpArgs* CommandRecorder::RecordCmdSetDepthCompareOp(VkCommandBuffer commandBuffer,
-                                                                      VkCompareOp depthCompareOp) {
-    auto* args = Alloc<CmdSetDepthCompareOpArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthCompareOp = depthCompareOp;
-    return args;
-}
-
-CmdSetDepthBoundsTestEnableArgs* CommandRecorder::RecordCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer,
-                                                                                    VkBool32 depthBoundsTestEnable) {
-    auto* args = Alloc<CmdSetDepthBoundsTestEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthBoundsTestEnable = depthBoundsTestEnable;
-    return args;
-}
-
-CmdSetStencilTestEnableArgs* CommandRecorder::RecordCmdSetStencilTestEnable(VkCommandBuffer commandBuffer,
-                                                                            VkBool32 stencilTestEnable) {
-    auto* args = Alloc<CmdSetStencilTestEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->stencilTestEnable = stencilTestEnable;
-    return args;
-}
-
-CmdSetStencilOpArgs* CommandRecorder::RecordCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
-                                                            VkStencilOp failOp, VkStencilOp passOp,
-                                                            VkStencilOp depthFailOp, VkCompareOp compareOp) {
-    auto* args = Alloc<CmdSetStencilOpArgs>();
-    args->commandBuffer = commandBuffer;
-    args->faceMask = faceMask;
-    args->failOp = failOp;
-    args->passOp = passOp;
-    args->depthFailOp = depthFailOp;
-    args->compareOp = compareOp;
-    return args;
-}
-
-CmdSetRasterizerDiscardEnableArgs* CommandRecorder::RecordCmdSetRasterizerDiscardEnable(
-    VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
-    auto* args = Alloc<CmdSetRasterizerDiscardEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->rasterizerDiscardEnable = rasterizerDiscardEnable;
-    return args;
-}
-
-CmdSetDepthBiasEnableArgs* CommandRecorder::RecordCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
-                                                                        VkBool32 depthBiasEnable) {
-    auto* args = Alloc<CmdSetDepthBiasEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthBiasEnable = depthBiasEnable;
-    return args;
-}
-
-CmdSetPrimitiveRestartEnableArgs* CommandRecorder::RecordCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer,
-                                                                                      VkBool32 primitiveRestartEnable) {
-    auto* args = Alloc<CmdSetPrimitiveRestartEnableArgs>();
-    args->commandBuffer = commandBuffer;
-    args->primitiveRestartEnable = primitiveRestartEnable;
-    return args;
-}
-
 CmdBeginVideoCodingKHRArgs* CommandRecorder::RecordCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
                                                                           const VkVideoBeginCodingInfoKHR* pBeginInfo) {
     auto* args = Alloc<CmdBeginVideoCodingKHRArgs>();
@@ -3159,35 +2727,6 @@ CmdBeginRenderingKHRArgs* CommandRecorder::RecordCmdBeginRenderingKHR(VkCommandB
     return args;
 }
 
-CmdEndRenderingKHRArgs* CommandRecorder::RecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdEndRenderingKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
-CmdSetDeviceMaskKHRArgs* CommandRecorder::RecordCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer,
-                                                                    uint32_t deviceMask) {
-    auto* args = Alloc<CmdSetDeviceMaskKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->deviceMask = deviceMask;
-    return args;
-}
-
-CmdDispatchBaseKHRArgs* CommandRecorder::RecordCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX,
-                                                                  uint32_t baseGroupY, uint32_t baseGroupZ,
-                                                                  uint32_t groupCountX, uint32_t groupCountY,
-                                                                  uint32_t groupCountZ) {
-    auto* args = Alloc<CmdDispatchBaseKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->baseGroupX = baseGroupX;
-    args->baseGroupY = baseGroupY;
-    args->baseGroupZ = baseGroupZ;
-    args->groupCountX = groupCountX;
-    args->groupCountY = groupCountY;
-    args->groupCountZ = groupCountZ;
-    return args;
-}
-
 CmdPushDescriptorSetKHRArgs* CommandRecorder::RecordCmdPushDescriptorSetKHR(
     VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set,
     uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) {
@@ -3254,36 +2793,6 @@ CmdEndRenderPass2KHRArgs* CommandRecorder::RecordCmdEndRenderPass2KHR(VkCommandB
     return args;
 }
 
-CmdDrawIndirectCountKHRArgs* CommandRecorder::RecordCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer,
-                                                                            VkBuffer buffer, VkDeviceSize offset,
-                                                                            VkBuffer countBuffer,
-                                                                            VkDeviceSize countBufferOffset,
-                                                                            uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndirectCountKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawIndexedIndirectCountKHRArgs* CommandRecorder::RecordCmdDrawIndexedIndirectCountKHR(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-    VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndexedIndirectCountKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
 CmdSetFragmentShadingRateKHRArgs* CommandRecorder::RecordCmdSetFragmentShadingRateKHR(
     VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize,
     const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
@@ -3340,15 +2849,6 @@ CmdSetEvent2KHRArgs* CommandRecorder::RecordCmdSetEvent2KHR(VkCommandBuffer comm
     return args;
 }
 
-CmdResetEvent2KHRArgs* CommandRecorder::RecordCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
-                                                                VkPipelineStageFlags2 stageMask) {
-    auto* args = Alloc<CmdResetEvent2KHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->event = event;
-    args->stageMask = stageMask;
-    return args;
-}
-
 CmdWaitEvents2KHRArgs* CommandRecorder::RecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount,
                                                                 const VkEvent* pEvents,
                                                                 const VkDependencyInfo* pDependencyInfos) {
@@ -3374,30 +2874,6 @@ CmdPipelineBarrier2KHRArgs* CommandRecorder::RecordCmdPipelineBarrier2KHR(VkComm
     return args;
 }
 
-CmdWriteTimestamp2KHRArgs* CommandRecorder::RecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
-                                                                        VkPipelineStageFlags2 stage,
-                                                                        VkQueryPool queryPool, uint32_t query) {
-    auto* args = Alloc<CmdWriteTimestamp2KHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->stage = stage;
-    args->queryPool = queryPool;
-    args->query = query;
-    return args;
-}
-
-CmdWriteBufferMarker2AMDArgs* CommandRecorder::RecordCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer,
-                                                                              VkPipelineStageFlags2 stage,
-                                                                              VkBuffer dstBuffer,
-                                                                              VkDeviceSize dstOffset, uint32_t marker) {
-    auto* args = Alloc<CmdWriteBufferMarker2AMDArgs>();
-    args->commandBuffer = commandBuffer;
-    args->stage = stage;
-    args->dstBuffer = dstBuffer;
-    args->dstOffset = dstOffset;
-    args->marker = marker;
-    return args;
-}
-
 CmdCopyBuffer2KHRArgs* CommandRecorder::RecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer,
                                                                 const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto* args = Alloc<CmdCopyBuffer2KHRArgs>();
@@ -3460,36 +2936,6 @@ CmdResolveImage2KHRArgs* CommandRecorder::RecordCmdResolveImage2KHR(VkCommandBuf
     return args;
 }
 
-CmdTraceRaysIndirect2KHRArgs* CommandRecorder::RecordCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer,
-                                                                              VkDeviceAddress indirectDeviceAddress) {
-    auto* args = Alloc<CmdTraceRaysIndirect2KHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->indirectDeviceAddress = indirectDeviceAddress;
-    return args;
-}
-
-CmdBindIndexBuffer2KHRArgs* CommandRecorder::RecordCmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
-                                                                          VkBuffer buffer, VkDeviceSize offset,
-                                                                          VkDeviceSize size, VkIndexType indexType) {
-    auto* args = Alloc<CmdBindIndexBuffer2KHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->size = size;
-    args->indexType = indexType;
-    return args;
-}
-
-CmdSetLineStippleKHRArgs* CommandRecorder::RecordCmdSetLineStippleKHR(VkCommandBuffer commandBuffer,
-                                                                      uint32_t lineStippleFactor,
-                                                                      uint16_t lineStipplePattern) {
-    auto* args = Alloc<CmdSetLineStippleKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->lineStippleFactor = lineStippleFactor;
-    args->lineStipplePattern = lineStipplePattern;
-    return args;
-}
-
 CmdBindDescriptorSets2KHRArgs* CommandRecorder::RecordCmdBindDescriptorSets2KHR(
     VkCommandBuffer commandBuffer, const VkBindDescriptorSetsInfoKHR* pBindDescriptorSetsInfo) {
     auto* args = Alloc<CmdBindDescriptorSets2KHRArgs>();
@@ -3566,12 +3012,6 @@ CmdDebugMarkerBeginEXTArgs* CommandRecorder::RecordCmdDebugMarkerBeginEXT(
     return args;
 }
 
-CmdDebugMarkerEndEXTArgs* CommandRecorder::RecordCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdDebugMarkerEndEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
 CmdDebugMarkerInsertEXTArgs* CommandRecorder::RecordCmdDebugMarkerInsertEXT(
     VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
     auto* args = Alloc<CmdDebugMarkerInsertEXTArgs>();
@@ -3637,43 +3077,6 @@ CmdEndTransformFeedbackEXTArgs* CommandRecorder::RecordCmdEndTransformFeedbackEX
     return args;
 }
 
-CmdBeginQueryIndexedEXTArgs* CommandRecorder::RecordCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer,
-                                                                            VkQueryPool queryPool, uint32_t query,
-                                                                            VkQueryControlFlags flags, uint32_t index) {
-    auto* args = Alloc<CmdBeginQueryIndexedEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->query = query;
-    args->flags = flags;
-    args->index = index;
-    return args;
-}
-
-CmdEndQueryIndexedEXTArgs* CommandRecorder::RecordCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer,
-                                                                        VkQueryPool queryPool, uint32_t query,
-                                                                        uint32_t index) {
-    auto* args = Alloc<CmdEndQueryIndexedEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->queryPool = queryPool;
-    args->query = query;
-    args->index = index;
-    return args;
-}
-
-CmdDrawIndirectByteCountEXTArgs* CommandRecorder::RecordCmdDrawIndirectByteCountEXT(
-    VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer,
-    VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) {
-    auto* args = Alloc<CmdDrawIndirectByteCountEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->instanceCount = instanceCount;
-    args->firstInstance = firstInstance;
-    args->counterBuffer = counterBuffer;
-    args->counterBufferOffset = counterBufferOffset;
-    args->counterOffset = counterOffset;
-    args->vertexStride = vertexStride;
-    return args;
-}
-
 CmdCuLaunchKernelNVXArgs* CommandRecorder::RecordCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer,
                                                                       const VkCuLaunchInfoNVX* pLaunchInfo) {
     auto* args = Alloc<CmdCuLaunchKernelNVXArgs>();
@@ -3684,36 +3087,6 @@ CmdCuLaunchKernelNVXArgs* CommandRecorder::RecordCmdCuLaunchKernelNVX(VkCommandB
     return args;
 }
 
-CmdDrawIndirectCountAMDArgs* CommandRecorder::RecordCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer,
-                                                                            VkBuffer buffer, VkDeviceSize offset,
-                                                                            VkBuffer countBuffer,
-                                                                            VkDeviceSize countBufferOffset,
-                                                                            uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndirectCountAMDArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawIndexedIndirectCountAMDArgs* CommandRecorder::RecordCmdDrawIndexedIndirectCountAMD(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-    VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawIndexedIndirectCountAMDArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
 CmdBeginConditionalRenderingEXTArgs* CommandRecorder::RecordCmdBeginConditionalRenderingEXT(
     VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) {
     auto* args = Alloc<CmdBeginConditionalRenderingEXTArgs>();
@@ -3725,12 +3098,6 @@ CmdBeginConditionalRenderingEXTArgs* CommandRecorder::RecordCmdBeginConditionalR
     return args;
 }
 
-CmdEndConditionalRenderingEXTArgs* CommandRecorder::RecordCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdEndConditionalRenderingEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
 CmdSetViewportWScalingNVArgs* CommandRecorder::RecordCmdSetViewportWScalingNV(
     VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
     const VkViewportWScalingNV* pViewportWScalings) {
@@ -3760,22 +3127,6 @@ CmdSetDiscardRectangleEXTArgs* CommandRecorder::RecordCmdSetDiscardRectangleEXT(
     return args;
 }
 
-CmdSetDiscardRectangleEnableEXTArgs* CommandRecorder::RecordCmdSetDiscardRectangleEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 discardRectangleEnable) {
-    auto* args = Alloc<CmdSetDiscardRectangleEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->discardRectangleEnable = discardRectangleEnable;
-    return args;
-}
-
-CmdSetDiscardRectangleModeEXTArgs* CommandRecorder::RecordCmdSetDiscardRectangleModeEXT(
-    VkCommandBuffer commandBuffer, VkDiscardRectangleModeEXT discardRectangleMode) {
-    auto* args = Alloc<CmdSetDiscardRectangleModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->discardRectangleMode = discardRectangleMode;
-    return args;
-}
-
 CmdBeginDebugUtilsLabelEXTArgs* CommandRecorder::RecordCmdBeginDebugUtilsLabelEXT(
     VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto* args = Alloc<CmdBeginDebugUtilsLabelEXTArgs>();
@@ -3786,12 +3137,6 @@ CmdBeginDebugUtilsLabelEXTArgs* CommandRecorder::RecordCmdBeginDebugUtilsLabelEX
     return args;
 }
 
-CmdEndDebugUtilsLabelEXTArgs* CommandRecorder::RecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdEndDebugUtilsLabelEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
 CmdInsertDebugUtilsLabelEXTArgs* CommandRecorder::RecordCmdInsertDebugUtilsLabelEXT(
     VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto* args = Alloc<CmdInsertDebugUtilsLabelEXTArgs>();
@@ -3802,16 +3147,6 @@ CmdInsertDebugUtilsLabelEXTArgs* CommandRecorder::RecordCmdInsertDebugUtilsLabel
     return args;
 }
 
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-CmdInitializeGraphScratchMemoryAMDXArgs* CommandRecorder::RecordCmdInitializeGraphScratchMemoryAMDX(
-    VkCommandBuffer commandBuffer, VkDeviceAddress scratch) {
-    auto* args = Alloc<CmdInitializeGraphScratchMemoryAMDXArgs>();
-    args->commandBuffer = commandBuffer;
-    args->scratch = scratch;
-    return args;
-}
-#endif  // VK_ENABLE_BETA_EXTENSIONS
-
 #ifdef VK_ENABLE_BETA_EXTENSIONS
 CmdDispatchGraphAMDXArgs* CommandRecorder::RecordCmdDispatchGraphAMDX(VkCommandBuffer commandBuffer,
                                                                       VkDeviceAddress scratch,
@@ -3839,17 +3174,6 @@ CmdDispatchGraphIndirectAMDXArgs* CommandRecorder::RecordCmdDispatchGraphIndirec
 }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-CmdDispatchGraphIndirectCountAMDXArgs* CommandRecorder::RecordCmdDispatchGraphIndirectCountAMDX(
-    VkCommandBuffer commandBuffer, VkDeviceAddress scratch, VkDeviceAddress countInfo) {
-    auto* args = Alloc<CmdDispatchGraphIndirectCountAMDXArgs>();
-    args->commandBuffer = commandBuffer;
-    args->scratch = scratch;
-    args->countInfo = countInfo;
-    return args;
-}
-#endif  // VK_ENABLE_BETA_EXTENSIONS
-
 CmdSetSampleLocationsEXTArgs* CommandRecorder::RecordCmdSetSampleLocationsEXT(
     VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
     auto* args = Alloc<CmdSetSampleLocationsEXTArgs>();
@@ -3860,16 +3184,6 @@ CmdSetSampleLocationsEXTArgs* CommandRecorder::RecordCmdSetSampleLocationsEXT(
     return args;
 }
 
-CmdBindShadingRateImageNVArgs* CommandRecorder::RecordCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer,
-                                                                                VkImageView imageView,
-                                                                                VkImageLayout imageLayout) {
-    auto* args = Alloc<CmdBindShadingRateImageNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->imageView = imageView;
-    args->imageLayout = imageLayout;
-    return args;
-}
-
 CmdSetViewportShadingRatePaletteNVArgs* CommandRecorder::RecordCmdSetViewportShadingRatePaletteNV(
     VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
     const VkShadingRatePaletteNV* pShadingRatePalettes) {
@@ -3917,42 +3231,6 @@ CmdBuildAccelerationStructureNVArgs* CommandRecorder::RecordCmdBuildAcceleration
     return args;
 }
 
-CmdCopyAccelerationStructureNVArgs* CommandRecorder::RecordCmdCopyAccelerationStructureNV(
-    VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
-    VkCopyAccelerationStructureModeKHR mode) {
-    auto* args = Alloc<CmdCopyAccelerationStructureNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->dst = dst;
-    args->src = src;
-    args->mode = mode;
-    return args;
-}
-
-CmdTraceRaysNVArgs* CommandRecorder::RecordCmdTraceRaysNV(
-    VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset,
-    VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride,
-    VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride,
-    VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset,
-    VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) {
-    auto* args = Alloc<CmdTraceRaysNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->raygenShaderBindingTableBuffer = raygenShaderBindingTableBuffer;
-    args->raygenShaderBindingOffset = raygenShaderBindingOffset;
-    args->missShaderBindingTableBuffer = missShaderBindingTableBuffer;
-    args->missShaderBindingOffset = missShaderBindingOffset;
-    args->missShaderBindingStride = missShaderBindingStride;
-    args->hitShaderBindingTableBuffer = hitShaderBindingTableBuffer;
-    args->hitShaderBindingOffset = hitShaderBindingOffset;
-    args->hitShaderBindingStride = hitShaderBindingStride;
-    args->callableShaderBindingTableBuffer = callableShaderBindingTableBuffer;
-    args->callableShaderBindingOffset = callableShaderBindingOffset;
-    args->callableShaderBindingStride = callableShaderBindingStride;
-    args->width = width;
-    args->height = height;
-    args->depth = depth;
-    return args;
-}
-
 CmdWriteAccelerationStructuresPropertiesNVArgs* CommandRecorder::RecordCmdWriteAccelerationStructuresPropertiesNV(
     VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount,
     const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool,
@@ -3970,54 +3248,6 @@ CmdWriteAccelerationStructuresPropertiesNVArgs* CommandRecorder::RecordCmdWriteA
     return args;
 }
 
-CmdWriteBufferMarkerAMDArgs* CommandRecorder::RecordCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer,
-                                                                            VkPipelineStageFlagBits pipelineStage,
-                                                                            VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                                                            uint32_t marker) {
-    auto* args = Alloc<CmdWriteBufferMarkerAMDArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineStage = pipelineStage;
-    args->dstBuffer = dstBuffer;
-    args->dstOffset = dstOffset;
-    args->marker = marker;
-    return args;
-}
-
-CmdDrawMeshTasksNVArgs* CommandRecorder::RecordCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount,
-                                                                  uint32_t firstTask) {
-    auto* args = Alloc<CmdDrawMeshTasksNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->taskCount = taskCount;
-    args->firstTask = firstTask;
-    return args;
-}
-
-CmdDrawMeshTasksIndirectNVArgs* CommandRecorder::RecordCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer,
-                                                                                  VkBuffer buffer, VkDeviceSize offset,
-                                                                                  uint32_t drawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawMeshTasksIndirectNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->drawCount = drawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawMeshTasksIndirectCountNVArgs* CommandRecorder::RecordCmdDrawMeshTasksIndirectCountNV(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-    VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawMeshTasksIndirectCountNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
 CmdSetExclusiveScissorEnableNVArgs* CommandRecorder::RecordCmdSetExclusiveScissorEnableNV(
     VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount,
     const VkBool32* pExclusiveScissorEnables) {
@@ -4085,40 +3315,6 @@ CmdSetPerformanceOverrideINTELArgs* CommandRecorder::RecordCmdSetPerformanceOver
     return args;
 }
 
-CmdSetLineStippleEXTArgs* CommandRecorder::RecordCmdSetLineStippleEXT(VkCommandBuffer commandBuffer,
-                                                                      uint32_t lineStippleFactor,
-                                                                      uint16_t lineStipplePattern) {
-    auto* args = Alloc<CmdSetLineStippleEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->lineStippleFactor = lineStippleFactor;
-    args->lineStipplePattern = lineStipplePattern;
-    return args;
-}
-
-CmdSetCullModeEXTArgs* CommandRecorder::RecordCmdSetCullModeEXT(VkCommandBuffer commandBuffer,
-                                                                VkCullModeFlags cullMode) {
-    auto* args = Alloc<CmdSetCullModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->cullMode = cullMode;
-    return args;
-}
-
-CmdSetFrontFaceEXTArgs* CommandRecorder::RecordCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer,
-                                                                  VkFrontFace frontFace) {
-    auto* args = Alloc<CmdSetFrontFaceEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->frontFace = frontFace;
-    return args;
-}
-
-CmdSetPrimitiveTopologyEXTArgs* CommandRecorder::RecordCmdSetPrimitiveTopologyEXT(
-    VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
-    auto* args = Alloc<CmdSetPrimitiveTopologyEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->primitiveTopology = primitiveTopology;
-    return args;
-}
-
 CmdSetViewportWithCountEXTArgs* CommandRecorder::RecordCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer,
                                                                                   uint32_t viewportCount,
                                                                                   const VkViewport* pViewports) {
@@ -4165,60 +3361,6 @@ CmdBindVertexBuffers2EXTArgs* CommandRecorder::RecordCmdBindVertexBuffers2EXT(
     return args;
 }
 
-CmdSetDepthTestEnableEXTArgs* CommandRecorder::RecordCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer,
-                                                                              VkBool32 depthTestEnable) {
-    auto* args = Alloc<CmdSetDepthTestEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthTestEnable = depthTestEnable;
-    return args;
-}
-
-CmdSetDepthWriteEnableEXTArgs* CommandRecorder::RecordCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                VkBool32 depthWriteEnable) {
-    auto* args = Alloc<CmdSetDepthWriteEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthWriteEnable = depthWriteEnable;
-    return args;
-}
-
-CmdSetDepthCompareOpEXTArgs* CommandRecorder::RecordCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer,
-                                                                            VkCompareOp depthCompareOp) {
-    auto* args = Alloc<CmdSetDepthCompareOpEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthCompareOp = depthCompareOp;
-    return args;
-}
-
-CmdSetDepthBoundsTestEnableEXTArgs* CommandRecorder::RecordCmdSetDepthBoundsTestEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
-    auto* args = Alloc<CmdSetDepthBoundsTestEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthBoundsTestEnable = depthBoundsTestEnable;
-    return args;
-}
-
-CmdSetStencilTestEnableEXTArgs* CommandRecorder::RecordCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                  VkBool32 stencilTestEnable) {
-    auto* args = Alloc<CmdSetStencilTestEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->stencilTestEnable = stencilTestEnable;
-    return args;
-}
-
-CmdSetStencilOpEXTArgs* CommandRecorder::RecordCmdSetStencilOpEXT(VkCommandBuffer commandBuffer,
-                                                                  VkStencilFaceFlags faceMask, VkStencilOp failOp,
-                                                                  VkStencilOp passOp, VkStencilOp depthFailOp,
-                                                                  VkCompareOp compareOp) {
-    auto* args = Alloc<CmdSetStencilOpEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->faceMask = faceMask;
-    args->failOp = failOp;
-    args->passOp = passOp;
-    args->depthFailOp = depthFailOp;
-    args->compareOp = compareOp;
-    return args;
-}
-
 CmdPreprocessGeneratedCommandsNVArgs* CommandRecorder::RecordCmdPreprocessGeneratedCommandsNV(
     VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
     auto* args = Alloc<CmdPreprocessGeneratedCommandsNVArgs>();
@@ -4242,16 +3384,6 @@ CmdExecuteGeneratedCommandsNVArgs* CommandRecorder::RecordCmdExecuteGeneratedCom
     return args;
 }
 
-CmdBindPipelineShaderGroupNVArgs* CommandRecorder::RecordCmdBindPipelineShaderGroupNV(
-    VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) {
-    auto* args = Alloc<CmdBindPipelineShaderGroupNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineBindPoint = pipelineBindPoint;
-    args->pipeline = pipeline;
-    args->groupIndex = groupIndex;
-    return args;
-}
-
 CmdSetDepthBias2EXTArgs* CommandRecorder::RecordCmdSetDepthBias2EXT(VkCommandBuffer commandBuffer,
                                                                     const VkDepthBiasInfoEXT* pDepthBiasInfo) {
     auto* args = Alloc<CmdSetDepthBias2EXTArgs>();
@@ -4301,16 +3433,6 @@ CmdSetDescriptorBufferOffsetsEXTArgs* CommandRecorder::RecordCmdSetDescriptorBuf
     return args;
 }
 
-CmdBindDescriptorBufferEmbeddedSamplersEXTArgs* CommandRecorder::RecordCmdBindDescriptorBufferEmbeddedSamplersEXT(
-    VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set) {
-    auto* args = Alloc<CmdBindDescriptorBufferEmbeddedSamplersEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineBindPoint = pipelineBindPoint;
-    args->layout = layout;
-    args->set = set;
-    return args;
-}
-
 CmdSetFragmentShadingRateEnumNVArgs* CommandRecorder::RecordCmdSetFragmentShadingRateEnumNV(
     VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate,
     const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
@@ -4342,61 +3464,6 @@ CmdSetVertexInputEXTArgs* CommandRecorder::RecordCmdSetVertexInputEXT(
     return args;
 }
 
-CmdSubpassShadingHUAWEIArgs* CommandRecorder::RecordCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
-    auto* args = Alloc<CmdSubpassShadingHUAWEIArgs>();
-    args->commandBuffer = commandBuffer;
-    return args;
-}
-
-CmdBindInvocationMaskHUAWEIArgs* CommandRecorder::RecordCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer,
-                                                                                    VkImageView imageView,
-                                                                                    VkImageLayout imageLayout) {
-    auto* args = Alloc<CmdBindInvocationMaskHUAWEIArgs>();
-    args->commandBuffer = commandBuffer;
-    args->imageView = imageView;
-    args->imageLayout = imageLayout;
-    return args;
-}
-
-CmdSetPatchControlPointsEXTArgs* CommandRecorder::RecordCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer,
-                                                                                    uint32_t patchControlPoints) {
-    auto* args = Alloc<CmdSetPatchControlPointsEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->patchControlPoints = patchControlPoints;
-    return args;
-}
-
-CmdSetRasterizerDiscardEnableEXTArgs* CommandRecorder::RecordCmdSetRasterizerDiscardEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
-    auto* args = Alloc<CmdSetRasterizerDiscardEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->rasterizerDiscardEnable = rasterizerDiscardEnable;
-    return args;
-}
-
-CmdSetDepthBiasEnableEXTArgs* CommandRecorder::RecordCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer,
-                                                                              VkBool32 depthBiasEnable) {
-    auto* args = Alloc<CmdSetDepthBiasEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthBiasEnable = depthBiasEnable;
-    return args;
-}
-
-CmdSetLogicOpEXTArgs* CommandRecorder::RecordCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
-    auto* args = Alloc<CmdSetLogicOpEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->logicOp = logicOp;
-    return args;
-}
-
-CmdSetPrimitiveRestartEnableEXTArgs* CommandRecorder::RecordCmdSetPrimitiveRestartEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
-    auto* args = Alloc<CmdSetPrimitiveRestartEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->primitiveRestartEnable = primitiveRestartEnable;
-    return args;
-}
-
 CmdSetColorWriteEnableEXTArgs* CommandRecorder::RecordCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer,
                                                                                 uint32_t attachmentCount,
                                                                                 const VkBool32* pColorWriteEnables) {
@@ -4500,38 +3567,6 @@ CmdWriteMicromapsPropertiesEXTArgs* CommandRecorder::RecordCmdWriteMicromapsProp
     return args;
 }
 
-CmdDrawClusterHUAWEIArgs* CommandRecorder::RecordCmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer,
-                                                                      uint32_t groupCountX, uint32_t groupCountY,
-                                                                      uint32_t groupCountZ) {
-    auto* args = Alloc<CmdDrawClusterHUAWEIArgs>();
-    args->commandBuffer = commandBuffer;
-    args->groupCountX = groupCountX;
-    args->groupCountY = groupCountY;
-    args->groupCountZ = groupCountZ;
-    return args;
-}
-
-CmdDrawClusterIndirectHUAWEIArgs* CommandRecorder::RecordCmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer,
-                                                                                      VkBuffer buffer,
-                                                                                      VkDeviceSize offset) {
-    auto* args = Alloc<CmdDrawClusterIndirectHUAWEIArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    return args;
-}
-
-CmdCopyMemoryIndirectNVArgs* CommandRecorder::RecordCmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer,
-                                                                            VkDeviceAddress copyBufferAddress,
-                                                                            uint32_t copyCount, uint32_t stride) {
-    auto* args = Alloc<CmdCopyMemoryIndirectNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->copyBufferAddress = copyBufferAddress;
-    args->copyCount = copyCount;
-    args->stride = stride;
-    return args;
-}
-
 CmdCopyMemoryToImageIndirectNVArgs* CommandRecorder::RecordCmdCopyMemoryToImageIndirectNV(
     VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride,
     VkImage dstImage, VkImageLayout dstImageLayout, const VkImageSubresourceLayers* pImageSubresources) {
@@ -4562,50 +3597,6 @@ CmdDecompressMemoryNVArgs* CommandRecorder::RecordCmdDecompressMemoryNV(
     return args;
 }
 
-CmdDecompressMemoryIndirectCountNVArgs* CommandRecorder::RecordCmdDecompressMemoryIndirectCountNV(
-    VkCommandBuffer commandBuffer, VkDeviceAddress indirectCommandsAddress,
-    VkDeviceAddress indirectCommandsCountAddress, uint32_t stride) {
-    auto* args = Alloc<CmdDecompressMemoryIndirectCountNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->indirectCommandsAddress = indirectCommandsAddress;
-    args->indirectCommandsCountAddress = indirectCommandsCountAddress;
-    args->stride = stride;
-    return args;
-}
-
-CmdUpdatePipelineIndirectBufferNVArgs* CommandRecorder::RecordCmdUpdatePipelineIndirectBufferNV(
-    VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
-    auto* args = Alloc<CmdUpdatePipelineIndirectBufferNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineBindPoint = pipelineBindPoint;
-    args->pipeline = pipeline;
-    return args;
-}
-
-CmdSetDepthClampEnableEXTArgs* CommandRecorder::RecordCmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                VkBool32 depthClampEnable) {
-    auto* args = Alloc<CmdSetDepthClampEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthClampEnable = depthClampEnable;
-    return args;
-}
-
-CmdSetPolygonModeEXTArgs* CommandRecorder::RecordCmdSetPolygonModeEXT(VkCommandBuffer commandBuffer,
-                                                                      VkPolygonMode polygonMode) {
-    auto* args = Alloc<CmdSetPolygonModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->polygonMode = polygonMode;
-    return args;
-}
-
-CmdSetRasterizationSamplesEXTArgs* CommandRecorder::RecordCmdSetRasterizationSamplesEXT(
-    VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples) {
-    auto* args = Alloc<CmdSetRasterizationSamplesEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->rasterizationSamples = rasterizationSamples;
-    return args;
-}
-
 CmdSetSampleMaskEXTArgs* CommandRecorder::RecordCmdSetSampleMaskEXT(VkCommandBuffer commandBuffer,
                                                                     VkSampleCountFlagBits samples,
                                                                     const VkSampleMask* pSampleMask) {
@@ -4618,30 +3609,6 @@ CmdSetSampleMaskEXTArgs* CommandRecorder::RecordCmdSetSampleMaskEXT(VkCommandBuf
     return args;
 }
 
-CmdSetAlphaToCoverageEnableEXTArgs* CommandRecorder::RecordCmdSetAlphaToCoverageEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) {
-    auto* args = Alloc<CmdSetAlphaToCoverageEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->alphaToCoverageEnable = alphaToCoverageEnable;
-    return args;
-}
-
-CmdSetAlphaToOneEnableEXTArgs* CommandRecorder::RecordCmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                VkBool32 alphaToOneEnable) {
-    auto* args = Alloc<CmdSetAlphaToOneEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->alphaToOneEnable = alphaToOneEnable;
-    return args;
-}
-
-CmdSetLogicOpEnableEXTArgs* CommandRecorder::RecordCmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
-                                                                          VkBool32 logicOpEnable) {
-    auto* args = Alloc<CmdSetLogicOpEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->logicOpEnable = logicOpEnable;
-    return args;
-}
-
 CmdSetColorBlendEnableEXTArgs* CommandRecorder::RecordCmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer,
                                                                                 uint32_t firstAttachment,
                                                                                 uint32_t attachmentCount,
@@ -4685,54 +3652,6 @@ CmdSetColorWriteMaskEXTArgs* CommandRecorder::RecordCmdSetColorWriteMaskEXT(
     return args;
 }
 
-CmdSetTessellationDomainOriginEXTArgs* CommandRecorder::RecordCmdSetTessellationDomainOriginEXT(
-    VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin) {
-    auto* args = Alloc<CmdSetTessellationDomainOriginEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->domainOrigin = domainOrigin;
-    return args;
-}
-
-CmdSetRasterizationStreamEXTArgs* CommandRecorder::RecordCmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer,
-                                                                                      uint32_t rasterizationStream) {
-    auto* args = Alloc<CmdSetRasterizationStreamEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->rasterizationStream = rasterizationStream;
-    return args;
-}
-
-CmdSetConservativeRasterizationModeEXTArgs* CommandRecorder::RecordCmdSetConservativeRasterizationModeEXT(
-    VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) {
-    auto* args = Alloc<CmdSetConservativeRasterizationModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->conservativeRasterizationMode = conservativeRasterizationMode;
-    return args;
-}
-
-CmdSetExtraPrimitiveOverestimationSizeEXTArgs* CommandRecorder::RecordCmdSetExtraPrimitiveOverestimationSizeEXT(
-    VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) {
-    auto* args = Alloc<CmdSetExtraPrimitiveOverestimationSizeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->extraPrimitiveOverestimationSize = extraPrimitiveOverestimationSize;
-    return args;
-}
-
-CmdSetDepthClipEnableEXTArgs* CommandRecorder::RecordCmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer,
-                                                                              VkBool32 depthClipEnable) {
-    auto* args = Alloc<CmdSetDepthClipEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->depthClipEnable = depthClipEnable;
-    return args;
-}
-
-CmdSetSampleLocationsEnableEXTArgs* CommandRecorder::RecordCmdSetSampleLocationsEnableEXT(
-    VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) {
-    auto* args = Alloc<CmdSetSampleLocationsEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->sampleLocationsEnable = sampleLocationsEnable;
-    return args;
-}
-
 CmdSetColorBlendAdvancedEXTArgs* CommandRecorder::RecordCmdSetColorBlendAdvancedEXT(
     VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount,
     const VkColorBlendAdvancedEXT* pColorBlendAdvanced) {
@@ -4747,46 +3666,6 @@ CmdSetColorBlendAdvancedEXTArgs* CommandRecorder::RecordCmdSetColorBlendAdvanced
     return args;
 }
 
-CmdSetProvokingVertexModeEXTArgs* CommandRecorder::RecordCmdSetProvokingVertexModeEXT(
-    VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode) {
-    auto* args = Alloc<CmdSetProvokingVertexModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->provokingVertexMode = provokingVertexMode;
-    return args;
-}
-
-CmdSetLineRasterizationModeEXTArgs* CommandRecorder::RecordCmdSetLineRasterizationModeEXT(
-    VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) {
-    auto* args = Alloc<CmdSetLineRasterizationModeEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->lineRasterizationMode = lineRasterizationMode;
-    return args;
-}
-
-CmdSetLineStippleEnableEXTArgs* CommandRecorder::RecordCmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                  VkBool32 stippledLineEnable) {
-    auto* args = Alloc<CmdSetLineStippleEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->stippledLineEnable = stippledLineEnable;
-    return args;
-}
-
-CmdSetDepthClipNegativeOneToOneEXTArgs* CommandRecorder::RecordCmdSetDepthClipNegativeOneToOneEXT(
-    VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) {
-    auto* args = Alloc<CmdSetDepthClipNegativeOneToOneEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->negativeOneToOne = negativeOneToOne;
-    return args;
-}
-
-CmdSetViewportWScalingEnableNVArgs* CommandRecorder::RecordCmdSetViewportWScalingEnableNV(
-    VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) {
-    auto* args = Alloc<CmdSetViewportWScalingEnableNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->viewportWScalingEnable = viewportWScalingEnable;
-    return args;
-}
-
 CmdSetViewportSwizzleNVArgs* CommandRecorder::RecordCmdSetViewportSwizzleNV(
     VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
     const VkViewportSwizzleNV* pViewportSwizzles) {
@@ -4801,38 +3680,6 @@ CmdSetViewportSwizzleNVArgs* CommandRecorder::RecordCmdSetViewportSwizzleNV(
     return args;
 }
 
-CmdSetCoverageToColorEnableNVArgs* CommandRecorder::RecordCmdSetCoverageToColorEnableNV(
-    VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) {
-    auto* args = Alloc<CmdSetCoverageToColorEnableNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->coverageToColorEnable = coverageToColorEnable;
-    return args;
-}
-
-CmdSetCoverageToColorLocationNVArgs* CommandRecorder::RecordCmdSetCoverageToColorLocationNV(
-    VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) {
-    auto* args = Alloc<CmdSetCoverageToColorLocationNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->coverageToColorLocation = coverageToColorLocation;
-    return args;
-}
-
-CmdSetCoverageModulationModeNVArgs* CommandRecorder::RecordCmdSetCoverageModulationModeNV(
-    VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) {
-    auto* args = Alloc<CmdSetCoverageModulationModeNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->coverageModulationMode = coverageModulationMode;
-    return args;
-}
-
-CmdSetCoverageModulationTableEnableNVArgs* CommandRecorder::RecordCmdSetCoverageModulationTableEnableNV(
-    VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) {
-    auto* args = Alloc<CmdSetCoverageModulationTableEnableNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->coverageModulationTableEnable = coverageModulationTableEnable;
-    return args;
-}
-
 CmdSetCoverageModulationTableNVArgs* CommandRecorder::RecordCmdSetCoverageModulationTableNV(
     VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float* pCoverageModulationTable) {
     auto* args = Alloc<CmdSetCoverageModulationTableNVArgs>();
@@ -4845,30 +3692,6 @@ CmdSetCoverageModulationTableNVArgs* CommandRecorder::RecordCmdSetCoverageModula
     return args;
 }
 
-CmdSetShadingRateImageEnableNVArgs* CommandRecorder::RecordCmdSetShadingRateImageEnableNV(
-    VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) {
-    auto* args = Alloc<CmdSetShadingRateImageEnableNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->shadingRateImageEnable = shadingRateImageEnable;
-    return args;
-}
-
-CmdSetRepresentativeFragmentTestEnableNVArgs* CommandRecorder::RecordCmdSetRepresentativeFragmentTestEnableNV(
-    VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) {
-    auto* args = Alloc<CmdSetRepresentativeFragmentTestEnableNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->representativeFragmentTestEnable = representativeFragmentTestEnable;
-    return args;
-}
-
-CmdSetCoverageReductionModeNVArgs* CommandRecorder::RecordCmdSetCoverageReductionModeNV(
-    VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) {
-    auto* args = Alloc<CmdSetCoverageReductionModeNVArgs>();
-    args->commandBuffer = commandBuffer;
-    args->coverageReductionMode = coverageReductionMode;
-    return args;
-}
-
 CmdOpticalFlowExecuteNVArgs* CommandRecorder::RecordCmdOpticalFlowExecuteNV(
     VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV* pExecuteInfo) {
     auto* args = Alloc<CmdOpticalFlowExecuteNVArgs>();
@@ -4895,14 +3718,6 @@ CmdBindShadersEXTArgs* CommandRecorder::RecordCmdBindShadersEXT(VkCommandBuffer
     return args;
 }
 
-CmdSetAttachmentFeedbackLoopEnableEXTArgs* CommandRecorder::RecordCmdSetAttachmentFeedbackLoopEnableEXT(
-    VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) {
-    auto* args = Alloc<CmdSetAttachmentFeedbackLoopEnableEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->aspectMask = aspectMask;
-    return args;
-}
-
 CmdBuildAccelerationStructuresKHRArgs* CommandRecorder::RecordCmdBuildAccelerationStructuresKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
     const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
@@ -5046,47 +3861,4 @@ CmdTraceRaysIndirectKHRArgs* CommandRecorder::RecordCmdTraceRaysIndirectKHR(
     return args;
 }
 
-CmdSetRayTracingPipelineStackSizeKHRArgs* CommandRecorder::RecordCmdSetRayTracingPipelineStackSizeKHR(
-    VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) {
-    auto* args = Alloc<CmdSetRayTracingPipelineStackSizeKHRArgs>();
-    args->commandBuffer = commandBuffer;
-    args->pipelineStackSize = pipelineStackSize;
-    return args;
-}
-
-CmdDrawMeshTasksEXTArgs* CommandRecorder::RecordCmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX,
-                                                                    uint32_t groupCountY, uint32_t groupCountZ) {
-    auto* args = Alloc<CmdDrawMeshTasksEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->groupCountX = groupCountX;
-    args->groupCountY = groupCountY;
-    args->groupCountZ = groupCountZ;
-    return args;
-}
-
-CmdDrawMeshTasksIndirectEXTArgs* CommandRecorder::RecordCmdDrawMeshTasksIndirectEXT(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawMeshTasksIndirectEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->drawCount = drawCount;
-    args->stride = stride;
-    return args;
-}
-
-CmdDrawMeshTasksIndirectCountEXTArgs* CommandRecorder::RecordCmdDrawMeshTasksIndirectCountEXT(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-    VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
-    auto* args = Alloc<CmdDrawMeshTasksIndirectCountEXTArgs>();
-    args->commandBuffer = commandBuffer;
-    args->buffer = buffer;
-    args->offset = offset;
-    args->countBuffer = countBuffer;
-    args->countBufferOffset = countBufferOffset;
-    args->maxDrawCount = maxDrawCount;
-    args->stride = stride;
-    return args;
-}
-
 // NOLINTEND
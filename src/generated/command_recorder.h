@@ -27,6 +27,8 @@
 
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <type_traits>
 #include <vector>
 #include <vulkan/vulkan.h>
 
@@ -35,16 +37,30 @@
 
 class CommandRecorder {
    public:
+    explicit CommandRecorder(std::shared_ptr<LinearAllocatorBlockCache> block_cache = nullptr)
+        : m_allocator(std::move(block_cache)) {}
     void Reset() { m_allocator.Reset(); }
+    const CommandLabel* PushLabel(const CommandLabel* parent, const char* name) {
+        auto* label = Alloc<CommandLabel>();
+        label->name = name ? CopyArray<>(name, 0, strlen(name) + 1) : nullptr;
+        label->parent = parent;
+        return label;
+    }
     BeginCommandBufferArgs* RecordBeginCommandBuffer(VkCommandBuffer commandBuffer,
                                                      const VkCommandBufferBeginInfo* pBeginInfo);
 
-    EndCommandBufferArgs* RecordEndCommandBuffer(VkCommandBuffer commandBuffer);
+    EndCommandBufferArgs* RecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<EndCommandBufferArgs>({commandBuffer});
+    }
 
-    ResetCommandBufferArgs* RecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags);
+    ResetCommandBufferArgs* RecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+        return AllocTrivial<ResetCommandBufferArgs>({commandBuffer, flags});
+    }
 
     CmdBindPipelineArgs* RecordCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
-                                               VkPipeline pipeline);
+                                               VkPipeline pipeline) {
+        return AllocTrivial<CmdBindPipelineArgs>({commandBuffer, pipelineBindPoint, pipeline});
+    }
 
     CmdSetViewportArgs* RecordCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                              uint32_t viewportCount, const VkViewport* pViewports);
@@ -52,24 +68,37 @@ class CommandRecorder {
     CmdSetScissorArgs* RecordCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
                                            const VkRect2D* pScissors);
 
-    CmdSetLineWidthArgs* RecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth);
+    CmdSetLineWidthArgs* RecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+        return AllocTrivial<CmdSetLineWidthArgs>({commandBuffer, lineWidth});
+    }
 
     CmdSetDepthBiasArgs* RecordCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor,
-                                               float depthBiasClamp, float depthBiasSlopeFactor);
+                                               float depthBiasClamp, float depthBiasSlopeFactor) {
+        return AllocTrivial<CmdSetDepthBiasArgs>({commandBuffer, depthBiasConstantFactor, depthBiasClamp,
+                                                  depthBiasSlopeFactor});
+    }
 
     CmdSetBlendConstantsArgs* RecordCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]);
 
     CmdSetDepthBoundsArgs* RecordCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds,
-                                                   float maxDepthBounds);
+                                                   float maxDepthBounds) {
+        return AllocTrivial<CmdSetDepthBoundsArgs>({commandBuffer, minDepthBounds, maxDepthBounds});
+    }
 
     CmdSetStencilCompareMaskArgs* RecordCmdSetStencilCompareMask(VkCommandBuffer commandBuffer,
-                                                                 VkStencilFaceFlags faceMask, uint32_t compareMask);
+                                                                 VkStencilFaceFlags faceMask, uint32_t compareMask) {
+        return AllocTrivial<CmdSetStencilCompareMaskArgs>({commandBuffer, faceMask, compareMask});
+    }
 
     CmdSetStencilWriteMaskArgs* RecordCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
-                                                             uint32_t writeMask);
+                                                             uint32_t writeMask) {
+        return AllocTrivial<CmdSetStencilWriteMaskArgs>({commandBuffer, faceMask, writeMask});
+    }
 
     CmdSetStencilReferenceArgs* RecordCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
-                                                             uint32_t reference);
+                                                             uint32_t reference) {
+        return AllocTrivial<CmdSetStencilReferenceArgs>({commandBuffer, faceMask, reference});
+    }
 
     CmdBindDescriptorSetsArgs* RecordCmdBindDescriptorSets(
         VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout,
@@ -77,29 +106,44 @@ class CommandRecorder {
         uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets);
 
     CmdBindIndexBufferArgs* RecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                     VkDeviceSize offset, VkIndexType indexType);
+                                                     VkDeviceSize offset, VkIndexType indexType) {
+        return AllocTrivial<CmdBindIndexBufferArgs>({commandBuffer, buffer, offset, indexType});
+    }
 
     CmdBindVertexBuffersArgs* RecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding,
                                                          uint32_t bindingCount, const VkBuffer* pBuffers,
                                                          const VkDeviceSize* pOffsets);
 
     CmdDrawArgs* RecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
-                               uint32_t firstVertex, uint32_t firstInstance);
+                               uint32_t firstVertex, uint32_t firstInstance) {
+        return AllocTrivial<CmdDrawArgs>({commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance});
+    }
 
     CmdDrawIndexedArgs* RecordCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
-                                             uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+                                             uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+        return AllocTrivial<CmdDrawIndexedArgs>({commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset,
+                                                 firstInstance});
+    }
 
     CmdDrawIndirectArgs* RecordCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
-                                               uint32_t drawCount, uint32_t stride);
+                                               uint32_t drawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawIndirectArgs>({commandBuffer, buffer, offset, drawCount, stride});
+    }
 
     CmdDrawIndexedIndirectArgs* RecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                             VkDeviceSize offset, uint32_t drawCount, uint32_t stride);
+                                                             VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawIndexedIndirectArgs>({commandBuffer, buffer, offset, drawCount, stride});
+    }
 
     CmdDispatchArgs* RecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
-                                       uint32_t groupCountZ);
+                                       uint32_t groupCountZ) {
+        return AllocTrivial<CmdDispatchArgs>({commandBuffer, groupCountX, groupCountY, groupCountZ});
+    }
 
     CmdDispatchIndirectArgs* RecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                       VkDeviceSize offset);
+                                                       VkDeviceSize offset) {
+        return AllocTrivial<CmdDispatchIndirectArgs>({commandBuffer, buffer, offset});
+    }
 
     CmdCopyBufferArgs* RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                            uint32_t regionCount, const VkBufferCopy* pRegions);
@@ -124,7 +168,9 @@ class CommandRecorder {
                                                VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData);
 
     CmdFillBufferArgs* RecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                           VkDeviceSize size, uint32_t data);
+                                           VkDeviceSize size, uint32_t data) {
+        return AllocTrivial<CmdFillBufferArgs>({commandBuffer, dstBuffer, dstOffset, size, data});
+    }
 
     CmdClearColorImageArgs* RecordCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image,
                                                      VkImageLayout imageLayout, const VkClearColorValue* pColor,
@@ -145,10 +191,14 @@ class CommandRecorder {
                                                VkImageLayout dstImageLayout, uint32_t regionCount,
                                                const VkImageResolve* pRegions);
 
-    CmdSetEventArgs* RecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask);
+    CmdSetEventArgs* RecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+        return AllocTrivial<CmdSetEventArgs>({commandBuffer, event, stageMask});
+    }
 
     CmdResetEventArgs* RecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event,
-                                           VkPipelineStageFlags stageMask);
+                                           VkPipelineStageFlags stageMask) {
+        return AllocTrivial<CmdResetEventArgs>({commandBuffer, event, stageMask});
+    }
 
     CmdWaitEventsArgs* RecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                            VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
@@ -165,20 +215,31 @@ class CommandRecorder {
         uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers);
 
     CmdBeginQueryArgs* RecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
-                                           VkQueryControlFlags flags);
+                                           VkQueryControlFlags flags) {
+        return AllocTrivial<CmdBeginQueryArgs>({commandBuffer, queryPool, query, flags});
+    }
 
-    CmdEndQueryArgs* RecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query);
+    CmdEndQueryArgs* RecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+        return AllocTrivial<CmdEndQueryArgs>({commandBuffer, queryPool, query});
+    }
 
     CmdResetQueryPoolArgs* RecordCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
-                                                   uint32_t firstQuery, uint32_t queryCount);
+                                                   uint32_t firstQuery, uint32_t queryCount) {
+        return AllocTrivial<CmdResetQueryPoolArgs>({commandBuffer, queryPool, firstQuery, queryCount});
+    }
 
     CmdWriteTimestampArgs* RecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
-                                                   VkQueryPool queryPool, uint32_t query);
+                                                   VkQueryPool queryPool, uint32_t query) {
+        return AllocTrivial<CmdWriteTimestampArgs>({commandBuffer, pipelineStage, queryPool, query});
+    }
 
     CmdCopyQueryPoolResultsArgs* RecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
                                                                uint32_t firstQuery, uint32_t queryCount,
                                                                VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                                               VkDeviceSize stride, VkQueryResultFlags flags);
+                                                               VkDeviceSize stride, VkQueryResultFlags flags) {
+        return AllocTrivial<CmdCopyQueryPoolResultsArgs>({commandBuffer, queryPool, firstQuery, queryCount, dstBuffer,
+                                                          dstOffset, stride, flags});
+    }
 
     CmdPushConstantsArgs* RecordCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
                                                  VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
@@ -188,28 +249,43 @@ class CommandRecorder {
                                                      const VkRenderPassBeginInfo* pRenderPassBegin,
                                                      VkSubpassContents contents);
 
-    CmdNextSubpassArgs* RecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents);
+    CmdNextSubpassArgs* RecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+        return AllocTrivial<CmdNextSubpassArgs>({commandBuffer, contents});
+    }
 
-    CmdEndRenderPassArgs* RecordCmdEndRenderPass(VkCommandBuffer commandBuffer);
+    CmdEndRenderPassArgs* RecordCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdEndRenderPassArgs>({commandBuffer});
+    }
 
     CmdExecuteCommandsArgs* RecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                      const VkCommandBuffer* pCommandBuffers);
 
-    CmdSetDeviceMaskArgs* RecordCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask);
+    CmdSetDeviceMaskArgs* RecordCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+        return AllocTrivial<CmdSetDeviceMaskArgs>({commandBuffer, deviceMask});
+    }
 
     CmdDispatchBaseArgs* RecordCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
                                                uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
-                                               uint32_t groupCountZ);
+                                               uint32_t groupCountZ) {
+        return AllocTrivial<CmdDispatchBaseArgs>({commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
+                                                  groupCountY, groupCountZ});
+    }
 
     CmdDrawIndirectCountArgs* RecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                          VkDeviceSize offset, VkBuffer countBuffer,
                                                          VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
-                                                         uint32_t stride);
+                                                         uint32_t stride) {
+        return AllocTrivial<CmdDrawIndirectCountArgs>({commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                       maxDrawCount, stride});
+    }
 
     CmdDrawIndexedIndirectCountArgs* RecordCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                        VkDeviceSize offset, VkBuffer countBuffer,
                                                                        VkDeviceSize countBufferOffset,
-                                                                       uint32_t maxDrawCount, uint32_t stride);
+                                                                       uint32_t maxDrawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawIndexedIndirectCountArgs>({commandBuffer, buffer, offset, countBuffer,
+                                                              countBufferOffset, maxDrawCount, stride});
+    }
 
     CmdBeginRenderPass2Args* RecordCmdBeginRenderPass2(VkCommandBuffer commandBuffer,
                                                        const VkRenderPassBeginInfo* pRenderPassBegin,
@@ -226,7 +302,9 @@ class CommandRecorder {
                                          const VkDependencyInfo* pDependencyInfo);
 
     CmdResetEvent2Args* RecordCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
-                                             VkPipelineStageFlags2 stageMask);
+                                             VkPipelineStageFlags2 stageMask) {
+        return AllocTrivial<CmdResetEvent2Args>({commandBuffer, event, stageMask});
+    }
 
     CmdWaitEvents2Args* RecordCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                              const VkDependencyInfo* pDependencyInfos);
@@ -235,7 +313,9 @@ class CommandRecorder {
                                                        const VkDependencyInfo* pDependencyInfo);
 
     CmdWriteTimestamp2Args* RecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage,
-                                                     VkQueryPool queryPool, uint32_t query);
+                                                     VkQueryPool queryPool, uint32_t query) {
+        return AllocTrivial<CmdWriteTimestamp2Args>({commandBuffer, stage, queryPool, query});
+    }
 
     CmdCopyBuffer2Args* RecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo);
 
@@ -255,14 +335,22 @@ class CommandRecorder {
     CmdBeginRenderingArgs* RecordCmdBeginRendering(VkCommandBuffer commandBuffer,
                                                    const VkRenderingInfo* pRenderingInfo);
 
-    CmdEndRenderingArgs* RecordCmdEndRendering(VkCommandBuffer commandBuffer);
+    CmdEndRenderingArgs* RecordCmdEndRendering(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdEndRenderingArgs>({commandBuffer});
+    }
 
-    CmdSetCullModeArgs* RecordCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode);
+    CmdSetCullModeArgs* RecordCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+        return AllocTrivial<CmdSetCullModeArgs>({commandBuffer, cullMode});
+    }
 
-    CmdSetFrontFaceArgs* RecordCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace);
+    CmdSetFrontFaceArgs* RecordCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+        return AllocTrivial<CmdSetFrontFaceArgs>({commandBuffer, frontFace});
+    }
 
     CmdSetPrimitiveTopologyArgs* RecordCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer,
-                                                               VkPrimitiveTopology primitiveTopology);
+                                                               VkPrimitiveTopology primitiveTopology) {
+        return AllocTrivial<CmdSetPrimitiveTopologyArgs>({commandBuffer, primitiveTopology});
+    }
 
     CmdSetViewportWithCountArgs* RecordCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                                const VkViewport* pViewports);
@@ -275,29 +363,47 @@ class CommandRecorder {
                                                            const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
                                                            const VkDeviceSize* pStrides);
 
-    CmdSetDepthTestEnableArgs* RecordCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable);
+    CmdSetDepthTestEnableArgs* RecordCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+        return AllocTrivial<CmdSetDepthTestEnableArgs>({commandBuffer, depthTestEnable});
+    }
 
-    CmdSetDepthWriteEnableArgs* RecordCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable);
+    CmdSetDepthWriteEnableArgs* RecordCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+        return AllocTrivial<CmdSetDepthWriteEnableArgs>({commandBuffer, depthWriteEnable});
+    }
 
-    CmdSetDepthCompareOpArgs* RecordCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp);
+    CmdSetDepthCompareOpArgs* RecordCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+        return AllocTrivial<CmdSetDepthCompareOpArgs>({commandBuffer, depthCompareOp});
+    }
 
     CmdSetDepthBoundsTestEnableArgs* RecordCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer,
-                                                                       VkBool32 depthBoundsTestEnable);
+                                                                       VkBool32 depthBoundsTestEnable) {
+        return AllocTrivial<CmdSetDepthBoundsTestEnableArgs>({commandBuffer, depthBoundsTestEnable});
+    }
 
     CmdSetStencilTestEnableArgs* RecordCmdSetStencilTestEnable(VkCommandBuffer commandBuffer,
-                                                               VkBool32 stencilTestEnable);
+                                                               VkBool32 stencilTestEnable) {
+        return AllocTrivial<CmdSetStencilTestEnableArgs>({commandBuffer, stencilTestEnable});
+    }
 
     CmdSetStencilOpArgs* RecordCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp,
-                                               VkCompareOp compareOp);
+                                               VkCompareOp compareOp) {
+        return AllocTrivial<CmdSetStencilOpArgs>({commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp});
+    }
 
     CmdSetRasterizerDiscardEnableArgs* RecordCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer,
-                                                                           VkBool32 rasterizerDiscardEnable);
+                                                                           VkBool32 rasterizerDiscardEnable) {
+        return AllocTrivial<CmdSetRasterizerDiscardEnableArgs>({commandBuffer, rasterizerDiscardEnable});
+    }
 
-    CmdSetDepthBiasEnableArgs* RecordCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable);
+    CmdSetDepthBiasEnableArgs* RecordCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
+        return AllocTrivial<CmdSetDepthBiasEnableArgs>({commandBuffer, depthBiasEnable});
+    }
 
     CmdSetPrimitiveRestartEnableArgs* RecordCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer,
-                                                                         VkBool32 primitiveRestartEnable);
+                                                                         VkBool32 primitiveRestartEnable) {
+        return AllocTrivial<CmdSetPrimitiveRestartEnableArgs>({commandBuffer, primitiveRestartEnable});
+    }
 
     CmdBeginVideoCodingKHRArgs* RecordCmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
                                                              const VkVideoBeginCodingInfoKHR* pBeginInfo);
@@ -314,13 +420,20 @@ class CommandRecorder {
     CmdBeginRenderingKHRArgs* RecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer,
                                                          const VkRenderingInfo* pRenderingInfo);
 
-    CmdEndRenderingKHRArgs* RecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer);
+    CmdEndRenderingKHRArgs* RecordCmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdEndRenderingKHRArgs>({commandBuffer});
+    }
 
-    CmdSetDeviceMaskKHRArgs* RecordCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask);
+    CmdSetDeviceMaskKHRArgs* RecordCmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+        return AllocTrivial<CmdSetDeviceMaskKHRArgs>({commandBuffer, deviceMask});
+    }
 
     CmdDispatchBaseKHRArgs* RecordCmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX,
                                                      uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX,
-                                                     uint32_t groupCountY, uint32_t groupCountZ);
+                                                     uint32_t groupCountY, uint32_t groupCountZ) {
+        return AllocTrivial<CmdDispatchBaseKHRArgs>({commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX,
+                                                     groupCountY, groupCountZ});
+    }
 
     CmdPushDescriptorSetKHRArgs* RecordCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer,
                                                                VkPipelineBindPoint pipelineBindPoint,
@@ -346,13 +459,19 @@ class CommandRecorder {
     CmdDrawIndirectCountKHRArgs* RecordCmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                VkDeviceSize offset, VkBuffer countBuffer,
                                                                VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
-                                                               uint32_t stride);
+                                                               uint32_t stride) {
+        return AllocTrivial<CmdDrawIndirectCountKHRArgs>({commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                          maxDrawCount, stride});
+    }
 
     CmdDrawIndexedIndirectCountKHRArgs* RecordCmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer,
                                                                              VkBuffer buffer, VkDeviceSize offset,
                                                                              VkBuffer countBuffer,
                                                                              VkDeviceSize countBufferOffset,
-                                                                             uint32_t maxDrawCount, uint32_t stride);
+                                                                             uint32_t maxDrawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawIndexedIndirectCountKHRArgs>({commandBuffer, buffer, offset, countBuffer,
+                                                                 countBufferOffset, maxDrawCount, stride});
+    }
 
     CmdSetFragmentShadingRateKHRArgs* RecordCmdSetFragmentShadingRateKHR(
         VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize,
@@ -371,7 +490,9 @@ class CommandRecorder {
                                                const VkDependencyInfo* pDependencyInfo);
 
     CmdResetEvent2KHRArgs* RecordCmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
-                                                   VkPipelineStageFlags2 stageMask);
+                                                   VkPipelineStageFlags2 stageMask) {
+        return AllocTrivial<CmdResetEvent2KHRArgs>({commandBuffer, event, stageMask});
+    }
 
     CmdWaitEvents2KHRArgs* RecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount,
                                                    const VkEvent* pEvents, const VkDependencyInfo* pDependencyInfos);
@@ -380,11 +501,15 @@ class CommandRecorder {
                                                              const VkDependencyInfo* pDependencyInfo);
 
     CmdWriteTimestamp2KHRArgs* RecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage,
-                                                           VkQueryPool queryPool, uint32_t query);
+                                                           VkQueryPool queryPool, uint32_t query) {
+        return AllocTrivial<CmdWriteTimestamp2KHRArgs>({commandBuffer, stage, queryPool, query});
+    }
 
     CmdWriteBufferMarker2AMDArgs* RecordCmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer,
                                                                  VkPipelineStageFlags2 stage, VkBuffer dstBuffer,
-                                                                 VkDeviceSize dstOffset, uint32_t marker);
+                                                                 VkDeviceSize dstOffset, uint32_t marker) {
+        return AllocTrivial<CmdWriteBufferMarker2AMDArgs>({commandBuffer, stage, dstBuffer, dstOffset, marker});
+    }
 
     CmdCopyBuffer2KHRArgs* RecordCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer,
                                                    const VkCopyBufferInfo2* pCopyBufferInfo);
@@ -403,14 +528,20 @@ class CommandRecorder {
                                                        const VkResolveImageInfo2* pResolveImageInfo);
 
     CmdTraceRaysIndirect2KHRArgs* RecordCmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer,
-                                                                 VkDeviceAddress indirectDeviceAddress);
+                                                                 VkDeviceAddress indirectDeviceAddress) {
+        return AllocTrivial<CmdTraceRaysIndirect2KHRArgs>({commandBuffer, indirectDeviceAddress});
+    }
 
     CmdBindIndexBuffer2KHRArgs* RecordCmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                              VkDeviceSize offset, VkDeviceSize size,
-                                                             VkIndexType indexType);
+                                                             VkIndexType indexType) {
+        return AllocTrivial<CmdBindIndexBuffer2KHRArgs>({commandBuffer, buffer, offset, size, indexType});
+    }
 
     CmdSetLineStippleKHRArgs* RecordCmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
-                                                         uint16_t lineStipplePattern);
+                                                         uint16_t lineStipplePattern) {
+        return AllocTrivial<CmdSetLineStippleKHRArgs>({commandBuffer, lineStippleFactor, lineStipplePattern});
+    }
 
     CmdBindDescriptorSets2KHRArgs* RecordCmdBindDescriptorSets2KHR(
         VkCommandBuffer commandBuffer, const VkBindDescriptorSetsInfoKHR* pBindDescriptorSetsInfo);
@@ -435,7 +566,9 @@ class CommandRecorder {
     CmdDebugMarkerBeginEXTArgs* RecordCmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
                                                              const VkDebugMarkerMarkerInfoEXT* pMarkerInfo);
 
-    CmdDebugMarkerEndEXTArgs* RecordCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer);
+    CmdDebugMarkerEndEXTArgs* RecordCmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdDebugMarkerEndEXTArgs>({commandBuffer});
+    }
 
     CmdDebugMarkerInsertEXTArgs* RecordCmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer,
                                                                const VkDebugMarkerMarkerInfoEXT* pMarkerInfo);
@@ -458,16 +591,24 @@ class CommandRecorder {
 
     CmdBeginQueryIndexedEXTArgs* RecordCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
                                                                uint32_t query, VkQueryControlFlags flags,
-                                                               uint32_t index);
+                                                               uint32_t index) {
+        return AllocTrivial<CmdBeginQueryIndexedEXTArgs>({commandBuffer, queryPool, query, flags, index});
+    }
 
     CmdEndQueryIndexedEXTArgs* RecordCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool,
-                                                           uint32_t query, uint32_t index);
+                                                           uint32_t query, uint32_t index) {
+        return AllocTrivial<CmdEndQueryIndexedEXTArgs>({commandBuffer, queryPool, query, index});
+    }
 
     CmdDrawIndirectByteCountEXTArgs* RecordCmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer,
                                                                        uint32_t instanceCount, uint32_t firstInstance,
                                                                        VkBuffer counterBuffer,
                                                                        VkDeviceSize counterBufferOffset,
-                                                                       uint32_t counterOffset, uint32_t vertexStride);
+                                                                       uint32_t counterOffset, uint32_t vertexStride) {
+        return AllocTrivial<CmdDrawIndirectByteCountEXTArgs>({commandBuffer, instanceCount, firstInstance,
+                                                              counterBuffer, counterBufferOffset, counterOffset,
+                                                              vertexStride});
+    }
 
     CmdCuLaunchKernelNVXArgs* RecordCmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer,
                                                          const VkCuLaunchInfoNVX* pLaunchInfo);
@@ -475,18 +616,26 @@ class CommandRecorder {
     CmdDrawIndirectCountAMDArgs* RecordCmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                VkDeviceSize offset, VkBuffer countBuffer,
                                                                VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
-                                                               uint32_t stride);
+                                                               uint32_t stride) {
+        return AllocTrivial<CmdDrawIndirectCountAMDArgs>({commandBuffer, buffer, offset, countBuffer, countBufferOffset,
+                                                          maxDrawCount, stride});
+    }
 
     CmdDrawIndexedIndirectCountAMDArgs* RecordCmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer,
                                                                              VkBuffer buffer, VkDeviceSize offset,
                                                                              VkBuffer countBuffer,
                                                                              VkDeviceSize countBufferOffset,
-                                                                             uint32_t maxDrawCount, uint32_t stride);
+                                                                             uint32_t maxDrawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawIndexedIndirectCountAMDArgs>({commandBuffer, buffer, offset, countBuffer,
+                                                                 countBufferOffset, maxDrawCount, stride});
+    }
 
     CmdBeginConditionalRenderingEXTArgs* RecordCmdBeginConditionalRenderingEXT(
         VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin);
 
-    CmdEndConditionalRenderingEXTArgs* RecordCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer);
+    CmdEndConditionalRenderingEXTArgs* RecordCmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdEndConditionalRenderingEXTArgs>({commandBuffer});
+    }
 
     CmdSetViewportWScalingNVArgs* RecordCmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                                  uint32_t viewportCount,
@@ -498,22 +647,30 @@ class CommandRecorder {
                                                                    const VkRect2D* pDiscardRectangles);
 
     CmdSetDiscardRectangleEnableEXTArgs* RecordCmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer,
-                                                                               VkBool32 discardRectangleEnable);
+                                                                               VkBool32 discardRectangleEnable) {
+        return AllocTrivial<CmdSetDiscardRectangleEnableEXTArgs>({commandBuffer, discardRectangleEnable});
+    }
 
     CmdSetDiscardRectangleModeEXTArgs* RecordCmdSetDiscardRectangleModeEXT(
-        VkCommandBuffer commandBuffer, VkDiscardRectangleModeEXT discardRectangleMode);
+        VkCommandBuffer commandBuffer, VkDiscardRectangleModeEXT discardRectangleMode) {
+        return AllocTrivial<CmdSetDiscardRectangleModeEXTArgs>({commandBuffer, discardRectangleMode});
+    }
 
     CmdBeginDebugUtilsLabelEXTArgs* RecordCmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                      const VkDebugUtilsLabelEXT* pLabelInfo);
 
-    CmdEndDebugUtilsLabelEXTArgs* RecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer);
+    CmdEndDebugUtilsLabelEXTArgs* RecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdEndDebugUtilsLabelEXTArgs>({commandBuffer});
+    }
 
     CmdInsertDebugUtilsLabelEXTArgs* RecordCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                        const VkDebugUtilsLabelEXT* pLabelInfo);
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
     CmdInitializeGraphScratchMemoryAMDXArgs* RecordCmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer commandBuffer,
-                                                                                       VkDeviceAddress scratch);
+                                                                                       VkDeviceAddress scratch) {
+        return AllocTrivial<CmdInitializeGraphScratchMemoryAMDXArgs>({commandBuffer, scratch});
+    }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
@@ -529,14 +686,18 @@ class CommandRecorder {
 #ifdef VK_ENABLE_BETA_EXTENSIONS
     CmdDispatchGraphIndirectCountAMDXArgs* RecordCmdDispatchGraphIndirectCountAMDX(VkCommandBuffer commandBuffer,
                                                                                    VkDeviceAddress scratch,
-                                                                                   VkDeviceAddress countInfo);
+                                                                                   VkDeviceAddress countInfo) {
+        return AllocTrivial<CmdDispatchGraphIndirectCountAMDXArgs>({commandBuffer, scratch, countInfo});
+    }
 #endif  // VK_ENABLE_BETA_EXTENSIONS
 
     CmdSetSampleLocationsEXTArgs* RecordCmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer,
                                                                  const VkSampleLocationsInfoEXT* pSampleLocationsInfo);
 
     CmdBindShadingRateImageNVArgs* RecordCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
-                                                                   VkImageLayout imageLayout);
+                                                                   VkImageLayout imageLayout) {
+        return AllocTrivial<CmdBindShadingRateImageNVArgs>({commandBuffer, imageView, imageLayout});
+    }
 
     CmdSetViewportShadingRatePaletteNVArgs* RecordCmdSetViewportShadingRatePaletteNV(
         VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
@@ -554,7 +715,9 @@ class CommandRecorder {
     CmdCopyAccelerationStructureNVArgs* RecordCmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer,
                                                                              VkAccelerationStructureNV dst,
                                                                              VkAccelerationStructureNV src,
-                                                                             VkCopyAccelerationStructureModeKHR mode);
+                                                                             VkCopyAccelerationStructureModeKHR mode) {
+        return AllocTrivial<CmdCopyAccelerationStructureNVArgs>({commandBuffer, dst, src, mode});
+    }
 
     CmdTraceRaysNVArgs* RecordCmdTraceRaysNV(
         VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset,
@@ -562,7 +725,15 @@ class CommandRecorder {
         VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset,
         VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer,
         VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width,
-        uint32_t height, uint32_t depth);
+        uint32_t height, uint32_t depth) {
+        return AllocTrivial<CmdTraceRaysNVArgs>({commandBuffer, raygenShaderBindingTableBuffer,
+                                                 raygenShaderBindingOffset, missShaderBindingTableBuffer,
+                                                 missShaderBindingOffset, missShaderBindingStride,
+                                                 hitShaderBindingTableBuffer, hitShaderBindingOffset,
+                                                 hitShaderBindingStride, callableShaderBindingTableBuffer,
+                                                 callableShaderBindingOffset, callableShaderBindingStride, width,
+                                                 height, depth});
+    }
 
     CmdWriteAccelerationStructuresPropertiesNVArgs* RecordCmdWriteAccelerationStructuresPropertiesNV(
         VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount,
@@ -572,20 +743,29 @@ class CommandRecorder {
     CmdWriteBufferMarkerAMDArgs* RecordCmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer,
                                                                VkPipelineStageFlagBits pipelineStage,
                                                                VkBuffer dstBuffer, VkDeviceSize dstOffset,
-                                                               uint32_t marker);
+                                                               uint32_t marker) {
+        return AllocTrivial<CmdWriteBufferMarkerAMDArgs>({commandBuffer, pipelineStage, dstBuffer, dstOffset, marker});
+    }
 
     CmdDrawMeshTasksNVArgs* RecordCmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount,
-                                                     uint32_t firstTask);
+                                                     uint32_t firstTask) {
+        return AllocTrivial<CmdDrawMeshTasksNVArgs>({commandBuffer, taskCount, firstTask});
+    }
 
     CmdDrawMeshTasksIndirectNVArgs* RecordCmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                      VkDeviceSize offset, uint32_t drawCount,
-                                                                     uint32_t stride);
+                                                                     uint32_t stride) {
+        return AllocTrivial<CmdDrawMeshTasksIndirectNVArgs>({commandBuffer, buffer, offset, drawCount, stride});
+    }
 
     CmdDrawMeshTasksIndirectCountNVArgs* RecordCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer,
                                                                                VkBuffer buffer, VkDeviceSize offset,
                                                                                VkBuffer countBuffer,
                                                                                VkDeviceSize countBufferOffset,
-                                                                               uint32_t maxDrawCount, uint32_t stride);
+                                                                               uint32_t maxDrawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawMeshTasksIndirectCountNVArgs>({commandBuffer, buffer, offset, countBuffer,
+                                                                  countBufferOffset, maxDrawCount, stride});
+    }
 
     CmdSetExclusiveScissorEnableNVArgs* RecordCmdSetExclusiveScissorEnableNV(VkCommandBuffer commandBuffer,
                                                                              uint32_t firstExclusiveScissor,
@@ -609,14 +789,22 @@ class CommandRecorder {
         VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo);
 
     CmdSetLineStippleEXTArgs* RecordCmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
-                                                         uint16_t lineStipplePattern);
+                                                         uint16_t lineStipplePattern) {
+        return AllocTrivial<CmdSetLineStippleEXTArgs>({commandBuffer, lineStippleFactor, lineStipplePattern});
+    }
 
-    CmdSetCullModeEXTArgs* RecordCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode);
+    CmdSetCullModeEXTArgs* RecordCmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+        return AllocTrivial<CmdSetCullModeEXTArgs>({commandBuffer, cullMode});
+    }
 
-    CmdSetFrontFaceEXTArgs* RecordCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace);
+    CmdSetFrontFaceEXTArgs* RecordCmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+        return AllocTrivial<CmdSetFrontFaceEXTArgs>({commandBuffer, frontFace});
+    }
 
     CmdSetPrimitiveTopologyEXTArgs* RecordCmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer,
-                                                                     VkPrimitiveTopology primitiveTopology);
+                                                                     VkPrimitiveTopology primitiveTopology) {
+        return AllocTrivial<CmdSetPrimitiveTopologyEXTArgs>({commandBuffer, primitiveTopology});
+    }
 
     CmdSetViewportWithCountEXTArgs* RecordCmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer,
                                                                      uint32_t viewportCount,
@@ -632,23 +820,35 @@ class CommandRecorder {
                                                                  const VkDeviceSize* pStrides);
 
     CmdSetDepthTestEnableEXTArgs* RecordCmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer,
-                                                                 VkBool32 depthTestEnable);
+                                                                 VkBool32 depthTestEnable) {
+        return AllocTrivial<CmdSetDepthTestEnableEXTArgs>({commandBuffer, depthTestEnable});
+    }
 
     CmdSetDepthWriteEnableEXTArgs* RecordCmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer,
-                                                                   VkBool32 depthWriteEnable);
+                                                                   VkBool32 depthWriteEnable) {
+        return AllocTrivial<CmdSetDepthWriteEnableEXTArgs>({commandBuffer, depthWriteEnable});
+    }
 
     CmdSetDepthCompareOpEXTArgs* RecordCmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer,
-                                                               VkCompareOp depthCompareOp);
+                                                               VkCompareOp depthCompareOp) {
+        return AllocTrivial<CmdSetDepthCompareOpEXTArgs>({commandBuffer, depthCompareOp});
+    }
 
     CmdSetDepthBoundsTestEnableEXTArgs* RecordCmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer,
-                                                                             VkBool32 depthBoundsTestEnable);
+                                                                             VkBool32 depthBoundsTestEnable) {
+        return AllocTrivial<CmdSetDepthBoundsTestEnableEXTArgs>({commandBuffer, depthBoundsTestEnable});
+    }
 
     CmdSetStencilTestEnableEXTArgs* RecordCmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer,
-                                                                     VkBool32 stencilTestEnable);
+                                                                     VkBool32 stencilTestEnable) {
+        return AllocTrivial<CmdSetStencilTestEnableEXTArgs>({commandBuffer, stencilTestEnable});
+    }
 
     CmdSetStencilOpEXTArgs* RecordCmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                      VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp,
-                                                     VkCompareOp compareOp);
+                                                     VkCompareOp compareOp) {
+        return AllocTrivial<CmdSetStencilOpEXTArgs>({commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp});
+    }
 
     CmdPreprocessGeneratedCommandsNVArgs* RecordCmdPreprocessGeneratedCommandsNV(
         VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo);
@@ -659,7 +859,9 @@ class CommandRecorder {
 
     CmdBindPipelineShaderGroupNVArgs* RecordCmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer,
                                                                          VkPipelineBindPoint pipelineBindPoint,
-                                                                         VkPipeline pipeline, uint32_t groupIndex);
+                                                                         VkPipeline pipeline, uint32_t groupIndex) {
+        return AllocTrivial<CmdBindPipelineShaderGroupNVArgs>({commandBuffer, pipelineBindPoint, pipeline, groupIndex});
+    }
 
     CmdSetDepthBias2EXTArgs* RecordCmdSetDepthBias2EXT(VkCommandBuffer commandBuffer,
                                                        const VkDepthBiasInfoEXT* pDepthBiasInfo);
@@ -675,7 +877,10 @@ class CommandRecorder {
         uint32_t firstSet, uint32_t setCount, const uint32_t* pBufferIndices, const VkDeviceSize* pOffsets);
 
     CmdBindDescriptorBufferEmbeddedSamplersEXTArgs* RecordCmdBindDescriptorBufferEmbeddedSamplersEXT(
-        VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set);
+        VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set) {
+        return AllocTrivial<CmdBindDescriptorBufferEmbeddedSamplersEXTArgs>({commandBuffer, pipelineBindPoint, layout,
+                                                                             set});
+    }
 
     CmdSetFragmentShadingRateEnumNVArgs* RecordCmdSetFragmentShadingRateEnumNV(
         VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate,
@@ -686,25 +891,39 @@ class CommandRecorder {
         const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount,
         const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions);
 
-    CmdSubpassShadingHUAWEIArgs* RecordCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer);
+    CmdSubpassShadingHUAWEIArgs* RecordCmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
+        return AllocTrivial<CmdSubpassShadingHUAWEIArgs>({commandBuffer});
+    }
 
     CmdBindInvocationMaskHUAWEIArgs* RecordCmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer,
                                                                        VkImageView imageView,
-                                                                       VkImageLayout imageLayout);
+                                                                       VkImageLayout imageLayout) {
+        return AllocTrivial<CmdBindInvocationMaskHUAWEIArgs>({commandBuffer, imageView, imageLayout});
+    }
 
     CmdSetPatchControlPointsEXTArgs* RecordCmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer,
-                                                                       uint32_t patchControlPoints);
+                                                                       uint32_t patchControlPoints) {
+        return AllocTrivial<CmdSetPatchControlPointsEXTArgs>({commandBuffer, patchControlPoints});
+    }
 
     CmdSetRasterizerDiscardEnableEXTArgs* RecordCmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer,
-                                                                                 VkBool32 rasterizerDiscardEnable);
+                                                                                 VkBool32 rasterizerDiscardEnable) {
+        return AllocTrivial<CmdSetRasterizerDiscardEnableEXTArgs>({commandBuffer, rasterizerDiscardEnable});
+    }
 
     CmdSetDepthBiasEnableEXTArgs* RecordCmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer,
-                                                                 VkBool32 depthBiasEnable);
+                                                                 VkBool32 depthBiasEnable) {
+        return AllocTrivial<CmdSetDepthBiasEnableEXTArgs>({commandBuffer, depthBiasEnable});
+    }
 
-    CmdSetLogicOpEXTArgs* RecordCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp);
+    CmdSetLogicOpEXTArgs* RecordCmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
+        return AllocTrivial<CmdSetLogicOpEXTArgs>({commandBuffer, logicOp});
+    }
 
     CmdSetPrimitiveRestartEnableEXTArgs* RecordCmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer,
-                                                                               VkBool32 primitiveRestartEnable);
+                                                                               VkBool32 primitiveRestartEnable) {
+        return AllocTrivial<CmdSetPrimitiveRestartEnableEXTArgs>({commandBuffer, primitiveRestartEnable});
+    }
 
     CmdSetColorWriteEnableEXTArgs* RecordCmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer,
                                                                    uint32_t attachmentCount,
@@ -735,14 +954,20 @@ class CommandRecorder {
         VkQueryPool queryPool, uint32_t firstQuery);
 
     CmdDrawClusterHUAWEIArgs* RecordCmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX,
-                                                         uint32_t groupCountY, uint32_t groupCountZ);
+                                                         uint32_t groupCountY, uint32_t groupCountZ) {
+        return AllocTrivial<CmdDrawClusterHUAWEIArgs>({commandBuffer, groupCountX, groupCountY, groupCountZ});
+    }
 
     CmdDrawClusterIndirectHUAWEIArgs* RecordCmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer,
-                                                                         VkDeviceSize offset);
+                                                                         VkDeviceSize offset) {
+        return AllocTrivial<CmdDrawClusterIndirectHUAWEIArgs>({commandBuffer, buffer, offset});
+    }
 
     CmdCopyMemoryIndirectNVArgs* RecordCmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer,
                                                                VkDeviceAddress copyBufferAddress, uint32_t copyCount,
-                                                               uint32_t stride);
+                                                               uint32_t stride) {
+        return AllocTrivial<CmdCopyMemoryIndirectNVArgs>({commandBuffer, copyBufferAddress, copyCount, stride});
+    }
 
     CmdCopyMemoryToImageIndirectNVArgs* RecordCmdCopyMemoryToImageIndirectNV(
         VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride,
@@ -754,29 +979,46 @@ class CommandRecorder {
 
     CmdDecompressMemoryIndirectCountNVArgs* RecordCmdDecompressMemoryIndirectCountNV(
         VkCommandBuffer commandBuffer, VkDeviceAddress indirectCommandsAddress,
-        VkDeviceAddress indirectCommandsCountAddress, uint32_t stride);
+        VkDeviceAddress indirectCommandsCountAddress, uint32_t stride) {
+        return AllocTrivial<CmdDecompressMemoryIndirectCountNVArgs>({commandBuffer, indirectCommandsAddress,
+                                                                     indirectCommandsCountAddress, stride});
+    }
 
     CmdUpdatePipelineIndirectBufferNVArgs* RecordCmdUpdatePipelineIndirectBufferNV(
-        VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline);
+        VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+        return AllocTrivial<CmdUpdatePipelineIndirectBufferNVArgs>({commandBuffer, pipelineBindPoint, pipeline});
+    }
 
     CmdSetDepthClampEnableEXTArgs* RecordCmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer,
-                                                                   VkBool32 depthClampEnable);
+                                                                   VkBool32 depthClampEnable) {
+        return AllocTrivial<CmdSetDepthClampEnableEXTArgs>({commandBuffer, depthClampEnable});
+    }
 
-    CmdSetPolygonModeEXTArgs* RecordCmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode);
+    CmdSetPolygonModeEXTArgs* RecordCmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) {
+        return AllocTrivial<CmdSetPolygonModeEXTArgs>({commandBuffer, polygonMode});
+    }
 
     CmdSetRasterizationSamplesEXTArgs* RecordCmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer,
-                                                                           VkSampleCountFlagBits rasterizationSamples);
+                                                                           VkSampleCountFlagBits rasterizationSamples) {
+        return AllocTrivial<CmdSetRasterizationSamplesEXTArgs>({commandBuffer, rasterizationSamples});
+    }
 
     CmdSetSampleMaskEXTArgs* RecordCmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples,
                                                        const VkSampleMask* pSampleMask);
 
     CmdSetAlphaToCoverageEnableEXTArgs* RecordCmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer,
-                                                                             VkBool32 alphaToCoverageEnable);
+                                                                             VkBool32 alphaToCoverageEnable) {
+        return AllocTrivial<CmdSetAlphaToCoverageEnableEXTArgs>({commandBuffer, alphaToCoverageEnable});
+    }
 
     CmdSetAlphaToOneEnableEXTArgs* RecordCmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer,
-                                                                   VkBool32 alphaToOneEnable);
+                                                                   VkBool32 alphaToOneEnable) {
+        return AllocTrivial<CmdSetAlphaToOneEnableEXTArgs>({commandBuffer, alphaToOneEnable});
+    }
 
-    CmdSetLogicOpEnableEXTArgs* RecordCmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable);
+    CmdSetLogicOpEnableEXTArgs* RecordCmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) {
+        return AllocTrivial<CmdSetLogicOpEnableEXTArgs>({commandBuffer, logicOpEnable});
+    }
 
     CmdSetColorBlendEnableEXTArgs* RecordCmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer,
                                                                    uint32_t firstAttachment, uint32_t attachmentCount,
@@ -791,70 +1033,108 @@ class CommandRecorder {
                                                                const VkColorComponentFlags* pColorWriteMasks);
 
     CmdSetTessellationDomainOriginEXTArgs* RecordCmdSetTessellationDomainOriginEXT(
-        VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin);
+        VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin) {
+        return AllocTrivial<CmdSetTessellationDomainOriginEXTArgs>({commandBuffer, domainOrigin});
+    }
 
     CmdSetRasterizationStreamEXTArgs* RecordCmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer,
-                                                                         uint32_t rasterizationStream);
+                                                                         uint32_t rasterizationStream) {
+        return AllocTrivial<CmdSetRasterizationStreamEXTArgs>({commandBuffer, rasterizationStream});
+    }
 
     CmdSetConservativeRasterizationModeEXTArgs* RecordCmdSetConservativeRasterizationModeEXT(
-        VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode);
+        VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) {
+        return AllocTrivial<CmdSetConservativeRasterizationModeEXTArgs>({commandBuffer, conservativeRasterizationMode});
+    }
 
     CmdSetExtraPrimitiveOverestimationSizeEXTArgs* RecordCmdSetExtraPrimitiveOverestimationSizeEXT(
-        VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize);
+        VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) {
+        return AllocTrivial<CmdSetExtraPrimitiveOverestimationSizeEXTArgs>({commandBuffer,
+                                                                            extraPrimitiveOverestimationSize});
+    }
 
     CmdSetDepthClipEnableEXTArgs* RecordCmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer,
-                                                                 VkBool32 depthClipEnable);
+                                                                 VkBool32 depthClipEnable) {
+        return AllocTrivial<CmdSetDepthClipEnableEXTArgs>({commandBuffer, depthClipEnable});
+    }
 
     CmdSetSampleLocationsEnableEXTArgs* RecordCmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer,
-                                                                             VkBool32 sampleLocationsEnable);
+                                                                             VkBool32 sampleLocationsEnable) {
+        return AllocTrivial<CmdSetSampleLocationsEnableEXTArgs>({commandBuffer, sampleLocationsEnable});
+    }
 
     CmdSetColorBlendAdvancedEXTArgs* RecordCmdSetColorBlendAdvancedEXT(
         VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount,
         const VkColorBlendAdvancedEXT* pColorBlendAdvanced);
 
     CmdSetProvokingVertexModeEXTArgs* RecordCmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer,
-                                                                         VkProvokingVertexModeEXT provokingVertexMode);
+                                                                         VkProvokingVertexModeEXT provokingVertexMode) {
+        return AllocTrivial<CmdSetProvokingVertexModeEXTArgs>({commandBuffer, provokingVertexMode});
+    }
 
     CmdSetLineRasterizationModeEXTArgs* RecordCmdSetLineRasterizationModeEXT(
-        VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode);
+        VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) {
+        return AllocTrivial<CmdSetLineRasterizationModeEXTArgs>({commandBuffer, lineRasterizationMode});
+    }
 
     CmdSetLineStippleEnableEXTArgs* RecordCmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer,
-                                                                     VkBool32 stippledLineEnable);
+                                                                     VkBool32 stippledLineEnable) {
+        return AllocTrivial<CmdSetLineStippleEnableEXTArgs>({commandBuffer, stippledLineEnable});
+    }
 
     CmdSetDepthClipNegativeOneToOneEXTArgs* RecordCmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer,
-                                                                                     VkBool32 negativeOneToOne);
+                                                                                     VkBool32 negativeOneToOne) {
+        return AllocTrivial<CmdSetDepthClipNegativeOneToOneEXTArgs>({commandBuffer, negativeOneToOne});
+    }
 
     CmdSetViewportWScalingEnableNVArgs* RecordCmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer,
-                                                                             VkBool32 viewportWScalingEnable);
+                                                                             VkBool32 viewportWScalingEnable) {
+        return AllocTrivial<CmdSetViewportWScalingEnableNVArgs>({commandBuffer, viewportWScalingEnable});
+    }
 
     CmdSetViewportSwizzleNVArgs* RecordCmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport,
                                                                uint32_t viewportCount,
                                                                const VkViewportSwizzleNV* pViewportSwizzles);
 
     CmdSetCoverageToColorEnableNVArgs* RecordCmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer,
-                                                                           VkBool32 coverageToColorEnable);
+                                                                           VkBool32 coverageToColorEnable) {
+        return AllocTrivial<CmdSetCoverageToColorEnableNVArgs>({commandBuffer, coverageToColorEnable});
+    }
 
     CmdSetCoverageToColorLocationNVArgs* RecordCmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer,
-                                                                               uint32_t coverageToColorLocation);
+                                                                               uint32_t coverageToColorLocation) {
+        return AllocTrivial<CmdSetCoverageToColorLocationNVArgs>({commandBuffer, coverageToColorLocation});
+    }
 
     CmdSetCoverageModulationModeNVArgs* RecordCmdSetCoverageModulationModeNV(
-        VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode);
+        VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) {
+        return AllocTrivial<CmdSetCoverageModulationModeNVArgs>({commandBuffer, coverageModulationMode});
+    }
 
     CmdSetCoverageModulationTableEnableNVArgs* RecordCmdSetCoverageModulationTableEnableNV(
-        VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable);
+        VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) {
+        return AllocTrivial<CmdSetCoverageModulationTableEnableNVArgs>({commandBuffer, coverageModulationTableEnable});
+    }
 
     CmdSetCoverageModulationTableNVArgs* RecordCmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer,
                                                                                uint32_t coverageModulationTableCount,
                                                                                const float* pCoverageModulationTable);
 
     CmdSetShadingRateImageEnableNVArgs* RecordCmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer,
-                                                                             VkBool32 shadingRateImageEnable);
+                                                                             VkBool32 shadingRateImageEnable) {
+        return AllocTrivial<CmdSetShadingRateImageEnableNVArgs>({commandBuffer, shadingRateImageEnable});
+    }
 
     CmdSetRepresentativeFragmentTestEnableNVArgs* RecordCmdSetRepresentativeFragmentTestEnableNV(
-        VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable);
+        VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) {
+        return AllocTrivial<CmdSetRepresentativeFragmentTestEnableNVArgs>({commandBuffer,
+                                                                           representativeFragmentTestEnable});
+    }
 
     CmdSetCoverageReductionModeNVArgs* RecordCmdSetCoverageReductionModeNV(
-        VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode);
+        VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) {
+        return AllocTrivial<CmdSetCoverageReductionModeNVArgs>({commandBuffer, coverageReductionMode});
+    }
 
     CmdOpticalFlowExecuteNVArgs* RecordCmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer,
                                                                VkOpticalFlowSessionNV session,
@@ -864,7 +1144,9 @@ class CommandRecorder {
                                                    const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders);
 
     CmdSetAttachmentFeedbackLoopEnableEXTArgs* RecordCmdSetAttachmentFeedbackLoopEnableEXT(
-        VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask);
+        VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) {
+        return AllocTrivial<CmdSetAttachmentFeedbackLoopEnableEXTArgs>({commandBuffer, aspectMask});
+    }
 
     CmdBuildAccelerationStructuresKHRArgs* RecordCmdBuildAccelerationStructuresKHR(
         VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
@@ -903,24 +1185,40 @@ class CommandRecorder {
         const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress);
 
     CmdSetRayTracingPipelineStackSizeKHRArgs* RecordCmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer,
-                                                                                         uint32_t pipelineStackSize);
+                                                                                         uint32_t pipelineStackSize) {
+        return AllocTrivial<CmdSetRayTracingPipelineStackSizeKHRArgs>({commandBuffer, pipelineStackSize});
+    }
 
     CmdDrawMeshTasksEXTArgs* RecordCmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX,
-                                                       uint32_t groupCountY, uint32_t groupCountZ);
+                                                       uint32_t groupCountY, uint32_t groupCountZ) {
+        return AllocTrivial<CmdDrawMeshTasksEXTArgs>({commandBuffer, groupCountX, groupCountY, groupCountZ});
+    }
 
     CmdDrawMeshTasksIndirectEXTArgs* RecordCmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer,
                                                                        VkDeviceSize offset, uint32_t drawCount,
-                                                                       uint32_t stride);
+                                                                       uint32_t stride) {
+        return AllocTrivial<CmdDrawMeshTasksIndirectEXTArgs>({commandBuffer, buffer, offset, drawCount, stride});
+    }
 
     CmdDrawMeshTasksIndirectCountEXTArgs* RecordCmdDrawMeshTasksIndirectCountEXT(
         VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
-        VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride);
+        VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+        return AllocTrivial<CmdDrawMeshTasksIndirectCountEXTArgs>({commandBuffer, buffer, offset, countBuffer,
+                                                                   countBufferOffset, maxDrawCount, stride});
+    }
 
    private:
     template <typename T>
     T* Alloc() {
         return new (m_allocator.Alloc(sizeof(T))) T;
     }
+    // Commands whose arguments are all scalars or handles are recorded inline
+    // with a single copy of the aggregate argument pack.
+    template <typename T>
+    T* AllocTrivial(const T& src) {
+        static_assert(std::is_trivially_copyable<T>::value, "Trivial commands must have POD argument packs");
+        return new (m_allocator.Alloc(sizeof(T))) T(src);
+    }
     template <typename T>
     T* CopyArray(const T* src, size_t start_index, size_t count) {
         auto ptr = reinterpret_cast<T*>(m_allocator.Alloc(sizeof(T) * count));
@@ -25,6 +25,7 @@
 
 // NOLINTBEGIN
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -32,13 +33,16 @@
 
 #include "command_common.h"
 #include "command_recorder.h"
+#include "command_store.h"
 
 class CommandTracker {
    public:
+    explicit CommandTracker(std::shared_ptr<LinearAllocatorBlockCache> block_cache = nullptr)
+        : recorder_(std::move(block_cache)) {}
     void Reset();
 
-    const std::vector<Command>& GetCommands() const { return commands_; }
-    std::vector<Command>& GetCommands() { return commands_; }
+    const CommandStore& GetCommands() const { return commands_; }
+    void SetInstrumented(uint32_t command_id) { commands_.SetInstrumented(command_id - 1); }
 
     void BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo);
 
@@ -750,9 +754,9 @@ class CommandTracker {
                                           uint32_t stride);
 
    private:
-    std::vector<Command> commands_;
+    CommandStore commands_;
     CommandRecorder recorder_;
-    std::vector<std::string> labels_;
+    const CommandLabel* labels_{nullptr};
 };
 
 // NOLINTEND
@@ -30,6 +30,7 @@
 #include <vulkan/vk_layer.h>
 #include <vulkan/vulkan.h>
 
+#include "concurrent_pointer_map.h"
 #include "layer_base.h"
 
 namespace crash_diagnostic_layer {
@@ -50,50 +51,49 @@ constexpr VkPhysicalDeviceToolPropertiesEXT kToolProperties{
 
 namespace {
 
-// Generally we expect to get the same device and instance, so we keep them handy
-static thread_local InstanceData* last_used_instance_data = nullptr;
-static thread_local DeviceData* last_used_device_data = nullptr;
+// Instances and devices are few and long lived, so the owning maps are only
+// touched on create/destroy. Every intercepted call resolves its dispatch data
+// through the lock free indexes.
+constexpr size_t kDispatchIndexCapacity = 16;
 
 std::mutex g_instance_mutex;
 std::unordered_map<uintptr_t, std::unique_ptr<InstanceData>> g_instance_data;
+ConcurrentPointerMap<InstanceData> g_instance_index(kDispatchIndexCapacity);
 
 std::mutex g_device_mutex;
 std::unordered_map<uintptr_t, std::unique_ptr<DeviceData>> g_device_data;
+ConcurrentPointerMap<DeviceData> g_device_index(kDispatchIndexCapacity);
 
 }  // namespace
 
 uintptr_t DataKey(const void* object) { return (uintptr_t)(*(void**)object); }
 
-InstanceData* GetInstanceLayerData(uintptr_t key) {
-    if (last_used_instance_data && DataKey(last_used_instance_data->instance) == key) {
-        return last_used_instance_data;
-    }
+InstanceData* GetInstanceLayerData(uintptr_t key) { return g_instance_index.Find(key); }
 
+static void SetInstanceLayerData(uintptr_t key, std::unique_ptr<InstanceData> data) {
     std::lock_guard<std::mutex> lock(g_instance_mutex);
-    last_used_instance_data = g_instance_data[key].get();
-    return last_used_instance_data;
+    g_instance_index.Insert(key, data.get());
+    g_instance_data[key] = std::move(data);
 }
 
 void FreeInstanceLayerData(uintptr_t key) {
     std::lock_guard<std::mutex> lock(g_instance_mutex);
+    g_instance_index.Erase(key);
     g_instance_data.erase(key);
-    last_used_instance_data = nullptr;
 }
 
-DeviceData* GetDeviceLayerData(uintptr_t key) {
-    if (last_used_device_data && DataKey(last_used_device_data->device) == key) {
-        return last_used_device_data;
-    }
+DeviceData* GetDeviceLayerData(uintptr_t key) { return g_device_index.Find(key); }
 
+static void SetDeviceLayerData(uintptr_t key, std::unique_ptr<DeviceData> data) {
     std::lock_guard<std::mutex> lock(g_device_mutex);
-    last_used_device_data = g_device_data[key].get();
-    return last_used_device_data;
+    g_device_index.Insert(key, data.get());
+    g_device_data[key] = std::move(data);
 }
 
 void FreeDeviceLayerData(uintptr_t key) {
     std::lock_guard<std::mutex> lock(g_device_mutex);
+    g_device_index.Erase(key);
     g_device_data.erase(key);
-    last_used_device_data = nullptr;
 }
 
 static VkStruct* FindOnChain(VkStruct* s, VkStructureType type) {
@@ -204,10 +204,7 @@ VKAPI_ATTR VkResult VKAPI_CALL InterceptCreateInstance(const VkInstanceCreateInf
     id->pfn_next_instance_proc_addr = pfn_get_instance_proc_addr;
     InitInstanceDispatchTable(*pInstance, pfn_get_instance_proc_addr, &id->dispatch_table);
 
-    {
-        std::lock_guard<std::mutex> lock(g_instance_mutex);
-        g_instance_data[DataKey(*pInstance)] = std::move(id);
-    }
+    SetInstanceLayerData(DataKey(*pInstance), std::move(id));
 
     result = interceptor->PostCreateInstance(pFinalCreateInfo, pAllocator, pInstance, result);
 
@@ -256,10 +253,7 @@ VKAPI_ATTR VkResult VKAPI_CALL InterceptCreateDevice(VkPhysicalDevice gpu, const
     dd->pfn_set_device_loader_data = chain_info->u.pfnSetDeviceLoaderData;
     dd->pfn_next_device_proc_addr = pfn_next_device_proc_addr;
     InitDeviceDispatchTable(*pDevice, pfn_next_device_proc_addr, &dd->dispatch_table);
-    {
-        std::lock_guard<std::mutex> lock(g_device_mutex);
-        g_device_data[DataKey(*pDevice)] = std::move(dd);
-    }
+    SetDeviceLayerData(DataKey(*pDevice), std::move(dd));
 
     result = instance_data->interceptor->PostCreateDevice(gpu, pFinalCreateInfo, pAllocator, pDevice, result);
 
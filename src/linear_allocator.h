@@ -17,14 +17,101 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <vector>
 
+//
+// LinearAllocatorBlockCache is a thread safe free list of default sized
+// LinearAllocator blocks. Allocators sharing a cache borrow blocks from it and
+// return them when they are reset or destroyed, so short lived allocators do
+// not churn the heap.
+//
+// The cache remembers the peak number of blocks in use over the last
+// kTrimWindow to 2 * kTrimWindow calls to Trim(), and Trim() frees the cached
+// blocks that this peak could not have used. Trim() is called on every pool
+// reset, so with several pools per frame a single reset says little about how
+// many blocks a frame needs. Keeping the peak over a window of resets stops
+// the cache from freeing and reallocating blocks every frame.
+//
+class LinearAllocatorBlockCache {
+   public:
+    explicit LinearAllocatorBlockCache(size_t block_size) : block_size_(block_size) {}
+    LinearAllocatorBlockCache(const LinearAllocatorBlockCache&) = delete;
+    LinearAllocatorBlockCache& operator=(const LinearAllocatorBlockCache&) = delete;
+
+    ~LinearAllocatorBlockCache() {
+        for (auto* block : free_blocks_) {
+            delete[] block;
+        }
+    }
+
+    size_t GetBlockSize() const { return block_size_; }
+
+    char* Acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++in_use_;
+            window_peak_ = std::max(window_peak_, in_use_);
+            if (!free_blocks_.empty()) {
+                char* block = free_blocks_.back();
+                free_blocks_.pop_back();
+                return block;
+            }
+        }
+        return new char[block_size_];
+    }
+
+    void Release(char* block) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        assert(in_use_ > 0);
+        --in_use_;
+        free_blocks_.push_back(block);
+    }
+
+    void Trim() {
+        std::vector<char*> trimmed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t keep = std::max(window_peak_, previous_window_peak_) - in_use_;
+            while (free_blocks_.size() > keep) {
+                trimmed.push_back(free_blocks_.back());
+                free_blocks_.pop_back();
+            }
+            if (++trims_ % kTrimWindow == 0) {
+                previous_window_peak_ = window_peak_;
+                window_peak_ = in_use_;
+            }
+        }
+        for (auto* block : trimmed) {
+            delete[] block;
+        }
+    }
+
+    size_t NumCachedBlocks() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return free_blocks_.size();
+    }
+
+    static constexpr size_t kTrimWindow = 16;
+
+   private:
+    const size_t block_size_;
+    mutable std::mutex mutex_;
+    std::vector<char*> free_blocks_;
+    size_t in_use_{0};
+    // Peak blocks in use in the current and previous window of Trim() calls.
+    size_t window_peak_{0};
+    size_t previous_window_peak_{0};
+    size_t trims_{0};
+};
+
 //
 // LinearAllocator is a block based linear allocator for fast allocation of
 // simple data structures.
@@ -39,12 +126,19 @@
 //
 // Destructors will not be called when Reset.
 //
+// When constructed with a LinearAllocatorBlockCache, default sized blocks are
+// borrowed from the cache and all but the first are returned on Reset.
+//
 template <size_t kDefaultBlockSize = 1024 * 32, size_t kAlignment = 8>
 class LinearAllocator {
     static_assert(kAlignment > 0 && 0 == (kAlignment & (kAlignment - 1)), "Power of 2 required");
 
    public:
-    LinearAllocator() : active_block_(0) { blocks_.push_back(std::make_unique<Block>(kDefaultBlockSize)); }
+    explicit LinearAllocator(std::shared_ptr<LinearAllocatorBlockCache> cache = nullptr)
+        : active_block_(0), cache_(std::move(cache)) {
+        assert(!cache_ || cache_->GetBlockSize() == kDefaultBlockSize);
+        blocks_.push_back(std::make_unique<Block>(kDefaultBlockSize, cache_.get()));
+    }
 
     void* Alloc(const size_t size) {
         assert(blocks_.size() > 0);
@@ -61,7 +155,7 @@ class LinearAllocator {
             // No free blocks, allocate a new one.
             if (active_block_ == blocks_.size() - 1) {
                 auto new_block_size = std::max(size + kAlignment, kDefaultBlockSize);
-                blocks_.push_back(std::make_unique<Block>(new_block_size));
+                blocks_.push_back(std::make_unique<Block>(new_block_size, cache_.get()));
             }
 
             active_block_++;
@@ -73,6 +167,10 @@ class LinearAllocator {
     }
 
     void Reset() {
+        if (cache_) {
+            // Give the spare blocks back so other allocators sharing the cache can use them.
+            blocks_.resize(1);
+        }
         for (auto& block : blocks_) {
             block->Reset();
         }
@@ -81,19 +179,27 @@ class LinearAllocator {
     }
 
     size_t NumBlocksAllocated() const { return blocks_.size(); }
-    size_t GetDefaultBlockSize() const { return kDefaultBlockSize; }
+    static size_t GetDefaultBlockSize() { return kDefaultBlockSize; }
 
    private:
     class Block {
        public:
-        Block(size_t blocksize) {
+        Block(size_t blocksize, LinearAllocatorBlockCache* cache) {
             blocksize_ = blocksize;
+            // Only default sized blocks can be shared through the cache.
+            cache_ = (cache && cache->GetBlockSize() == blocksize_) ? cache : nullptr;
             std::set_new_handler(NewHandler);
-            data_ = new char[blocksize_];
+            data_ = cache_ ? cache_->Acquire() : new char[blocksize_];
             Reset();
         }
 
-        ~Block() { delete[] data_; }
+        ~Block() {
+            if (cache_) {
+                cache_->Release(data_);
+            } else {
+                delete[] data_;
+            }
+        }
 
         void* Alloc(const size_t size) {
             uintptr_t h = (uintptr_t)head_;
@@ -119,9 +225,12 @@ class LinearAllocator {
         size_t blocksize_;
         char* head_;
         char* data_;
+        LinearAllocatorBlockCache* cache_;
     };
 
    private:
     unsigned int active_block_;
+    // Declared before blocks_ so the cache outlives the blocks borrowed from it.
+    std::shared_ptr<LinearAllocatorBlockCache> cache_;
     std::vector<std::unique_ptr<Block>> blocks_;
 };
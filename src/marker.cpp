@@ -22,17 +22,26 @@
 
 namespace crash_diagnostic_layer {
 
-struct MarkerData {
-    VkBuffer buffer = VK_NULL_HANDLE;
-    uint32_t offset = 0;
-    void* cpu_mapped_address = nullptr;
-};
-
-BufferMarkerMgr::BufferMarkerMgr(Device& device) : device_(device) {
+BufferMarkerMgr::BufferMarkerMgr(Device& device)
+    : device_(device), reserve_target_(device.GetContext().GetSettings().marker_buffer_reserve) {
     device_.GetContext().Dispatch().GetPhysicalDeviceMemoryProperties(device_.GetVkGpu(), &memory_properties_);
+    if (reserve_target_ > 0) {
+        // Fill the reserve right away so the first recordings don't pay for it.
+        refill_requested_ = true;
+        refill_thread_ = std::thread([this]() { RefillThread(); });
+    }
 }
 
 BufferMarkerMgr::~BufferMarkerMgr() {
+    if (refill_thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(marker_buffers_mutex_);
+            stop_refill_ = true;
+        }
+        refill_cv_.notify_one();
+        refill_thread_.join();
+    }
+
     VkDevice device = device_.GetVkDevice();
     const auto& dt = device_.Dispatch();
 
@@ -41,6 +50,10 @@ BufferMarkerMgr::~BufferMarkerMgr() {
         dt.DestroyBuffer(device, marker_buffer.buffer, nullptr);
     }
     marker_buffers_.clear();
+    for (auto& marker_buffer : spare_buffers_) {
+        dt.DestroyBuffer(device, marker_buffer.buffer, nullptr);
+    }
+    spare_buffers_.clear();
     if (marker_buffers_heap_ != VK_NULL_HANDLE) {
         device_.Log().Verbose("Destroy Marker memory %llx", marker_buffers_heap_);
         dt.FreeMemory(device, marker_buffers_heap_, nullptr);
@@ -74,9 +87,6 @@ VkResult BufferMarkerMgr::CreateHostBuffer(VkDeviceSize buffer_size, VkBuffer* p
 
     assert(p_buffer != nullptr);
     buffer_size = std::max<VkDeviceSize>(buffer_size, 256);
-    if (heap_offset + buffer_size >= kBuffermarkerHeapSize) {
-        return VK_ERROR_INITIALIZATION_FAILED;
-    }
 
     VkBufferCreateInfo create_info = {};
     create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -144,18 +154,29 @@ VkResult BufferMarkerMgr::CreateHostBuffer(VkDeviceSize buffer_size, VkBuffer* p
     return VK_SUCCESS;
 }
 
-VkResult BufferMarkerMgr::AcquireMarkerBuffer() {
+VkResult BufferMarkerMgr::CreateMarkerBuffer(MarkerBuffer& marker_buffer) {
     const auto& dt = device_.Dispatch();
-    // No need to lock on marker_buffers_mutex_, already locked on callsite.
-    MarkerBuffer marker_buffer = {};
+    std::lock_guard<std::mutex> lock(heap_mutex_);
+    if (heap_exhausted_) {
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    if (current_heap_offset_ + kBufferMarkerBufferSize > kBuffermarkerHeapSize) {
+        // Hard cap: don't keep calling into the driver for every allocation.
+        heap_exhausted_ = true;
+        device_.Log().Warning(
+            "Marker heap exhausted after %llu marker buffers. New command buffers and semaphores will not be tracked.",
+            current_heap_offset_ / kBufferMarkerBufferSize);
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    marker_buffer = {};
     marker_buffer.size = kBufferMarkerBufferSize;
     marker_buffer.heap_offset = current_heap_offset_;
-    current_heap_offset_ += kBufferMarkerBufferSize;
 
     VkResult vk_res = CreateHostBuffer(marker_buffer.size, &marker_buffer.buffer, marker_buffer.heap_offset);
     if (vk_res != VK_SUCCESS) {
         return vk_res;
     }
+    current_heap_offset_ += kBufferMarkerBufferSize;
     VkDevice device = device_.GetVkDevice();
     if (marker_buffers_heap_mapped_base_ == nullptr) {
         vk_res =
@@ -168,36 +189,79 @@ VkResult BufferMarkerMgr::AcquireMarkerBuffer() {
         }
     }
     marker_buffer.cpu_mapped_address = (void*)((uintptr_t)marker_buffers_heap_mapped_base_ + marker_buffer.heap_offset);
+    return VK_SUCCESS;
+}
+
+VkResult BufferMarkerMgr::AcquireMarkerBuffer() {
+    // No need to lock on marker_buffers_mutex_, already locked on callsite.
+    MarkerBuffer marker_buffer;
+    if (!spare_buffers_.empty()) {
+        marker_buffer = spare_buffers_.back();
+        spare_buffers_.pop_back();
+    } else {
+        // The reserve ran dry, or there is none: create the buffer here.
+        VkResult vk_res = CreateMarkerBuffer(marker_buffer);
+        if (vk_res != VK_SUCCESS) {
+            return vk_res;
+        }
+    }
     marker_buffers_.push_back(marker_buffer);
+
+    if (reserve_target_ > 0 && spare_buffers_.size() <= reserve_target_ / 2 && !refill_requested_) {
+        refill_requested_ = true;
+        refill_cv_.notify_one();
+    }
     return VK_SUCCESS;
 }
 
+void BufferMarkerMgr::RefillThread() {
+    std::unique_lock<std::mutex> lock(marker_buffers_mutex_);
+    while (true) {
+        refill_cv_.wait(lock, [this]() { return refill_requested_ || stop_refill_; });
+        if (stop_refill_) {
+            return;
+        }
+        while (!stop_refill_ && spare_buffers_.size() < reserve_target_) {
+            // Create the buffer without blocking the recording threads.
+            lock.unlock();
+            MarkerBuffer marker_buffer;
+            VkResult vk_res = CreateMarkerBuffer(marker_buffer);
+            lock.lock();
+            if (vk_res != VK_SUCCESS) {
+                break;
+            }
+            spare_buffers_.push_back(marker_buffer);
+        }
+        refill_requested_ = false;
+    }
+}
+
 MarkerDataPtr BufferMarkerMgr::AllocateData(uint32_t num_words) {
-    assert(num_words == 1 || num_words == 2);
+    assert(num_words > 0 && num_words <= kBufferMarkerEventCount);
     std::lock_guard<std::mutex> mlock(marker_buffers_mutex_);
-    // Check if we have the required marker already allocated
-    auto marker_buffer_index = (current_marker_index_ + (num_words - 1)) / kBufferMarkerEventCount;
-
-    // Out of space, allocate a new buffer
-    if (marker_buffer_index >= marker_buffers_.size()) {
-        // This causes a glitch if CDL is on while a user plays
-        // the game. If CDL goes to be activated for end users, this should be
-        // done out of markers_buffers_mutex_ lock in a predictive mode.
+    uint32_t first_index = current_marker_index_;
+    if (num_words > 1) {
+        // Keep multi word ranges 8 byte aligned
+        first_index = (first_index + 1u) & ~1u;
+    }
+    // Ranges never straddle two marker buffers
+    if (first_index / kBufferMarkerEventCount != (first_index + num_words - 1) / kBufferMarkerEventCount) {
+        first_index = static_cast<uint32_t>((first_index / kBufferMarkerEventCount + 1) * kBufferMarkerEventCount);
+    }
+    auto marker_buffer_index = first_index / kBufferMarkerEventCount;
+
+    // Out of space, take a spare buffer or allocate a new one
+    while (marker_buffer_index >= marker_buffers_.size()) {
         if (AcquireMarkerBuffer() != VK_SUCCESS) {
             return nullptr;
         }
-        assert(marker_buffer_index < marker_buffers_.size());
-        if (num_words == 2) {
-            // Make sure current_marker_index_ is even
-            current_marker_index_ = ((current_marker_index_ + 1u) & ~3u);
-        }
     }
-    auto& marker_buffer = marker_buffers_.back();
+    auto& marker_buffer = marker_buffers_[marker_buffer_index];
     auto data = std::make_unique<MarkerData>();
     data->buffer = marker_buffer.buffer;
-    data->offset = (current_marker_index_ % kBufferMarkerEventCount) * sizeof(uint32_t);
+    data->offset = (first_index % kBufferMarkerEventCount) * sizeof(uint32_t);
     data->cpu_mapped_address = (void*)((uintptr_t)marker_buffer.cpu_mapped_address + data->offset);
-    current_marker_index_ += num_words;
+    current_marker_index_ = first_index + num_words;
     return data;
 }
 
@@ -17,8 +17,12 @@
 
 #pragma once
 
-#include <memory>
+#include <condition_variable>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
@@ -28,7 +32,13 @@ namespace crash_diagnostic_layer {
 class BufferMarkerMgr;
 class Device;
 struct DeviceDispatchTable;
-struct MarkerData;
+
+// Location of a range of 32 bit words in a marker buffer.
+struct MarkerData {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    uint32_t offset = 0;
+    void *cpu_mapped_address = nullptr;
+};
 
 using MarkerDataPtr = std::unique_ptr<MarkerData>;
 
@@ -73,6 +83,22 @@ class Marker64 {
     MarkerDataPtr data_;
 };
 
+//
+// BufferMarkerMgr hands out marker words from 4 KiB marker buffers, all bound
+// to a single host visible heap.
+//
+// Creating a marker buffer is a trip through the driver. With the
+// marker_buffer_reserve setting, a background thread keeps that many spare
+// buffers ready and tops them up whenever half of them have been used, so
+// recording threads normally only pop a spare. Without it, buffers are
+// created on demand by the allocating thread. A device has one manager,
+// shared by its checkpoints and its semaphore tracker, so it never runs more
+// than one refill thread.
+//
+// The heap is never grown. Once it is full the manager stops trying, logs
+// one warning and fails further allocations; callers then leave the object
+// they wanted to track untracked.
+//
 class BufferMarkerMgr {
    public:
     BufferMarkerMgr(Device &);
@@ -88,15 +114,15 @@ class BufferMarkerMgr {
 
     const DeviceDispatchTable &Dispatch();
 
+    // Reserves num_words contiguous 32 bit words in a single marker buffer.
+    // Multi word ranges start on an 8 byte boundary. Returns nullptr when no
+    // marker buffer could be acquired.
+    MarkerDataPtr AllocateData(uint32_t num_words);
+
    private:
     static constexpr VkDeviceSize kBufferMarkerBufferSize = kBufferMarkerEventCount * sizeof(uint32_t);
     static constexpr VkDeviceSize kBuffermarkerHeapSize = 64 * 1024 * 1024;
 
-    VkResult AcquireMarkerBuffer();
-    VkResult CreateHostBuffer(VkDeviceSize buffer_size, VkBuffer *p_buffer, VkDeviceSize heap_offset);
-
-    MarkerDataPtr AllocateData(uint32_t num_words);
-
     struct MarkerBuffer {
         VkDeviceSize size{0};
         VkBuffer buffer{VK_NULL_HANDLE};
@@ -104,6 +130,11 @@ class BufferMarkerMgr {
         VkDeviceSize heap_offset{0};
     };
 
+    VkResult AcquireMarkerBuffer();
+    VkResult CreateMarkerBuffer(MarkerBuffer &marker_buffer);
+    VkResult CreateHostBuffer(VkDeviceSize buffer_size, VkBuffer *p_buffer, VkDeviceSize heap_offset);
+    void RefillThread();
+
     Device &device_;
 
     std::mutex recycled_markers_u32_mutex_;
@@ -116,9 +147,22 @@ class BufferMarkerMgr {
     std::vector<MarkerBuffer> marker_buffers_;
     uint32_t current_marker_index_{0};
 
+    // Pre-created buffers, guarded by marker_buffers_mutex_.
+    const uint32_t reserve_target_;
+    std::vector<MarkerBuffer> spare_buffers_;
+    std::condition_variable refill_cv_;
+    bool refill_requested_{false};
+    bool stop_refill_{false};
+    std::thread refill_thread_;
+
+    // Guards the heap, which both the recording threads and the refill
+    // thread create buffers in. May be taken while marker_buffers_mutex_ is
+    // held, never the other way around.
+    std::mutex heap_mutex_;
     VkDeviceMemory marker_buffers_heap_{VK_NULL_HANDLE};
     void *marker_buffers_heap_mapped_base_{nullptr};
     VkDeviceSize current_heap_offset_{0};
+    bool heap_exhausted_{false};
     VkPhysicalDeviceMemoryProperties memory_properties_{};
 };
 
@@ -18,8 +18,8 @@
 #include "object_name_db.h"
 
 #include <algorithm>
-#include <iomanip>
-#include <sstream>
+#include <cassert>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -27,50 +27,209 @@
 
 ObjectInfoDB::ObjectInfoDB() {}
 
+ObjectInfoDB::~ObjectInfoDB() {}
+
+ObjectInfoDB::ObjectShard& ObjectInfoDB::GetObjectShard(uint64_t handle) const {
+    // Handles are pointers or aligned values, mix the bits so the low ones are useful.
+    uint64_t h = handle;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return object_shards_[static_cast<size_t>(h % kShardCount)];
+}
+
+ObjectInfoDB::NameShard& ObjectInfoDB::GetNameShard(std::string_view name) {
+    return name_shards_[std::hash<std::string_view>{}(name) % kShardCount];
+}
+
+ObjectInfoDB::InternedName* ObjectInfoDB::InternName(std::string_view name) {
+    auto& shard = GetNameShard(name);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.names.find(name);
+    if (it == shard.names.end()) {
+        auto interned = std::make_unique<InternedName>();
+        interned->str = name;
+        std::string_view key = interned->str;
+        it = shard.names.emplace(key, std::move(interned)).first;
+    }
+    ++it->second->refs;
+    return it->second.get();
+}
+
+void ObjectInfoDB::ReleaseName(InternedName* name) {
+    if (!name) {
+        return;
+    }
+    auto& shard = GetNameShard(name->str);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    assert(name->refs > 0);
+    if (--name->refs == 0) {
+        shard.names.erase(shard.names.find(name->str));
+    }
+}
+
 void ObjectInfoDB::AddObjectInfo(uint64_t handle, VkObjectType type, const char* name) {
-    ObjectInfoPtr info = std::make_unique<ObjectInfo>(handle, type, name);
-    std::lock_guard<std::mutex> lock(lock_);
-    object_info_[handle] = std::move(info);
+    if (!name || !name[0]) {
+        RemoveObjectInfo(handle);
+        return;
+    }
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& entry = shard.objects[handle];
+    entry.type = type;
+    if (entry.name && entry.name->str == name) {
+        return;
+    }
+    ReleaseName(entry.name);
+    entry.name = InternName(name);
 }
 
 void ObjectInfoDB::AddExtraInfo(uint64_t handle, ExtraObjectInfo info) {
-    std::lock_guard<std::mutex> lock(lock_);
-    object_extra_info_[handle].push_back(info);
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.objects[handle].extra_info.push_back(std::move(info));
+}
+
+void ObjectInfoDB::RemoveObjectInfo(uint64_t handle) {
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.objects.find(handle);
+    if (it == shard.objects.end()) {
+        return;
+    }
+    ReleaseName(it->second.name);
+    shard.objects.erase(it);
+}
+
+std::string_view ObjectInfoDB::FindNameLocked(const ObjectShard& shard, uint64_t handle) const {
+    auto it = shard.objects.find(handle);
+    if (it == shard.objects.end() || !it->second.name) {
+        return {};
+    }
+    return it->second.name->str;
 }
 
 ObjectInfo ObjectInfoDB::FindObjectInfo(uint64_t handle) const {
-    std::lock_guard<std::mutex> lock(lock_);
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.objects.find(handle);
+    if (it == shard.objects.end()) {
+        return ObjectInfo(handle, VK_OBJECT_TYPE_UNKNOWN, {});
+    }
+    return ObjectInfo(handle, it->second.type, FindNameLocked(shard, handle));
+}
 
-    auto handle_info = object_info_.find(handle);
-    if (end(object_info_) != handle_info) {
-        return *handle_info->second.get();
+size_t ObjectInfoDB::Size() const {
+    size_t size = 0;
+    for (const auto& shard : object_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.objects.size();
     }
-    auto result = unknown_object_;
-    result.object = handle;
-    return result;
+    return size;
 }
 
+// The name lookups below keep the shard locked until the name is copied into
+// the result, another thread may be destroying the object.
+
 std::string ObjectInfoDB::GetObjectName(uint64_t handle, HandleDebugNamePreference handle_debug_name_preference) const {
-    auto info = FindObjectInfo(handle);
+    std::string object_name;
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto name = FindNameLocked(shard, handle);
     if (handle_debug_name_preference == kPreferDebugName) {
-        if (!info.name.empty()) {
-            return info.name;
+        if (!name.empty()) {
+            return std::string(name);
         }
         return crash_diagnostic_layer::Uint64ToStr(handle);
     }
-    std::stringstream object_name;
-    if (!info.name.empty()) {
-        object_name << info.name << " ";
+    if (!name.empty()) {
+        object_name.append(name);
+        object_name.append(" ");
     }
-    object_name << "(" << crash_diagnostic_layer::Uint64ToStr(handle) << ")";
-    return object_name.str();
+    object_name.append("(");
+    object_name.append(crash_diagnostic_layer::Uint64ToStr(handle));
+    object_name.append(")");
+    return object_name;
 }
 
 std::string ObjectInfoDB::GetObjectInfo(uint64_t handle) const {
     // TODO cleanup so all object are tracked and debug object names only
     // enhance object names
-    std::stringstream info_ss;
-    auto info = FindObjectInfo(handle);
-    info_ss << crash_diagnostic_layer::Uint64ToStr(handle) << "[" << info.name << "]";
-    return info_ss.str();
+    std::string info = crash_diagnostic_layer::Uint64ToStr(handle);
+    auto& shard = GetObjectShard(handle);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    info.append("[");
+    info.append(FindNameLocked(shard, handle));
+    info.append("]");
+    return info;
+}
+
+ObjectInfoSnapshot ObjectInfoDB::Snapshot() {
+    ObjectInfoSnapshot snapshot;
+    snapshot.db_ = this;
+    for (auto& shard : object_shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        snapshot.entries_.reserve(snapshot.entries_.size() + shard.objects.size());
+        for (const auto& it : shard.objects) {
+            if (it.second.name) {
+                // The entry keeps the name alive while the shard is locked.
+                ++it.second.name->refs;
+                snapshot.entries_.push_back({it.first, it.second.name});
+            }
+        }
+    }
+    std::sort(snapshot.entries_.begin(), snapshot.entries_.end(),
+              [](const auto& a, const auto& b) { return a.handle < b.handle; });
+    return snapshot;
+}
+
+ObjectInfoSnapshot::ObjectInfoSnapshot(ObjectInfoSnapshot&& other) noexcept
+    : db_(other.db_), entries_(std::move(other.entries_)) {
+    other.db_ = nullptr;
+    other.entries_.clear();
+}
+
+ObjectInfoSnapshot& ObjectInfoSnapshot::operator=(ObjectInfoSnapshot&& other) noexcept {
+    if (this != &other) {
+        Release();
+        db_ = other.db_;
+        entries_ = std::move(other.entries_);
+        other.db_ = nullptr;
+        other.entries_.clear();
+    }
+    return *this;
+}
+
+ObjectInfoSnapshot::~ObjectInfoSnapshot() { Release(); }
+
+void ObjectInfoSnapshot::Release() {
+    for (auto& entry : entries_) {
+        db_->ReleaseName(entry.name);
+    }
+    entries_.clear();
+    db_ = nullptr;
+}
+
+std::string_view ObjectInfoSnapshot::FindName(uint64_t handle) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), handle,
+                               [](const SnapshotEntry& entry, uint64_t h) { return entry.handle < h; });
+    if (it == entries_.end() || it->handle != handle) {
+        return {};
+    }
+    return it->name->str;
+}
+
+void ObjectInfoSnapshot::PrintObjectInfo(crash_diagnostic_layer::DumpEmitter& os, uint64_t handle) const {
+    static constexpr char kHexDigits[] = "0123456789ABCDEF";
+    // A dump formats a handle for every object parameter of every command,
+    // reuse one buffer per thread instead of building a string each time.
+    thread_local std::string info;
+    info.assign("0x");
+    for (int shift = 60; shift >= 0; shift -= 4) {
+        info.push_back(kHexDigits[(handle >> shift) & 0xF]);
+    }
+    info.push_back('[');
+    info.append(FindName(handle));
+    info.push_back(']');
+    os << info;
 }
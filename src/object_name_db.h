@@ -20,27 +20,32 @@
 
 #include <vulkan/vulkan.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <utility>
-#include <yaml-cpp/emitter.h>
+
+#include "dump_emitter.h"
 
 // -----------------------------------------------------------------------------
 // Debug info for a Vulkan object
 // -----------------------------------------------------------------------------
 struct ObjectInfo {
-    ObjectInfo(uint64_t o, VkObjectType t, const char* n) : object(o), type(t), name(n) {}
-    ObjectInfo() : object(0), type(VK_OBJECT_TYPE_UNKNOWN), name("") {}
+    ObjectInfo(uint64_t o, VkObjectType t, std::string_view n) : object(o), type(t), name(n) {}
+    ObjectInfo() : object(0), type(VK_OBJECT_TYPE_UNKNOWN) {}
 
     uint64_t object;
     VkObjectType type;
+    // A copy of the interned name. The interned string may be freed by a
+    // rename or removal on another thread as soon as the shard lock is
+    // released.
     std::string name;
 };
 
-using ObjectInfoPtr = std::unique_ptr<ObjectInfo>;
 using ExtraObjectInfo = std::pair<std::string, std::string>;
 
 enum HandleDebugNamePreference {
@@ -50,29 +55,116 @@ enum HandleDebugNamePreference {
 
 // -----------------------------------------------------------------------------
 // Database of debug info for multiple Vulkan objects
+//
+// Objects are spread over lock striped shards by handle, so naming, removal
+// and lookups on different objects rarely contend. Names are interned and
+// reference counted: objects sharing a name share one string, and the string
+// is freed when the last object using it is renamed or removed.
 // -----------------------------------------------------------------------------
+class ObjectInfoSnapshot;
+
 class ObjectInfoDB {
    public:
     ObjectInfoDB();
     ObjectInfoDB(ObjectInfoDB&) = delete;
     ObjectInfoDB& operator=(ObjectInfoDB&) = delete;
+    ~ObjectInfoDB();
 
+    // A null or empty name removes the name of the object.
     void AddObjectInfo(uint64_t handle, VkObjectType type, const char* name);
     void AddExtraInfo(uint64_t handle, ExtraObjectInfo info);
 
-    void RemoveObjectInfo(uint64_t handle) {}  // TODO remove object info..
+    // Forget everything about a destroyed object.
+    void RemoveObjectInfo(uint64_t handle);
 
     ObjectInfo FindObjectInfo(uint64_t handle) const;
     std::string GetObjectName(uint64_t handle,
                               HandleDebugNamePreference handle_debug_name_preference = kReportBoth) const;
     std::string GetObjectInfo(uint64_t handle) const;
 
+    size_t Size() const;
+
+    // Copy the names of all named objects into an immutable snapshot. Each
+    // shard is locked only while it is being copied.
+    ObjectInfoSnapshot Snapshot();
+
+   private:
+    friend class ObjectInfoSnapshot;
+
+    static constexpr size_t kShardCount = 16;
+
+    struct InternedName {
+        std::string str;
+        // Only dropped with the name shard locked. A snapshot may add a
+        // reference holding just the lock of an object shard using the name.
+        std::atomic<uint32_t> refs{0};
+    };
+
+    struct Entry {
+        VkObjectType type{VK_OBJECT_TYPE_UNKNOWN};
+        InternedName* name{nullptr};
+        std::vector<ExtraObjectInfo> extra_info;
+    };
+
+    struct alignas(64) ObjectShard {
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, Entry> objects;
+    };
+
+    struct alignas(64) NameShard {
+        std::mutex mutex;
+        // Keys are views of the InternedName strings.
+        std::unordered_map<std::string_view, std::unique_ptr<InternedName>> names;
+    };
+
+    ObjectShard& GetObjectShard(uint64_t handle) const;
+    NameShard& GetNameShard(std::string_view name);
+    std::string_view FindNameLocked(const ObjectShard& shard, uint64_t handle) const;
+
+    InternedName* InternName(std::string_view name);
+    void ReleaseName(InternedName* name);
+
+    mutable ObjectShard object_shards_[kShardCount];
+    NameShard name_shards_[kShardCount];
+};
+
+// -----------------------------------------------------------------------------
+// Immutable view of the object names of an ObjectInfoDB at one point in time
+//
+// Used while writing a dump: the names are a sorted flat array searched
+// without taking any lock, so printing does not contend with application
+// threads that keep naming and destroying objects. The snapshot holds a
+// reference to every name in it and must not outlive the database.
+// -----------------------------------------------------------------------------
+class ObjectInfoSnapshot {
+   public:
+    ObjectInfoSnapshot() = default;
+    ObjectInfoSnapshot(ObjectInfoSnapshot&& other) noexcept;
+    ObjectInfoSnapshot& operator=(ObjectInfoSnapshot&& other) noexcept;
+    ObjectInfoSnapshot(const ObjectInfoSnapshot&) = delete;
+    ObjectInfoSnapshot& operator=(const ObjectInfoSnapshot&) = delete;
+    ~ObjectInfoSnapshot();
+
+    // Returns an empty name for unnamed objects.
+    std::string_view FindName(uint64_t handle) const;
+
+    // Same format as ObjectInfoDB::GetObjectInfo().
+    void PrintObjectInfo(crash_diagnostic_layer::DumpEmitter& os, uint64_t handle) const;
+
+    size_t Size() const { return entries_.size(); }
+
    private:
-    mutable std::mutex lock_;
+    friend class ObjectInfoDB;
+
+    struct SnapshotEntry {
+        uint64_t handle;
+        ObjectInfoDB::InternedName* name;
+    };
+
+    void Release();
 
-    std::unordered_map<uint64_t, ObjectInfoPtr> object_info_;
-    std::unordered_map<uint64_t, std::vector<ExtraObjectInfo>> object_extra_info_;
-    ObjectInfo unknown_object_;
+    ObjectInfoDB* db_{nullptr};
+    std::vector<SnapshotEntry> entries_;
 };
 
 #endif  // OBJECT_NAME_DB_HEADER_
@@ -58,9 +58,10 @@ const PipelineBoundShader& Pipeline::FindShaderStage(VkShaderStageFlagBits shade
     return PipelineBoundShader::NULL_SHADER;
 }
 
-YAML::Emitter& Pipeline::Print(YAML::Emitter& os, const ObjectInfoDB& name_resolver) const {
+DumpEmitter& Pipeline::Print(DumpEmitter& os, const ObjectInfoSnapshot& names) const {
     os << YAML::BeginMap;
-    os << YAML::Key << "handle" << YAML::Value << name_resolver.GetObjectInfo((uint64_t)vk_pipeline_);
+    os << YAML::Key << "handle" << YAML::Value;
+    names.PrintObjectInfo(os, (uint64_t)vk_pipeline_);
     auto bind_point = GetVkPipelineBindPoint();
     os << YAML::Key << "bindPoint" << YAML::Value;
     if (bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
@@ -92,7 +93,8 @@ YAML::Emitter& Pipeline::Print(YAML::Emitter& os, const ObjectInfoDB& name_resol
             } else if (shader.stage == VK_SHADER_STAGE_COMPUTE_BIT) {
                 os << "cs";
             }
-            os << YAML::Key << "module" << YAML::Value << name_resolver.GetObjectInfo((uint64_t)shader.module);
+            os << YAML::Key << "module" << YAML::Value;
+            names.PrintObjectInfo(os, (uint64_t)shader.module);
             os << YAML::Key << "entry" << YAML::Value << shader.entry_point;
             os << YAML::EndMap;
         }
@@ -52,7 +52,7 @@ class Pipeline {
 
     const PipelineBoundShader& FindShaderStage(VkShaderStageFlagBits shader_stage) const;
 
-    YAML::Emitter& Print(YAML::Emitter& stream, const ObjectInfoDB& name_resolver) const;
+    DumpEmitter& Print(DumpEmitter& stream, const ObjectInfoSnapshot& names) const;
 
     const std::vector<PipelineBoundShader>& GetBoundShaders() const { return shaders_; }
 
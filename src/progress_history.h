@@ -0,0 +1,115 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace crash_diagnostic_layer {
+
+// One reading of a queue's progress by the progress sampler thread.
+struct ProgressSample {
+    // steady_clock milliseconds
+    int64_t time_ms{0};
+    VkQueue queue{VK_NULL_HANDLE};
+    uint64_t completed_seq{0};
+    uint64_t submitted_seq{0};
+    // Marker words of the command buffer running at the time, if the
+    // checkpoint markers are host visible.
+    bool has_checkpoint{false};
+    uint32_t top_checkpoint{0};
+    uint32_t bottom_checkpoint{0};
+};
+
+//
+// ProgressHistory is a fixed size ring of the most recent ProgressSamples.
+//
+// There is a single writer, the sampler thread, and Push() never blocks.
+// Read() may run on any thread at the same time: every slot carries a
+// sequence word that is odd while the slot is being written and encodes which
+// sample the slot holds, so readers drop samples that were overwritten while
+// they copied them instead of waiting for the writer.
+//
+class ProgressHistory {
+   public:
+    static constexpr size_t kCapacity = 4096;
+
+    void Push(const ProgressSample& sample) {
+        uint64_t index = count_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[index % kCapacity];
+        slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.time_ms.store(sample.time_ms, std::memory_order_relaxed);
+        slot.queue.store(sample.queue, std::memory_order_relaxed);
+        slot.completed_seq.store(sample.completed_seq, std::memory_order_relaxed);
+        slot.submitted_seq.store(sample.submitted_seq, std::memory_order_relaxed);
+        slot.has_checkpoint.store(sample.has_checkpoint, std::memory_order_relaxed);
+        slot.top_checkpoint.store(sample.top_checkpoint, std::memory_order_relaxed);
+        slot.bottom_checkpoint.store(sample.bottom_checkpoint, std::memory_order_relaxed);
+        slot.seq.store(2 * index + 2, std::memory_order_release);
+        count_.store(index + 1, std::memory_order_release);
+    }
+
+    // Returns the samples still in the ring, oldest first.
+    std::vector<ProgressSample> Read() const {
+        std::vector<ProgressSample> samples;
+        uint64_t end = count_.load(std::memory_order_acquire);
+        uint64_t begin = end > kCapacity ? end - kCapacity : 0;
+        samples.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t index = begin; index < end; ++index) {
+            const Slot& slot = slots_[index % kCapacity];
+            if (slot.seq.load(std::memory_order_acquire) != 2 * index + 2) {
+                continue;
+            }
+            ProgressSample sample;
+            sample.time_ms = slot.time_ms.load(std::memory_order_relaxed);
+            sample.queue = slot.queue.load(std::memory_order_relaxed);
+            sample.completed_seq = slot.completed_seq.load(std::memory_order_relaxed);
+            sample.submitted_seq = slot.submitted_seq.load(std::memory_order_relaxed);
+            sample.has_checkpoint = slot.has_checkpoint.load(std::memory_order_relaxed);
+            sample.top_checkpoint = slot.top_checkpoint.load(std::memory_order_relaxed);
+            sample.bottom_checkpoint = slot.bottom_checkpoint.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != 2 * index + 2) {
+                continue;
+            }
+            samples.push_back(sample);
+        }
+        return samples;
+    }
+
+   private:
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<int64_t> time_ms{0};
+        std::atomic<VkQueue> queue{VK_NULL_HANDLE};
+        std::atomic<uint64_t> completed_seq{0};
+        std::atomic<uint64_t> submitted_seq{0};
+        std::atomic<bool> has_checkpoint{false};
+        std::atomic<uint32_t> top_checkpoint{0};
+        std::atomic<uint32_t> bottom_checkpoint{0};
+    };
+
+    std::atomic<uint64_t> count_{0};
+    Slot slots_[kCapacity];
+};
+
+}  // namespace crash_diagnostic_layer
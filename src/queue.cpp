@@ -18,15 +18,16 @@
 #include "queue.h"
 
 #include <cstring>
+#include <iterator>
 #include <iomanip>
 #include <sstream>
 
 #include "cdl.h"
 #include "device.h"
+#include "dump_emitter.h"
 #include "util.h"
 
 #include <vulkan/utility/vk_struct_helper.hpp>
-#include <yaml-cpp/emitter.h>
 
 namespace crash_diagnostic_layer {
 
@@ -36,7 +37,10 @@ Queue::Queue(Device& device, VkQueue queue, uint32_t family_index, uint32_t inde
       queue_family_index_(family_index),
       queue_index_(index),
       queue_family_properties_(props),
-      trace_all_semaphores_(device_.GetContext().GetSettings().trace_all_semaphores) {
+      trace_all_semaphores_(device_.GetContext().GetSettings().trace_all_semaphores),
+      sample_progress_(device_.GetContext().GetSettings().progress_sample_ms > 0),
+      batch_submits_(device_.GetContext().GetSettings().batch_queue_submits),
+      max_tracked_submits_(device_.GetContext().GetSettings().max_tracked_submits) {
     auto type_ci = vku::InitStruct<VkSemaphoreTypeCreateInfo>();
     type_ci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
     type_ci.initialValue = submit_seq_;
@@ -61,8 +65,15 @@ Queue::~Queue() { Destroy(); }
 
 const Logger& Queue::Log() const { return device_.Log(); }
 
-Queue::SubmitInfo::SubmitInfo(Device& device, const VkSubmitInfo& submit_info, uint64_t seq_)
-    : type(kQueueSubmit), start_seq(seq_) {
+void Queue::SubmitInfo::Clear() {
+    wait_semaphores.clear();
+    command_buffers.clear();
+    checkpoint_markers.clear();
+    signal_semaphores.clear();
+}
+
+void Queue::SubmitInfo::Set(Device& device, const VkSubmitInfo& submit_info, uint64_t seq_) {
+    Reset(kQueueSubmit, seq_);
     for (uint32_t i = 0; i < submit_info.waitSemaphoreCount; i++) {
         wait_semaphores.push_back({submit_info.pWaitSemaphores[i], 1, submit_info.pWaitDstStageMask[i]});
     }
@@ -91,8 +102,8 @@ Queue::SubmitInfo::SubmitInfo(Device& device, const VkSubmitInfo& submit_info, u
     }
 }
 
-Queue::SubmitInfo::SubmitInfo(Device& device, const VkSubmitInfo2& submit_info, uint64_t seq_)
-    : type(kQueueSubmit2), start_seq(seq_) {
+void Queue::SubmitInfo::Set(Device& device, const VkSubmitInfo2& submit_info, uint64_t seq_) {
+    Reset(kQueueSubmit2, seq_);
     auto semaphore_tracker = device.GetSemaphoreTracker();
 
     for (uint32_t i = 0; i < submit_info.waitSemaphoreInfoCount; i++) {
@@ -112,8 +123,8 @@ Queue::SubmitInfo::SubmitInfo(Device& device, const VkSubmitInfo2& submit_info,
     }
 }
 
-Queue::SubmitInfo::SubmitInfo(Device& device, const VkBindSparseInfo& sparse_info, uint64_t seq_)
-    : type(kQueueBindSparse), start_seq(seq_) {
+void Queue::SubmitInfo::Set(Device& device, const VkBindSparseInfo& sparse_info, uint64_t seq_) {
+    Reset(kQueueBindSparse, seq_);
     for (uint32_t i = 0; i < sparse_info.waitSemaphoreCount; i++) {
         wait_semaphores.push_back({sparse_info.pWaitSemaphores[i], 1, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT});
     }
@@ -161,8 +172,79 @@ bool Queue::UpdateSeq() {
                    device_.GetObjectInfo((uint64_t)submit_sem_).c_str());
         return false;
     }
-    assert(value >= complete_seq_);
-    complete_seq_ = value;
+    // The watchdog thread reads the semaphore too, never move backwards.
+    uint64_t completed = complete_seq_;
+    while (value > completed && !complete_seq_.compare_exchange_weak(completed, value)) {
+    }
+    return true;
+}
+
+bool Queue::ArmWatchdog() {
+    if (watchdog_armed_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    watchdog_seq_ = CompletedSeq();
+    return !watchdog_armed_.exchange(true);
+}
+
+Queue::WatchdogState Queue::CheckWatchdog() {
+    UpdateSeq();
+    uint64_t completed = CompletedSeq();
+    bool rearmed = false;
+    if (completed >= SubmittedSeq()) {
+        watchdog_armed_ = false;
+        // A submit racing with the store may have seen the queue still armed, keep watching for it.
+        if (completed >= SubmittedSeq() || watchdog_armed_.exchange(true)) {
+            return WatchdogState::kIdle;
+        }
+        rearmed = true;
+    }
+    uint64_t last_seq = watchdog_seq_.exchange(completed);
+    if (rearmed || completed != last_seq) {
+        return WatchdogState::kProgressed;
+    }
+    return WatchdogState::kStalled;
+}
+
+bool Queue::SampleProgress(ProgressSample& sample) {
+    UpdateSeq();
+    uint64_t completed = CompletedSeq();
+    uint64_t submitted = SubmittedSeq();
+    if (completed >= submitted && completed == last_sampled_seq_) {
+        return false;
+    }
+    last_sampled_seq_ = completed;
+    sample.queue = vk_queue_;
+    sample.completed_seq = completed;
+    sample.submitted_seq = submitted;
+    sample.has_checkpoint = false;
+
+    // The running command buffer is the first one that has not signaled its sequence number.
+    const uint32_t* markers = nullptr;
+    {
+        std::lock_guard<std::mutex> qlock(queue_submits_mutex_);
+        for (auto submission = queue_submits_.begin(); !markers && submission != queue_submits_.end(); ++submission) {
+            if (completed >= submission->end_seq) {
+                continue;
+            }
+            for (auto& submit_info : submission->submit_infos) {
+                for (auto& cb_markers : submit_info.checkpoint_markers) {
+                    if (cb_markers.seq > completed) {
+                        markers = cb_markers.markers;
+                        break;
+                    }
+                }
+                if (markers) {
+                    break;
+                }
+            }
+        }
+    }
+    if (markers) {
+        sample.has_checkpoint = true;
+        sample.top_checkpoint = markers[0];
+        sample.bottom_checkpoint = markers[1];
+    }
     return true;
 }
 
@@ -183,11 +265,8 @@ bool Queue::UpdateIdleState() {
             if (completed_seq >= submit_info.end_seq) {
                 Log().Verbose("info start: %lld end: %lld FINISH", submit_info.start_seq, submit_info.end_seq);
                 submit_info.state = kFinished;
-                for (auto& cb : submit_info.command_buffers) {
-                    auto cmd = crash_diagnostic_layer::GetCommandBuffer(cb);
-                    if (cmd) {
-                        cmd->SetCompleted();
-                    }
+                for (auto cb : submit_info.command_buffers) {
+                    MarkCompleted(cb, submit_info.end_seq);
                 }
             } else if ((completed_seq + 1) >= submit_info.start_seq) {
                 Log().Verbose("info start: %lld end: %lld RUNNING", submit_info.start_seq, submit_info.end_seq);
@@ -195,13 +274,13 @@ bool Queue::UpdateIdleState() {
                 bool found_running_cb = false;
                 for (auto pos = submit_info.command_buffers.rbegin(); pos != submit_info.command_buffers.rend();
                      ++pos) {
+                    if (found_running_cb) {
+                        MarkCompleted(*pos, submit_info.end_seq);
+                        continue;
+                    }
                     auto cmd = crash_diagnostic_layer::GetCommandBuffer(*pos);
-                    if (cmd) {
-                        if (found_running_cb) {
-                            cmd->SetCompleted();
-                        } else if (cmd->GetCommandBufferState() == CommandBufferState::kSubmittedExecutionIncomplete) {
-                            found_running_cb = true;
-                        }
+                    if (cmd && cmd->GetCommandBufferState() == CommandBufferState::kSubmittedExecutionIncomplete) {
+                        found_running_cb = true;
                     }
                 }
                 break;
@@ -212,7 +291,7 @@ bool Queue::UpdateIdleState() {
         }
 
         if (completed_seq >= submission.end_seq) {
-            queue_submits_.pop_front();
+            RecycleSubmit(queue_submits_.begin());
         } else {
             submission.state = kRunning;
             break;
@@ -243,9 +322,11 @@ std::vector<TrackedSemaphoreInfo> Queue::GetTrackedSemaphoreInfos(const SubmitIn
         return std::vector<TrackedSemaphoreInfo>();
     }
     if (operation == SemaphoreOperation::kWaitOperation) {
-        return semaphore_tracker->GetTrackedSemaphoreInfos(submit_info.wait_semaphores);
+        return semaphore_tracker->GetTrackedSemaphoreInfos(submit_info.wait_semaphores.data(),
+                                                           submit_info.wait_semaphores.size());
     }
-    return semaphore_tracker->GetTrackedSemaphoreInfos(submit_info.signal_semaphores);
+    return semaphore_tracker->GetTrackedSemaphoreInfos(submit_info.signal_semaphores.data(),
+                                                       submit_info.signal_semaphores.size());
 }
 
 bool Queue::SubmitInfoHasSemaphores(const SubmitInfo& submit_info) const {
@@ -286,9 +367,10 @@ std::string Queue::GetSubmitInfoSemaphoresLog(const SubmitInfo& submit_info) con
     return log.str();
 }
 
-void Queue::Print(YAML::Emitter& os) {
+void Queue::Print(DumpEmitter& os, const ObjectInfoSnapshot& names) {
     os << YAML::BeginMap << YAML::Comment("Queue");
-    os << YAML::Key << "handle" << YAML::Value << device_.GetObjectInfo((uint64_t)vk_queue_);
+    os << YAML::Key << "handle" << YAML::Value;
+    names.PrintObjectInfo(os, (uint64_t)vk_queue_);
     os << YAML::Key << "queueFamilyIndex" << YAML::Value << queue_family_index_;
     os << YAML::Key << "index" << YAML::Value << queue_index_;
     os << YAML::Key << "flags" << YAML::Value << YAML::BeginSeq;
@@ -321,6 +403,9 @@ void Queue::Print(YAML::Emitter& os) {
     os << YAML::Key << "submittedSeq" << YAML::Value << SubmittedSeq();
 
     std::lock_guard<std::mutex> qlock(queue_submits_mutex_);
+    if (dropped_submits_ > 0) {
+        os << YAML::Key << "droppedSubmits" << YAML::Value << dropped_submits_;
+    }
     if (queue_submits_.size() == 0) {
         os << YAML::EndMap;
         return;
@@ -384,7 +469,7 @@ void Queue::Print(YAML::Emitter& os) {
                 os << YAML::Key << "CommandBuffers" << YAML::Value << YAML::BeginSeq;
                 for (const auto& cb : submit_info.command_buffers) {
                     std::stringstream value;
-                    value << device_.GetObjectInfo((uint64_t)cb);
+                    value << Uint64ToStr((uint64_t)cb) << "[" << names.FindName((uint64_t)cb) << "]";
                     auto cmd = crash_diagnostic_layer::GetCommandBuffer(cb);
                     if (cmd) {
                         value << " " << cmd->PrintCommandBufferState() << " " << cmd->GetQueueSeq();
@@ -398,7 +483,8 @@ void Queue::Print(YAML::Emitter& os) {
                 os << YAML::Key << "WaitSemaphores" << YAML::Value << YAML::BeginSeq;
                 for (const auto& wait : wait_semaphores) {
                     os << YAML::BeginMap;
-                    os << YAML::Key << "handle" << YAML::Value << device_.GetObjectInfo((uint64_t)wait.semaphore);
+                    os << YAML::Key << "handle" << YAML::Value;
+                    names.PrintObjectInfo(os, (uint64_t)wait.semaphore);
                     os << YAML::Key << "type" << YAML::Value;
                     if (wait.semaphore_type == VK_SEMAPHORE_TYPE_BINARY_KHR) {
                         os << "Binary";
@@ -420,7 +506,8 @@ void Queue::Print(YAML::Emitter& os) {
                 os << YAML::Key << "SignalSemaphores" << YAML::Value << YAML::BeginSeq;
                 for (auto signal : signal_semaphores) {
                     os << YAML::BeginMap;
-                    os << YAML::Key << "handle" << YAML::Value << device_.GetObjectInfo((uint64_t)signal.semaphore);
+                    os << YAML::Key << "handle" << YAML::Value;
+                    names.PrintObjectInfo(os, (uint64_t)signal.semaphore);
                     os << YAML::Key << "type" << YAML::Value;
                     if (signal.semaphore_type == VK_SEMAPHORE_TYPE_BINARY_KHR) {
                         os << "Binary";
@@ -435,7 +522,8 @@ void Queue::Print(YAML::Emitter& os) {
             os << YAML::EndMap;
         }
         if (submission.fence) {
-            os << YAML::Key << "Fence" << YAML::Value << device_.GetObjectInfo((uint64_t)submission.fence);
+            os << YAML::Key << "Fence" << YAML::Value;
+            names.PrintObjectInfo(os, (uint64_t)submission.fence);
         }
         os << YAML::EndSeq << YAML::EndMap;
     }
@@ -450,14 +538,86 @@ void Queue::PostSubmit(VkResult result) {
     }
 }
 
+std::list<Queue::Submission> Queue::AcquireSubmission(QueueOperationType type, uint64_t start_seq) {
+    std::list<Submission> node;
+    {
+        std::lock_guard<std::mutex> lock(queue_submits_mutex_);
+        RetireSubmits(CompletedSeq());
+        if (!free_submits_.empty()) {
+            node.splice(node.end(), free_submits_, free_submits_.begin());
+        }
+    }
+    if (node.empty()) {
+        node.emplace_back(type, start_seq);
+    } else {
+        node.front().Reset(type, start_seq);
+    }
+    return node;
+}
+
+void Queue::PushSubmission(std::list<Submission>& submission) {
+    std::lock_guard<std::mutex> lock(queue_submits_mutex_);
+    queue_submits_.splice(queue_submits_.end(), submission);
+}
+
+void Queue::RetireSubmits(uint64_t completed_seq) {
+    // Submissions complete in order, so this only looks at each one once and
+    // stops at the first that is still in flight.
+    while (!queue_submits_.empty() && completed_seq >= queue_submits_.front().end_seq) {
+        for (const auto& submit_info : queue_submits_.front().submit_infos) {
+            for (auto cb : submit_info.command_buffers) {
+                MarkCompleted(cb, submit_info.end_seq);
+            }
+        }
+        RecycleSubmit(queue_submits_.begin());
+    }
+    // Everything left is still in flight. Leave room for the submission about to
+    // be added by dropping the newest of them, never the oldest: that is the one
+    // the GPU is most likely stuck on.
+    while (max_tracked_submits_ > 0 && queue_submits_.size() > 1 && queue_submits_.size() >= max_tracked_submits_) {
+        ++dropped_submits_;
+        RecycleSubmit(std::prev(queue_submits_.end()));
+    }
+}
+
+void Queue::RecycleSubmit(std::list<Submission>::iterator pos) {
+    if (free_submits_.size() < kMaxFreeSubmits) {
+        free_submits_.splice(free_submits_.end(), queue_submits_, pos);
+    } else {
+        queue_submits_.erase(pos);
+    }
+}
+
+void Queue::MarkCompleted(VkCommandBuffer cb, uint64_t end_seq) const {
+    auto cmd = crash_diagnostic_layer::GetCommandBuffer(cb);
+    // Leave command buffers that were submitted again since alone.
+    if (cmd && cmd->GetSubmittedQueue() == vk_queue_ && cmd->GetQueueSeq() <= end_seq) {
+        cmd->SetCompleted();
+    }
+}
+
+void Queue::TrackCommandBufferSubmit(SubmitInfo& submit_info, VkCommandBuffer cb, uint64_t cb_seq, VkFence fence) {
+    auto command_buffer = GetCommandBuffer(cb);
+    if (command_buffer) {
+        command_buffer->QueueSubmit(vk_queue_, cb_seq, fence);
+        if (sample_progress_ && command_buffer->GetCheckpointMarkers()) {
+            submit_info.checkpoint_markers.push_back({cb_seq, command_buffer->GetCheckpointMarkers()});
+        }
+    }
+}
+
 VkResult Queue::Submit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    if (batch_submits_) {
+        return BatchedSubmit(submitCount, pSubmits, fence);
+    }
     UpdateSeq();
     VkResult result = VK_SUCCESS;
 
-    Submission submission(kQueueSubmit, ++submit_seq_);
+    auto submission_node = AcquireSubmission(kQueueSubmit, ++submit_seq_);
+    auto& submission = submission_node.front();
 
     for (uint32_t i = 0; i < submitCount; i++) {
-        SubmitInfo submit_info(device_, pSubmits[i], submit_seq_++);
+        auto& submit_info = submission.AddSubmitInfo(device_, pSubmits[i], submit_seq_++);
         {
             auto timeline_values = vku::InitStruct<VkTimelineSemaphoreSubmitInfo>();
             timeline_values.signalSemaphoreValueCount = 1;
@@ -481,10 +641,7 @@ VkResult Queue::Submit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFen
         }
         for (auto& cb : submit_info.command_buffers) {
             uint64_t cb_seq = ++submit_seq_;
-            auto command_buffer = GetCommandBuffer(cb);
-            if (command_buffer) {
-                command_buffer->QueueSubmit(vk_queue_, cb_seq, fence);
-            }
+            TrackCommandBufferSubmit(submit_info, cb, cb_seq, fence);
             auto timeline_values = vku::InitStruct<VkTimelineSemaphoreSubmitInfo>();
             timeline_values.signalSemaphoreValueCount = 1;
             timeline_values.pSignalSemaphoreValues = &cb_seq;
@@ -522,13 +679,9 @@ VkResult Queue::Submit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFen
         if (trace_all_semaphores_) {
             LogSubmitInfoSemaphores(submit_info);
         }
-        submission.submit_infos.emplace_back(std::move(submit_info));
     }
     submission.end_seq = submit_seq_;  // don't increment so that this is the same as submit_infos.back().end_seq;
-    {
-        std::lock_guard<std::mutex> lock(queue_submits_mutex_);
-        queue_submits_.emplace_back(std::move(submission));
-    }
+    PushSubmission(submission_node);
     if (fence && result == VK_SUCCESS) {
         result = device_.Dispatch().QueueSubmit(vk_queue_, 0, nullptr, fence);
     }
@@ -537,15 +690,19 @@ VkResult Queue::Submit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFen
 }
 
 VkResult Queue::Submit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    if (batch_submits_) {
+        return BatchedSubmit2(submitCount, pSubmits, fence);
+    }
     auto QueueSubmit2 =
         device_.Dispatch().QueueSubmit2 ? device_.Dispatch().QueueSubmit2 : device_.Dispatch().QueueSubmit2KHR;
     UpdateSeq();
     VkResult result = VK_SUCCESS;
 
-    Submission submission(kQueueSubmit2, ++submit_seq_);
+    auto submission_node = AcquireSubmission(kQueueSubmit2, ++submit_seq_);
+    auto& submission = submission_node.front();
 
     for (uint32_t i = 0; i < submitCount; i++) {
-        SubmitInfo submit_info(device_, pSubmits[i], submit_seq_++);
+        auto& submit_info = submission.AddSubmitInfo(device_, pSubmits[i], submit_seq_++);
         {
             auto signal_info = vku::InitStruct<VkSemaphoreSubmitInfo>();
             signal_info.semaphore = submit_sem_;
@@ -569,10 +726,7 @@ VkResult Queue::Submit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkF
         }
         for (auto& cb : submit_info.command_buffers) {
             uint64_t cb_seq = ++submit_seq_;
-            auto command_buffer = GetCommandBuffer(cb);
-            if (command_buffer) {
-                command_buffer->QueueSubmit(vk_queue_, cb_seq, fence);
-            }
+            TrackCommandBufferSubmit(submit_info, cb, cb_seq, fence);
             auto signal_info = vku::InitStruct<VkSemaphoreSubmitInfo>();
             signal_info.semaphore = submit_sem_;
             signal_info.value = cb_seq;
@@ -617,13 +771,9 @@ VkResult Queue::Submit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkF
         if (trace_all_semaphores_) {
             LogSubmitInfoSemaphores(submit_info);
         }
-        submission.submit_infos.emplace_back(std::move(submit_info));
     }
     submission.end_seq = submit_seq_;  // don't increment so that this is the same as submit_infos.back().end_seq;
-    {
-        std::lock_guard<std::mutex> lock(queue_submits_mutex_);
-        queue_submits_.emplace_back(std::move(submission));
-    }
+    PushSubmission(submission_node);
     if (fence && result == VK_SUCCESS) {
         result = QueueSubmit2(vk_queue_, 0, nullptr, fence);
     }
@@ -631,14 +781,157 @@ VkResult Queue::Submit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkF
     return result;
 }
 
+// The batched paths build the same sequence of batches as Submit() and
+// Submit2(), but hand all of them to the driver in a single call. Batches
+// start in submission order and the timeline signal of each command buffer's
+// batch still waits for that command buffer, so the sequence numbers mean the
+// same thing in both modes.
+VkResult Queue::BatchedSubmit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    UpdateSeq();
+
+    size_t max_batches = 0;
+    for (uint32_t i = 0; i < submitCount; i++) {
+        max_batches += 4 + pSubmits[i].commandBufferCount;
+    }
+    // Batches point into these, so they must not reallocate.
+    auto& batches = scratch_.batches;
+    auto& timeline_values = scratch_.timeline_values;
+    auto& seqs = scratch_.seqs;
+    batches.clear();
+    timeline_values.clear();
+    seqs.clear();
+    batches.reserve(max_batches);
+    timeline_values.reserve(max_batches);
+    seqs.reserve(max_batches);
+    auto add_signal_batch = [&](uint64_t seq) -> VkSubmitInfo& {
+        seqs.push_back(seq);
+        timeline_values.push_back(vku::InitStruct<VkTimelineSemaphoreSubmitInfo>());
+        timeline_values.back().signalSemaphoreValueCount = 1;
+        timeline_values.back().pSignalSemaphoreValues = &seqs.back();
+        batches.push_back(vku::InitStruct<VkSubmitInfo>(&timeline_values.back()));
+        batches.back().signalSemaphoreCount = 1;
+        batches.back().pSignalSemaphores = &submit_sem_;
+        return batches.back();
+    };
+
+    auto submission_node = AcquireSubmission(kQueueSubmit, ++submit_seq_);
+    auto& submission = submission_node.front();
+
+    for (uint32_t i = 0; i < submitCount; i++) {
+        auto& submit_info = submission.AddSubmitInfo(device_, pSubmits[i], submit_seq_++);
+        add_signal_batch(submit_info.start_seq);
+        if (pSubmits[i].waitSemaphoreCount > 0) {
+            auto submit = vku::InitStruct<VkSubmitInfo>();
+            submit.pNext = pSubmits[i].pNext;
+            submit.waitSemaphoreCount = pSubmits[i].waitSemaphoreCount;
+            submit.pWaitSemaphores = pSubmits[i].pWaitSemaphores;
+            submit.pWaitDstStageMask = pSubmits[i].pWaitDstStageMask;
+            batches.push_back(submit);
+        }
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++) {
+            uint64_t cb_seq = ++submit_seq_;
+            TrackCommandBufferSubmit(submit_info, pSubmits[i].pCommandBuffers[j], cb_seq, fence);
+            auto& submit = add_signal_batch(cb_seq);
+            submit.commandBufferCount = 1;
+            submit.pCommandBuffers = &pSubmits[i].pCommandBuffers[j];
+        }
+        if (pSubmits[i].signalSemaphoreCount > 0) {
+            auto submit = vku::InitStruct<VkSubmitInfo>();
+            submit.pNext = pSubmits[i].pNext;
+            submit.signalSemaphoreCount = pSubmits[i].signalSemaphoreCount;
+            submit.pSignalSemaphores = pSubmits[i].pSignalSemaphores;
+            batches.push_back(submit);
+        }
+        submit_info.end_seq = ++submit_seq_;
+        add_signal_batch(submit_info.end_seq);
+        if (trace_all_semaphores_) {
+            LogSubmitInfoSemaphores(submit_info);
+        }
+    }
+    submission.end_seq = submit_seq_;
+    assert(batches.size() <= max_batches);
+    VkResult result =
+        device_.Dispatch().QueueSubmit(vk_queue_, static_cast<uint32_t>(batches.size()), batches.data(), fence);
+    PushSubmission(submission_node);
+    PostSubmit(result);
+    return result;
+}
+
+VkResult Queue::BatchedSubmit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    auto QueueSubmit2 =
+        device_.Dispatch().QueueSubmit2 ? device_.Dispatch().QueueSubmit2 : device_.Dispatch().QueueSubmit2KHR;
+    UpdateSeq();
+
+    size_t max_batches = 0;
+    for (uint32_t i = 0; i < submitCount; i++) {
+        max_batches += 4 + pSubmits[i].commandBufferInfoCount;
+    }
+    // Batches point into these, so they must not reallocate.
+    auto& batches = scratch_.batches2;
+    auto& signal_infos = scratch_.signal_infos;
+    batches.clear();
+    signal_infos.clear();
+    batches.reserve(max_batches);
+    signal_infos.reserve(max_batches);
+    auto add_signal_batch = [&](uint64_t seq) -> VkSubmitInfo2& {
+        signal_infos.push_back(vku::InitStruct<VkSemaphoreSubmitInfo>());
+        signal_infos.back().semaphore = submit_sem_;
+        signal_infos.back().value = seq;
+        signal_infos.back().stageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
+        batches.push_back(vku::InitStruct<VkSubmitInfo2>());
+        batches.back().signalSemaphoreInfoCount = 1;
+        batches.back().pSignalSemaphoreInfos = &signal_infos.back();
+        return batches.back();
+    };
+
+    auto submission_node = AcquireSubmission(kQueueSubmit2, ++submit_seq_);
+    auto& submission = submission_node.front();
+
+    for (uint32_t i = 0; i < submitCount; i++) {
+        auto& submit_info = submission.AddSubmitInfo(device_, pSubmits[i], submit_seq_++);
+        add_signal_batch(submit_info.start_seq);
+        if (pSubmits[i].waitSemaphoreInfoCount > 0) {
+            auto submit = vku::InitStruct<VkSubmitInfo2>();
+            submit.waitSemaphoreInfoCount = pSubmits[i].waitSemaphoreInfoCount;
+            submit.pWaitSemaphoreInfos = pSubmits[i].pWaitSemaphoreInfos;
+            batches.push_back(submit);
+        }
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++) {
+            uint64_t cb_seq = ++submit_seq_;
+            TrackCommandBufferSubmit(submit_info, pSubmits[i].pCommandBufferInfos[j].commandBuffer, cb_seq, fence);
+            auto& submit = add_signal_batch(cb_seq);
+            submit.commandBufferInfoCount = 1;
+            submit.pCommandBufferInfos = &pSubmits[i].pCommandBufferInfos[j];
+        }
+        if (pSubmits[i].signalSemaphoreInfoCount > 0) {
+            auto submit = vku::InitStruct<VkSubmitInfo2>();
+            submit.signalSemaphoreInfoCount = pSubmits[i].signalSemaphoreInfoCount;
+            submit.pSignalSemaphoreInfos = pSubmits[i].pSignalSemaphoreInfos;
+            batches.push_back(submit);
+        }
+        submit_info.end_seq = ++submit_seq_;
+        add_signal_batch(submit_info.end_seq);
+        if (trace_all_semaphores_) {
+            LogSubmitInfoSemaphores(submit_info);
+        }
+    }
+    submission.end_seq = submit_seq_;
+    assert(batches.size() <= max_batches);
+    VkResult result = QueueSubmit2(vk_queue_, static_cast<uint32_t>(batches.size()), batches.data(), fence);
+    PushSubmission(submission_node);
+    PostSubmit(result);
+    return result;
+}
+
 VkResult Queue::BindSparse(uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfos, VkFence fence) {
     UpdateSeq();
     VkResult result = VK_SUCCESS;
 
-    Submission submission(kQueueSubmit, ++submit_seq_);
+    auto submission_node = AcquireSubmission(kQueueSubmit, ++submit_seq_);
+    auto& submission = submission_node.front();
 
     for (uint32_t i = 0; i < bindInfoCount; i++) {
-        SubmitInfo submit_info(device_, pBindInfos[i], submit_seq_++);
+        auto& submit_info = submission.AddSubmitInfo(device_, pBindInfos[i], submit_seq_++);
         {
             auto timeline_values = vku::InitStruct<VkTimelineSemaphoreSubmitInfo>();
             timeline_values.signalSemaphoreValueCount = 1;
@@ -668,13 +961,9 @@ VkResult Queue::BindSparse(uint32_t bindInfoCount, const VkBindSparseInfo* pBind
         if (trace_all_semaphores_) {
             LogSubmitInfoSemaphores(submit_info);
         }
-        submission.submit_infos.emplace_back(std::move(submit_info));
     }
     submission.end_seq = submit_seq_;  // don't increment so that this is the same as submit_infos.back().end_seq;
-    {
-        std::lock_guard<std::mutex> lock(queue_submits_mutex_);
-        queue_submits_.emplace_back(std::move(submission));
-    }
+    PushSubmission(submission_node);
     if (fence && result == VK_SUCCESS) {
         result = device_.Dispatch().QueueBindSparse(vk_queue_, 0, nullptr, fence);
     }
@@ -28,7 +28,9 @@
 #include "command.h"
 #include "command_pool.h"
 #include "marker.h"
+#include "progress_history.h"
 #include "semaphore_tracker.h"
+#include "small_vector.h"
 
 namespace YAML {
 class Emitter;
@@ -58,7 +60,7 @@ class Queue {
 
     VkQueue GetVkQueue() const { return vk_queue_; }
 
-    void Print(YAML::Emitter& os);
+    void Print(DumpEmitter& os, const ObjectInfoSnapshot& names);
 
     VkResult Submit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
     VkResult Submit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence);
@@ -66,6 +68,24 @@ class Queue {
 
     bool UpdateIdleState();
 
+    enum class WatchdogState {
+        kIdle,
+        kProgressed,
+        kStalled,
+    };
+
+    // Returns true if the queue had no watchdog deadline and the caller must
+    // schedule one.
+    bool ArmWatchdog();
+    // Called by the watchdog thread when the queue's deadline expires. Returns
+    // kProgressed if the deadline must be scheduled again.
+    WatchdogState CheckWatchdog();
+
+    // Called by the progress sampler thread. Fills in the queue's progress and
+    // the markers of the command buffer it is running, returns false if the
+    // queue is idle and has not moved since the last sample.
+    bool SampleProgress(ProgressSample& sample);
+
    private:
     enum SubmitState : uint32_t {
         kQueued = 1,
@@ -74,27 +94,74 @@ class Queue {
     };
 
     struct SubmitInfo {
-        SubmitInfo(Device& device, const VkSubmitInfo& submit_info, uint64_t seq);
-        SubmitInfo(Device& device, const VkSubmitInfo2& submit_info, uint64_t seq);
-        SubmitInfo(Device& device, const VkBindSparseInfo& submit_info, uint64_t seq);
-
-        QueueOperationType type;
+        // Fill in a cleared SubmitInfo.
+        void Set(Device& device, const VkSubmitInfo& submit_info, uint64_t seq);
+        void Set(Device& device, const VkSubmitInfo2& submit_info, uint64_t seq);
+        void Set(Device& device, const VkBindSparseInfo& submit_info, uint64_t seq);
+        // Empty the arrays but keep their storage for the next Set().
+        void Clear();
+
+        QueueOperationType type{kQueueSubmit};
         SubmitState state{kQueued};
         uint64_t start_seq{0};
         uint64_t end_seq{0};
-        std::vector<SemInfo> wait_semaphores;
-        std::vector<VkCommandBuffer> command_buffers;
+        // Inline sizes cover typical submits without heap allocations.
+        SmallVector<SemInfo, 4> wait_semaphores;
+        SmallVector<VkCommandBuffer, 8> command_buffers;
+        // Host addresses of the checkpoint markers, captured at submit time so
+        // the progress sampler never looks at CommandBuffers, which may be freed
+        // as soon as their work completes.
+        struct CheckpointMarkers {
+            uint64_t seq;
+            const uint32_t* markers;
+        };
+        SmallVector<CheckpointMarkers, 8> checkpoint_markers;
         // TODO: sparse info
-        std::vector<SemInfo> signal_semaphores;
+        SmallVector<SemInfo, 4> signal_semaphores;
+
+       private:
+        void Reset(QueueOperationType type_, uint64_t start) {
+            type = type_;
+            state = kQueued;
+            start_seq = start;
+            end_seq = 0;
+        }
     };
 
     struct Submission {
         Submission(QueueOperationType type_, uint64_t start) : type(type_), start_seq(start) {}
+        void Reset(QueueOperationType type_, uint64_t start) {
+            type = type_;
+            state = kQueued;
+            start_seq = start;
+            end_seq = 0;
+            for (auto& submit_info : submit_infos) {
+                submit_info.Clear();
+                spare_submit_infos.push_back(std::move(submit_info));
+            }
+            submit_infos.clear();
+            fence = VK_NULL_HANDLE;
+        }
+        // Adds a SubmitInfo, reusing the storage of one from before Reset().
+        template <typename Info>
+        SubmitInfo& AddSubmitInfo(Device& device, const Info& info, uint64_t seq) {
+            if (spare_submit_infos.empty()) {
+                submit_infos.emplace_back();
+            } else {
+                submit_infos.push_back(std::move(spare_submit_infos.back()));
+                spare_submit_infos.pop_back();
+            }
+            auto& submit_info = submit_infos.back();
+            submit_info.Set(device, info, seq);
+            return submit_info;
+        }
         QueueOperationType type;
         SubmitState state{kQueued};
         uint64_t start_seq;
         uint64_t end_seq{0};
         std::vector<SubmitInfo> submit_infos;
+        // Cleared SubmitInfos that still own their array storage.
+        std::vector<SubmitInfo> spare_submit_infos;
         VkFence fence{VK_NULL_HANDLE};
     };
 
@@ -108,6 +175,26 @@ class Queue {
 
     void PostSubmit(VkResult result);
 
+    // Returns a one element list holding a Submission, recycled from a retired
+    // one if possible so its storage is reused. Splice it into queue_submits_
+    // once it is filled in.
+    std::list<Submission> AcquireSubmission(QueueOperationType type, uint64_t start_seq);
+    void PushSubmission(std::list<Submission>& submission);
+
+    // Drop the submissions the GPU has finished, and the newest in-flight ones
+    // beyond max_tracked_submits. The oldest in-flight submission is always kept.
+    // queue_submits_mutex_ must be held.
+    void RetireSubmits(uint64_t completed_seq);
+    void RecycleSubmit(std::list<Submission>::iterator pos);
+    void MarkCompleted(VkCommandBuffer cb, uint64_t end_seq) const;
+
+    // Submit one vkQueueSubmit() or vkQueueSubmit2() call for all the batches
+    // needed to track an application submit, see batch_queue_submits.
+    VkResult BatchedSubmit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence);
+    VkResult BatchedSubmit2(uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence);
+
+    void TrackCommandBufferSubmit(SubmitInfo& submit_info, VkCommandBuffer cb, uint64_t cb_seq, VkFence fence);
+
     void LogSubmitInfoSemaphores(const SubmitInfo& submit_info);
 
     uint64_t CompletedSeq() const { return complete_seq_; }
@@ -122,13 +209,38 @@ class Queue {
     const uint32_t queue_index_;
     const VkQueueFamilyProperties queue_family_properties_;
     bool trace_all_semaphores_{false};
+    bool sample_progress_{false};
+    bool batch_submits_{false};
+    const uint32_t max_tracked_submits_;
 
     mutable std::mutex queue_submits_mutex_;
     std::list<Submission> queue_submits_;
+    // Retired submissions kept for reuse.
+    std::list<Submission> free_submits_;
+    static constexpr size_t kMaxFreeSubmits = 64;
+    uint64_t dropped_submits_{0};
+
+    // Scratch arrays for the batched submit paths. vkQueueSubmit calls on a
+    // queue are externally synchronized, so these need no lock.
+    struct SubmitScratch {
+        std::vector<VkSubmitInfo> batches;
+        std::vector<VkTimelineSemaphoreSubmitInfo> timeline_values;
+        std::vector<uint64_t> seqs;
+        std::vector<VkSubmitInfo2> batches2;
+        std::vector<VkSemaphoreSubmitInfo> signal_infos;
+    };
+    SubmitScratch scratch_;
 
     VkSemaphore submit_sem_{VK_NULL_HANDLE};
     std::atomic<uint64_t> submit_seq_{0};
     std::atomic<uint64_t> complete_seq_{0};
+
+    std::atomic<bool> watchdog_armed_{false};
+    // Completed sequence number when the watchdog last looked at the queue.
+    std::atomic<uint64_t> watchdog_seq_{0};
+
+    // Only used by the progress sampler thread.
+    uint64_t last_sampled_seq_{0};
 };
 
 }  // namespace crash_diagnostic_layer
@@ -39,8 +39,8 @@ void SemaphoreTracker::SemaphoreInfo::UpdateLastModifier(Device& device, Semapho
 }
 
 // TODO https://github.com/LunarG/CrashDiagnosticLayer/issues/70 track_semaphores_last_setter_ is broken
-SemaphoreTracker::SemaphoreTracker(Device& device)
-    : device_(device), markers_(device), track_semaphores_last_setter_(false) {}
+SemaphoreTracker::SemaphoreTracker(Device& device, BufferMarkerMgr& markers)
+    : device_(device), markers_(markers), track_semaphores_last_setter_(false) {}
 
 const Logger& SemaphoreTracker::Log() const { return device_.Log(); }
 
@@ -149,10 +149,10 @@ void SemaphoreTracker::WriteMarker(VkSemaphore vk_semaphore, VkCommandBuffer vk_
     }
 }
 
-std::vector<TrackedSemaphoreInfo> SemaphoreTracker::GetTrackedSemaphoreInfos(const std::vector<SemInfo>& semaphores) {
+std::vector<TrackedSemaphoreInfo> SemaphoreTracker::GetTrackedSemaphoreInfos(const SemInfo* semaphores, size_t count) {
     std::vector<TrackedSemaphoreInfo> tracked_semaphores;
     std::lock_guard<std::mutex> lock(semaphores_mutex_);
-    for (uint32_t i = 0; i < semaphores.size(); i++) {
+    for (size_t i = 0; i < count; i++) {
         if (semaphores_.find(semaphores[i].handle) == semaphores_.end()) continue;
         auto& semaphore_info = semaphores_[semaphores[i].handle];
         TrackedSemaphoreInfo tracked_semaphore;
@@ -207,7 +207,7 @@ std::string SemaphoreTracker::PrintTrackedSemaphoreInfos(const std::vector<Track
     return log.str();
 }
 
-void SemaphoreTracker::DumpWaitingThreads(YAML::Emitter& os) const {
+void SemaphoreTracker::DumpWaitingThreads(DumpEmitter& os, const ObjectInfoSnapshot& names) const {
     std::lock_guard<std::mutex> lock(waiting_threads_mutex_);
     if (waiting_threads_.size() == 0) {
         return;
@@ -224,7 +224,8 @@ void SemaphoreTracker::DumpWaitingThreads(YAML::Emitter& os) const {
         os << YAML::Key << "WaitSemaphores" << YAML::Value << YAML::BeginSeq;
         for (size_t i = 0; i < it.semaphores.size(); i++) {
             os << YAML::BeginMap;
-            os << YAML::Key << "handle" << YAML::Value << device_.GetObjectInfo((uint64_t)it.semaphores[i]);
+            os << YAML::Key << "handle" << YAML::Value;
+            names.PrintObjectInfo(os, (uint64_t)it.semaphores[i]);
             os << YAML::Key << "type" << YAML::Value << "Timeline";
             os << YAML::Key << "value" << YAML::Value << it.wait_values[i];
             if (GetSemaphoreValue(it.semaphores[i], semaphore_value)) {
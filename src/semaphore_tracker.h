@@ -18,7 +18,6 @@
 #pragma once
 
 #include <vulkan/vulkan.h>
-#include <yaml-cpp/emitter.h>
 
 #include <map>
 #include <memory>
@@ -26,8 +25,11 @@
 #include <unordered_map>
 #include <vector>
 
+#include "dump_emitter.h"
 #include "marker.h"
 
+class ObjectInfoSnapshot;
+
 namespace crash_diagnostic_layer {
 
 class Device;
@@ -64,7 +66,7 @@ struct TrackedSemaphoreInfo {
 
 class SemaphoreTracker {
    public:
-    SemaphoreTracker(Device& device);
+    SemaphoreTracker(Device& device, BufferMarkerMgr& markers);
     SemaphoreTracker(SemaphoreTracker&) = delete;
     SemaphoreTracker& operator=(SemaphoreTracker&) = delete;
 
@@ -79,19 +81,19 @@ class SemaphoreTracker {
 
     void BeginWaitOnSemaphores(int pid, int tid, const VkSemaphoreWaitInfoKHR* pWaitInfo);
     void EndWaitOnSemaphores(int pid, int tid, const VkSemaphoreWaitInfoKHR* pWaitInfo);
-    void DumpWaitingThreads(YAML::Emitter& os) const;
+    void DumpWaitingThreads(DumpEmitter& os, const ObjectInfoSnapshot& names) const;
 
     void WriteMarker(VkSemaphore vk_semaphore, VkCommandBuffer vk_command_buffer,
                      VkPipelineStageFlagBits vk_pipeline_stage, uint64_t value, SemaphoreModifierInfo modifier_info);
 
-    std::vector<TrackedSemaphoreInfo> GetTrackedSemaphoreInfos(const std::vector<SemInfo>& semaphores);
+    std::vector<TrackedSemaphoreInfo> GetTrackedSemaphoreInfos(const SemInfo* semaphores, size_t count);
 
     std::string PrintTrackedSemaphoreInfos(const std::vector<TrackedSemaphoreInfo>& tracked_semaphores,
                                            const char* tab) const;
 
    private:
     Device& device_;
-    BufferMarkerMgr markers_;
+    BufferMarkerMgr& markers_;
     bool track_semaphores_last_setter_ = false;
 
     struct SemaphoreInfo {
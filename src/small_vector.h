@@ -0,0 +1,137 @@
+/*
+ Copyright 2024 LunarG, Inc.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace crash_diagnostic_layer {
+
+//
+// SmallVector is a vector of trivially copyable elements that keeps the first
+// N of them inline, so short arrays never touch the heap. It only grows, and
+// clear() keeps any heap storage for reuse.
+//
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector elements are copied with memcpy");
+
+   public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() = default;
+    SmallVector(const SmallVector& other) { Append(other.data(), other.size()); }
+    SmallVector(SmallVector&& other) noexcept { *this = std::move(other); }
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            clear();
+            Append(other.data(), other.size());
+        }
+        return *this;
+    }
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+        if (other.heap_) {
+            heap_ = std::move(other.heap_);
+            capacity_ = other.capacity_;
+            size_ = other.size_;
+            other.capacity_ = N;
+        } else {
+            clear();
+            Append(other.data(), other.size());
+        }
+        other.size_ = 0;
+        return *this;
+    }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            Grow(capacity_ * 2);
+        }
+        data()[size_++] = value;
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity > capacity_) {
+            Grow(capacity);
+        }
+    }
+
+    void clear() { size_ = 0; }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return capacity_; }
+
+    T* data() { return heap_ ? heap_.get() : reinterpret_cast<T*>(inline_); }
+    const T* data() const { return heap_ ? heap_.get() : reinterpret_cast<const T*>(inline_); }
+
+    T& operator[](size_t index) {
+        assert(index < size_);
+        return data()[index];
+    }
+    const T& operator[](size_t index) const {
+        assert(index < size_);
+        return data()[index];
+    }
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+   private:
+    void Append(const T* values, size_t count) {
+        reserve(size_ + count);
+        if (count > 0) {
+            std::memcpy(data() + size_, values, count * sizeof(T));
+        }
+        size_ += count;
+    }
+
+    void Grow(size_t capacity) {
+        std::unique_ptr<T[]> heap(new T[capacity]);
+        if (size_ > 0) {
+            std::memcpy(heap.get(), data(), size_ * sizeof(T));
+        }
+        heap_ = std::move(heap);
+        capacity_ = capacity;
+    }
+
+    size_t size_{0};
+    size_t capacity_{N};
+    std::unique_ptr<T[]> heap_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+};
+
+}  // namespace crash_diagnostic_layer
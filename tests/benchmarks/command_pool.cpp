@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class CommandPoolBenchmark : public CDLTestBase {};
+
+// Allocate a growing number of command buffers, free them one handle at a
+// time in an order that does not match allocation order, then destroy a pool
+// that still owns all of its command buffers. The time per handle is recorded
+// for each size so regressions to per-handle linear bookkeeping show up as a
+// per-handle cost that grows with the count.
+TEST_F(CommandPoolBenchmark, AllocateFreeScaling) {
+    const std::vector<uint32_t> counts{100, 1000, 10000, 100000};
+
+    InitInstance();
+    InitDevice();
+
+    for (auto count : counts) {
+        vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+        vk::CommandBufferAllocateInfo alloc_info(*pool, vk::CommandBufferLevel::ePrimary, count);
+
+        auto start = std::chrono::steady_clock::now();
+        {
+            vk::raii::CommandBuffers cmd_buffs(device_, alloc_info);
+            // Free every other command buffer from the back, the rest go from the front.
+            for (size_t i = cmd_buffs.size(); i >= 2; i -= 2) {
+                cmd_buffs[i - 1].clear();
+            }
+        }
+        auto free_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        {
+            vk::raii::CommandPool doomed_pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+            alloc_info.commandPool = *doomed_pool;
+            vk::raii::CommandBuffers cmd_buffs(device_, alloc_info);
+            // Leave the command buffers to the pool.
+            for (auto& cb : cmd_buffs) {
+                (void)cb.release();
+            }
+        }
+        auto destroy_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        RecordProperty("free_ns_per_cb_" + std::to_string(count), std::to_string(free_ns.count() / count));
+        RecordProperty("pool_destroy_ns_per_cb_" + std::to_string(count), std::to_string(destroy_ns.count() / count));
+    }
+}
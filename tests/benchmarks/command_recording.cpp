@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "bound_image.h"
+#include "compute_pipeline.h"
+#include "graphics_pipeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class CommandRecordingBenchmark : public CDLTestBase {
+   protected:
+    // Create a device with dynamic rendering and a pipeline that draws a
+    // triangle into a 256x256 color target.
+    void InitRendering();
+    // Bind the pipeline and begin rendering into cmd_buff_.
+    void BeginRendering();
+
+    // Record kCommandsPerClass calls of record(cmd_buff_) into a fresh
+    // command buffer and return the best time per command over a few passes.
+    // The calls are recorded inside a render pass if in_rendering is set,
+    // otherwise with compute_ bound if it was created.
+    template <typename Fn>
+    int64_t NsPerCommand(bool in_rendering, Fn&& record);
+
+    static constexpr uint32_t kCommandsPerClass = 100000;
+
+    std::optional<BoundImage> image_;
+    vk::raii::ImageView view_{nullptr};
+    std::optional<GraphicsPipelineHelper> pipeline_;
+    std::optional<ComputePipelineHelper> compute_;
+};
+
+template <typename Fn>
+int64_t CommandRecordingBenchmark::NsPerCommand(bool in_rendering, Fn&& record) {
+    constexpr uint32_t kNumPasses = 3;
+
+    int64_t best_ns = std::numeric_limits<int64_t>::max();
+    for (uint32_t pass = 0; pass < kNumPasses; ++pass) {
+        cmd_pool_.reset();
+        cmd_buff_.begin(vk::CommandBufferBeginInfo());
+        if (in_rendering) {
+            BeginRendering();
+        } else if (compute_) {
+            cmd_buff_.bindPipeline(vk::PipelineBindPoint::eCompute, compute_->Pipeline());
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kCommandsPerClass; ++i) {
+            record(cmd_buff_);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        if (in_rendering) {
+            cmd_buff_.endRendering();
+        }
+        cmd_buff_.end();
+        best_ns = std::min<int64_t>(best_ns, elapsed.count());
+    }
+    return best_ns / kCommandsPerClass;
+}
+
+void CommandRecordingBenchmark::InitRendering() {
+    InitInstance();
+    auto chain = vk::StructureChain<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDynamicRenderingFeatures>();
+    chain.get<vk::PhysicalDeviceDynamicRenderingFeatures>().dynamicRendering = vk::True;
+    InitDevice({}, &chain.get<vk::PhysicalDeviceFeatures2>());
+
+    const char vs_source[] = R"glsl(
+    #version 450
+    void main() {
+        gl_Position = vec4(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1), 0, 1);
+    }
+    )glsl";
+    const char fs_source[] = R"glsl(
+    #version 460
+    layout(location = 0) out vec4 uFragColor;
+    void main(){
+       uFragColor = vec4(0,1,0,1);
+    }
+    )glsl";
+
+    vk::ImageCreateInfo create_info;
+    create_info.imageType = vk::ImageType::e2D;
+    create_info.format = vk::Format::eR8G8B8A8Unorm;
+    create_info.extent = vk::Extent3D(256, 256, 1);
+    create_info.mipLevels = 1;
+    create_info.arrayLayers = 1;
+    create_info.usage = vk::ImageUsageFlagBits::eColorAttachment;
+    image_.emplace(physical_device_, device_, create_info, "render_target");
+
+    vk::ImageViewCreateInfo view_create_info;
+    view_create_info.viewType = vk::ImageViewType::e2D;
+    view_create_info.format = create_info.format;
+    view_create_info.image = image_->image;
+    view_create_info.subresourceRange = vk::ImageSubresourceRange(vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1);
+    view_ = vk::raii::ImageView(device_, view_create_info);
+
+    // The shaders don't use the binding, it only gives the pipeline layout a set.
+    const std::vector<vk::DescriptorSetLayoutBinding> bindings{
+        {0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eVertex},
+    };
+    pipeline_.emplace(device_, vs_source, fs_source, bindings);
+}
+
+void CommandRecordingBenchmark::BeginRendering() {
+    cmd_buff_.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline_->Pipeline());
+    vk::RenderingAttachmentInfo attachment(*view_, vk::ImageLayout::eColorAttachmentOptimal);
+    cmd_buff_.beginRendering(vk::RenderingInfo({}, {{0, 0}, {256, 256}}, 1, {}, attachment));
+}
+
+// Record 50k draws, each inside its own debug label, and record the time per
+// draw. The pool is reset between passes like it would be every frame, so
+// later passes show the cost once the recorder's memory is reused.
+TEST_F(CommandRecordingBenchmark, LabelledDraws) {
+    constexpr uint32_t kNumDraws = 50000;
+    constexpr uint32_t kNumPasses = 5;
+
+    InitRendering();
+
+    std::vector<int64_t> pass_ns;
+    for (uint32_t pass = 0; pass < kNumPasses; ++pass) {
+        cmd_pool_.reset();
+        auto start = std::chrono::steady_clock::now();
+        cmd_buff_.begin(vk::CommandBufferBeginInfo());
+        BeginRendering();
+        for (uint32_t i = 0; i < kNumDraws; ++i) {
+            cmd_buff_.beginDebugUtilsLabelEXT(vk::DebugUtilsLabelEXT("draw"));
+            cmd_buff_.draw(3, 1, 0, 0);
+            cmd_buff_.endDebugUtilsLabelEXT();
+        }
+        cmd_buff_.endRendering();
+        cmd_buff_.end();
+        pass_ns.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    queue_.submit(vk::SubmitInfo({}, {}, *cmd_buff_, {}));
+    queue_.waitIdle();
+
+    RecordProperty("first_pass_ns_per_draw", std::to_string(pass_ns.front() / kNumDraws));
+    RecordProperty("ns_per_draw", std::to_string(*std::min_element(pass_ns.begin() + 1, pass_ns.end()) / kNumDraws));
+}
+
+// Time per recorded command for trivial commands, whose arguments are all
+// scalars or handles, and for commands that carry arrays or structures.
+TEST_F(CommandRecordingBenchmark, NsPerCommandClass) {
+    InitRendering();
+
+    const char cs_source[] = R"glsl(
+    #version 450
+    layout(local_size_x = 1) in;
+    void main() {}
+    )glsl";
+    const std::vector<vk::DescriptorSetLayoutBinding> bindings{
+        {0, vk::DescriptorType::eStorageBuffer, 1, vk::ShaderStageFlagBits::eCompute},
+    };
+    compute_.emplace(device_, cs_source, bindings);
+
+    InitCopyBuffers();
+
+    const auto graphics_pipeline = pipeline_->Pipeline();
+    const auto graphics_layout = pipeline_->PipelineLayout();
+    const auto graphics_set = pipeline_->DescriptorSet().Set();
+
+    // Trivial commands.
+    RecordProperty("draw_ns", std::to_string(NsPerCommand(true, [](auto& cb) { cb.draw(3, 1, 0, 0); })));
+    RecordProperty("set_line_width_ns", std::to_string(NsPerCommand(true, [](auto& cb) { cb.setLineWidth(1.0f); })));
+    RecordProperty("bind_pipeline_ns", std::to_string(NsPerCommand(true, [&](auto& cb) {
+                       cb.bindPipeline(vk::PipelineBindPoint::eGraphics, graphics_pipeline);
+                   })));
+    RecordProperty("dispatch_ns", std::to_string(NsPerCommand(false, [](auto& cb) { cb.dispatch(1, 1, 1); })));
+
+    // Commands with arrays or structures.
+    const vk::Viewport viewport(0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f);
+    RecordProperty("set_viewport_ns",
+                   std::to_string(NsPerCommand(true, [&](auto& cb) { cb.setViewport(0, viewport); })));
+    RecordProperty("bind_descriptor_sets_ns", std::to_string(NsPerCommand(true, [&](auto& cb) {
+                       cb.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, graphics_layout, 0, graphics_set, {});
+                   })));
+    const vk::MemoryBarrier barrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eTransferRead);
+    RecordProperty("pipeline_barrier_ns", std::to_string(NsPerCommand(false, [&](auto& cb) {
+                       cb.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eTransfer,
+                                          {}, barrier, {}, {});
+                   })));
+    RecordProperty("copy_buffer_ns", std::to_string(NsPerCommand(false, [this](auto& cb) { RecordCopy(cb); })));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "dump_file.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vulkan/vulkan_raii.hpp>
+
+class GpuCrashBenchmark : public CDLTestBase {};
+
+// Dump a command buffer with 100k commands and record how long the failing
+// wait took and how big the dump was. Every command is dumped, so this mostly
+// measures the cost of writing the dump.
+TEST_F(GpuCrashBenchmark, LargeDump) {
+    constexpr uint32_t kNumCopies = 100000;
+
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    for (uint32_t i = 0; i < kNumCopies; ++i) {
+        RecordCopy(cmd_buff_);
+    }
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+
+    RecordProperty("dump_ms", std::to_string(elapsed.count()));
+    RecordProperty("dump_bytes", std::to_string(std::filesystem::file_size(dump_file.full_path)));
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    ASSERT_GE(dump_file.devices[0].command_buffers[0].commands.size(), kNumCopies + 3);
+}
+
+// Dumping only the running commands should take time proportional to the
+// commands printed, not to the size of the command buffer.
+TEST_F(GpuCrashBenchmark, LargeDumpRunning) {
+    constexpr uint32_t kNumCopies = 1000000;
+
+    layer_settings_.SetDumpCommands("running");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    for (uint32_t i = 0; i < kNumCopies; ++i) {
+        RecordCopy(cmd_buff_);
+    }
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+
+    RecordProperty("dump_ms", std::to_string(elapsed.count()));
+    RecordProperty("dump_bytes", std::to_string(std::filesystem::file_size(dump_file.full_path)));
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+}
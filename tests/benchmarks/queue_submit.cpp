@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class QueueSubmitBenchmark : public CDLTestBase {
+   protected:
+    // Submit 10k times, 8 command buffers per submit, and record the submit
+    // rate. Waiting for the queue now and then lets the layer retire and
+    // reuse its submission records, as it would in a frame loop.
+    void MeasureSubmitRate(const std::string& name);
+};
+
+void QueueSubmitBenchmark::MeasureSubmitRate(const std::string& name) {
+    constexpr uint32_t kNumSubmits = 10000;
+    constexpr uint32_t kBuffersPerSubmit = 8;
+    constexpr uint32_t kSubmitsPerWait = 64;
+
+    InitInstance();
+    InitDevice();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(
+        device_, vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, kBuffersPerSubmit));
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (auto& cb : cmd_buffs) {
+        cb.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eSimultaneousUse));
+        cb.end();
+        submit_buffers.push_back(*cb);
+    }
+    vk::SubmitInfo submit_info({}, {}, submit_buffers, {});
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kNumSubmits; ++i) {
+        queue_.submit(submit_info);
+        if ((i + 1) % kSubmitsPerWait == 0) {
+            queue_.waitIdle();
+        }
+    }
+    queue_.waitIdle();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    int64_t submits_per_sec = elapsed.count() > 0 ? int64_t(kNumSubmits) * 1000000 / elapsed.count() : 0;
+    RecordProperty(name + "_submits_per_sec", std::to_string(submits_per_sec));
+}
+
+TEST_F(QueueSubmitBenchmark, Rate) { MeasureSubmitRate("unbatched"); }
+
+TEST_F(QueueSubmitBenchmark, BatchedRate) {
+    layer_settings_.batch_queue_submits = true;
+    MeasureSubmitRate("batched");
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+class ThreadingBenchmark : public CDLTestBase {};
+
+// Resident set size in bytes, or 0 where it is not available.
+static size_t ResidentSetSize() {
+#if defined(__linux__)
+    size_t pages = 0;
+    size_t resident = 0;
+    std::ifstream statm("/proc/self/statm");
+    if (statm >> pages >> resident) {
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+// Name and destroy a million buffers from several threads. Half of the names
+// are unique, the other half are shared, like the per-frame staging buffers
+// of a streaming engine. Names must be dropped on destroy, so the layer's
+// memory must not grow with the number of objects ever named.
+TEST_F(ThreadingBenchmark, ObjectNameChurn) {
+    constexpr uint32_t kNumThreads = 4;
+    constexpr uint32_t kObjectsPerThread = 250000;
+
+    InitInstance();
+    InitDevice();
+
+    auto rss_before = ResidentSetSize();
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([this, t]() {
+            vk::BufferCreateInfo buffer_ci({}, 256, vk::BufferUsageFlagBits::eTransferSrc);
+            for (uint32_t i = 0; i < kObjectsPerThread; ++i) {
+                vk::raii::Buffer buffer(device_, buffer_ci);
+                std::string name = (i % 2) ? "staging" : "transient_" + std::to_string(t) + "_" + std::to_string(i);
+                SetObjectName(device_, buffer, name);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    auto rss_after = ResidentSetSize();
+
+    RecordProperty("ns_per_object", std::to_string(elapsed.count() / (kNumThreads * kObjectsPerThread)));
+    RecordProperty("rss_growth_kb", std::to_string((rss_after > rss_before ? rss_after - rss_before : 0) / 1024));
+}
+
+// Record into several command buffers per thread from a growing number of
+// threads, switching command buffer on every command so each call looks up a
+// different CommandBuffer. The wall time divided by the commands each thread
+// records stays flat as threads are added unless the lookups contend.
+TEST_F(ThreadingBenchmark, InterleavedRecording) {
+    const std::vector<uint32_t> thread_counts{1, 2, 4, 8};
+    constexpr uint32_t kBuffersPerThread = 4;
+    constexpr uint32_t kCommandsPerThread = 200000;
+
+    InitInstance();
+    InitDevice();
+
+    for (auto num_threads : thread_counts) {
+        std::vector<vk::raii::CommandPool> pools;
+        std::vector<vk::raii::CommandBuffers> buffers;
+        for (uint32_t t = 0; t < num_threads; ++t) {
+            pools.emplace_back(device_, vk::CommandPoolCreateInfo({}, qfi_));
+            vk::CommandBufferAllocateInfo alloc_info(*pools.back(), vk::CommandBufferLevel::ePrimary,
+                                                     kBuffersPerThread);
+            buffers.emplace_back(device_, alloc_info);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&cmd_buffs = buffers[t]]() {
+                for (auto &cb : cmd_buffs) {
+                    cb.begin(vk::CommandBufferBeginInfo());
+                }
+                for (uint32_t i = 0; i < kCommandsPerThread; ++i) {
+                    cmd_buffs[i % kBuffersPerThread].setLineWidth(1.0f);
+                }
+                for (auto &cb : cmd_buffs) {
+                    cb.end();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        RecordProperty("ns_per_command_" + std::to_string(num_threads) + "_threads",
+                       std::to_string(elapsed.count() / kCommandsPerThread));
+    }
+}
+
+// Drive a growing number of devices from a pool of threads, every thread
+// moving to a different device on each call so per-thread caching of the
+// device dispatch data cannot help. The wall time divided by the commands each
+// thread records should not grow with the number of devices.
+TEST_F(ThreadingBenchmark, ManyDevicesDispatchLookup) {
+    const std::vector<uint32_t> device_counts{1, 2, 4};
+    constexpr uint32_t kNumThreads = 8;
+    constexpr uint32_t kCommandsPerThread = 200000;
+
+    InitInstance();
+    InitDevice();
+
+    float priority = 0.0f;
+    vk::DeviceQueueCreateInfo queue_ci({}, qfi_, 1, &priority);
+    vk::DeviceCreateInfo device_ci({}, queue_ci, {}, {}, nullptr, nullptr);
+
+    for (auto num_devices : device_counts) {
+        std::vector<vk::raii::Device> devices;
+        for (uint32_t d = 0; d < num_devices; ++d) {
+            devices.emplace_back(physical_device_, device_ci);
+        }
+
+        // One pool per (thread, device) pair so the pools stay externally synchronized.
+        std::vector<vk::raii::CommandPool> pools;
+        std::vector<vk::raii::CommandBuffers> buffers;
+        for (uint32_t t = 0; t < kNumThreads; ++t) {
+            for (auto &device : devices) {
+                pools.emplace_back(device, vk::CommandPoolCreateInfo({}, qfi_));
+                vk::CommandBufferAllocateInfo alloc_info(*pools.back(), vk::CommandBufferLevel::ePrimary, 1);
+                buffers.emplace_back(device, alloc_info);
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < kNumThreads; ++t) {
+            threads.emplace_back([&buffers, num_devices, t]() {
+                auto cmd_buff = [&buffers, num_devices, t](uint32_t d) -> vk::raii::CommandBuffer & {
+                    return buffers[t * num_devices + d].front();
+                };
+                for (uint32_t d = 0; d < num_devices; ++d) {
+                    cmd_buff(d).begin(vk::CommandBufferBeginInfo());
+                }
+                for (uint32_t i = 0; i < kCommandsPerThread; ++i) {
+                    cmd_buff((t + i) % num_devices).setLineWidth(1.0f);
+                }
+                for (uint32_t d = 0; d < num_devices; ++d) {
+                    cmd_buff(d).end();
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        RecordProperty("ns_per_command_" + std::to_string(num_devices) + "_devices",
+                       std::to_string(elapsed.count() / kCommandsPerThread));
+    }
+}
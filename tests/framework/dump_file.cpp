@@ -16,8 +16,11 @@
  * limitations under the License.
  */
 #include "dump_file.h"
+#include "dump_emitter.h"
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
+#include <fstream>
+#include <iterator>
 #include <regex>
 
 namespace dump {
@@ -32,6 +35,29 @@ static void ParseSettings(std::map<std::string, std::string>& settings, const YA
     }
 }
 
+static void ParseInstrumentationPolicy(InstrumentationPolicy& policy, const YAML::Node& in_node) {
+    ASSERT_TRUE(in_node.IsMap());
+    for (const auto& node : in_node) {
+        std::string key = node.first.as<std::string>();
+        if (key == "mode") {
+            policy.mode = node.second.as<std::string>();
+        } else if (key == "everyNth") {
+            policy.everyNth = node.second.as<uint32_t>();
+        } else if (key == "labelRegions") {
+            ASSERT_TRUE(node.second.IsSequence());
+            for (const auto& elem : node.second) {
+                policy.labelRegions.push_back(elem.as<std::string>());
+            }
+        } else if (key == "widenAfterCrash") {
+            policy.widenAfterCrash = node.second.as<bool>();
+        } else if (key == "widened") {
+            policy.widened = node.second.as<bool>();
+        } else {
+            FAIL() << "Unkown InstrumentationPolicy key: " << key;
+        }
+    }
+}
+
 static void ParseAppInfo(Instance& instance, const YAML::Node& in_node) {
     for (const auto& node : in_node) {
         std::string key = node.first.as<std::string>();
@@ -185,6 +211,8 @@ static void ParseQueue(Queue& queue, const YAML::Node& in_node) {
             queue.completedSeq = node.second.as<uint64_t>();
         } else if (key == "submittedSeq") {
             queue.submittedSeq = node.second.as<uint64_t>();
+        } else if (key == "droppedSubmits") {
+            queue.droppedSubmits = node.second.as<uint64_t>();
         } else if (key == "IncompleteSubmits") {
             ASSERT_TRUE(node.second.IsSequence());
             for (const auto& elem : node.second) {
@@ -215,9 +243,18 @@ static void ParseCommand(Command& cmd, const YAML::Node& in_node) {
         } else if (key == "message") {
             cmd.message = node.second.as<std::string>();
         } else if (key == "parameters") {
-            // TODO
+            ASSERT_TRUE(node.second.IsMap());
+            for (const auto& param : node.second) {
+                if (param.second.IsScalar()) {
+                    cmd.parameters[param.first.as<std::string>()] = param.second.as<std::string>();
+                }
+            }
         } else if (key == "internalState") {
-            // TODO
+            ASSERT_TRUE(node.second.IsMap());
+            const auto& pipeline = node.second["pipeline"];
+            if (pipeline && pipeline["handle"]) {
+                ParseHandle(cmd.pipeline, pipeline["handle"]);
+            }
         } else if (key == "labels") {
             ASSERT_TRUE(node.second.IsSequence());
             for (const auto& elem : node.second) {
@@ -299,6 +336,29 @@ static void ParseWaitingThread(WaitingThread& wt, const YAML::Node& in_node) {
     }
 }
 
+static void ParseProgressSample(ProgressSample& sample, const YAML::Node& in_node) {
+    ASSERT_TRUE(in_node);
+    ASSERT_TRUE(in_node.IsMap());
+    for (const auto& node : in_node) {
+        std::string key = node.first.as<std::string>();
+        if (key == "queue") {
+            ParseHandle(sample.queue, node.second);
+        } else if (key == "msBeforeDump") {
+            sample.msBeforeDump = node.second.as<int64_t>();
+        } else if (key == "completedSeq") {
+            sample.completedSeq = node.second.as<uint64_t>();
+        } else if (key == "submittedSeq") {
+            sample.submittedSeq = node.second.as<uint64_t>();
+        } else if (key == "topCheckpointValue") {
+            sample.topCheckpointValue = node.second.as<uint32_t>();
+        } else if (key == "bottomCheckpointValue") {
+            sample.bottomCheckpointValue = node.second.as<uint32_t>();
+        } else {
+            FAIL() << "Unkown ProgressSample key: " << key;
+        }
+    }
+}
+
 static void ParseAddressRecord(AddressRecord& record, const YAML::Node& in_node) {
     ASSERT_TRUE(in_node);
     ASSERT_TRUE(in_node.IsMap());
@@ -314,6 +374,8 @@ static void ParseAddressRecord(AddressRecord& record, const YAML::Node& in_node)
             record.end = node.second.as<uint64_t>();
         } else if (key == "currentlyBound") {
             record.currentlyBound = node.second.as<bool>();
+        } else if (key == "msBeforeDump") {
+            record.msBeforeDump = node.second.as<int64_t>();
         } else {
             FAIL() << "Unkown AddressRecord key: " << key;
         }
@@ -332,10 +394,12 @@ static void ParseFaultAddressRange(FaultAddressRange& range, const YAML::Node& i
         } else if (key == "end") {
             range.end = node.second.as<uint64_t>();
         } else if (key == "matchingAddressRecords") {
-            ASSERT_FALSE(range.match.has_value());
-            AddressRecord rec;
-            ParseAddressRecord(rec, node.second);
-            range.match = rec;
+            ASSERT_TRUE(node.second.IsSequence());
+            for (const auto& elem : node.second) {
+                AddressRecord rec;
+                ParseAddressRecord(rec, elem);
+                range.matches.emplace_back(std::move(rec));
+            }
         } else if (key == "priorAddressRecord") {
             ASSERT_FALSE(range.prior.has_value());
             AddressRecord rec;
@@ -346,6 +410,13 @@ static void ParseFaultAddressRange(FaultAddressRange& range, const YAML::Node& i
             AddressRecord rec;
             ParseAddressRecord(rec, node.second);
             range.next = rec;
+        } else if (key == "unboundAddressRecords") {
+            ASSERT_TRUE(node.second.IsSequence());
+            for (const auto& elem : node.second) {
+                AddressRecord rec;
+                ParseAddressRecord(rec, elem);
+                range.unbound.emplace_back(std::move(rec));
+            }
         } else {
             FAIL() << "Unkown FaultAddressRange key: " << key;
         }
@@ -415,6 +486,8 @@ static void ParseDevice(Device& device, const YAML::Node& in_node) {
             device.vendorID = node.second.as<uint32_t>();
         } else if (key == "deviceID") {
             device.deviceID = node.second.as<uint32_t>();
+        } else if (key == "namedObjects") {
+            device.namedObjects = node.second.as<size_t>();
         } else if (key == "Queues") {
             ASSERT_TRUE(node.second.IsSequence());
             for (const auto& elem : node.second) {
@@ -436,6 +509,13 @@ static void ParseDevice(Device& device, const YAML::Node& in_node) {
                 ParseWaitingThread(wt, elem);
                 device.waiting_threads.emplace_back(std::move(wt));
             }
+        } else if (key == "ProgressHistory") {
+            ASSERT_TRUE(node.second.IsSequence());
+            for (const auto& elem : node.second) {
+                ProgressSample sample;
+                ParseProgressSample(sample, elem);
+                device.progress_history.emplace_back(std::move(sample));
+            }
         } else if (key == "extensions") {
             ASSERT_TRUE(node.second.IsSequence());
             for (const auto& elem : node.second) {
@@ -458,7 +538,8 @@ void Parse(File& dump_file, const std::filesystem::path& search_path) {
     for (; iter != end; ++iter) {
         // There should be only 1 dump file in the search path.
         // Check that instead of breaking out on the first one found.
-        if (iter->path().filename() == "cdl_dump.yaml") {
+        auto filename = iter->path().filename();
+        if (filename == "cdl_dump.yaml" || filename == "cdl_dump.cdlb") {
             ASSERT_TRUE(file.empty());
             file = iter->path();
             dump_file.full_path = iter->path();
@@ -466,7 +547,19 @@ void Parse(File& dump_file, const std::filesystem::path& search_path) {
     }
     ASSERT_FALSE(file.empty());
 
-    YAML::Node root = YAML::LoadFile(file.string());
+    YAML::Node root;
+    if (file.extension() == ".cdlb") {
+        // Binary dumps are checked through the YAML they convert to.
+        std::ifstream in(file, std::ios_base::in | std::ios_base::binary);
+        std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        ASSERT_TRUE(crash_diagnostic_layer::IsBinaryDump(data));
+        crash_diagnostic_layer::DumpEmitter os;
+        std::string error;
+        ASSERT_TRUE(crash_diagnostic_layer::ReadBinaryDump(data, os, &error)) << error;
+        root = YAML::Load(os.c_str());
+    } else {
+        root = YAML::LoadFile(file.string());
+    }
     ASSERT_TRUE(root);
     ASSERT_TRUE(root.IsMap());
     for (const auto& node : root) {
@@ -479,6 +572,8 @@ void Parse(File& dump_file, const std::filesystem::path& search_path) {
             dump_file.timeSinceStart = node.second.as<std::string>();
         } else if (key == "Settings") {
             ParseSettings(dump_file.settings, node.second);
+        } else if (key == "InstrumentationPolicy") {
+            ParseInstrumentationPolicy(dump_file.instrumentation_policy, node.second);
         } else if (key == "SystemInfo") {
             // TODO ParseSystemInfo(dump_file.systemInfo, node.second);
         } else if (key == "Instance") {
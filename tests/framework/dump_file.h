@@ -74,6 +74,7 @@ struct Queue {
     uint32_t flags{0};
     uint64_t completedSeq{0};
     uint64_t submittedSeq{0};
+    uint64_t droppedSubmits{0};
 
     std::vector<Submit> submits;
 };
@@ -85,6 +86,10 @@ struct Command {
     std::string state;
     std::string message;
     std::vector<std::string> labels;
+    // Parameters with scalar values, such as handles.
+    std::map<std::string, std::string> parameters;
+    // Pipeline bound for the command, from its internalState.
+    Handle pipeline;
 };
 
 struct CommandBuffer {
@@ -114,12 +119,22 @@ struct WaitingThread {
     std::vector<SemaphoreInfo> wait_semaphores;
 };
 
+struct ProgressSample {
+    Handle queue;
+    int64_t msBeforeDump{0};
+    uint64_t completedSeq{0};
+    uint64_t submittedSeq{0};
+    std::optional<uint32_t> topCheckpointValue;
+    std::optional<uint32_t> bottomCheckpointValue;
+};
+
 struct AddressRecord {
     uint64_t begin{0};
     uint64_t end{0};
     std::string type;
     Handle handle;
     bool currentlyBound{false};
+    int64_t msBeforeDump{0};
 };
 
 struct FaultAddressRange {
@@ -127,8 +142,9 @@ struct FaultAddressRange {
     uint64_t begin{0};
     uint64_t end{0};
     std::optional<AddressRecord> prior;
-    std::optional<AddressRecord> match;
+    std::vector<AddressRecord> matches;
     std::optional<AddressRecord> next;
+    std::vector<AddressRecord> unbound;
 };
 
 struct VendorInfo {
@@ -151,16 +167,26 @@ struct Device {
     std::string driverVersion;
     uint32_t vendorID{0};
     uint32_t deviceID{0};
+    size_t namedObjects{0};
 
     std::vector<std::string> extensions;
 
     std::vector<Queue> queues;
     std::vector<CommandBuffer> command_buffers;
     std::vector<WaitingThread> waiting_threads;
+    std::vector<ProgressSample> progress_history;
 
     std::optional<DeviceFaultInfo> fault_info;
 };
 
+struct InstrumentationPolicy {
+    std::string mode;
+    uint32_t everyNth{0};
+    std::vector<std::string> labelRegions;
+    bool widenAfterCrash{false};
+    bool widened{false};
+};
+
 struct File {
     std::filesystem::path full_path;
     std::string version;
@@ -168,6 +194,7 @@ struct File {
     std::string timeSinceStart;
 
     std::map<std::string, std::string> settings;
+    InstrumentationPolicy instrumentation_policy;
 
     Instance instance;
 
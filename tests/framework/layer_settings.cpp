@@ -25,6 +25,9 @@
 #define MakeBoolSetting(_name) \
     vk::LayerSettingEXT(kLayerSettingsName, #_name, vk::LayerSettingTypeEXT::eBool32, 1, &_name)
 
+#define MakeUint32Setting(_name) \
+    vk::LayerSettingEXT(kLayerSettingsName, #_name, vk::LayerSettingTypeEXT::eUint32, 1, &_name)
+
 #define MakeUint64Setting(_name) \
     vk::LayerSettingEXT(kLayerSettingsName, #_name, vk::LayerSettingTypeEXT::eUint64, 1, &_name)
 
@@ -37,6 +40,14 @@ LayerSettings::LayerSettings(const void* pnext)
 
         MakeBoolSetting(instrument_all_commands),
         MakeBoolSetting(sync_after_commands),
+        MakeBoolSetting(packed_checkpoints),
+        MakeStringSetting(instrumentation_mode),
+        MakeUint32Setting(instrument_every_nth),
+        MakeStringSetting(instrument_label_regions),
+        MakeBoolSetting(widen_after_crash),
+        MakeUint32Setting(marker_buffer_reserve),
+        MakeBoolSetting(batch_queue_submits),
+        MakeUint32Setting(max_tracked_submits),
 
         MakeBoolSetting(track_semaphores),
         MakeBoolSetting(trace_all_semaphores),
@@ -45,8 +56,10 @@ LayerSettings::LayerSettings(const void* pnext)
         MakeStringSetting(dump_command_buffers),
         MakeStringSetting(dump_commands),
         MakeStringSetting(dump_shaders),
+        MakeStringSetting(dump_format),
 
         MakeUint64Setting(watchdog_timeout_ms),
+        MakeUint64Setting(progress_sample_ms),
     },
     create_info_(settings_, pnext) {
     SetOutputPath("");
@@ -56,6 +69,9 @@ LayerSettings::LayerSettings(const void* pnext)
     SetDumpCommandBuffers("");
     SetDumpCommands("");
     SetDumpShaders("");
+    SetDumpFormat("");
+    SetInstrumentationMode("");
+    SetInstrumentLabelRegions("");
 }
 
 LayerSettings::~LayerSettings() {
@@ -63,6 +79,9 @@ LayerSettings::~LayerSettings() {
     free(message_severity);
     free(log_file);
     free(dump_shaders);
+    free(dump_format);
+    free(instrumentation_mode);
+    free(instrument_label_regions);
 }
 
 void LayerSettings::SetOutputPath(const char* s) {
@@ -99,3 +118,18 @@ void LayerSettings::SetDumpShaders(const char* s) {
     free(dump_shaders);
     dump_shaders = strdup(s);
 }
+
+void LayerSettings::SetDumpFormat(const char* s) {
+    free(dump_format);
+    dump_format = strdup(s);
+}
+
+void LayerSettings::SetInstrumentationMode(const char* s) {
+    free(instrumentation_mode);
+    instrumentation_mode = strdup(s);
+}
+
+void LayerSettings::SetInstrumentLabelRegions(const char* s) {
+    free(instrument_label_regions);
+    instrument_label_regions = strdup(s);
+}
@@ -35,9 +35,12 @@ class LayerSettings {
     void SetLogFile(const char*);
     void SetMessageSeverity(const char*);
     void SetDumpShaders(const char*);
+    void SetDumpFormat(const char*);
     void SetDumpQueueSubmits(const char*);
     void SetDumpCommandBuffers(const char*);
     void SetDumpCommands(const char*);
+    void SetInstrumentationMode(const char*);
+    void SetInstrumentLabelRegions(const char*);
 
     // logging section
     vk::Bool32 trace_on{false};
@@ -45,6 +48,12 @@ class LayerSettings {
     // commands section
     vk::Bool32 instrument_all_commands{false};
     vk::Bool32 sync_after_commands{false};
+    vk::Bool32 packed_checkpoints{false};
+    uint32_t instrument_every_nth{4};
+    vk::Bool32 widen_after_crash{false};
+    uint32_t marker_buffer_reserve{0};
+    vk::Bool32 batch_queue_submits{false};
+    uint32_t max_tracked_submits{0};
 
     // semaphores section
     vk::Bool32 track_semaphores{true};
@@ -52,6 +61,7 @@ class LayerSettings {
 
     // hang detection section
     uint64_t watchdog_timeout_ms{20000};
+    uint64_t progress_sample_ms{0};
 
    private:
     // these member names must match the setting name exactly.
@@ -59,9 +69,12 @@ class LayerSettings {
     char* log_file{nullptr};
     char* message_severity{nullptr};
     char* dump_shaders{nullptr};
+    char* dump_format{nullptr};
     char* dump_queue_submits{nullptr};
     char* dump_command_buffers{nullptr};
     char* dump_commands{nullptr};
+    char* instrumentation_mode{nullptr};
+    char* instrument_label_regions{nullptr};
 
     std::vector<vk::LayerSettingEXT> settings_;
     vk::LayerSettingsCreateInfoEXT create_info_;
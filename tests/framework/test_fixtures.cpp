@@ -169,6 +169,42 @@ void CDLTestBase::InitDevice(std::vector<const char*> extensions, const vk::Phys
     cmd_buff_ = std::move(vk::raii::CommandBuffers(device_, cmd_alloc_info).front());
 }
 
+void CDLTestBase::InitCopyBuffers() {
+    in_.emplace(physical_device_, device_, kCopyBuffSize, "in", vk::BufferUsageFlagBits::eTransferSrc);
+    in_->Set(1.0f, kCopyElems);
+    out_.emplace(physical_device_, device_, kCopyBuffSize, "out", vk::BufferUsageFlagBits::eTransferDst);
+    out_->Set(0.0f, kCopyElems);
+}
+
+void CDLTestBase::BeginHangLabel(vk::raii::CommandBuffer& cb) {
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cb.beginDebugUtilsLabelEXT(label);
+}
+
+void CDLTestBase::RecordCopy(vk::raii::CommandBuffer& cb) {
+    cb.copyBuffer(in_->buffer, out_->buffer, vk::BufferCopy(0, 0, sizeof(float)));
+}
+
+void CDLTestBase::RecordHungCopy(vk::raii::CommandBuffer& cb) {
+    BeginHangLabel(cb);
+    RecordCopy(cb);
+    cb.endDebugUtilsLabelEXT();
+}
+
+void CDLTestBase::SubmitHang(const vk::SubmitInfo& submit_info) {
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(submit_info);
+        queue_.waitIdle();
+    } catch (vk::SystemError&) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+}
+
 static EShLanguage FindLanguage(vk::ShaderStageFlagBits shader_type) {
     switch (shader_type) {
         case vk::ShaderStageFlagBits::eVertex:
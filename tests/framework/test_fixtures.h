@@ -19,6 +19,7 @@
 
 #include <vulkan/vulkan_raii.hpp>
 #include <filesystem>
+#include <optional>
 
 // Prevent conflicts between X.h and gtest
 #ifdef None
@@ -28,6 +29,7 @@
 #undef Bool
 #endif
 #include <gtest/gtest.h>
+#include "bound_buffer.h"
 #include "error_monitor.h"
 #include "layer_settings.h"
 
@@ -42,6 +44,17 @@ class CDLTestBase : public ::testing::Test {
 
     static void InitArgs(int argc, char* argv[]);
 
+    // Create the in_ and out_ buffers copied between by RecordCopy().
+    void InitCopyBuffers();
+    // Commands recorded inside this label hang on the test ICD.
+    static void BeginHangLabel(vk::raii::CommandBuffer& cb);
+    void RecordCopy(vk::raii::CommandBuffer& cb);
+    // A copy inside the hang label.
+    void RecordHungCopy(vk::raii::CommandBuffer& cb);
+    // Submit work that is expected to hang and check that the layer noticed.
+    // Callers should wrap this in ASSERT_NO_FATAL_FAILURE().
+    void SubmitHang(const vk::SubmitInfo& submit_info);
+
     static inline bool print_all_{false};
     static inline bool no_mock_icd_{false};
     static inline uint32_t phys_device_index_{~0u};
@@ -62,6 +75,11 @@ class CDLTestBase : public ::testing::Test {
 
     vk::raii::CommandPool cmd_pool_;
     vk::raii::CommandBuffer cmd_buff_;
+
+    static constexpr size_t kCopyElems = 256;
+    static constexpr VkDeviceSize kCopyBuffSize = kCopyElems * sizeof(float);
+    std::optional<BoundBuffer> in_;
+    std::optional<BoundBuffer> out_;
 };
 
 template <typename T>
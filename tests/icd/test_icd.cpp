@@ -625,6 +625,41 @@ static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceLayerProperties(VkPhysicalD
     return VK_SUCCESS;
 }
 
+// Only memory objects are reported, their base address is what
+// vkGetBufferDeviceAddress() hands out for buffers bound to them.
+static void ReportAddressBinding(VkDeviceMemory memory, VkDeviceAddress base, VkDeviceSize size,
+                                 VkDeviceAddressBindingTypeEXT binding_type) {
+    std::vector<DebugMessenger> messengers;
+    {
+        unique_lock_t lock(global_lock);
+        for (const auto& entry : debug_messenger_map) {
+            if ((entry.second.types & VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT) &&
+                (entry.second.severities & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT)) {
+                messengers.push_back(entry.second);
+            }
+        }
+    }
+    if (messengers.empty()) {
+        return;
+    }
+    auto binding = vku::InitStruct<VkDeviceAddressBindingCallbackDataEXT>();
+    binding.baseAddress = base;
+    binding.size = size;
+    binding.bindingType = binding_type;
+    auto object = vku::InitStruct<VkDebugUtilsObjectNameInfoEXT>();
+    object.objectType = VK_OBJECT_TYPE_DEVICE_MEMORY;
+    object.objectHandle = reinterpret_cast<uint64_t>(memory);
+    auto callback_data = vku::InitStruct<VkDebugUtilsMessengerCallbackDataEXT>(&binding);
+    callback_data.pMessage = "address binding";
+    callback_data.objectCount = 1;
+    callback_data.pObjects = &object;
+    for (const auto& messenger : messengers) {
+        messenger.callback(VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
+                           VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT, &callback_data,
+                           messenger.user_data);
+    }
+}
+
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
     auto* mem = new DeviceMemory(*pAllocateInfo);
@@ -636,12 +671,16 @@ static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMe
         return VK_ERROR_OUT_OF_DEVICE_MEMORY;
     }
     *pMemory = reinterpret_cast<VkDeviceMemory>(mem);
+    ReportAddressBinding(*pMemory, uintptr_t(mem->memory), mem->size, VK_DEVICE_ADDRESS_BINDING_TYPE_BIND_EXT);
     return VK_SUCCESS;
 }
 
 static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory,
                                              const VkAllocationCallbacks* pAllocator) {
     auto* mem = reinterpret_cast<DeviceMemory*>(memory);
+    if (mem) {
+        ReportAddressBinding(memory, uintptr_t(mem->memory), mem->size, VK_DEVICE_ADDRESS_BINDING_TYPE_UNBIND_EXT);
+    }
     delete mem;
 }
 
@@ -2322,4 +2361,20 @@ static VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer com
     cb->CmdBeginDebugUtilsLabel(pLabelInfo);
 }
 
+static VKAPI_ATTR VkResult VKAPI_CALL
+CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo,
+                             const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pMessenger) {
+    unique_lock_t lock(global_lock);
+    *pMessenger = (VkDebugUtilsMessengerEXT)global_unique_handle++;
+    debug_messenger_map[*pMessenger] = DebugMessenger{pCreateInfo->messageSeverity, pCreateInfo->messageType,
+                                                      pCreateInfo->pfnUserCallback, pCreateInfo->pUserData};
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger,
+                                                                const VkAllocationCallbacks* pAllocator) {
+    unique_lock_t lock(global_lock);
+    debug_messenger_map.erase(messenger);
+}
+
 }  // namespace icd
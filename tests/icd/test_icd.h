@@ -54,6 +54,15 @@ static std::unordered_map<VkPhysicalDevice, std::unordered_set<VkDisplayKHR>> di
 
 static std::unordered_map<VkDevice, std::unordered_map<VkImage, VkDeviceSize>> image_memory_size_map;
 
+// Messengers that asked for address binding reports, which the layer relies on.
+struct DebugMessenger {
+    VkDebugUtilsMessageSeverityFlagsEXT severities;
+    VkDebugUtilsMessageTypeFlagsEXT types;
+    PFN_vkDebugUtilsMessengerCallbackEXT callback;
+    void* user_data;
+};
+static std::unordered_map<VkDebugUtilsMessengerEXT, DebugMessenger> debug_messenger_map;
+
 static constexpr uint32_t icd_swapchain_image_count = 1;
 static std::unordered_map<VkSwapchainKHR, VkImage[icd_swapchain_image_count]> swapchain_image_map;
 
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "bound_buffer.h"
+#include "dump_file.h"
+
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class CommandPool : public CDLTestBase {};
+
+// Free command buffers one handle at a time in an order that does not match
+// allocation order, and destroy a pool that still owns all of its command
+// buffers. Only the command buffers that are still allocated may be dumped.
+TEST_F(CommandPool, AllocateFree) {
+    constexpr uint32_t kNumBuffers = 1000;
+
+    layer_settings_.SetDumpCommandBuffers("all");
+    InitInstance();
+    InitDevice();
+
+    constexpr size_t kNumElems = 256;
+    constexpr VkDeviceSize kBuffSize = kNumElems * sizeof(float);
+
+    BoundBuffer in(physical_device_, device_, kBuffSize, "in", vk::BufferUsageFlagBits::eTransferSrc);
+    in.Set(1.0f, kNumElems);
+
+    BoundBuffer out(physical_device_, device_, kBuffSize, "out", vk::BufferUsageFlagBits::eTransferDst);
+    out.Set(0.0f, kNumElems);
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::CommandBufferAllocateInfo alloc_info(*pool, vk::CommandBufferLevel::ePrimary, kNumBuffers);
+    vk::raii::CommandBuffers cmd_buffs(device_, alloc_info);
+    // Free every other command buffer from the back, name the ones that are kept.
+    for (size_t i = cmd_buffs.size(); i >= 2; i -= 2) {
+        cmd_buffs[i - 1].clear();
+        SetObjectName(device_, cmd_buffs[i - 2], "kept_" + std::to_string(i - 2));
+    }
+
+    {
+        vk::raii::CommandPool doomed_pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+        alloc_info.commandPool = *doomed_pool;
+        vk::raii::CommandBuffers doomed_buffs(device_, alloc_info);
+        // Leave the command buffers to the pool.
+        for (auto &cb : doomed_buffs) {
+            (void)cb.release();
+        }
+    }
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    vk::BufferCopy regions(0, 0, sizeof(float));
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cmd_buff_.beginDebugUtilsLabelEXT(label);
+    cmd_buff_.copyBuffer(in.buffer, out.buffer, regions);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(vk::SubmitInfo({}, {}, *cmd_buff_, {}));
+        queue_.waitIdle();
+    } catch (vk::SystemError &) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    // The submitted fixture command buffer and the kept half of the pool.
+    const auto &dumped_cbs = dump_file.devices[0].command_buffers;
+    ASSERT_EQ(dumped_cbs.size(), 1 + kNumBuffers / 2);
+    size_t num_kept = 0;
+    for (const auto &dumped_cb : dumped_cbs) {
+        if (dumped_cb.handle.name.rfind("kept_", 0) == 0) {
+            ++num_kept;
+        }
+    }
+    ASSERT_EQ(num_kept, kNumBuffers / 2);
+}
+
+// Record into every command buffer of a pool, reset the pool and record a
+// shorter, hanging command stream. The dump must only contain the commands of
+// the second recording and the checkpoint must be usable after the reset.
+TEST_F(CommandPool, ResetRerecord) {
+    constexpr uint32_t kNumBuffers = 16;
+    constexpr uint32_t kFirstRecordingCommands = 100;
+
+    InitInstance();
+    InitDevice();
+
+    constexpr size_t kNumElems = 256;
+    constexpr VkDeviceSize kBuffSize = kNumElems * sizeof(float);
+
+    BoundBuffer in(physical_device_, device_, kBuffSize, "in", vk::BufferUsageFlagBits::eTransferSrc);
+    in.Set(1.0f, kNumElems);
+
+    BoundBuffer out(physical_device_, device_, kBuffSize, "out", vk::BufferUsageFlagBits::eTransferDst);
+    out.Set(0.0f, kNumElems);
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::CommandBufferAllocateInfo alloc_info(*pool, vk::CommandBufferLevel::ePrimary, kNumBuffers);
+    vk::raii::CommandBuffers cmd_buffs(device_, alloc_info);
+
+    vk::BufferCopy regions(0, 0, sizeof(float));
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (auto &cb : cmd_buffs) {
+        cb.begin(vk::CommandBufferBeginInfo());
+        for (uint32_t i = 0; i < kFirstRecordingCommands; ++i) {
+            cb.copyBuffer(in.buffer, out.buffer, regions);
+        }
+        cb.end();
+        submit_buffers.push_back(*cb);
+    }
+    queue_.submit(vk::SubmitInfo({}, {}, submit_buffers, {}));
+    queue_.waitIdle();
+
+    pool.reset();
+
+    auto &cb = cmd_buffs.front();
+    cb.begin(vk::CommandBufferBeginInfo());
+    cb.copyBuffer(in.buffer, out.buffer, regions);
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cb.beginDebugUtilsLabelEXT(label);
+    cb.copyBuffer(in.buffer, out.buffer, regions);
+    cb.endDebugUtilsLabelEXT();
+    cb.end();
+
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(vk::SubmitInfo({}, {}, *cb, {}));
+        queue_.waitIdle();
+    } catch (vk::SystemError &) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &dumped_cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_EQ(dumped_cb.state, "INCOMPLETE");
+
+    // Ids: 1 vkBeginCommandBuffer, 2 vkCmdCopyBuffer, 3 vkCmdBeginDebugUtilsLabelEXT, 4 vkCmdCopyBuffer,
+    // 5 vkCmdEndDebugUtilsLabelEXT, 6 vkEndCommandBuffer
+    ASSERT_EQ(dumped_cb.lastCompletedCommand, 2);
+    ASSERT_EQ(dumped_cb.lastStartedCommand, 4);
+    for (const auto &cmd : dumped_cb.commands) {
+        ASSERT_LE(cmd.id, 6);
+    }
+}
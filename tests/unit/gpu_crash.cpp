@@ -16,13 +16,19 @@
  * limitations under the License.
  */
 #include "test_fixtures.h"
+#include "bound_buffer.h"
 #include "bound_image.h"
 #include "compute_pipeline.h"
 #include "graphics_pipeline.h"
 #include "dump_file.h"
 #include "shaders.h"
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 class GpuCrash : public CDLTestBase {};
@@ -175,6 +181,53 @@ TEST_F(GpuCrash, InfiniteLoop) {
     dump::Parse(dump_file, output_path_);
 }
 
+// The bound pipeline of a command far from the start of the command buffer
+// comes from the nearest state keyframe.
+TEST_F(GpuCrash, InternalStateKeyframes) {
+    constexpr uint32_t kNumBarriers = 5000;
+
+    layer_settings_.SetDumpCommands("running");
+    InitInstance();
+    InitDevice();
+
+    ComputeIOTest state(physical_device_, device_, kInfiniteLoopComp);
+    state.input.Set(uint32_t(65535), ComputeIOTest::kNumElems);
+    state.output.Set(0.0f, ComputeIOTest::kNumElems);
+
+    vk::CommandBufferBeginInfo begin_info;
+    cmd_buff_.begin(begin_info);
+    cmd_buff_.bindPipeline(vk::PipelineBindPoint::eCompute, state.pipeline.Pipeline());
+    cmd_buff_.bindDescriptorSets(vk::PipelineBindPoint::eCompute, state.pipeline.PipelineLayout(), 0,
+                                 state.pipeline.DescriptorSet().Set(), {});
+    for (uint32_t i = 0; i < kNumBarriers; ++i) {
+        cmd_buff_.pipelineBarrier(vk::PipelineStageFlagBits::eComputeShader, vk::PipelineStageFlagBits::eComputeShader,
+                                  {}, {}, {}, {});
+    }
+    BeginHangLabel(cmd_buff_);
+    cmd_buff_.dispatch(1, 1, 1);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    // Only the commands around the hang are dumped.
+    ASSERT_LT(cb.commands.size(), kNumBarriers);
+    bool found_dispatch = false;
+    for (const auto &cmd : cb.commands) {
+        if (cmd.name == "vkCmdDispatch") {
+            found_dispatch = true;
+            ASSERT_EQ(cmd.pipeline.value, uint64_t(VkPipeline(state.pipeline.Pipeline())));
+        }
+    }
+    ASSERT_TRUE(found_dispatch);
+}
+
 TEST_F(GpuCrash, InfiniteLoopSubmit2) {
     InitInstance();
 
@@ -362,6 +415,81 @@ TEST_F(GpuCrash, ReadBeforePointerPushConstant) {
     }
 }
 
+// Address binding reports come from a single instance level messenger. Each
+// one must be recorded by the device that owns the reported memory, so the
+// fault on one device only matches records of its own allocations.
+TEST_F(GpuCrash, AddressBindingTwoDevices) {
+    InitInstance();
+    auto props = physical_device_.getProperties();
+    if (props.deviceType != vk::PhysicalDeviceType::eVirtualGpu) {
+        GTEST_SKIP() << " This test only works on the test ICD";
+    }
+    vk::StructureChain<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceBufferDeviceAddressFeatures> chain;
+    chain.get<vk::PhysicalDeviceBufferDeviceAddressFeatures>().bufferDeviceAddress = VK_TRUE;
+    const auto &features2 = chain.get<vk::PhysicalDeviceFeatures2>();
+    InitDevice({}, &features2);
+
+    float priority = 0.0f;
+    vk::DeviceQueueCreateInfo queue_ci({}, qfi_, 1, &priority);
+    vk::raii::Device other_device(physical_device_, vk::DeviceCreateInfo({}, queue_ci, {}, {}, nullptr, &features2));
+
+    constexpr VkDeviceSize kBuffSize = 4096;
+    const auto usage = vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eShaderDeviceAddress;
+    BoundBuffer other(physical_device_, other_device, kBuffSize, "other", usage,
+                      vk::MemoryAllocateFlagBits::eDeviceAddress);
+    BoundBuffer faulting(physical_device_, device_, kBuffSize, "faulting", usage,
+                         vk::MemoryAllocateFlagBits::eDeviceAddress);
+    const uint64_t other_memory = uint64_t(VkDeviceMemory(*other.memory));
+    const uint64_t faulting_memory = uint64_t(VkDeviceMemory(*faulting.memory));
+
+    vk::DeviceAddress addr = device_.getBufferAddress(vk::BufferDeviceAddressInfo(*faulting.buffer));
+    ASSERT_NE(addr, 0);
+
+    // using non-hpp types because those try to do memory management on pointers in the fault info struct.
+    VkDeviceFaultAddressInfoEXT address_info{VK_DEVICE_FAULT_ADDRESS_TYPE_WRITE_INVALID_EXT, addr, 4};
+    auto fault_info = vku::InitStruct<VkDeviceFaultInfoEXT>();
+    strncpy(fault_info.description, "fault-description", sizeof(fault_info.description));
+    fault_info.pAddressInfos = &address_info;
+    auto counts = vku::InitStruct<VkDeviceFaultCountsEXT>(&fault_info, 1, 0, 0);
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cmd_buff_.beginDebugUtilsLabelEXT(label);
+    cmd_buff_.fillBuffer(*faulting.buffer, 0, vk::WholeSize, 0);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 2);
+
+    const dump::FaultAddressRange *fault_range = nullptr;
+    for (const auto &device : dump_file.devices) {
+        if (device.fault_info && !device.fault_info->fault_address_ranges.empty()) {
+            ASSERT_EQ(fault_range, nullptr);
+            ASSERT_EQ(device.fault_info->fault_address_ranges.size(), 1);
+            fault_range = &device.fault_info->fault_address_ranges[0];
+        }
+    }
+    ASSERT_NE(fault_range, nullptr);
+    ASSERT_FALSE(fault_range->matches.empty());
+    for (const auto &rec : fault_range->matches) {
+        ASSERT_EQ(rec.handle.value, faulting_memory);
+        ASSERT_TRUE(rec.currentlyBound);
+    }
+    if (fault_range->prior) {
+        ASSERT_NE(fault_range->prior->handle.value, other_memory);
+    }
+    if (fault_range->next) {
+        ASSERT_NE(fault_range->next->handle.value, other_memory);
+    }
+    for (const auto &rec : fault_range->unbound) {
+        ASSERT_NE(rec.handle.value, other_memory);
+    }
+}
+
 TEST_F(GpuCrash, VendorInfo) {
     InitInstance();
     auto props = physical_device_.getProperties();
@@ -451,3 +579,281 @@ TEST_F(GpuCrash, VendorInfo) {
         ASSERT_EQ(memcmp(data.data(), vendor_binary, file_size), 0);
     }
 }
+
+// With packed checkpoints only command ends are written. The dump must still
+// report the hung command as the one that started but didn't complete.
+TEST_F(GpuCrash, PackedCheckpoints) {
+    layer_settings_.packed_checkpoints = true;
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordCopy(cmd_buff_);
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_EQ(cb.state, "INCOMPLETE");
+
+    // Ids: 1 vkBeginCommandBuffer, 2 vkCmdCopyBuffer, 3 vkCmdBeginDebugUtilsLabelEXT, 4 vkCmdCopyBuffer
+    ASSERT_EQ(cb.lastCompletedCommand, 2);
+    ASSERT_EQ(cb.lastStartedCommand, 4);
+    bool found_hung_copy = false;
+    for (const auto &cmd : cb.commands) {
+        if (cmd.id == 4) {
+            ASSERT_EQ(cmd.name, "vkCmdCopyBuffer");
+            ASSERT_EQ(cmd.state, "INCOMPLETE");
+            found_hung_copy = true;
+        }
+    }
+    ASSERT_TRUE(found_hung_copy);
+}
+
+// Only instrument commands inside the "hang-expected" label. The copy outside
+// of it gets no checkpoints, so nothing is known to have completed.
+TEST_F(GpuCrash, LabelRegionInstrumentation) {
+    layer_settings_.SetInstrumentationMode("label_regions");
+    layer_settings_.SetInstrumentLabelRegions("some-other-label, hang-expected");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordCopy(cmd_buff_);
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    const auto &policy = dump_file.instrumentation_policy;
+    ASSERT_EQ(policy.mode, "label_regions");
+    ASSERT_EQ(policy.labelRegions.size(), 2);
+    ASSERT_EQ(policy.labelRegions[1], "hang-expected");
+    ASSERT_FALSE(policy.widened);
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    // Ids: 1 vkBeginCommandBuffer, 2 vkCmdCopyBuffer, 3 vkCmdBeginDebugUtilsLabelEXT, 4 vkCmdCopyBuffer
+    ASSERT_EQ(cb.lastCompletedCommand, 0);
+    ASSERT_EQ(cb.lastStartedCommand, 4);
+}
+
+// Let the progress sampler watch a few completed submits before a hang. The
+// dump must contain the sampled history, oldest first.
+TEST_F(GpuCrash, ProgressHistory) {
+    layer_settings_.progress_sample_ms = 1;
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers warmup_buffs(device_,
+                                          vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, 1));
+    auto &warmup = warmup_buffs.front();
+    warmup.begin(vk::CommandBufferBeginInfo());
+    RecordCopy(warmup);
+    warmup.end();
+    for (int i = 0; i < 4; ++i) {
+        queue_.submit(vk::SubmitInfo({}, {}, *warmup, {}));
+        queue_.waitIdle();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    const auto &history = dump_file.devices[0].progress_history;
+    ASSERT_FALSE(history.empty());
+    for (size_t i = 1; i < history.size(); ++i) {
+        ASSERT_GE(history[i - 1].msBeforeDump, history[i].msBeforeDump);
+        ASSERT_LE(history[i - 1].completedSeq, history[i].completedSeq);
+    }
+    ASSERT_GE(history.back().msBeforeDump, 0);
+}
+
+// Submit several command buffers in one VkSubmitInfo with batching enabled.
+// Progress must still be tracked per command buffer, so only the hung one is
+// reported as running.
+TEST_F(GpuCrash, BatchedSubmit) {
+    layer_settings_.batch_queue_submits = true;
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    constexpr uint32_t kNumBuffers = 3;
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(
+        device_, vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, kNumBuffers));
+
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (uint32_t i = 0; i < kNumBuffers; ++i) {
+        auto &cb = cmd_buffs[i];
+        SetObjectName(device_, cb, "cmd_buff_" + std::to_string(i));
+        cb.begin(vk::CommandBufferBeginInfo());
+        RecordCopy(cb);
+        if (i == 1) {
+            RecordHungCopy(cb);
+        }
+        cb.end();
+        submit_buffers.push_back(*cb);
+    }
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, submit_buffers, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &dumped_cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_EQ(dumped_cb.handle.name, "cmd_buff_1");
+    ASSERT_EQ(dumped_cb.state, "INCOMPLETE");
+}
+
+// The binary dump must hold the same information as the YAML one.
+TEST_F(GpuCrash, BinaryDump) {
+    layer_settings_.SetDumpFormat("binary");
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordCopy(cmd_buff_);
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.full_path.extension(), ".cdlb");
+    ASSERT_EQ(dump_file.settings["dump_format"], "binary");
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_EQ(cb.state, "INCOMPLETE");
+
+    // Ids: 1 vkBeginCommandBuffer, 2 vkCmdCopyBuffer, 3 vkCmdBeginDebugUtilsLabelEXT, 4 vkCmdCopyBuffer
+    ASSERT_GE(cb.commands.size(), 4);
+    ASSERT_EQ(cb.commands[1].name, "vkCmdCopyBuffer");
+    ASSERT_EQ(cb.commands[2].name, "vkCmdBeginDebugUtilsLabelEXT");
+    ASSERT_EQ(cb.commands[3].name, "vkCmdCopyBuffer");
+}
+
+// Label names that YAML reads as null must be quoted, or they come back as
+// null instead of the name.
+TEST_F(GpuCrash, NullLikeLabelNames) {
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    const std::vector<std::string> kNames{"~", "null", "Null", "NULL", ""};
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    for (const auto &name : kNames) {
+        cmd_buff_.beginDebugUtilsLabelEXT(vk::DebugUtilsLabelEXT(name.c_str()));
+    }
+    RecordHungCopy(cmd_buff_);
+    for (size_t i = 0; i < kNames.size(); ++i) {
+        cmd_buff_.endDebugUtilsLabelEXT();
+    }
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const dump::Command *copy = nullptr;
+    for (const auto &cmd : dump_file.devices[0].command_buffers[0].commands) {
+        if (cmd.name == "vkCmdCopyBuffer") {
+            copy = &cmd;
+        }
+    }
+    ASSERT_NE(copy, nullptr);
+    for (const auto &name : kNames) {
+        ASSERT_NE(std::find(copy->labels.begin(), copy->labels.end(), name), copy->labels.end()) << name;
+    }
+}
+
+// Dump every command of a command buffer with a few hundred commands. Timing
+// a much larger dump is done by GpuCrashBenchmark.LargeDump.
+TEST_F(GpuCrash, LargeDump) {
+    constexpr uint32_t kNumCopies = 500;
+
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    for (uint32_t i = 0; i < kNumCopies; ++i) {
+        RecordCopy(cmd_buff_);
+    }
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_GE(cb.commands.size(), kNumCopies + 3);
+    // Command 1 is vkBeginCommandBuffer, the copies follow in order.
+    for (uint32_t i = 1; i <= kNumCopies; ++i) {
+        ASSERT_EQ(cb.commands[i].id, i + 1);
+        ASSERT_EQ(cb.commands[i].name, "vkCmdCopyBuffer") << "command " << i;
+    }
+}
+
+// Dump only the running commands of a command buffer that spans several state
+// keyframe intervals, with the running window starting between two keyframes.
+TEST_F(GpuCrash, LargeDumpRunning) {
+    constexpr uint32_t kNumCopies = 5000;
+
+    layer_settings_.SetDumpCommands("running");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    for (uint32_t i = 0; i < kNumCopies; ++i) {
+        RecordCopy(cmd_buff_);
+    }
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    const auto &cb = dump_file.devices[0].command_buffers[0];
+    ASSERT_LT(cb.commands.size(), 16u);
+    for (const auto &cmd : cb.commands) {
+        ASSERT_GE(cmd.id, kNumCopies);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "linear_allocator.h"
+
+#include <memory>
+
+// After a burst of allocations, resetting the pool every frame with a small
+// working set must keep the burst's blocks cached for a full window of trims,
+// then shrink the cache back to what the recent frames needed.
+TEST(LinearAllocator, BlockCacheTrimsToRecentPeak) {
+    constexpr size_t kBlockSize = 1024;
+    constexpr size_t kBurstBlocks = 64;
+    constexpr size_t kFrameBlocks = 4;
+    constexpr size_t kTrimWindow = LinearAllocatorBlockCache::kTrimWindow;
+
+    auto cache = std::make_shared<LinearAllocatorBlockCache>(kBlockSize);
+    LinearAllocator<kBlockSize> allocator(cache);
+
+    // Allocate half blocks so every block the allocator adds is default sized
+    // and comes from the cache.
+    auto fill_blocks = [&allocator](size_t num_blocks) {
+        for (size_t i = 0; i < num_blocks * 2; ++i) {
+            ASSERT_NE(allocator.Alloc(kBlockSize / 2), nullptr);
+        }
+        ASSERT_EQ(allocator.NumBlocksAllocated(), num_blocks);
+    };
+    auto frame = [&]() {
+        fill_blocks(kFrameBlocks);
+        allocator.Reset();
+        cache->Trim();
+    };
+
+    ASSERT_NO_FATAL_FAILURE(fill_blocks(kBurstBlocks));
+    allocator.Reset();
+    // The allocator keeps its first block, the rest went back to the cache.
+    ASSERT_EQ(cache->NumCachedBlocks(), kBurstBlocks - 1);
+
+    // The burst is still within the last two windows of trims.
+    for (size_t i = 0; i < 2 * kTrimWindow; ++i) {
+        ASSERT_NO_FATAL_FAILURE(frame());
+        ASSERT_EQ(cache->NumCachedBlocks(), kBurstBlocks - 1) << "trim " << i;
+    }
+
+    // Only the frames' peak is left to keep.
+    for (size_t i = 0; i < 2 * kTrimWindow; ++i) {
+        ASSERT_NO_FATAL_FAILURE(frame());
+        ASSERT_EQ(cache->NumCachedBlocks(), kFrameBlocks - 1) << "trim " << i;
+    }
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "dump_file.h"
+
+#include <string>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class QueueSubmit : public CDLTestBase {
+   protected:
+    // Submit in a frame loop, so the layer retires and reuses its submission
+    // records, then hang. Earlier submits use more submit infos and command
+    // buffers than the last one, so the records reused for the last submit
+    // must not keep anything from before.
+    void CheckRecycledSubmissions();
+};
+
+void QueueSubmit::CheckRecycledSubmissions() {
+    constexpr uint32_t kNumSubmits = 200;
+    constexpr uint32_t kOldBuffers = 12;
+    constexpr uint32_t kSubmitsPerWait = 16;
+
+    layer_settings_.SetDumpQueueSubmits("pending");
+    InitInstance();
+    InitDevice();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(
+        device_, vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, kOldBuffers + 2));
+    std::vector<vk::CommandBuffer> old_buffers;
+    std::vector<vk::CommandBuffer> new_buffers;
+    for (uint32_t i = 0; i < cmd_buffs.size(); ++i) {
+        auto& cb = cmd_buffs[i];
+        cb.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eSimultaneousUse));
+        cb.end();
+        if (i < kOldBuffers) {
+            SetObjectName(device_, cb, "old_" + std::to_string(i));
+            old_buffers.push_back(*cb);
+        } else {
+            SetObjectName(device_, cb, "new_" + std::to_string(i - kOldBuffers));
+            new_buffers.push_back(*cb);
+        }
+    }
+
+    std::vector<vk::SubmitInfo> old_submit_infos(3, vk::SubmitInfo({}, {}, old_buffers, {}));
+    for (uint32_t i = 0; i < kNumSubmits; ++i) {
+        queue_.submit(old_submit_infos);
+        if ((i + 1) % kSubmitsPerWait == 0) {
+            queue_.waitIdle();
+        }
+    }
+    queue_.waitIdle();
+
+    SetObjectName(device_, cmd_buff_, "hung");
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cmd_buff_.beginDebugUtilsLabelEXT(label);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    std::vector<vk::SubmitInfo> submit_infos{vk::SubmitInfo({}, {}, new_buffers, {}),
+                                             vk::SubmitInfo({}, {}, *cmd_buff_, {})};
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(submit_infos);
+        queue_.waitIdle();
+    } catch (vk::SystemError&) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].queues.size(), 1);
+    const auto& queue = dump_file.devices[0].queues[0];
+    ASSERT_EQ(queue.droppedSubmits, 0);
+    // Everything before the hang completed and was retired.
+    ASSERT_EQ(queue.submits.size(), 1);
+    const auto& submit = queue.submits[0];
+    ASSERT_LE(submit.endSeq, queue.submittedSeq);
+    ASSERT_EQ(submit.SubmitInfos.size(), 2);
+    ASSERT_EQ(submit.SubmitInfos[0].CommandBuffers.size(), new_buffers.size());
+    for (const auto& cb : submit.SubmitInfos[0].CommandBuffers) {
+        ASSERT_NE(cb.find("[new_"), std::string::npos);
+    }
+    ASSERT_EQ(submit.SubmitInfos[1].CommandBuffers.size(), 1);
+    ASSERT_NE(submit.SubmitInfos[1].CommandBuffers[0].find("[hung]"), std::string::npos);
+    ASSERT_LT(submit.SubmitInfos[0].startSeq, submit.SubmitInfos[1].startSeq);
+}
+
+TEST_F(QueueSubmit, RecycledSubmissions) { CheckRecycledSubmissions(); }
+
+TEST_F(QueueSubmit, BatchedRecycledSubmissions) {
+    layer_settings_.batch_queue_submits = true;
+    CheckRecycledSubmissions();
+}
+
+// Submit a lot of work without ever waiting, then hang. Completed submissions
+// are retired as new ones come in, and max_tracked_submits bounds the ones
+// still in flight, so the dump can't hold the whole backlog.
+TEST_F(QueueSubmit, RetireOnSubmit) {
+    constexpr uint32_t kNumSubmits = 1000;
+    constexpr uint32_t kMaxTrackedSubmits = 8;
+
+    layer_settings_.max_tracked_submits = kMaxTrackedSubmits;
+    layer_settings_.SetDumpQueueSubmits("pending");
+    InitInstance();
+    InitDevice();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(device_,
+                                       vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, 1));
+    auto& cb = cmd_buffs.front();
+    cb.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eSimultaneousUse));
+    cb.end();
+    for (uint32_t i = 0; i < kNumSubmits; ++i) {
+        queue_.submit(vk::SubmitInfo({}, {}, *cb, {}));
+    }
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cmd_buff_.beginDebugUtilsLabelEXT(label);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(vk::SubmitInfo({}, {}, *cmd_buff_, {}));
+        queue_.waitIdle();
+    } catch (vk::SystemError&) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].queues.size(), 1);
+    ASSERT_LE(dump_file.devices[0].queues[0].submits.size(), kMaxTrackedSubmits);
+}
+
+// Hang the first submission, then keep submitting behind it. Nothing can
+// complete, so max_tracked_submits has to drop in-flight records, but never the
+// hung one at the front of the queue.
+TEST_F(QueueSubmit, KeepOldestInFlight) {
+    constexpr uint32_t kNumSubmits = 100;
+    constexpr uint32_t kMaxTrackedSubmits = 8;
+
+    layer_settings_.max_tracked_submits = kMaxTrackedSubmits;
+    layer_settings_.SetDumpQueueSubmits("pending");
+    InitInstance();
+    InitDevice();
+
+    SetObjectName(device_, cmd_buff_, "hung");
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    vk::DeviceFaultCountsEXT counts(0, 0, 0);
+    vk::DebugUtilsLabelEXT label("hang-expected", {}, &counts);
+    cmd_buff_.beginDebugUtilsLabelEXT(label);
+    cmd_buff_.endDebugUtilsLabelEXT();
+    cmd_buff_.end();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(device_,
+                                       vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, 1));
+    auto& cb = cmd_buffs.front();
+    SetObjectName(device_, cb, "behind");
+    cb.begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eSimultaneousUse));
+    cb.end();
+
+    bool hang_detected = false;
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    try {
+        queue_.submit(vk::SubmitInfo({}, {}, *cmd_buff_, {}));
+        for (uint32_t i = 0; i < kNumSubmits; ++i) {
+            queue_.submit(vk::SubmitInfo({}, {}, *cb, {}));
+        }
+        queue_.waitIdle();
+    } catch (vk::SystemError&) {
+        hang_detected = true;
+    }
+    monitor_.VerifyFound();
+    ASSERT_TRUE(hang_detected);
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].queues.size(), 1);
+    const auto& queue = dump_file.devices[0].queues[0];
+    ASSERT_LE(queue.submits.size(), kMaxTrackedSubmits);
+    ASSERT_EQ(queue.droppedSubmits + queue.submits.size(), kNumSubmits + 1);
+    ASSERT_EQ(queue.submits[0].SubmitInfos.size(), 1);
+    ASSERT_EQ(queue.submits[0].SubmitInfos[0].CommandBuffers.size(), 1);
+    ASSERT_NE(queue.submits[0].SubmitInfos[0].CommandBuffers[0].find("[hung]"), std::string::npos);
+    ASSERT_NE(queue.submits.back().SubmitInfos[0].CommandBuffers[0].find("[behind]"), std::string::npos);
+}
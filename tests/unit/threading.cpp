@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test_fixtures.h"
+#include "dump_file.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <vulkan/vulkan_raii.hpp>
+
+class Threading : public CDLTestBase {};
+
+// Record into several command buffers per thread from several threads at once,
+// switching command buffer on every command so each intercepted call has to
+// look up a different CommandBuffer. Every command must end up in the command
+// buffer it was recorded into.
+TEST_F(Threading, InterleavedRecording) {
+    constexpr uint32_t kNumThreads = 8;
+    constexpr uint32_t kBuffersPerThread = 4;
+    constexpr uint32_t kCommandsPerThread = 2000;
+
+    layer_settings_.SetDumpCommandBuffers("all");
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    std::vector<vk::raii::CommandPool> pools;
+    std::vector<vk::raii::CommandBuffers> buffers;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        pools.emplace_back(device_, vk::CommandPoolCreateInfo({}, qfi_));
+        vk::CommandBufferAllocateInfo alloc_info(*pools.back(), vk::CommandBufferLevel::ePrimary, kBuffersPerThread);
+        buffers.emplace_back(device_, alloc_info);
+        for (uint32_t i = 0; i < kBuffersPerThread; ++i) {
+            SetObjectName(device_, buffers.back()[i], "interleaved_" + std::to_string(t) + "_" + std::to_string(i));
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&cmd_buffs = buffers[t]]() {
+            for (auto &cb : cmd_buffs) {
+                cb.begin(vk::CommandBufferBeginInfo());
+            }
+            for (uint32_t i = 0; i < kCommandsPerThread; ++i) {
+                cmd_buffs[i % kBuffersPerThread].setLineWidth(1.0f);
+            }
+            for (auto &cb : cmd_buffs) {
+                cb.end();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (auto &cmd_buffs : buffers) {
+        for (auto &cb : cmd_buffs) {
+            submit_buffers.push_back(*cb);
+        }
+    }
+    queue_.submit(vk::SubmitInfo({}, {}, submit_buffers, {}));
+    queue_.waitIdle();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    size_t num_interleaved = 0;
+    for (const auto &cb : dump_file.devices[0].command_buffers) {
+        if (cb.handle.name.rfind("interleaved_", 0) != 0) {
+            continue;
+        }
+        ++num_interleaved;
+        // vkBeginCommandBuffer, this buffer's share of the commands and vkEndCommandBuffer.
+        ASSERT_EQ(cb.commands.size(), kCommandsPerThread / kBuffersPerThread + 2) << cb.handle.name;
+        for (size_t i = 1; i + 1 < cb.commands.size(); ++i) {
+            ASSERT_EQ(cb.commands[i].name, "vkCmdSetLineWidth") << cb.handle.name;
+        }
+    }
+    ASSERT_EQ(num_interleaved, kNumThreads * kBuffersPerThread);
+}
+
+// Drive several devices from a pool of threads, every thread moving to a
+// different device on each call so per-thread caching of the device dispatch
+// data cannot help. Every command must be recorded by the device it was
+// issued to.
+TEST_F(Threading, ManyDevicesDispatchLookup) {
+    constexpr uint32_t kNumDevices = 4;
+    constexpr uint32_t kNumThreads = 8;
+    constexpr uint32_t kCommandsPerThread = 2000;
+    const std::string kPrefix = "lookup_";
+
+    layer_settings_.SetDumpCommandBuffers("all");
+    layer_settings_.SetDumpCommands("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    float priority = 0.0f;
+    vk::DeviceQueueCreateInfo queue_ci({}, qfi_, 1, &priority);
+    vk::DeviceCreateInfo device_ci({}, queue_ci, {}, {}, nullptr, nullptr);
+
+    std::vector<vk::raii::Device> devices;
+    for (uint32_t d = 0; d < kNumDevices; ++d) {
+        devices.emplace_back(physical_device_, device_ci);
+    }
+
+    // One pool per (thread, device) pair so the pools stay externally synchronized.
+    std::vector<vk::raii::CommandPool> pools;
+    std::vector<vk::raii::CommandBuffers> buffers;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        for (uint32_t d = 0; d < kNumDevices; ++d) {
+            pools.emplace_back(devices[d], vk::CommandPoolCreateInfo({}, qfi_));
+            vk::CommandBufferAllocateInfo alloc_info(*pools.back(), vk::CommandBufferLevel::ePrimary, 1);
+            buffers.emplace_back(devices[d], alloc_info);
+            SetObjectName(devices[d], buffers.back().front(), kPrefix + std::to_string(d) + "_" + std::to_string(t));
+        }
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&buffers, t]() {
+            auto cmd_buff = [&buffers, t](uint32_t d) -> vk::raii::CommandBuffer & {
+                return buffers[t * kNumDevices + d].front();
+            };
+            for (uint32_t d = 0; d < kNumDevices; ++d) {
+                cmd_buff(d).begin(vk::CommandBufferBeginInfo());
+            }
+            for (uint32_t i = 0; i < kCommandsPerThread; ++i) {
+                cmd_buff((t + i) % kNumDevices).setLineWidth(1.0f);
+            }
+            for (uint32_t d = 0; d < kNumDevices; ++d) {
+                cmd_buff(d).end();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (uint32_t d = 0; d < kNumDevices; ++d) {
+        std::vector<vk::CommandBuffer> submit_buffers;
+        for (uint32_t t = 0; t < kNumThreads; ++t) {
+            submit_buffers.push_back(*buffers[t * kNumDevices + d].front());
+        }
+        auto queue = devices[d].getQueue(qfi_, 0);
+        queue.submit(vk::SubmitInfo({}, {}, submit_buffers, {}));
+        queue.waitIdle();
+    }
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1 + kNumDevices);
+    size_t num_lookup = 0;
+    for (const auto &device : dump_file.devices) {
+        std::string device_index;
+        for (const auto &cb : device.command_buffers) {
+            const auto &name = cb.handle.name;
+            if (name.rfind(kPrefix, 0) != 0) {
+                continue;
+            }
+            ++num_lookup;
+            // A dumped device only holds the command buffers of one test device.
+            auto index = name.substr(kPrefix.size(), name.find('_', kPrefix.size()) - kPrefix.size());
+            if (device_index.empty()) {
+                device_index = index;
+            }
+            ASSERT_EQ(index, device_index) << name;
+            // vkBeginCommandBuffer, this device's share of the commands and vkEndCommandBuffer.
+            ASSERT_EQ(cb.commands.size(), kCommandsPerThread / kNumDevices + 2) << name;
+        }
+    }
+    ASSERT_EQ(num_lookup, kNumDevices * kNumThreads);
+}
+
+// Allocate and free command buffers from several threads, each command buffer
+// owning a checkpoint, so checkpoint marker pairs are recycled through the
+// per-thread caches and the shared free list. Command buffers allocated
+// afterwards get recycled pairs, which must start from the new buffer's begin
+// value and track its execution.
+TEST_F(Threading, CheckpointRecycling) {
+    constexpr uint32_t kNumThreads = 8;
+    constexpr uint32_t kIterations = 200;
+    constexpr uint32_t kBuffersPerIteration = 16;
+    constexpr uint32_t kRecycledBuffers = 16;
+
+    layer_settings_.SetDumpCommandBuffers("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    std::vector<vk::raii::CommandPool> pools;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        pools.emplace_back(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([this, &pool = pools[t]]() {
+            vk::CommandBufferAllocateInfo alloc_info(*pool, vk::CommandBufferLevel::ePrimary, kBuffersPerIteration);
+            for (uint32_t i = 0; i < kIterations; ++i) {
+                vk::raii::CommandBuffers cmd_buffs(device_, alloc_info);
+                for (auto &cb : cmd_buffs) {
+                    cb.begin(vk::CommandBufferBeginInfo());
+                    cb.setLineWidth(1.0f);
+                    cb.end();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    vk::CommandBufferAllocateInfo alloc_info(*pools[0], vk::CommandBufferLevel::ePrimary, kRecycledBuffers);
+    vk::raii::CommandBuffers recycled(device_, alloc_info);
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (uint32_t i = 0; i < kRecycledBuffers; ++i) {
+        SetObjectName(device_, recycled[i], "recycled_" + std::to_string(i));
+        recycled[i].begin(vk::CommandBufferBeginInfo());
+        recycled[i].setLineWidth(1.0f);
+        recycled[i].end();
+        submit_buffers.push_back(*recycled[i]);
+    }
+    queue_.submit(vk::SubmitInfo({}, {}, submit_buffers, {}));
+    queue_.waitIdle();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    size_t num_recycled = 0;
+    for (const auto &cb : dump_file.devices[0].command_buffers) {
+        if (cb.handle.name.rfind("recycled_", 0) != 0) {
+            continue;
+        }
+        ++num_recycled;
+        ASSERT_EQ(cb.state, "COMPLETED") << cb.handle.name;
+        // Both markers were written past the begin value, the bottom one by
+        // vkEndCommandBuffer.
+        ASSERT_GT(cb.topCheckpointValue, cb.beginValue) << cb.handle.name;
+        ASSERT_EQ(cb.bottomCheckpointValue, cb.endValue) << cb.handle.name;
+    }
+    ASSERT_EQ(num_recycled, kRecycledBuffers);
+}
+
+// With a marker buffer reserve, marker buffers are created by a background
+// thread. Allocate and record enough command buffers to use up the reserve a
+// few times over. The reserve must keep up, so every command buffer gets a
+// checkpoint and is tracked to completion.
+TEST_F(Threading, MarkerBufferReserve) {
+    constexpr uint32_t kNumThreads = 4;
+    constexpr uint32_t kBuffersPerThread = 1024;
+
+    layer_settings_.marker_buffer_reserve = 2;
+    layer_settings_.SetDumpCommandBuffers("all");
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+
+    std::vector<vk::raii::CommandPool> pools;
+    std::vector<vk::raii::CommandBuffers> buffers;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        pools.emplace_back(device_, vk::CommandPoolCreateInfo({}, qfi_));
+        vk::CommandBufferAllocateInfo alloc_info(*pools.back(), vk::CommandBufferLevel::ePrimary, kBuffersPerThread);
+        buffers.emplace_back(device_, alloc_info);
+    }
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&cmd_buffs = buffers[t]]() {
+            for (auto &cb : cmd_buffs) {
+                cb.begin(vk::CommandBufferBeginInfo());
+                cb.setLineWidth(1.0f);
+                cb.end();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<vk::CommandBuffer> submit_buffers;
+    for (auto &cmd_buffs : buffers) {
+        for (auto &cb : cmd_buffs) {
+            submit_buffers.push_back(*cb);
+        }
+    }
+    vk::SubmitInfo submit_info({}, {}, submit_buffers, {});
+    queue_.submit(submit_info);
+    queue_.waitIdle();
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    // Command buffers without a checkpoint don't dump their marker values, so
+    // their endValue reads as 0. The hung command buffer is incomplete.
+    size_t num_tracked = 0;
+    for (const auto &cb : dump_file.devices[0].command_buffers) {
+        if (cb.state == "COMPLETED") {
+            ASSERT_NE(cb.endValue, 0u);
+            ASSERT_EQ(cb.bottomCheckpointValue, cb.endValue);
+            ++num_tracked;
+        }
+    }
+    ASSERT_EQ(num_tracked, kNumThreads * kBuffersPerThread);
+}
+
+// Name, rename and destroy buffers from several threads. Half of the names
+// are unique, the other half are shared, like the per-frame staging buffers
+// of a streaming engine. Names must follow renames and be dropped on destroy,
+// so the number of named objects must not grow with the objects ever named.
+TEST_F(Threading, ObjectNameChurn) {
+    constexpr uint32_t kNumThreads = 4;
+    constexpr uint32_t kObjectsPerThread = 1000;
+
+    InitInstance();
+    InitDevice();
+    // Names in_buffer, in_memory, out_buffer and out_memory.
+    InitCopyBuffers();
+    SetObjectName(device_, in_->buffer, "renamed_before_churn");
+    constexpr size_t kNamedObjects = 4;
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([this, t]() {
+            vk::BufferCreateInfo buffer_ci({}, 256, vk::BufferUsageFlagBits::eTransferSrc);
+            for (uint32_t i = 0; i < kObjectsPerThread; ++i) {
+                vk::raii::Buffer buffer(device_, buffer_ci);
+                std::string name = (i % 2) ? "staging" : "transient_" + std::to_string(t) + "_" + std::to_string(i);
+                SetObjectName(device_, buffer, name);
+                if (i % 3 == 0) {
+                    SetObjectName(device_, buffer, name + "_renamed");
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    SetObjectName(device_, in_->buffer, "renamed_after_churn");
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    ASSERT_NO_FATAL_FAILURE(SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {})));
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    const auto &device = dump_file.devices[0];
+    // None of the destroyed buffers keep a name.
+    ASSERT_EQ(device.namedObjects, kNamedObjects);
+
+    ASSERT_EQ(device.command_buffers.size(), 1);
+    bool found_copy = false;
+    for (const auto &cmd : device.command_buffers[0].commands) {
+        if (cmd.name == "vkCmdCopyBuffer") {
+            found_copy = true;
+            ASSERT_EQ(cmd.parameters.count("srcBuffer"), 1);
+            ASSERT_NE(cmd.parameters.at("srcBuffer").find("[renamed_after_churn]"), std::string::npos);
+            ASSERT_NE(cmd.parameters.at("dstBuffer").find("[out_buffer]"), std::string::npos);
+        }
+    }
+    ASSERT_TRUE(found_copy);
+}
+
+// Write a hang dump while another thread keeps naming and destroying objects.
+// The dump resolves names against a snapshot taken when it starts, so objects
+// named before the hang must keep their names in it.
+TEST_F(Threading, DumpWhileNaming) {
+    InitInstance();
+    InitDevice();
+    InitCopyBuffers();
+    SetObjectName(device_, cmd_buff_, "hung_cmd_buff");
+
+    std::atomic<bool> done{false};
+    std::thread namer([this, &done]() {
+        vk::BufferCreateInfo buffer_ci({}, 256, vk::BufferUsageFlagBits::eTransferSrc);
+        for (uint32_t i = 0; !done; ++i) {
+            vk::raii::Buffer buffer(device_, buffer_ci);
+            SetObjectName(device_, buffer, "churn_" + std::to_string(i));
+        }
+    });
+
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    RecordHungCopy(cmd_buff_);
+    cmd_buff_.end();
+
+    // Stop the namer before bailing out if the hang wasn't detected.
+    SubmitHang(vk::SubmitInfo({}, {}, *cmd_buff_, {}));
+    done = true;
+    namer.join();
+    ASSERT_FALSE(HasFatalFailure());
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers.size(), 1);
+    ASSERT_EQ(dump_file.devices[0].command_buffers[0].handle.name, "hung_cmd_buff");
+}
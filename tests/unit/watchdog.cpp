@@ -20,8 +20,11 @@
 #include "dump_file.h"
 #include "shaders.h"
 
+#include <chrono>
 #include <filesystem>
+#include <string>
 #include <thread>
+#include <vector>
 
 class Watchdog : public CDLTestBase {};
 
@@ -62,3 +65,94 @@ TEST_F(Watchdog, Timeout) {
 
     queue_.waitIdle();
 }
+
+// A queue that stops making progress must be caught even while the
+// application keeps submitting work elsewhere.
+TEST_F(Watchdog, StalledQueueOtherDeviceBusy) {
+    layer_settings_.watchdog_timeout_ms = kWatchdogTimeout;
+    InitInstance();
+    InitDevice();
+
+    float priority = 0.0f;
+    vk::DeviceQueueCreateInfo queue_ci({}, qfi_, 1, &priority);
+    vk::raii::Device busy_device(physical_device_, vk::DeviceCreateInfo({}, queue_ci, {}, {}, nullptr, nullptr));
+    vk::raii::Queue busy_queue(busy_device, qfi_, 0);
+    vk::raii::CommandPool busy_pool(busy_device, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers busy_cbs(busy_device,
+                                      vk::CommandBufferAllocateInfo(*busy_pool, vk::CommandBufferLevel::ePrimary, 1));
+    busy_cbs[0].begin(vk::CommandBufferBeginInfo());
+    busy_cbs[0].end();
+
+    vk::SemaphoreTypeCreateInfo sem_type_ci(vk::SemaphoreType::eTimeline, 0);
+    vk::raii::Semaphore never_signalled(device_, vk::SemaphoreCreateInfo({}, &sem_type_ci));
+
+    uint64_t wait_value = 1;
+    vk::PipelineStageFlags wait_mask = vk::PipelineStageFlagBits::eBottomOfPipe;
+    vk::TimelineSemaphoreSubmitInfo timeline_info(1, &wait_value);
+    cmd_buff_.begin(vk::CommandBufferBeginInfo());
+    cmd_buff_.end();
+
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    queue_.submit(vk::SubmitInfo(*never_signalled, wait_mask, *cmd_buff_, {}, &timeline_info));
+
+    auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(kWatchdogTimeout * 2);
+    while (std::chrono::steady_clock::now() < end) {
+        busy_queue.submit(vk::SubmitInfo({}, {}, *busy_cbs[0], {}));
+        busy_queue.waitIdle();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    monitor_.VerifyFound();
+
+    device_.signalSemaphore(vk::SemaphoreSignalInfo(*never_signalled, wait_value));
+    queue_.waitIdle();
+}
+
+// Command buffers are formatted in parallel, the dump must still list them
+// in submission order.
+TEST_F(Watchdog, CommandBufferOrder) {
+    constexpr uint32_t kNumBuffers = 16;
+
+    layer_settings_.watchdog_timeout_ms = kWatchdogTimeout;
+    layer_settings_.SetDumpCommandBuffers("all");
+    InitInstance();
+    InitDevice();
+
+    vk::raii::CommandPool pool(device_, vk::CommandPoolCreateInfo({}, qfi_));
+    vk::raii::CommandBuffers cmd_buffs(
+        device_, vk::CommandBufferAllocateInfo(*pool, vk::CommandBufferLevel::ePrimary, kNumBuffers));
+
+    vk::SemaphoreTypeCreateInfo sem_type_ci(vk::SemaphoreType::eTimeline, 0);
+    vk::raii::Semaphore never_signalled(device_, vk::SemaphoreCreateInfo({}, &sem_type_ci));
+    uint64_t wait_value = 1;
+    vk::PipelineStageFlags wait_mask = vk::PipelineStageFlagBits::eBottomOfPipe;
+    vk::TimelineSemaphoreSubmitInfo timeline_info(1, &wait_value);
+
+    monitor_.SetDesiredError("Device error encountered and log being recorded");
+    for (uint32_t i = 0; i < kNumBuffers; ++i) {
+        auto &cb = cmd_buffs[i];
+        SetObjectName(device_, cb, "cmd_buff_" + std::to_string(i));
+        cb.begin(vk::CommandBufferBeginInfo());
+        cb.end();
+        queue_.submit(vk::SubmitInfo(*never_signalled, wait_mask, *cb, {}, &timeline_info));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(kWatchdogTimeout * 2));
+    monitor_.VerifyFound();
+
+    device_.signalSemaphore(vk::SemaphoreSignalInfo(*never_signalled, wait_value));
+    queue_.waitIdle();
+
+    dump::File dump_file;
+    dump::Parse(dump_file, output_path_);
+    ASSERT_EQ(dump_file.devices.size(), 1);
+    // The fixture's own command buffer is dumped too.
+    std::vector<std::string> names;
+    for (const auto &dumped_cb : dump_file.devices[0].command_buffers) {
+        if (dumped_cb.handle.name.rfind("cmd_buff_", 0) == 0) {
+            names.push_back(dumped_cb.handle.name);
+        }
+    }
+    ASSERT_EQ(names.size(), kNumBuffers);
+    for (uint32_t i = 0; i < kNumBuffers; ++i) {
+        ASSERT_EQ(names[i], "cmd_buff_" + std::to_string(i));
+    }
+}